@@ -0,0 +1,456 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/satellite-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-kernel-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief  Microbenchmarks of the computational kernels of the satellite
+ *         module. Each kernel is run in isolation with synthetic input and
+ *         the time and the number of heap allocations per operation are
+ *         reported, one kernel per line, in CSV format:
+ *
+ *         kernel,iterations,ns_per_op,allocs_per_op
+ *
+ *         To see help for user arguments, execute the command
+ *
+ *         ./waf --run "sat-kernel-benchmark --PrintHelp"
+ *
+ *         The results are meant for comparing builds and changes on the same
+ *         machine, so the benchmark should be run with an optimized build.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-kernel-benchmark");
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Runner of the kernel microbenchmarks.
+ */
+class SatKernelBenchmark : public SimpleRefCount<SatKernelBenchmark>
+{
+public:
+  /**
+   * \brief Constructor
+   * \param iterations number of operations measured per kernel
+   * \param kernel name of the kernel to run, empty runs all kernels
+   */
+  SatKernelBenchmark (uint32_t iterations, std::string kernel);
+
+  /**
+   * \brief Run the selected kernels and write the results.
+   * \param os output stream of the results
+   */
+  void Run (std::ostream &os);
+
+private:
+  /// Kernel run once per operation.
+  typedef Callback<void> Kernel_t;
+
+  /**
+   * \brief Measure a kernel and write one result line.
+   * \param os output stream of the results
+   * \param name name of the kernel
+   * \param kernel the kernel
+   */
+  void Measure (std::ostream &os, std::string name, Kernel_t kernel);
+
+  /// \brief DVB-S2 and DVB-RCS2 BLER look up.
+  void RunLookUpTable ();
+
+  /// \brief Per packet interference add and calculate of one reception.
+  void RunPerPacketInterference ();
+
+  /// \brief One scheduling round of the forward link scheduler.
+  void RunFwdLinkScheduler ();
+
+  /// \brief Allocation and time slot generation of one return link frame.
+  void RunFrameAllocator ();
+
+  /// \brief Antenna gain pattern look up.
+  void RunAntennaGainPattern ();
+
+  /// \brief Rayleigh fading oscillators.
+  void RunFadingOscillators ();
+
+  /**
+   * \brief Forward link scheduler callback giving the scheduling objects.
+   * \param output the scheduling objects
+   */
+  void GetSchedulingObjects (std::vector< Ptr<SatSchedulingObject> > &output);
+
+  /**
+   * \brief Forward link scheduler callback giving the packets of an
+   *        infinite backlog.
+   * \param bytes tx opportunity in bytes
+   * \param address address of the UT
+   * \param flowId flow identifier
+   * \param bytesLeft bytes left in the backlog
+   * \param nextMinTxO minimum next tx opportunity
+   * \return the packet
+   */
+  Ptr<Packet> NotifyTxOpportunity (uint32_t bytes, Mac48Address address, uint8_t flowId,
+                                   uint32_t &bytesLeft, uint32_t &nextMinTxO);
+
+  uint32_t m_iterations;
+  std::string m_kernel;
+  uint32_t m_index;
+
+  // sum of the kernel results, printed so that the kernels are not optimized away
+  double m_sink;
+
+  // look up table kernel
+  Ptr<SatLinkResultsDvbS2> m_linkResultsDvbS2;
+  Ptr<SatLinkResultsDvbRcs2> m_linkResultsDvbRcs2;
+  std::vector<double> m_esNoDb;
+
+  // interference kernel
+  Ptr<SatPerPacketInterference> m_interference;
+  std::vector<Address> m_addresses;
+
+  // forward link scheduler kernel
+  Ptr<SatFwdLinkScheduler> m_fwdScheduler;
+  std::vector<Mac48Address> m_utAddresses;
+
+  // frame allocator kernel
+  Ptr<SatWaveformConf> m_waveformConf;
+  Ptr<SatFrameConf> m_frameConf;
+  Ptr<SatFrameAllocator> m_frameAllocator;
+  std::vector<SatFrameAllocator::SatFrameAllocReq> m_allocReqs;
+
+  // antenna gain pattern kernel
+  Ptr<SatAntennaGainPattern> m_antennaGainPattern;
+  std::vector<GeoCoordinate> m_positions;
+
+  // fading oscillator kernel
+  Ptr<SatRayleighModel> m_rayleighModel;
+};
+
+
+SatKernelBenchmark::SatKernelBenchmark (uint32_t iterations, std::string kernel)
+  : m_iterations (iterations),
+    m_kernel (kernel),
+    m_index (0),
+    m_sink (0.0)
+{
+  static const std::string kernels[] = { "look-up-table", "per-packet-interference", "fwd-link-scheduler",
+                                         "frame-allocator", "antenna-gain-pattern", "fading-oscillators" };
+  const std::string *kernelsEnd = kernels + sizeof (kernels) / sizeof (kernels[0]);
+
+  if (!m_kernel.empty () && std::find (kernels, kernelsEnd, m_kernel) == kernelsEnd)
+    {
+      NS_FATAL_ERROR ("Unknown kernel " << m_kernel);
+    }
+}
+
+
+void
+SatKernelBenchmark::Run (std::ostream &os)
+{
+  os << "kernel,iterations,ns_per_op,allocs_per_op" << std::endl;
+
+  // inputs are created outside of the measured loops
+  if (m_kernel.empty () || m_kernel == "look-up-table")
+    {
+      m_linkResultsDvbS2 = CreateObject<SatLinkResultsDvbS2> ();
+      m_linkResultsDvbS2->Initialize ();
+      m_linkResultsDvbRcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+      m_linkResultsDvbRcs2->Initialize ();
+
+      Ptr<UniformRandomVariable> esNo = CreateObject<UniformRandomVariable> ();
+      for (uint32_t i = 0; i < 1024; i++)
+        {
+          m_esNoDb.push_back (esNo->GetValue (-3.0, 12.0));
+        }
+
+      Measure (os, "look-up-table", MakeCallback (&SatKernelBenchmark::RunLookUpTable, this));
+    }
+
+  if (m_kernel.empty () || m_kernel == "per-packet-interference")
+    {
+      m_interference = CreateObject<SatPerPacketInterference> (SatEnums::RETURN_USER_CH, 1.25e6);
+
+      for (uint32_t i = 0; i < 51; i++)
+        {
+          m_addresses.push_back (Mac48Address::Allocate ());
+        }
+
+      Measure (os, "per-packet-interference", MakeCallback (&SatKernelBenchmark::RunPerPacketInterference, this));
+    }
+
+  if (m_kernel.empty () || m_kernel == "fwd-link-scheduler")
+    {
+      Ptr<SatLinkResultsDvbS2> linkResults = CreateObject<SatLinkResultsDvbS2> ();
+      linkResults->Initialize ();
+
+      Ptr<SatBbFrameConf> bbFrameConf = CreateObject<SatBbFrameConf> (400e6);
+      bbFrameConf->InitializeCNoRequirements (linkResults);
+
+      m_fwdScheduler = CreateObject<SatFwdLinkScheduler> (bbFrameConf, Mac48Address::Allocate (), 500e6);
+      m_fwdScheduler->SetSchedContextCallback (MakeCallback (&SatKernelBenchmark::GetSchedulingObjects, this));
+      m_fwdScheduler->SetTxOpportunityCallback (MakeCallback (&SatKernelBenchmark::NotifyTxOpportunity, this));
+
+      Ptr<UniformRandomVariable> cno = CreateObject<UniformRandomVariable> ();
+      for (uint32_t i = 0; i < 50; i++)
+        {
+          m_utAddresses.push_back (Mac48Address::Allocate ());
+          m_fwdScheduler->CnoInfoUpdated (m_utAddresses.back (), SatUtils::DbToLinear (cno->GetValue (80.0, 95.0)));
+        }
+
+      Measure (os, "fwd-link-scheduler", MakeCallback (&SatKernelBenchmark::RunFwdLinkScheduler, this));
+    }
+
+  if (m_kernel.empty () || m_kernel == "frame-allocator")
+    {
+      std::string dataPath = Singleton<SatEnvVariables>::Get ()->GetDataPath ();
+      m_waveformConf = CreateObject<SatWaveformConf> (dataPath + "/dvbRcs2Waveforms.txt");
+
+      Ptr<SatBtuConf> btu = Create<SatBtuConf> (10e4, 0.4, 0.1);
+      m_frameConf = Create<SatFrameConf> (10e4 * 16, MilliSeconds (125), btu, m_waveformConf, false, false, true);
+      m_frameAllocator = Create<SatFrameAllocator> (m_frameConf, 0, SatSuperframeConf::CONFIG_TYPE_0);
+
+      Ptr<UniformRandomVariable> cno = CreateObject<UniformRandomVariable> ();
+      uint32_t carrierBytes = m_frameConf->GetCarrierMinPayloadInBytes ();
+
+      for (uint32_t i = 0; i < 20; i++)
+        {
+          SatFrameAllocator::SatFrameAllocReq req (SatFrameAllocator::SatFrameAllocReqItemContainer_t (1, SatFrameAllocator::SatFrameAllocReqItem ()));
+          req.m_address = Mac48Address::Allocate ();
+          req.m_cno = SatUtils::DbToLinear (cno->GetValue (60.0, 80.0));
+          req.m_generateCtrlSlot = (i % 4 == 0);
+          req.m_reqPerRc[0].m_minRbdcBytes = carrierBytes / 4;
+          req.m_reqPerRc[0].m_rbdcBytes = carrierBytes / 2;
+          req.m_reqPerRc[0].m_vbdcBytes = carrierBytes;
+          m_allocReqs.push_back (req);
+        }
+
+      Measure (os, "frame-allocator", MakeCallback (&SatKernelBenchmark::RunFrameAllocator, this));
+    }
+
+  if (m_kernel.empty () || m_kernel == "antenna-gain-pattern")
+    {
+      Ptr<SatAntennaGainPatternContainer> patterns = CreateObject<SatAntennaGainPatternContainer> ();
+      m_antennaGainPattern = patterns->GetAntennaGainPattern (1);
+
+      for (uint32_t i = 0; i < 1024; i++)
+        {
+          m_positions.push_back (m_antennaGainPattern->GetValidRandomPosition ());
+        }
+
+      Measure (os, "antenna-gain-pattern", MakeCallback (&SatKernelBenchmark::RunAntennaGainPattern, this));
+    }
+
+  if (m_kernel.empty () || m_kernel == "fading-oscillators")
+    {
+      m_rayleighModel = CreateObject<SatRayleighModel> (CreateObject<SatRayleighConf> (), 0, 0);
+
+      Measure (os, "fading-oscillators", MakeCallback (&SatKernelBenchmark::RunFadingOscillators, this));
+    }
+
+  NS_LOG_INFO ("Sum of kernel results " << m_sink);
+}
+
+
+void
+SatKernelBenchmark::Measure (std::ostream &os, std::string name, Kernel_t kernel)
+{
+  NS_LOG_FUNCTION (this << name);
+
+  // warm up caches and lazily created state
+  for (uint32_t i = 0; i < std::min<uint32_t> (m_iterations, 100); i++)
+    {
+      kernel ();
+    }
+
+  m_index = 0;
+  uint64_t allocations = SatAccountingSimulatorImpl::GetAllocationCount ();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+
+  for (uint32_t i = 0; i < m_iterations; i++)
+    {
+      kernel ();
+    }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+  allocations = SatAccountingSimulatorImpl::GetAllocationCount () - allocations;
+
+  double ns = std::chrono::duration_cast<std::chrono::nanoseconds> (end - start).count ();
+
+  os << name << "," << m_iterations
+     << "," << ns / m_iterations
+     << "," << (double) allocations / m_iterations << std::endl;
+}
+
+
+void
+SatKernelBenchmark::RunLookUpTable ()
+{
+  double esNoDb = m_esNoDb[m_index++ % m_esNoDb.size ()];
+
+  m_sink += m_linkResultsDvbS2->GetBler (SatEnums::SAT_MODCOD_8PSK_3_TO_5, SatEnums::NORMAL_FRAME, esNoDb);
+  m_sink += m_linkResultsDvbRcs2->GetBler (3, esNoDb);
+}
+
+
+void
+SatKernelBenchmark::RunPerPacketInterference ()
+{
+  // 50 overlapping interferers and the received packet
+  for (uint32_t i = 0; i < 50; i++)
+    {
+      m_interference->Add (MicroSeconds (500 + 10 * i), 1e-14 * (i + 1), m_addresses[i]);
+    }
+
+  Ptr<SatInterference::InterferenceChangeEvent> event = m_interference->Add (MicroSeconds (600), 1e-12, m_addresses[50]);
+
+  m_interference->NotifyRxStart (event);
+  m_sink += m_interference->Calculate (event);
+  m_interference->NotifyRxEnd (event);
+  m_interference->Reset ();
+}
+
+
+void
+SatKernelBenchmark::RunFwdLinkScheduler ()
+{
+  m_sink += m_fwdScheduler->GetNextFrame ()->GetSpaceUsedInBytes ();
+}
+
+
+void
+SatKernelBenchmark::RunFrameAllocator ()
+{
+  m_frameAllocator->Reset ();
+
+  for (std::vector<SatFrameAllocator::SatFrameAllocReq>::iterator it = m_allocReqs.begin ();
+       it != m_allocReqs.end (); ++it)
+    {
+      uint32_t waveformId = m_waveformConf->GetDefaultWaveformId ();
+      m_frameAllocator->GetBestWaveform (it->m_cno, waveformId);
+      m_frameAllocator->Allocate (SatFrameAllocator::CC_LEVEL_CRA_RBDC_VBDC, &(*it), waveformId);
+    }
+
+  m_frameAllocator->PreAllocateSymbols (0.9, false);
+
+  SatFrameAllocator::TbtpMsgContainer_t tbtpContainer;
+  tbtpContainer.push_back (CreateObject<SatTbtpMessage> ());
+  SatFrameAllocator::UtAllocInfoContainer_t utAllocContainer;
+
+  m_frameAllocator->GenerateTimeSlots (tbtpContainer, 1000, utAllocContainer, false,
+                                       TracedCallback<uint32_t> (),
+                                       TracedCallback<uint32_t, uint32_t> (),
+                                       TracedCallback<uint32_t, double> ());
+}
+
+
+void
+SatKernelBenchmark::RunAntennaGainPattern ()
+{
+  m_sink += m_antennaGainPattern->GetAntennaGain_lin (m_positions[m_index++ % m_positions.size ()]);
+}
+
+
+void
+SatKernelBenchmark::RunFadingOscillators ()
+{
+  m_sink += m_rayleighModel->GetChannelGainDb ();
+}
+
+
+void
+SatKernelBenchmark::GetSchedulingObjects (std::vector< Ptr<SatSchedulingObject> > &output)
+{
+  for (uint32_t i = 0; i < m_utAddresses.size (); i++)
+    {
+      output.push_back (Create<SatSchedulingObject> (m_utAddresses[i], 100000, 1, Seconds (0), 1));
+    }
+}
+
+
+Ptr<Packet>
+SatKernelBenchmark::NotifyTxOpportunity (uint32_t bytes, Mac48Address address, uint8_t flowId,
+                                         uint32_t &bytesLeft, uint32_t &nextMinTxO)
+{
+  uint32_t packetBytes = std::min<uint32_t> (bytes, 1500);
+  bytesLeft = (bytesLeft > packetBytes) ? bytesLeft - packetBytes : 0;
+  nextMinTxO = 1;
+
+  return Create<Packet> (packetBytes);
+}
+
+
+} // namespace ns3
+
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t iterations = 10000;
+  std::string kernel = "";
+  std::string outputFileName = "";
+
+  /// Read command line parameters given by user
+  CommandLine cmd;
+  cmd.AddValue ("iterations", "Number of measured operations per kernel", iterations);
+  cmd.AddValue ("kernel", "Kernel to run (look-up-table, per-packet-interference, fwd-link-scheduler, "
+                "frame-allocator, antenna-gain-pattern, fading-oscillators), all if not given", kernel);
+  cmd.AddValue ("output", "CSV output file, standard output if not given", outputFileName);
+  cmd.Parse (argc, argv);
+
+  if (iterations == 0)
+    {
+      NS_FATAL_ERROR ("Number of iterations must be positive");
+    }
+
+  Singleton<SatEnvVariables>::Get ()->Initialize ();
+
+  Ptr<SatKernelBenchmark> benchmark = Create<SatKernelBenchmark> (iterations, kernel);
+
+  if (outputFileName.empty ())
+    {
+      benchmark->Run (std::cout);
+    }
+  else
+    {
+      std::ofstream ofs (outputFileName.c_str ());
+
+      if (!ofs.is_open ())
+        {
+          NS_FATAL_ERROR ("Unable to open output file " << outputFileName);
+        }
+
+      benchmark->Run (ofs);
+    }
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -60,7 +60,7 @@ static void LinkBudgetTraceCb ( std::string context, Ptr<SatSignalParameters> pa
                                       << params->m_channelType << " "
                                       << ownAdd << " "
                                       << destAdd << " "
-                                      << params->m_beamId << " "
+                                      << params->m_burst->m_beamId << " "
                                       << params->m_carrierFreq_hz << " "
                                       << SatUtils::WToDbW (ifPower) << " "
                                       << SatUtils::WToDbW ( params->m_rxPower_W ) << " "
@@ -119,13 +119,13 @@ main (int argc, char *argv[])
   Ptr<SatHelper> helper = simulationHelper->CreateSatScenario ();
 
   // set callback traces where we want results out
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
   // Set UT position
   NodeContainer ut = helper->UtNodes ();
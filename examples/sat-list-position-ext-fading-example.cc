@@ -65,7 +65,7 @@ static void LinkBudgetTraceCb ( std::string context, Ptr<SatSignalParameters> pa
                                       << params->m_channelType << " "
                                       << ownAdd << " "
                                       << destAdd << " "
-                                      << params->m_beamId << " "
+                                      << params->m_burst->m_beamId << " "
                                       << SatUtils::LinearToDb (params->m_sinr) << " "
                                       << SatUtils::LinearToDb (cSinr) );
     }
@@ -121,13 +121,13 @@ main (int argc, char *argv[])
   Ptr<SatHelper> helper = simulationHelper->CreateSatScenario ();
 
   // set callback traces where we want results out
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
   // Install CBR traffic model
@@ -33,7 +33,11 @@ using namespace ns3;
  * \file sat-profiling-sim.cc
  * \ingroup satellite
  *
- * \brief
+ * \brief  Scenario for profiling the satellite module. The events and the
+ *         heap allocations are accounted per subsystem and reported with the
+ *         progress logs; the program is linked with the counting operator
+ *         new for that, see utils/satellite-allocation-counter.cc.
+ *
  *         To see help for user arguments:
  *         execute command -> ./waf --run "sat-profiling-sim --PrintHelp"
  *
@@ -53,6 +57,9 @@ main (int argc, char *argv[])
 
   Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("sat-profiling-sim");
 
+  // Must be enabled before anything is scheduled
+  simulationHelper->EnableEventAccounting ();
+
   simulationHelper->SetDefaultValues ();
   simulationHelper->SetUtCountPerBeam (utsPerBeam);
   simulationHelper->SetUserCountPerUt (endUsersPerUt);
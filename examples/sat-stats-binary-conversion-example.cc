@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/satellite-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-stats-binary-conversion-example.cc
+ * \ingroup satellite
+ *
+ * \brief  Converts a binary statistics file written by SatBinaryFileAggregator
+ *         (statistics helpers with `BinaryOutputEnabled` attribute set) to
+ *         text files and optionally to a Gnuplot script. To see help for
+ *         user arguments, execute the command
+ *
+ *         ./waf --run "sat-stats-binary-conversion-example --PrintHelp"
+ *
+ *         When the output name is not given, the outputs are written next to
+ *         the input file, using the input file name without the binary file
+ *         suffix, i.e. with the same names the text aggregator would use.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-stats-binary-conversion-example");
+
+int
+main (int argc, char *argv[])
+{
+  std::string inputFileName;
+  std::string outputFileName;
+  bool multiFileMode = true;
+  bool contextPrinting = false;
+  bool useStoredMode = true;
+  bool gnuplot = false;
+  std::string xLegend = "Time (in seconds)";
+  std::string yLegend = "";
+
+  /// Read command line parameters given by user
+  CommandLine cmd;
+  cmd.AddValue ("input", "Binary statistics file", inputFileName);
+  cmd.AddValue ("output", "Output file name without extension", outputFileName);
+  cmd.AddValue ("useStoredMode", "Use the text output mode stored in the binary file", useStoredMode);
+  cmd.AddValue ("multiFile", "Write one text file per context (if useStoredMode is false)", multiFileMode);
+  cmd.AddValue ("contextPrinting", "Print the context on every line (if useStoredMode is false)", contextPrinting);
+  cmd.AddValue ("gnuplot", "Write also a Gnuplot script", gnuplot);
+  cmd.AddValue ("xLegend", "Legend of the x axis of the Gnuplot output", xLegend);
+  cmd.AddValue ("yLegend", "Legend of the y axis of the Gnuplot output", yLegend);
+  cmd.Parse (argc, argv);
+
+  if (inputFileName.empty ())
+    {
+      NS_FATAL_ERROR ("Input file not given");
+    }
+
+  if (outputFileName.empty ())
+    {
+      const std::string suffix = SatBinaryFileAggregator::BINARY_FILE_SUFFIX;
+      outputFileName = inputFileName;
+
+      if ((outputFileName.size () > suffix.size ())
+          && (outputFileName.compare (outputFileName.size () - suffix.size (),
+                                      suffix.size (), suffix) == 0))
+        {
+          outputFileName.erase (outputFileName.size () - suffix.size ());
+        }
+    }
+
+  Ptr<SatBinaryFileConverter> converter = Create<SatBinaryFileConverter> (inputFileName);
+
+  if (useStoredMode)
+    {
+      converter->WriteTextFiles (outputFileName);
+    }
+  else
+    {
+      converter->WriteTextFiles (outputFileName, multiFileMode, contextPrinting);
+    }
+
+  if (gnuplot)
+    {
+      converter->WriteGnuplotFile (outputFileName, xLegend, yLegend);
+    }
+
+  std::cout << "Converted " << converter->GetNumOfContexts () << " contexts of "
+            << inputFileName << " to " << outputFileName << std::endl;
+
+  return 0;
+}
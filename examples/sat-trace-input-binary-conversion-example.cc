@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/satellite-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-trace-input-binary-conversion-example.cc
+ * \ingroup satellite
+ *
+ * \brief  Converts a text format input trace file (e.g. interference or
+ *         rx power density trace) to the binary format read by
+ *         SatInputFileStreamTimeDoubleContainer. To see help for user
+ *         arguments, execute the command
+ *
+ *         ./waf --run "sat-trace-input-binary-conversion-example --PrintHelp"
+ *
+ *         When the output file name is not given, the binary file is written
+ *         next to the input file with the suffix, which makes the containers
+ *         prefer it over the text file.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-trace-input-binary-conversion-example");
+
+int
+main (int argc, char *argv[])
+{
+  std::string inputFileName;
+  std::string outputFileName;
+  uint32_t valuesInRow = SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS;
+
+  /// Read command line parameters given by user
+  CommandLine cmd;
+  cmd.AddValue ("input", "Text format input trace file", inputFileName);
+  cmd.AddValue ("output", "Binary format output trace file", outputFileName);
+  cmd.AddValue ("columns", "Number of values in a row", valuesInRow);
+  cmd.Parse (argc, argv);
+
+  if (inputFileName.empty ())
+    {
+      NS_FATAL_ERROR ("Input file not given");
+    }
+
+  if (outputFileName.empty ())
+    {
+      outputFileName = inputFileName + SatInputFileStreamTimeDoubleContainer::BINARY_FILE_SUFFIX;
+    }
+
+  SatInputFileStreamTimeDoubleContainer::ConvertToBinary (inputFileName, outputFileName, valuesInRow);
+
+  std::cout << "Converted " << inputFileName << " to " << outputFileName << std::endl;
+
+  return 0;
+}
@@ -23,8 +23,10 @@
 #include "ns3/ipv4-static-routing-helper.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-interface.h"
+#include "ns3/ipv4.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/enum.h"
+#include "ns3/uinteger.h"
 #include "ns3/pointer.h"
 #include "ns3/config.h"
 #include "../model/satellite-const-variables.h"
@@ -33,7 +35,13 @@
 #include "../model/satellite-phy-tx.h"
 #include "../model/satellite-phy-rx.h"
 #include "../model/satellite-arp-cache.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-signalling-channel.h"
+#include "../model/satellite-gw-mac.h"
+#include "../model/satellite-fwd-link-scheduler.h"
+#include "../model/satellite-beam-interference-matrix.h"
 #include "../model/satellite-mobility-model.h"
+#include "../model/satellite-constant-position-mobility-model.h"
 #include "../model/satellite-propagation-delay-model.h"
 #include "../model/satellite-antenna-gain-pattern-container.h"
 #include "../model/satellite-packet-trace.h"
@@ -109,6 +117,12 @@ SatBeamHelper::GetTypeId (void)
                    TimeValue (Seconds (0.13)),
                    MakeTimeAccessor (&SatBeamHelper::m_constantPropagationDelay),
                    MakeTimeChecker ())
+    .AddAttribute ("RoutingMode",
+                   "Routing mode used between GWs and UTs",
+                   EnumValue (SatBeamHelper::ROUTING_UT_NETWORK_ROUTES),
+                   MakeEnumAccessor (&SatBeamHelper::m_routingMode),
+                   MakeEnumChecker (SatBeamHelper::ROUTING_UT_NETWORK_ROUTES, "UtNetworkRoutes",
+                                    SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES, "BeamPrefixRoutes"))
     .AddAttribute ("PrintDetailedInformationToCreationTraces",
                    "Print detailed information to creation traces",
                    BooleanValue (true),
@@ -122,6 +136,24 @@ SatBeamHelper::GetTypeId (void)
                    TimeValue (MilliSeconds (1000)),
                    MakeTimeAccessor (&SatBeamHelper::m_ctrlMsgStoreTimeRtnLink),
                    MakeTimeChecker ())
+    .AddAttribute ("CtrlMsgRingCapacity",
+                   "Initial capacity of the ring based control message containers. "
+                   "Value 0 uses the map based SatControlMsgContainer instead.",
+                   UintegerValue (1024),
+                   MakeUintegerAccessor (&SatBeamHelper::m_ctrlMsgRingCapacity),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("AbstractSignalling",
+                   "Deliver capacity requests, C/N0 reports, RA control messages and TBTPs "
+                   "through a direct signalling path instead of the LLC, MAC and PHY.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatBeamHelper::m_abstractSignalling),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BackgroundLoadEnabled",
+                   "Create a flow level background load (ns3::SatBackgroundLoad) for both "
+                   "link directions of every beam, served by the schedulers of the beam.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatBeamHelper::m_backgroundLoadEnabled),
+                   MakeBooleanChecker ())
     .AddTraceSource ("Creation", "Creation traces",
                      MakeTraceSourceAccessor (&SatBeamHelper::m_creationTrace),
                      "ns3::SatTypedefs::CreationCallback")
@@ -138,14 +170,18 @@ SatBeamHelper::GetInstanceTypeId (void) const
 }
 
 SatBeamHelper::SatBeamHelper ()
-  : m_printDetailedInformationToCreationTraces (false),
+  : m_routingMode (SatBeamHelper::ROUTING_UT_NETWORK_ROUTES),
+    m_printDetailedInformationToCreationTraces (false),
     m_fadingModel (),
     m_propagationDelayModel (SatEnums::PD_CONSTANT_SPEED),
     m_constantPropagationDelay (Seconds (0.13)),
     m_randomAccessModel (SatEnums::RA_MODEL_OFF),
     m_raInterferenceModel (SatPhyRxCarrierConf::IF_CONSTANT),
     m_raCollisionModel (SatPhyRxCarrierConf::RA_COLLISION_NOT_DEFINED),
-    m_raConstantErrorRate (0.0)
+    m_raConstantErrorRate (0.0),
+    m_abstractSignalling (false),
+    m_ctrlMsgRingCapacity (1024),
+    m_backgroundLoadEnabled (false)
 {
   NS_LOG_FUNCTION (this);
 
@@ -160,6 +196,7 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
                               Ptr<SatSuperframeSeq> seq)
   : m_carrierBandwidthConverter (bandwidthConverterCb),
     m_superframeSeq (seq),
+    m_routingMode (SatBeamHelper::ROUTING_UT_NETWORK_ROUTES),
     m_printDetailedInformationToCreationTraces (false),
     m_fadingModel (SatEnums::FADING_MARKOV),
     m_propagationDelayModel (SatEnums::PD_CONSTANT_SPEED),
@@ -167,7 +204,10 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
     m_randomAccessModel (SatEnums::RA_MODEL_OFF),
     m_raInterferenceModel (SatPhyRxCarrierConf::IF_CONSTANT),
     m_raCollisionModel (SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR),
-    m_raConstantErrorRate (0.0)
+    m_raConstantErrorRate (0.0),
+    m_abstractSignalling (false),
+    m_ctrlMsgRingCapacity (1024),
+    m_backgroundLoadEnabled (false)
 {
   NS_LOG_FUNCTION (this << geoNode << rtnLinkCarrierCount << fwdLinkCarrierCount << seq);
 
@@ -177,17 +217,45 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
 
   m_channelFactory.SetTypeId ("ns3::SatChannel");
 
+  // the matrix is shared by the scenarios of the simulation run, so the beams
+  // and the receivers of a previous scenario are removed
+  Singleton<SatBeamInterferenceMatrix>::Get ()->Reset ();
+
   // create link specific control message containers
-  Ptr<SatControlMsgContainer> rtnCtrlMsgContainer = Create <SatControlMsgContainer> (m_ctrlMsgStoreTimeRtnLink, true);
-  Ptr<SatControlMsgContainer> fwdCtrlMsgContainer = Create <SatControlMsgContainer> (m_ctrlMsgStoreTimeFwdLink, false);
+  SatMac::ReadCtrlMsgCallback rtnReadCtrlCb;
+  SatMac::ReserveCtrlMsgCallback rtnReserveCtrlCb;
+  SatMac::SendCtrlMsgCallback rtnSendCtrlCb;
 
-  SatMac::ReadCtrlMsgCallback rtnReadCtrlCb = MakeCallback (&SatControlMsgContainer::Read, rtnCtrlMsgContainer);
-  SatMac::ReserveCtrlMsgCallback rtnReserveCtrlCb = MakeCallback (&SatControlMsgContainer::ReserveIdAndStore, rtnCtrlMsgContainer);
-  SatMac::SendCtrlMsgCallback rtnSendCtrlCb = MakeCallback (&SatControlMsgContainer::Send, rtnCtrlMsgContainer);
+  SatMac::ReadCtrlMsgCallback fwdReadCtrlCb;
+  SatMac::ReserveCtrlMsgCallback fwdReserveCtrlCb;
+  SatMac::SendCtrlMsgCallback fwdSendCtrlCb;
 
-  SatMac::ReadCtrlMsgCallback fwdReadCtrlCb = MakeCallback (&SatControlMsgContainer::Read, fwdCtrlMsgContainer);
-  SatMac::ReserveCtrlMsgCallback fwdReserveCtrlCb = MakeCallback (&SatControlMsgContainer::ReserveIdAndStore, fwdCtrlMsgContainer);
-  SatMac::SendCtrlMsgCallback fwdSendCtrlCb = MakeCallback (&SatControlMsgContainer::Send, fwdCtrlMsgContainer);
+  if (m_ctrlMsgRingCapacity > 0)
+    {
+      Ptr<SatControlMsgRingContainer> rtnCtrlMsgContainer = Create <SatControlMsgRingContainer> (m_ctrlMsgStoreTimeRtnLink, true, m_ctrlMsgRingCapacity);
+      Ptr<SatControlMsgRingContainer> fwdCtrlMsgContainer = Create <SatControlMsgRingContainer> (m_ctrlMsgStoreTimeFwdLink, false, m_ctrlMsgRingCapacity);
+
+      rtnReadCtrlCb = MakeCallback (&SatControlMsgRingContainer::Read, rtnCtrlMsgContainer);
+      rtnReserveCtrlCb = MakeCallback (&SatControlMsgRingContainer::ReserveIdAndStore, rtnCtrlMsgContainer);
+      rtnSendCtrlCb = MakeCallback (&SatControlMsgRingContainer::Send, rtnCtrlMsgContainer);
+
+      fwdReadCtrlCb = MakeCallback (&SatControlMsgRingContainer::Read, fwdCtrlMsgContainer);
+      fwdReserveCtrlCb = MakeCallback (&SatControlMsgRingContainer::ReserveIdAndStore, fwdCtrlMsgContainer);
+      fwdSendCtrlCb = MakeCallback (&SatControlMsgRingContainer::Send, fwdCtrlMsgContainer);
+    }
+  else
+    {
+      Ptr<SatControlMsgContainer> rtnCtrlMsgContainer = Create <SatControlMsgContainer> (m_ctrlMsgStoreTimeRtnLink, true);
+      Ptr<SatControlMsgContainer> fwdCtrlMsgContainer = Create <SatControlMsgContainer> (m_ctrlMsgStoreTimeFwdLink, false);
+
+      rtnReadCtrlCb = MakeCallback (&SatControlMsgContainer::Read, rtnCtrlMsgContainer);
+      rtnReserveCtrlCb = MakeCallback (&SatControlMsgContainer::ReserveIdAndStore, rtnCtrlMsgContainer);
+      rtnSendCtrlCb = MakeCallback (&SatControlMsgContainer::Send, rtnCtrlMsgContainer);
+
+      fwdReadCtrlCb = MakeCallback (&SatControlMsgContainer::Read, fwdCtrlMsgContainer);
+      fwdReserveCtrlCb = MakeCallback (&SatControlMsgContainer::ReserveIdAndStore, fwdCtrlMsgContainer);
+      fwdSendCtrlCb = MakeCallback (&SatControlMsgContainer::Send, fwdCtrlMsgContainer);
+    }
 
   SatGeoHelper::RandomAccessSettings_s geoRaSettings;
   geoRaSettings.m_raInterferenceModel = m_raInterferenceModel;
@@ -223,18 +291,20 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
   // - Packet reception at the UT
   // - FWD link packet scheduling at the GW
   //
-  Ptr<SatLinkResultsDvbS2> linkResultsS2 = CreateObject<SatLinkResultsDvbS2> ();
-  Ptr<SatLinkResultsDvbRcs2> linkResultsRcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
-  linkResultsS2->Initialize ();
-  linkResultsRcs2->Initialize ();
+  // Both are kept for the loss of the abstracted signalling messages.
+  //
+  m_linkResultsS2 = CreateObject<SatLinkResultsDvbS2> ();
+  m_linkResultsRcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+  m_linkResultsS2->Initialize ();
+  m_linkResultsRcs2->Initialize ();
 
   // DVB-S2 link results for packet decoding at the UT
-  m_utHelper->Initialize (linkResultsS2);
+  m_utHelper->Initialize (m_linkResultsS2);
   // DVB-RCS2 link results for packet decoding at the GW +
   // DVB-S2 link results for FWD link RRM
-  m_gwHelper->Initialize (linkResultsRcs2, linkResultsS2);
+  m_gwHelper->Initialize (m_linkResultsRcs2, m_linkResultsS2);
   // DVB-RCS2 link results for RTN link waveform configurations
-  m_superframeSeq->GetWaveformConf ()->InitializeEbNoRequirements (linkResultsRcs2);
+  m_superframeSeq->GetWaveformConf ()->InitializeEbNoRequirements (m_linkResultsRcs2);
 
   m_geoNode = geoNode;
   m_geoHelper->Install (m_geoNode);
@@ -286,7 +356,25 @@ SatBeamHelper::DoDispose ()
   m_ulChannels.clear ();
   m_flChannels.clear ();
   m_beamFreqs.clear ();
+  m_utNetworkBlocks.clear ();
+
+  // the loads refer to their co-channel interferers, so they are disposed together
+  for (std::map<uint32_t, Ptr<SatBackgroundLoad> >::iterator it = m_fwdBackgroundLoads.begin (); it != m_fwdBackgroundLoads.end (); ++it)
+    {
+      it->second->Dispose ();
+    }
+
+  for (std::map<uint32_t, Ptr<SatBackgroundLoad> >::iterator it = m_rtnBackgroundLoads.begin (); it != m_rtnBackgroundLoads.end (); ++it)
+    {
+      it->second->Dispose ();
+    }
+
+  m_fwdBackgroundLoads.clear ();
+  m_rtnBackgroundLoads.clear ();
+  Singleton<SatBeamInterferenceMatrix>::Get ()->Reset ();
   m_markovConf = NULL;
+  m_linkResultsS2 = NULL;
+  m_linkResultsRcs2 = NULL;
   m_ncc = NULL;
   m_geoHelper = NULL;
   m_gwHelper = NULL;
@@ -430,8 +518,26 @@ SatBeamHelper::Install (NodeContainer ut, Ptr<Node> gwNode, uint32_t gwId, uint3
 
   Ipv4InterfaceContainer utAddress = m_ipv4Helper.Assign (utNd);
 
+  if (m_abstractSignalling)
+    {
+      InstallSignallingChannel (gwNd, utNd, feederLink, userLink);
+    }
+
+  if (m_backgroundLoadEnabled)
+    {
+      InstallBackgroundLoad (gwNd, utNd, beamId, ulFreqId);
+    }
+
+  EnumValue fwdIfModel;
+  m_utHelper->GetAttribute ("DaFwdLinkInterferenceModel", fwdIfModel);
+
+  if (fwdIfModel.Get () == SatPhyRxCarrierConf::IF_PRECOMPUTED)
+    {
+      InstallBeamInterferenceMatrix (utNd, beamId, ulFreqId, userLink);
+    }
+
   // set needed routings and fill ARP cache
-  PopulateRoutings (ut, utNd, gwNode, gwNd, gwAddress.GetAddress (0), utAddress );
+  PopulateRoutings (ut, utNd, gwNode, gwNd, gwAddress.GetAddress (0), utAddress, beamId);
 
   m_ipv4Helper.NewNetwork ();
 
@@ -453,6 +559,14 @@ SatBeamHelper::GetGwId (uint32_t beamId) const
     }
 }
 
+void
+SatBeamHelper::SetUtNetworkBlock (uint32_t beamId, Ipv4Address network, Ipv4Mask mask)
+{
+  NS_LOG_FUNCTION (this << beamId << network << mask);
+
+  m_utNetworkBlocks[beamId] = std::make_pair (network.CombineMask (mask), mask);
+}
+
 Ptr<Node>
 SatBeamHelper::GetGwNode (uint32_t gwId) const
 {
@@ -574,6 +688,22 @@ SatBeamHelper::GetNcc () const
   return m_ncc;
 }
 
+Ptr<SatBackgroundLoad>
+SatBeamHelper::GetBackgroundLoad (uint32_t beamId, SatEnums::SatLinkDir_t linkDir) const
+{
+  NS_LOG_FUNCTION (this << beamId << linkDir);
+
+  const std::map<uint32_t, Ptr<SatBackgroundLoad> >& loads = ( linkDir == SatEnums::LD_FORWARD ) ? m_fwdBackgroundLoads : m_rtnBackgroundLoads;
+  std::map<uint32_t, Ptr<SatBackgroundLoad> >::const_iterator it = loads.find (beamId);
+
+  if ( it == loads.end () )
+    {
+      return NULL;
+    }
+
+  return it->second;
+}
+
 uint32_t
 SatBeamHelper::GetUtBeamId (Ptr<Node> utNode) const
 {
@@ -1017,9 +1147,10 @@ SatBeamHelper::StoreGwNode (uint32_t id, Ptr<Node> node)
 }
 
 void
-SatBeamHelper::PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<Node> gw, Ptr<NetDevice> gwNd, Ipv4Address gwAddr, Ipv4InterfaceContainer utIfs)
+SatBeamHelper::PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<Node> gw, Ptr<NetDevice> gwNd, Ipv4Address gwAddr, Ipv4InterfaceContainer utIfs, uint32_t beamId)
 {
-  NS_LOG_FUNCTION (this << gw << gwNd << gwAddr);
+  NS_LOG_FUNCTION (this << gw << gwNd << gwAddr << beamId);
+  NS_ASSERT (utIfs.GetN () == utNd.GetN ());
 
   Ipv4StaticRoutingHelper ipv4RoutingHelper;
   Ptr<Ipv4L3Protocol> ipv4Gw = gw->GetObject<Ipv4L3Protocol> ();
@@ -1031,22 +1162,51 @@ SatBeamHelper::PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<
   utArpCache->Add (gwAddr, macAddressGw);
   NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, UT arp entry:  " << gwAddr << " - " << macAddressGw );
 
-  // Add the ARP entries of all the UTs in this beam
-  // - MAC address vs. IPv4 address
-  Ptr<SatArpCache> gwArpCache = CreateObject<SatArpCache> ();
-  for (uint32_t i = 0; i < utIfs.GetN (); ++i)
+  // UT network block of the beam, used in prefix routing mode
+  std::pair<Ipv4Address, Ipv4Mask> utNetworkBlock;
+  bool utNetworkBlockAdded = false;
+  Ptr<SatNetDevice> gwSatNd = DynamicCast<SatNetDevice> (gwNd);
+
+  if (m_routingMode == SatBeamHelper::ROUTING_UT_NETWORK_ROUTES)
     {
-      NS_ASSERT (utIfs.GetN () == utNd.GetN ());
-      Ptr<NetDevice> nd = utNd.Get (i);
-      Ipv4Address ipv4Addr = utIfs.GetAddress (i);
-      gwArpCache->Add (ipv4Addr, nd->GetAddress ());
-      NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW arp entry:  " << ipv4Addr << " - " << nd->GetAddress ());
+      // Precompute the ARP entries of all the UTs in this beam
+      // - MAC address vs. IPv4 address
+      SatArpCache::IpMacTable_t gwArpTable;
+      gwArpTable.reserve (utIfs.GetN ());
+
+      for (uint32_t i = 0; i < utIfs.GetN (); ++i)
+        {
+          gwArpTable.push_back (std::make_pair (utIfs.GetAddress (i), utNd.Get (i)->GetAddress ()));
+          NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW arp entry:  " << utIfs.GetAddress (i) << " - " << utNd.Get (i)->GetAddress ());
+        }
+
+      // Set the ARP cache to the proper GW IPv4Interface (the one for satellite
+      // link). ARP cache contains the entries for all UTs within this spot-beam.
+      Ptr<SatArpCache> gwArpCache = CreateObject<SatArpCache> ();
+      gwArpCache->AddEntries (gwArpTable);
+      ipv4Gw->GetInterface (gwNd->GetIfIndex ())->SetArpCache (gwArpCache);
+      NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, Add ARP cache to GW: " << gw->GetId () << " with " << gwArpTable.size () << " entries" );
     }
+  else if (m_routingMode == SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES)
+    {
+      // The GW netdevice resolves the satellite interfaces of the UTs by
+      // indexing with the host part of the address, thus no ARP is needed
+      Ipv4InterfaceAddress gwIfAddress = ipv4Gw->GetAddress (gwNd->GetIfIndex (), 0);
+      gwSatNd->AddNetworkBlock (gwIfAddress.GetLocal (), gwIfAddress.GetMask (), Ipv4Mask::GetOnes ());
+
+      std::map<uint32_t, std::pair<Ipv4Address, Ipv4Mask> >::const_iterator block = m_utNetworkBlocks.find (beamId);
+
+      if (block == m_utNetworkBlocks.end ())
+        {
+          NS_FATAL_ERROR ("SatBeamHelper::PopulateRoutings - UT network block of beam " << beamId << " not set");
+        }
 
-  // Set the ARP cache to the proper GW IPv4Interface (the one for satellite
-  // link). ARP cache contains the entries for all UTs within this spot-beam.
-  ipv4Gw->GetInterface (gwNd->GetIfIndex ())->SetArpCache (gwArpCache);
-  NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, Add ARP cache to GW: " << gw->GetId () );
+      utNetworkBlock = block->second;
+
+      // Route the whole block of the beam directly to the satellite interface
+      srGw->AddNetworkRouteTo (utNetworkBlock.first, utNetworkBlock.second, gwNd->GetIfIndex ());
+      NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW prefix route:  " << utNetworkBlock.first << ", " << utNetworkBlock.second);
+    }
 
   uint32_t utAddressIndex = 0;
 
@@ -1058,10 +1218,8 @@ SatBeamHelper::PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<
 
       for (uint32_t j = 1; j < count; j++)
         {
-          std::string devName = ipv4Ut->GetNetDevice (j)->GetInstanceTypeId ().GetName ();
-
           // If SatNetDevice interface, add default route to towards GW of the beam on UTs
-          if ( devName == "ns3::SatNetDevice" )
+          if ( DynamicCast<SatNetDevice> (ipv4Ut->GetNetDevice (j)) != NULL )
             {
               Ptr<Ipv4StaticRouting> srUt = ipv4RoutingHelper.GetStaticRouting (ipv4Ut);
               srUt->SetDefaultRoute (gwAddr, j);
@@ -1077,9 +1235,44 @@ SatBeamHelper::PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<
               Ipv4Address address = ipv4Ut->GetAddress (j, 0).GetLocal ();
               Ipv4Mask mask = ipv4Ut->GetAddress (j, 0).GetMask ();
 
-              srGw->AddNetworkRouteTo (address.CombineMask (mask), mask, utIfs.GetAddress (utAddressIndex),gwNd->GetIfIndex ());
-              NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW Network route:  " << address.CombineMask (mask) <<
-                           ", " << mask << ", " << utIfs.GetAddress (utAddressIndex));
+              switch (m_routingMode)
+                {
+                case SatBeamHelper::ROUTING_UT_NETWORK_ROUTES:
+                  {
+                    srGw->AddNetworkRouteTo (address.CombineMask (mask), mask, utIfs.GetAddress (utAddressIndex),gwNd->GetIfIndex ());
+                    NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW Network route:  " << address.CombineMask (mask) <<
+                                 ", " << mask << ", " << utIfs.GetAddress (utAddressIndex));
+                    break;
+                  }
+                case SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES:
+                  {
+                    if (!address.CombineMask (utNetworkBlock.second).IsEqual (utNetworkBlock.first))
+                      {
+                        NS_FATAL_ERROR ("SatBeamHelper::PopulateRoutings - UT network " << address.CombineMask (mask) <<
+                                        " outside the UT network block of beam " << beamId);
+                      }
+
+                    // The GW netdevice resolves the whole UT network to the
+                    // UT MAC, thus no ARP entries are needed for the users
+                    if (!utNetworkBlockAdded)
+                      {
+                        gwSatNd->AddNetworkBlock (utNetworkBlock.first, utNetworkBlock.second, mask);
+                        utNetworkBlockAdded = true;
+                      }
+
+                    gwSatNd->AddNetworkMacAddress (address, mask, utNd.Get (utAddressIndex)->GetAddress ());
+                    gwSatNd->AddNetworkMacAddress (utIfs.GetAddress (utAddressIndex), Ipv4Mask::GetOnes (),
+                                                   utNd.Get (utAddressIndex)->GetAddress ());
+                    NS_LOG_INFO ("SatBeamHelper::PopulateRoutings, GW UT network:  " << address.CombineMask (mask) <<
+                                 ", " << mask << " - " << utNd.Get (utAddressIndex)->GetAddress ());
+                    break;
+                  }
+                default:
+                  {
+                    NS_FATAL_ERROR ("SatBeamHelper::PopulateRoutings - Invalid routing mode");
+                    break;
+                  }
+                }
             }
         }
 
@@ -1136,6 +1329,152 @@ SatBeamHelper::InstallFadingContainer (Ptr<Node> node) const
   return fadingContainer;
 }
 
+void
+SatBeamHelper::InstallSignallingChannel (Ptr<NetDevice> gwNd, NetDeviceContainer utNd,
+                                         ChannelPair_t feederLink, ChannelPair_t userLink) const
+{
+  NS_LOG_FUNCTION (this << gwNd);
+
+  Ptr<SatSignallingChannel> channel = CreateObject<SatSignallingChannel> ();
+  channel->SetLinks (m_geoNode->GetObject<MobilityModel> (),
+                     feederLink.second->GetPropagationDelayModel (),
+                     userLink.second->GetPropagationDelayModel ());
+
+  // GW messages are sent with the most robust MODCOD of the BB frames
+  Ptr<SatBbFrameConf> bbFrameConf = m_gwHelper->GetBbFrameConf ();
+  SatEnums::SatBbFrameType_t frameType = SatEnums::NORMAL_FRAME;
+
+  if (bbFrameConf->GetBbFrameUsageMode () == SatBbFrameConf::SHORT_FRAMES)
+    {
+      frameType = SatEnums::SHORT_FRAME;
+    }
+
+  channel->SetFwdLinkResults (m_linkResultsS2,
+                              bbFrameConf->GetMostRobustModcod (frameType),
+                              frameType,
+                              m_carrierBandwidthConverter (SatEnums::FORWARD_USER_CH, 0, SatEnums::EFFECTIVE_BANDWIDTH));
+
+  // UT messages are sent with the most robust waveform
+  Ptr<SatWaveformConf> waveformConf = m_superframeSeq->GetWaveformConf ();
+  uint32_t waveformId = 0;
+
+  if (!waveformConf->GetMostRobustWaveformId (waveformId))
+    {
+      NS_FATAL_ERROR ("No waveform for the abstracted signalling messages found!");
+    }
+
+  channel->SetRtnLinkResults (m_linkResultsRcs2,
+                              waveformId,
+                              waveformConf->GetModCod (waveformId),
+                              m_carrierBandwidthConverter (SatEnums::RETURN_USER_CH, 0, SatEnums::EFFECTIVE_BANDWIDTH));
+
+  Ptr<SatNetDevice> gwDev = DynamicCast<SatNetDevice> (gwNd);
+  channel->AddTerminal (Mac48Address::ConvertFrom (gwDev->GetAddress ()),
+                        gwDev->GetMac (),
+                        gwDev->GetNode ()->GetObject<MobilityModel> (),
+                        gwDev->GetNode ()->GetId (),
+                        true);
+  gwDev->SetSignallingChannel (channel);
+  gwDev->GetPhy ()->TraceConnectWithoutContext ("Cno", MakeCallback (&SatSignallingChannel::NotifyCno, channel));
+
+  for (NetDeviceContainer::Iterator it = utNd.Begin (); it != utNd.End (); ++it)
+    {
+      Ptr<SatNetDevice> utDev = DynamicCast<SatNetDevice> (*it);
+      channel->AddTerminal (Mac48Address::ConvertFrom (utDev->GetAddress ()),
+                            utDev->GetMac (),
+                            utDev->GetNode ()->GetObject<MobilityModel> (),
+                            utDev->GetNode ()->GetId (),
+                            false);
+      utDev->SetSignallingChannel (channel);
+      utDev->GetPhy ()->TraceConnectWithoutContext ("Cno", MakeCallback (&SatSignallingChannel::NotifyCno, channel));
+    }
+}
+
+void
+SatBeamHelper::InstallBackgroundLoad (Ptr<NetDevice> gwNd, NetDeviceContainer utNd, uint32_t beamId, uint32_t ulFreqId)
+{
+  NS_LOG_FUNCTION (this << gwNd << beamId << ulFreqId);
+
+  Ptr<SatBackgroundLoad> fwdLoad = CreateObject<SatBackgroundLoad> ();
+  Ptr<SatBackgroundLoad> rtnLoad = CreateObject<SatBackgroundLoad> ();
+
+  // forward link load is served by the forward link scheduler of the GW MAC
+  Ptr<SatNetDevice> gwDev = DynamicCast<SatNetDevice> (gwNd);
+  PointerValue schedulerValue;
+  gwDev->GetMac ()->GetAttribute ("Scheduler", schedulerValue);
+  Ptr<SatFwdLinkScheduler> fwdScheduler = schedulerValue.Get<SatFwdLinkScheduler> ();
+  NS_ASSERT (fwdScheduler != NULL);
+  fwdScheduler->SetBackgroundLoad (fwdLoad);
+
+  // return link load is served by the beam scheduler of the NCC
+  m_ncc->GetBeamScheduler (beamId)->SetBackgroundLoad (rtnLoad);
+
+  // background loads of the beams using the same user link frequency interfere with each other
+  for (std::map<uint32_t, FrequencyPair_t >::const_iterator it = m_beamFreqs.begin (); it != m_beamFreqs.end (); ++it)
+    {
+      std::map<uint32_t, Ptr<SatBackgroundLoad> >::const_iterator fwdIt = m_fwdBackgroundLoads.find (it->first);
+
+      if ( it->first != beamId && it->second.first == ulFreqId && fwdIt != m_fwdBackgroundLoads.end () )
+        {
+          Ptr<SatBackgroundLoad> otherRtnLoad = m_rtnBackgroundLoads.at (it->first);
+
+          fwdLoad->AddInterferer (fwdIt->second);
+          fwdIt->second->AddInterferer (fwdLoad);
+          rtnLoad->AddInterferer (otherRtnLoad);
+          otherRtnLoad->AddInterferer (rtnLoad);
+        }
+    }
+
+  m_fwdBackgroundLoads.insert (std::make_pair (beamId, fwdLoad));
+  m_rtnBackgroundLoads.insert (std::make_pair (beamId, rtnLoad));
+
+  // UTs receive the interference of the forward link loads and the GW the one of the return link loads
+  for (NetDeviceContainer::Iterator it = utNd.Begin (); it != utNd.End (); ++it)
+    {
+      DynamicCast<SatNetDevice> (*it)->GetPhy ()->GetPhyRx ()->SetBackgroundInterferenceCallback (MakeCallback (&SatBackgroundLoad::GetInterferenceWrtNoise, fwdLoad));
+    }
+
+  gwDev->GetPhy ()->GetPhyRx ()->SetBackgroundInterferenceCallback (MakeCallback (&SatBackgroundLoad::GetInterferenceWrtNoise, rtnLoad));
+}
+
+void
+SatBeamHelper::InstallBeamInterferenceMatrix (NetDeviceContainer utNd, uint32_t beamId, uint32_t ulFreqId, ChannelPair_t userLink)
+{
+  NS_LOG_FUNCTION (this << beamId << ulFreqId);
+
+  SatBeamInterferenceMatrix *matrix = Singleton<SatBeamInterferenceMatrix>::Get ();
+  matrix->AddBeam (beamId, ulFreqId, m_antennaGainPatterns->GetAntennaGainPattern (beamId));
+
+  // co-channel interference is computed from the matrix, so the UTs need not
+  // to receive the transmissions of the other beams
+  EnumValue fwdMode;
+  userLink.first->GetAttribute ("ForwardingMode", fwdMode);
+
+  if (fwdMode.Get () == SatChannel::ALL_BEAMS)
+    {
+      userLink.first->SetAttribute ("ForwardingMode", EnumValue (SatChannel::ONLY_DEST_BEAM));
+    }
+
+  userLink.first->SetTxNotificationCallback (MakeCallback (&SatBeamInterferenceMatrix::NotifyBeamTx, matrix));
+
+  Ptr<MobilityModel> geoMobility = m_geoNode->GetObject<MobilityModel> ();
+
+  for (NetDeviceContainer::Iterator it = utNd.Begin (); it != utNd.End (); ++it)
+    {
+      Ptr<Node> utNode = (*it)->GetNode ();
+
+      // the gain ratios are computed once, so they hold only for static UTs
+      if (DynamicCast<SatConstantPositionMobilityModel> (utNode->GetObject<MobilityModel> ()) == NULL)
+        {
+          NS_FATAL_ERROR ("Beam interference matrix supports only UTs with constant position mobility!");
+        }
+
+      Time delay = userLink.first->GetPropagationDelayModel ()->GetDelay (geoMobility, utNode->GetObject<MobilityModel> ());
+
+      matrix->AddReceiver ((*it)->GetAddress (), beamId, utNode->GetObject<SatMobilityModel> ()->GetGeoPosition (), delay);
+    }
+}
+
 void
 SatBeamHelper::AddMulticastRouteToUt (Ptr<Node> utNode, Ipv4Address sourceAddress, Ipv4Address groupAddress, bool routeToSatellite)
 {
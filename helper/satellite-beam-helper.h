@@ -37,6 +37,7 @@
 #include "ns3/satellite-packet-trace.h"
 #include "ns3/satellite-superframe-sequence.h"
 #include "ns3/satellite-typedefs.h"
+#include "ns3/satellite-background-load.h"
 #include "satellite-geo-helper.h"
 #include "satellite-gw-helper.h"
 #include "satellite-ut-helper.h"
@@ -73,6 +74,20 @@ public:
   typedef std::set<Ptr<Node> >                          MulticastBeamInfoItem_t;  // set container having receiving UT nodes in beam
   typedef std::map<uint32_t, std::set<Ptr<Node> > >     MulticastBeamInfo_t;      // key = beam ID, value = receiving UT nodes in beam
 
+  /**
+   * Routing modes between GWs and UTs
+   * - ROUTING_UT_NETWORK_ROUTES: one network route per UT network via the UT
+   * - ROUTING_BEAM_PREFIX_ROUTES: one prefix route per beam directly to the
+   *   satellite interface, the UT networks of the beam are allocated from an
+   *   aligned block (see SetUtNetworkBlock) and resolved to the UT MAC
+   *   addresses by the GW netdevice
+   */
+  typedef enum
+  {
+    ROUTING_UT_NETWORK_ROUTES,
+    ROUTING_BEAM_PREFIX_ROUTES
+  } RoutingMode_t;
+
   /**
    * \brief Get the type ID
    * \return the object TypeId
@@ -179,6 +194,26 @@ public:
    */
   uint32_t GetGwId (uint32_t beamId) const;
 
+  /**
+   * \return the routing mode used between GWs and UTs
+   */
+  inline RoutingMode_t GetRoutingMode () const
+  {
+    return m_routingMode;
+  }
+
+  /**
+   * \brief Set the block the UT networks of a beam are allocated from. Must
+   * be set before the beam is installed when the routing mode is
+   * ROUTING_BEAM_PREFIX_ROUTES, the block is then the only route of the
+   * GW to the UT networks of the beam.
+   *
+   * \param beamId ID of the beam
+   * \param network network address of the block
+   * \param mask network mask of the block
+   */
+  void SetUtNetworkBlock (uint32_t beamId, Ipv4Address network, Ipv4Mask mask);
+
   /**
    * \return container having all GW nodes in satellite network.
    */
@@ -253,6 +288,17 @@ public:
    */
   Ptr<SatNcc> GetNcc () const;
 
+  /**
+   * Get the aggregate background load of a beam. Background loads are
+   * created only when attribute BackgroundLoadEnabled is set. The attributes
+   * of the returned load can be changed until the simulation is started.
+   *
+   * \param beamId ID of the beam
+   * \param linkDir link direction of the load
+   * \return pointer to the background load or NULL, if not found
+   */
+  Ptr<SatBackgroundLoad> GetBackgroundLoad (uint32_t beamId, SatEnums::SatLinkDir_t linkDir) const;
+
   /**
    * Get beam Id of the given UT.
    *
@@ -304,6 +350,14 @@ private:
 
   Ptr<SatAntennaGainPatternContainer>   m_antennaGainPatterns;
 
+  Ptr<SatLinkResultsDvbS2>    m_linkResultsS2;
+  Ptr<SatLinkResultsDvbRcs2>  m_linkResultsRcs2;
+
+  /**
+   * Routing mode used to populate the routes between GWs and UTs
+   */
+  RoutingMode_t         m_routingMode;
+
   std::map<uint32_t, uint32_t >             m_beam;        // first beam ID, second GW ID
   std::set<GwLink_t >                       m_gwLinks;     // gateway links (GW id and feeder frequency id pairs).
   std::map<uint32_t, Ptr<Node> >            m_gwNode;      // first GW ID, second node pointer
@@ -311,6 +365,7 @@ private:
   std::map<uint32_t, ChannelPair_t >        m_ulChannels;  // user link ID, channel pointers pair
   std::map<uint32_t, ChannelPair_t >        m_flChannels;  // feeder link ID, channel pointers pair
   std::map<uint32_t, FrequencyPair_t >      m_beamFreqs;   // first beam ID, channel frequency IDs pair
+  std::map<uint32_t, std::pair<Ipv4Address, Ipv4Mask> > m_utNetworkBlocks; // first beam ID, UT network block of the beam
 
 
   /**
@@ -378,6 +433,26 @@ private:
    */
   double m_raConstantErrorRate;
 
+  /**
+   * Flag indicating whether the capacity requests, C/N0 reports, RA control
+   * messages and TBTPs are delivered through SatSignallingChannel.
+   */
+  bool m_abstractSignalling;
+
+  /**
+   * Initial capacity of the ring based control message containers, or 0 to
+   * use SatControlMsgContainer.
+   */
+  uint32_t m_ctrlMsgRingCapacity;
+
+  /**
+   * Flag indicating whether aggregate background loads are created for the beams.
+   */
+  bool m_backgroundLoadEnabled;
+
+  std::map<uint32_t, Ptr<SatBackgroundLoad> > m_fwdBackgroundLoads;  // beam ID, forward link background load
+  std::map<uint32_t, Ptr<SatBackgroundLoad> > m_rtnBackgroundLoads;  // beam ID, return link background load
+
   /**
    * Packet trace
    */
@@ -417,9 +492,11 @@ private:
    * \param gwNd  pointer to gateway netdevice
    * \param gwAddr address of the gateway
    * \param utIfs container having UT ipv2 interfaces (for addresses)
+   * \param beamId ID of the beam
    */
   void PopulateRoutings (NodeContainer ut, NetDeviceContainer utNd, Ptr<Node> gw,
-                         Ptr<NetDevice> gwNd, Ipv4Address gwAddr, Ipv4InterfaceContainer utIfs);
+                         Ptr<NetDevice> gwNd, Ipv4Address gwAddr, Ipv4InterfaceContainer utIfs,
+                         uint32_t beamId);
 
   /**
    * Install fading model to node, if fading model doesn't exist already in node
@@ -429,6 +506,41 @@ private:
    */
   Ptr<SatBaseFading>  InstallFadingContainer (Ptr<Node> node) const;
 
+  /**
+   * Install the abstracted signalling path to the GW and the UTs of a beam.
+   *
+   * \param gwNd GW net device of the beam
+   * \param utNd UT net devices of the beam
+   * \param feederLink feeder link channels of the beam
+   * \param userLink user link channels of the beam
+   */
+  void InstallSignallingChannel (Ptr<NetDevice> gwNd, NetDeviceContainer utNd,
+                                 ChannelPair_t feederLink, ChannelPair_t userLink) const;
+
+  /**
+   * Create the background loads of a beam, attach them to the schedulers of
+   * the beam and make them interfere with the co-channel beams.
+   *
+   * \param gwNd GW net device of the beam
+   * \param utNd UT net devices of the beam
+   * \param beamId ID of the beam
+   * \param ulFreqId ID of the user link frequency of the beam
+   */
+  void InstallBackgroundLoad (Ptr<NetDevice> gwNd, NetDeviceContainer utNd, uint32_t beamId, uint32_t ulFreqId);
+
+  /**
+   * Add a beam and its UTs to the precomputed interference matrix of the
+   * forward user link and stop delivering the transmissions of the forward
+   * user link channel to the UTs of the other beams. The UTs must have
+   * constant position mobility.
+   *
+   * \param utNd UT net devices of the beam
+   * \param beamId ID of the beam
+   * \param ulFreqId ID of the user link frequency of the beam
+   * \param userLink user link channels of the beam
+   */
+  void InstallBeamInterferenceMatrix (NetDeviceContainer utNd, uint32_t beamId, uint32_t ulFreqId, ChannelPair_t userLink);
+
   /**
    * Add multicast route to UT node.
    *
@@ -227,6 +227,7 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   params.m_device = dev;
   params.m_txCh = fCh;
   params.m_rxCh = rCh;
+  params.m_lazyRxCarriers = false;
 
   // Create a packet classifier
   Ptr<SatPacketClassifier> classifier = Create<SatPacketClassifier> ();
@@ -318,11 +319,14 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   // Attach the device receive callback to SatLlc
   mac->SetReceiveCallback (MakeCallback (&SatLlc::Receive, llc));
 
+  // Attach the MAC wake-up callback to SatLlc, used with idle carrier suspension
+  llc->SetTxDataAvailableCallback (MakeCallback (&SatGwMac::NotifyTxDataAvailable, mac));
+
   // Set the device address and pass it to MAC as well
   Mac48Address addr = Mac48Address::Allocate ();
   dev->SetAddress (addr);
 
-  Singleton<SatIdMapper>::Get ()->AttachMacToTraceId (dev->GetAddress ());
+  uint32_t traceId = Singleton<SatIdMapper>::Get ()->AttachMacToTraceId (dev->GetAddress ());
   Singleton<SatIdMapper>::Get ()->AttachMacToGwId (dev->GetAddress (), gwId);
   Singleton<SatIdMapper>::Get ()->AttachMacToBeamId (dev->GetAddress (), beamId);
 
@@ -339,7 +343,7 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   phy->Initialize ();
 
   // Create a node info to all the protocol layers
-  Ptr<SatNodeInfo> nodeInfo = Create <SatNodeInfo> (SatEnums::NT_GW, n->GetId (), addr);
+  Ptr<SatNodeInfo> nodeInfo = Create <SatNodeInfo> (SatEnums::NT_GW, n->GetId (), addr, traceId);
   dev->SetNodeInfo (nodeInfo);
   llc->SetNodeInfo (nodeInfo);
   mac->SetNodeInfo (nodeInfo);
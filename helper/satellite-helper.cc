@@ -398,6 +398,20 @@ SatHelper::SetUtPositionAllocatorForBeam (uint32_t beamId, Ptr<SatListPositionAl
 	m_utPositionsByBeam[beamId] = posAllocator;
 }
 
+void
+SatHelper::SetUtTrajectoriesForBeam (uint32_t beamId, std::vector<std::string> trajectoryFileNames)
+{
+  NS_LOG_FUNCTION (this << beamId);
+  m_utTrajectoriesByBeam[beamId] = trajectoryFileNames;
+}
+
+Ptr<SatTrajectoryMobilityUpdater>
+SatHelper::GetTrajectoryMobilityUpdater () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_trajectoryUpdater;
+}
+
 void
 SatHelper::CreateUserDefinedScenarioFromListPositions (BeamUserInfoMap_t& infos, bool checkBeam)
 {
@@ -476,6 +490,14 @@ SatHelper::DoCreateScenario (BeamUserInfoMap_t& beamInfos, uint32_t gwUsers)
           SetUtMobility (uts, info->first);
           internet.Install (uts);
 
+          if (m_beamHelper->GetRoutingMode () == SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES)
+            {
+              // allocate the UT networks of the beam from a block of their own,
+              // which the GW then routes with a single prefix
+              std::pair<Ipv4Address, Ipv4Mask> block = m_userHelper->StartUtNetworkBlock (info->second.GetUtCount ());
+              m_beamHelper->SetUtNetworkBlock (info->first, block.first, block.second);
+            }
+
           for ( uint32_t i = 0; i < info->second.GetUtCount (); i++ )
             {
               // create and install needed users
@@ -527,6 +549,33 @@ SatHelper::SetUtMobility (NodeContainer uts, uint32_t beamId)
 {
   NS_LOG_FUNCTION (this);
 
+  std::map<uint32_t, std::vector<std::string> >::const_iterator trajectories = m_utTrajectoriesByBeam.find (beamId);
+
+  // trajectory driven UTs are advanced in one batch by the common updater
+  if (trajectories != m_utTrajectoriesByBeam.end ())
+    {
+      if (trajectories->second.size () < uts.GetN ())
+        {
+          NS_FATAL_ERROR ("Not enough trajectory files for UTs of beam " << beamId << "!!!");
+        }
+
+      if (m_trajectoryUpdater == NULL)
+        {
+          Ptr<SatMobilityModel> satMobility = m_beamHelper->GetGeoSatNode ()->GetObject<SatMobilityModel> ();
+          m_trajectoryUpdater = CreateObject<SatTrajectoryMobilityUpdater> (satMobility);
+        }
+
+      for (uint32_t i = 0; i < uts.GetN (); i++)
+        {
+          Ptr<SatTrajectoryMobilityModel> utMobility = CreateObject<SatTrajectoryMobilityModel> ();
+          uts.Get (i)->AggregateObject (utMobility);
+          m_trajectoryUpdater->Add (utMobility, trajectories->second[i]);
+        }
+
+      InstallMobilityObserver (uts);
+      return;
+    }
+
   MobilityHelper mobility;
 
   Ptr<SatPositionAllocator> allocator;
@@ -728,6 +777,19 @@ SatHelper::DoDispose ()
   NS_LOG_FUNCTION (this);
 
   m_utPositionsByBeam.clear ();
+  m_utTrajectoriesByBeam.clear ();
+
+  if (m_trajectoryUpdater != NULL)
+    {
+      m_trajectoryUpdater->Dispose ();
+      m_trajectoryUpdater = NULL;
+    }
+
+  if (m_beamHelper != NULL)
+    {
+      m_beamHelper->Dispose ();
+      m_beamHelper = NULL;
+    }
 }
 
 bool
@@ -931,7 +993,20 @@ SatHelper::SetNetworkAddresses (BeamUserInfoMap_t& beamInfos, uint32_t gwUsers)
   for (BeamUserInfoMap_t::const_iterator it = beamInfos.begin (); it != beamInfos.end (); it++)
     {
       uint32_t beamUtCount = it->second.GetUtCount ();
-      utNetworkAddressCount += beamUtCount;
+
+      if (m_beamHelper->GetRoutingMode () == SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES)
+        {
+          // the UT networks of a beam are allocated from a block aligned to its size,
+          // see SatUserHelper::StartUtNetworkBlock
+          uint32_t blockSize = SatUserHelper::GetUtNetworkBlockSize (beamUtCount);
+          uint32_t firstNetwork = m_utNetworkAddress.Get () >> (32 - m_utNetworkMask.GetPrefixLength ());
+          uint32_t blockStart = ((firstNetwork + utNetworkAddressCount + blockSize - 1) / blockSize) * blockSize;
+          utNetworkAddressCount = blockStart - firstNetwork + blockSize;
+        }
+      else
+        {
+          utNetworkAddressCount += beamUtCount;
+        }
 
       if (beamUtCount > beamHostAddressCount)
         {
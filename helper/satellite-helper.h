@@ -34,6 +34,7 @@
 #include "satellite-beam-user-info.h"
 #include "satellite-conf.h"
 #include "ns3/satellite-position-allocator.h"
+#include "ns3/satellite-trajectory-mobility-updater.h"
 #include "ns3/satellite-rx-power-input-trace-container.h"
 #include "ns3/satellite-rx-power-output-trace-container.h"
 #include "ns3/satellite-interference-input-trace-container.h"
@@ -159,6 +160,23 @@ public:
    */
   void SetUtPositionAllocatorForBeam (uint32_t beamId, Ptr<SatListPositionAllocator> posAllocator);
 
+  /**
+   * \brief Set trajectory files for UTs of specific beam. The UTs of the beam
+   * are installed with SatTrajectoryMobilityModel, which positions are
+   * advanced by a common SatTrajectoryMobilityUpdater. This overrides the
+   * position allocators for this beam.
+   * \param beamId
+   * \param trajectoryFileNames trajectory file for each UT of the beam, row
+   *        format [time, latitude, longitude, altitude]
+   */
+  void SetUtTrajectoriesForBeam (uint32_t beamId, std::vector<std::string> trajectoryFileNames);
+
+  /**
+   * \return pointer to the trajectory mobility updater, NULL if there are no
+   *         trajectory driven UTs
+   */
+  Ptr<SatTrajectoryMobilityUpdater> GetTrajectoryMobilityUpdater () const;
+
   /**
    * Set multicast group to satellite network and IP router. Add needed routes to net devices.
    *
@@ -313,6 +331,17 @@ private:
    */
   Ptr<SatListPositionAllocator> m_utPositions;
 
+  /**
+   * User defined UT trajectory files by beam ID.
+   */
+  std::map<uint32_t, std::vector<std::string> > m_utTrajectoriesByBeam;
+
+  /**
+   * Updater of the trajectory driven UTs, created when the first trajectory
+   * driven UT is installed.
+   */
+  Ptr<SatTrajectoryMobilityUpdater> m_trajectoryUpdater;
+
   /**
    * Enables creation traces to be written in given file
    */
@@ -68,7 +68,8 @@ SatUserHelper::GetInstanceTypeId (void) const
 }
 
 SatUserHelper::SatUserHelper ()
-  : m_backboneNetworkType (SatUserHelper::NETWORK_TYPE_SAT_SIMPLE),
+  : m_utNetworkBlockEnd (0),
+    m_backboneNetworkType (SatUserHelper::NETWORK_TYPE_SAT_SIMPLE),
     m_subscriberNetworkType (SatUserHelper::NETWORK_TYPE_CSMA),
     m_router (0)
 
@@ -110,6 +111,47 @@ void SatUserHelper::SetUtBaseAddress (const Ipv4Address& network, const Ipv4Mask
   NS_LOG_FUNCTION (this);
 
   m_ipv4Ut.SetBase (network, mask, address);
+  m_utNetwork = network.CombineMask (mask);
+  m_utNetworkMask = mask;
+  m_utNetworkBlockEnd = 0;
+}
+
+std::pair<Ipv4Address, Ipv4Mask>
+SatUserHelper::StartUtNetworkBlock (uint32_t utCount)
+{
+  NS_LOG_FUNCTION (this << utCount);
+
+  uint32_t hostBits = 32 - m_utNetworkMask.GetPrefixLength ();
+  uint32_t blockSize = GetUtNetworkBlockSize (utCount);
+  uint32_t index = m_utNetwork.Get () >> hostBits;
+
+  // skip the rest of the previous block and align to the block size
+  while ((index < m_utNetworkBlockEnd) || (index % blockSize != 0))
+    {
+      m_utNetwork = m_ipv4Ut.NewNetwork ();
+      index++;
+    }
+
+  m_utNetworkBlockEnd = index + blockSize;
+
+  Ipv4Mask blockMask (m_utNetworkMask.Get () & ~((blockSize << hostBits) - 1));
+
+  NS_LOG_INFO ("SatUserHelper::StartUtNetworkBlock, UT network block: " << m_utNetwork << ", " << blockMask);
+
+  return std::make_pair (m_utNetwork, blockMask);
+}
+
+uint32_t
+SatUserHelper::GetUtNetworkBlockSize (uint32_t utCount)
+{
+  uint32_t blockSize = 1;
+
+  while (blockSize < utCount)
+    {
+      blockSize <<= 1;
+    }
+
+  return blockSize;
 }
 
 void SatUserHelper::SetGwBaseAddress (const Ipv4Address& network, const Ipv4Mask& mask, const Ipv4Address address)
@@ -180,7 +222,7 @@ SatUserHelper::InstallUt (Ptr<Node> ut, uint32_t userCount )
       NS_LOG_INFO ("SatUserHelper::InstallUt, User default route: " << addresses.GetAddress (0) );
     }
 
-  m_ipv4Ut.NewNetwork ();
+  m_utNetwork = m_ipv4Ut.NewNetwork ();
 
   std::pair<UtUsersContainer_t::const_iterator, bool> result = m_utUsers.insert ( std::make_pair (ut, users) );
 
@@ -136,6 +136,25 @@ public:
   */
   void SetUtBaseAddress (const Ipv4Address& network, const Ipv4Mask& mask, Ipv4Address base = "0.0.0.1");
 
+  /**
+   * \brief Start a block of UT networks aligned to its size. The networks of
+   * the next UTs installed are allocated from the block, and the block is
+   * never shared with the UTs installed after the next block is started.
+   * Thus the UT networks of the block are routed with a single prefix.
+   *
+   * \param utCount number of UTs the block holds
+   * \return network address and mask of the block
+   */
+  std::pair<Ipv4Address, Ipv4Mask> StartUtNetworkBlock (uint32_t utCount);
+
+  /**
+   * \brief Get the size of a UT network block, see StartUtNetworkBlock.
+   *
+   * \param utCount number of UTs the block holds
+   * \return number of UT networks in the block, a power of two
+   */
+  static uint32_t GetUtNetworkBlockSize (uint32_t utCount);
+
   /**
   * \param network The Ipv4Address containing the initial network number to
   * use for satellite network allocation. The bits outside the network mask are not used.
@@ -292,6 +311,14 @@ private:
   Ipv4AddressHelper m_ipv4Ut;
   Ipv4AddressHelper m_ipv4Gw;
 
+  /**
+   * Next UT network allocated by #m_ipv4Ut, its mask and the index of the
+   * first network after the current UT network block
+   */
+  Ipv4Address       m_utNetwork;
+  Ipv4Mask          m_utNetworkMask;
+  uint32_t          m_utNetworkBlockEnd;
+
   NodeContainer       m_gwUsers;
   UtUsersContainer_t  m_utUsers;
   NodeContainer       m_allUtUsers;
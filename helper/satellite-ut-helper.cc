@@ -77,7 +77,8 @@ SatUtHelper::GetTypeId (void)
                    MakeEnumAccessor (&SatUtHelper::m_daInterferenceModel),
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
-                                    SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket"))
+                                    SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
+                                    SatPhyRxCarrierConf::IF_PRECOMPUTED, "Precomputed"))
     .AddAttribute ("FwdLinkErrorModel",
                    "Forward link error model",
                    EnumValue (SatPhyRxCarrierConf::EM_AVI),
@@ -105,6 +106,14 @@ SatUtHelper::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&SatUtHelper::m_crdsaOnlyForControl),
                    MakeBooleanChecker ())
+    .AddAttribute ("CompactStack",
+                   "Share the packet classifier and the channel estimation error container "
+                   "between all the UTs of the helper and create the forward link RX carriers "
+                   "only on their first reception. The rest of the UT stack, including the "
+                   "MAC, LLC and their trace sources, is created per UT as without the option.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatUtHelper::m_compactStack),
+                   MakeBooleanChecker ())
     .AddTraceSource ("Creation",
                      "Creation traces",
                      MakeTraceSourceAccessor (&SatUtHelper::m_creationTrace),
@@ -132,7 +141,8 @@ SatUtHelper::SatUtHelper ()
     m_llsConf (),
     m_enableChannelEstimationError (false),
     m_crdsaOnlyForControl (false),
-    m_raSettings ()
+    m_raSettings (),
+    m_compactStack (false)
 {
   NS_LOG_FUNCTION (this);
 
@@ -160,7 +170,8 @@ SatUtHelper::SatUtHelper (SatTypedefs::CarrierBandwidthConverter_t carrierBandwi
     m_llsConf (),
     m_enableChannelEstimationError (false),
     m_crdsaOnlyForControl (false),
-    m_raSettings (randomAccessSettings)
+    m_raSettings (randomAccessSettings),
+    m_compactStack (false)
 {
   NS_LOG_FUNCTION (this << fwdLinkCarrierCount << seq );
   m_deviceFactory.SetTypeId ("ns3::SatNetDevice");
@@ -241,24 +252,15 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   params.m_device = dev;
   params.m_txCh = rCh;
   params.m_rxCh = fCh;
+  params.m_lazyRxCarriers = m_compactStack;
 
   // Create a packet classifier
-  Ptr<SatPacketClassifier> classifier = Create<SatPacketClassifier> ();
+  Ptr<SatPacketClassifier> classifier = GetPacketClassifier ();
 
   /**
    * Channel estimation errors
    */
-  Ptr<SatChannelEstimationErrorContainer> cec;
-  // Not enabled, create only base class
-  if (!m_enableChannelEstimationError)
-    {
-      cec = Create<SatSimpleChannelEstimationErrorContainer> ();
-    }
-  // Create SatFwdLinkChannelEstimationErrorContainer
-  else
-    {
-      cec = Create<SatFwdLinkChannelEstimationErrorContainer> ();
-    }
+  Ptr<SatChannelEstimationErrorContainer> cec = GetChannelEstimationErrorContainer ();
 
   SatPhyRxCarrierConf::RxCarrierCreateParams_s parameters = SatPhyRxCarrierConf::RxCarrierCreateParams_s ();
   parameters.m_errorModel = m_errorModel;
@@ -336,7 +338,7 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   Mac48Address addr = Mac48Address::Allocate ();
   dev->SetAddress (addr);
 
-  Singleton<SatIdMapper>::Get ()->AttachMacToTraceId (dev->GetAddress ());
+  uint32_t traceId = Singleton<SatIdMapper>::Get ()->AttachMacToTraceId (dev->GetAddress ());
   Singleton<SatIdMapper>::Get ()->AttachMacToUtId (dev->GetAddress ());
   Singleton<SatIdMapper>::Get ()->AttachMacToBeamId (dev->GetAddress (),beamId);
 
@@ -394,7 +396,7 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   mac->SetAttribute ("Scheduler", PointerValue (utScheduler));
 
   // Create a node info to all the protocol layers
-  Ptr<SatNodeInfo> nodeInfo = Create <SatNodeInfo> (SatEnums::NT_UT, n->GetId (), addr);
+  Ptr<SatNodeInfo> nodeInfo = Create <SatNodeInfo> (SatEnums::NT_UT, n->GetId (), addr, traceId);
   dev->SetNodeInfo (nodeInfo);
   llc->SetNodeInfo (nodeInfo);
   mac->SetNodeInfo (nodeInfo);
@@ -430,6 +432,55 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   return dev;
 }
 
+Ptr<SatPacketClassifier>
+SatUtHelper::GetPacketClassifier ()
+{
+  NS_LOG_FUNCTION (this);
+
+  // The classifier is stateless, so the compact stack shares one between all the UTs
+  if (!m_compactStack)
+    {
+      return Create<SatPacketClassifier> ();
+    }
+
+  if (m_sharedClassifier == NULL)
+    {
+      m_sharedClassifier = Create<SatPacketClassifier> ();
+    }
+
+  return m_sharedClassifier;
+}
+
+Ptr<SatChannelEstimationErrorContainer>
+SatUtHelper::GetChannelEstimationErrorContainer ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_compactStack && m_sharedCec != NULL)
+    {
+      return m_sharedCec;
+    }
+
+  Ptr<SatChannelEstimationErrorContainer> cec;
+  // Not enabled, create only base class
+  if (!m_enableChannelEstimationError)
+    {
+      cec = Create<SatSimpleChannelEstimationErrorContainer> ();
+    }
+  // Create SatFwdLinkChannelEstimationErrorContainer
+  else
+    {
+      cec = Create<SatFwdLinkChannelEstimationErrorContainer> ();
+    }
+
+  if (m_compactStack)
+    {
+      m_sharedCec = cec;
+    }
+
+  return cec;
+}
+
 void
 SatUtHelper::EnableCreationTraces (Ptr<OutputStreamWrapper> stream, CallbackBase &cb)
 {
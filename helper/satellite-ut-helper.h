@@ -36,6 +36,8 @@
 #include "ns3/satellite-random-access-container.h"
 #include "ns3/satellite-random-access-container-conf.h"
 #include "ns3/satellite-typedefs.h"
+#include "ns3/satellite-packet-classifier.h"
+#include "ns3/satellite-channel-estimation-error-container.h"
 
 namespace ns3 {
 
@@ -172,6 +174,20 @@ public:
   void EnableCreationTraces (Ptr<OutputStreamWrapper> stream, CallbackBase &cb);
 
 private:
+  /**
+   * \brief Get the packet classifier for a new UT. With the compact stack
+   * profile one classifier is shared by all the UTs.
+   * \return packet classifier
+   */
+  Ptr<SatPacketClassifier> GetPacketClassifier ();
+
+  /**
+   * \brief Get the channel estimation error container for a new UT. With
+   * the compact stack profile one container is shared by all the UTs.
+   * \return channel estimation error container
+   */
+  Ptr<SatChannelEstimationErrorContainer> GetChannelEstimationErrorContainer ();
+
   SatTypedefs::CarrierBandwidthConverter_t m_carrierBandwidthConverter;
   uint32_t m_fwdLinkCarrierCount;
   Ptr<SatSuperframeSeq> m_superframeSeq;
@@ -233,6 +249,18 @@ private:
    * The used random access model settings
    */
   RandomAccessSettings_s m_raSettings;
+
+  /**
+   * Share the classifier and the CEC between UTs and create the forward link
+   * RX carriers lazily. Set as an attribute.
+   */
+  bool m_compactStack;
+
+  /**
+   * Objects shared by all the UTs with the compact stack profile
+   */
+  Ptr<SatPacketClassifier> m_sharedClassifier;
+  Ptr<SatChannelEstimationErrorContainer> m_sharedCec;
 };
 
 } // namespace ns3
@@ -20,6 +20,8 @@
 
 #include "simulation-helper.h"
 
+#include <fstream>
+
 #include <ns3/log.h>
 #include <ns3/pointer.h>
 #include <ns3/string.h>
@@ -28,8 +30,12 @@
 #include <ns3/singleton.h>
 #include <ns3/enum.h>
 #include <ns3/config.h>
+#include <ns3/global-value.h>
 #include <ns3/config-store.h>
 #include <ns3/satellite-env-variables.h>
+#include <ns3/satellite-mobility-model.h>
+#include <ns3/satellite-constant-position-mobility-model.h>
+#include <ns3/satellite-position-allocator.h>
 
 #include <ns3/packet-sink.h>
 #include <ns3/packet-sink-helper.h>
@@ -85,8 +91,13 @@ SimulationHelper::SimulationHelper ()
 	m_enableInputFileUtListPositions (false),
 	m_inputFileUtPositionsCheckBeams (true),
 	m_gwUserId (0),
+	m_utLayoutLoaded (false),
+	m_utLayoutBeamInfos (),
+	m_utLayoutPositionsByBeam (),
+	m_createdUtPositionsByBeam (),
 	m_progressLoggingEnabled (false),
-	m_progressUpdateInterval (Seconds (0.5))
+	m_progressUpdateInterval (Seconds (0.5)),
+	m_eventAccounting (NULL)
 {
   NS_FATAL_ERROR ("SimulationHelper: Default constructor not in use. Please create with simulation name. ");
 }
@@ -108,8 +119,13 @@ SimulationHelper::SimulationHelper (std::string simulationName)
 	m_enableInputFileUtListPositions (false),
 	m_inputFileUtPositionsCheckBeams (true),
 	m_gwUserId (0),
+	m_utLayoutLoaded (false),
+	m_utLayoutBeamInfos (),
+	m_utLayoutPositionsByBeam (),
+	m_createdUtPositionsByBeam (),
 	m_progressLoggingEnabled (false),
-	m_progressUpdateInterval (Seconds (0.5))
+	m_progressUpdateInterval (Seconds (0.5)),
+	m_eventAccounting (NULL)
 {
   NS_LOG_FUNCTION (this);
 
@@ -133,6 +149,10 @@ SimulationHelper::DoDispose (void)
 
   m_commonUtPositions = NULL;
   m_utPositionsByBeam.clear ();
+  m_utLayoutBeamInfos.clear ();
+  m_utLayoutPositionsByBeam.clear ();
+  m_createdUtPositionsByBeam.clear ();
+  m_eventAccounting = NULL;
 }
 
 void
@@ -535,6 +555,12 @@ void
 SimulationHelper::ProgressCb ()
 {
   std::cout << "Progress: " << Simulator::Now ().GetSeconds () << "/" << GetSimTime ().GetSeconds () << std::endl;
+
+  if (m_eventAccounting != NULL)
+    {
+      std::cout << m_eventAccounting->GetReport ();
+    }
+
   m_progressReportEvent = Simulator::Schedule (m_progressUpdateInterval, &SimulationHelper::ProgressCb, this);
 }
 
@@ -901,14 +927,31 @@ SimulationHelper::CreateSatScenario (SatHelper::PreDefinedScenario_t scenario)
   m_satHelper = CreateObject<SatHelper> (scenarioName);
 
   // Set UT position allocators, if any
-  if (!m_enableInputFileUtListPositions)
+  if (m_utLayoutLoaded)
+    {
+      // UT positions are taken from the loaded layout
+      for (std::map<uint32_t, Ptr<SatListPositionAllocator> >::iterator it = m_utLayoutPositionsByBeam.begin ();
+           it != m_utLayoutPositionsByBeam.end (); ++it)
+        {
+          m_satHelper->SetUtPositionAllocatorForBeam (it->first, it->second);
+        }
+    }
+  else if (!m_enableInputFileUtListPositions)
     {
       if (m_commonUtPositions) m_satHelper->SetCustomUtPositionAllocator (m_commonUtPositions);
       for (auto it : m_utPositionsByBeam) m_satHelper->SetUtPositionAllocatorForBeam (it.first, it.second);
     }
 
   // Determine scenario
-  if (scenario == SatHelper::NONE)
+  if (m_utLayoutLoaded)
+    {
+      // UT/user counts and UT positions come from the loaded layout, thus
+      // neither random draws nor position file parsing is needed
+      ss << "  UT layout loaded: " << m_utLayoutBeamInfos.size () << " beams" << std::endl;
+
+      m_satHelper->CreateUserDefinedScenario (m_utLayoutBeamInfos);
+    }
+  else if (scenario == SatHelper::NONE)
 		{
 			// Create beam scenario
 			SatHelper::BeamUserInfoMap_t beamInfo;
@@ -945,11 +988,157 @@ SimulationHelper::CreateSatScenario (SatHelper::PreDefinedScenario_t scenario)
 			m_satHelper->CreatePredefinedScenario (scenario);
 		}
 
+  // Keep the UT positions drawn at creation for SaveUtLayout, so that the
+  // layout does not depend on how far the UTs have moved when it is saved
+  Ptr<SatBeamHelper> beamHelper = m_satHelper->GetBeamHelper ();
+  std::list<uint32_t> beams = beamHelper->GetBeams ();
+
+  for (std::list<uint32_t>::const_iterator it = beams.begin (); it != beams.end (); ++it)
+    {
+      NodeContainer uts = beamHelper->GetUtNodes (*it);
+      std::vector<GeoCoordinate> & positions = m_createdUtPositionsByBeam[*it];
+
+      for (uint32_t i = 0; i < uts.GetN (); i++)
+        {
+          if (DynamicCast<SatConstantPositionMobilityModel> (uts.Get (i)->GetObject<MobilityModel> ()) != NULL)
+            {
+              positions.push_back (uts.Get (i)->GetObject<SatMobilityModel> ()->GetGeoPosition ());
+            }
+        }
+    }
+
   NS_LOG_INFO (ss.str ());
 
   return m_satHelper;
 }
 
+void
+SimulationHelper::SaveUtLayout (std::string fileName) const
+{
+  NS_LOG_FUNCTION (this << fileName);
+  NS_ASSERT_MSG (m_satHelper != 0, "Satellite scenario not created yet!");
+
+  std::ofstream ofs (fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!ofs.is_open ())
+    {
+      NS_FATAL_ERROR ("SimulationHelper::SaveUtLayout - Unable to open file " << fileName);
+    }
+
+  Ptr<SatBeamHelper> beamHelper = m_satHelper->GetBeamHelper ();
+  Ptr<SatUserHelper> userHelper = m_satHelper->GetUserHelper ();
+  std::list<uint32_t> beams = beamHelper->GetBeams ();
+
+  uint32_t magic = UT_LAYOUT_MAGIC;
+  uint32_t version = UT_LAYOUT_VERSION;
+  uint32_t beamCount = beams.size ();
+
+  ofs.write (reinterpret_cast<const char*> (&magic), sizeof (magic));
+  ofs.write (reinterpret_cast<const char*> (&version), sizeof (version));
+  ofs.write (reinterpret_cast<const char*> (&beamCount), sizeof (beamCount));
+
+  for (std::list<uint32_t>::const_iterator it = beams.begin (); it != beams.end (); ++it)
+    {
+      uint32_t beamId = *it;
+      NodeContainer uts = beamHelper->GetUtNodes (beamId);
+      uint32_t utCount = uts.GetN ();
+
+      ofs.write (reinterpret_cast<const char*> (&beamId), sizeof (beamId));
+      ofs.write (reinterpret_cast<const char*> (&utCount), sizeof (utCount));
+
+      std::map<uint32_t, std::vector<GeoCoordinate> >::const_iterator positions = m_createdUtPositionsByBeam.find (beamId);
+
+      // trajectory driven UTs have no fixed position to store
+      if (positions == m_createdUtPositionsByBeam.end () || positions->second.size () != utCount)
+        {
+          NS_FATAL_ERROR ("SimulationHelper::SaveUtLayout - UTs of beam " << beamId << " do not have constant positions");
+        }
+
+      for (uint32_t i = 0; i < utCount; i++)
+        {
+          const GeoCoordinate & position = positions->second[i];
+          uint32_t userCount = userHelper->GetUtUserCount (uts.Get (i));
+          double coordinates[3] = { position.GetLatitude (), position.GetLongitude (), position.GetAltitude () };
+
+          ofs.write (reinterpret_cast<const char*> (&userCount), sizeof (userCount));
+          ofs.write (reinterpret_cast<const char*> (coordinates), sizeof (coordinates));
+        }
+    }
+
+  if (!ofs.good ())
+    {
+      NS_FATAL_ERROR ("SimulationHelper::SaveUtLayout - Writing file " << fileName << " failed");
+    }
+
+  ofs.close ();
+}
+
+void
+SimulationHelper::LoadUtLayout (std::string fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  NS_ASSERT_MSG (m_satHelper == 0, "Satellite scenario already created!");
+
+  std::ifstream ifs (fileName.c_str (), std::ios::in | std::ios::binary);
+
+  if (!ifs.is_open ())
+    {
+      NS_FATAL_ERROR ("SimulationHelper::LoadUtLayout - Unable to open file " << fileName);
+    }
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint32_t beamCount = 0;
+
+  ifs.read (reinterpret_cast<char*> (&magic), sizeof (magic));
+  ifs.read (reinterpret_cast<char*> (&version), sizeof (version));
+  ifs.read (reinterpret_cast<char*> (&beamCount), sizeof (beamCount));
+
+  if (!ifs.good () || magic != UT_LAYOUT_MAGIC || version != UT_LAYOUT_VERSION)
+    {
+      NS_FATAL_ERROR ("SimulationHelper::LoadUtLayout - " << fileName << " is not a valid UT layout file");
+    }
+
+  m_utLayoutBeamInfos.clear ();
+  m_utLayoutPositionsByBeam.clear ();
+
+  for (uint32_t b = 0; b < beamCount; b++)
+    {
+      uint32_t beamId = 0;
+      uint32_t utCount = 0;
+
+      ifs.read (reinterpret_cast<char*> (&beamId), sizeof (beamId));
+      ifs.read (reinterpret_cast<char*> (&utCount), sizeof (utCount));
+
+      SatBeamUserInfo info;
+      Ptr<SatListPositionAllocator> positions = CreateObject<SatListPositionAllocator> ();
+
+      for (uint32_t i = 0; i < utCount; i++)
+        {
+          uint32_t userCount = 0;
+          double coordinates[3];
+
+          ifs.read (reinterpret_cast<char*> (&userCount), sizeof (userCount));
+          ifs.read (reinterpret_cast<char*> (coordinates), sizeof (coordinates));
+
+          info.AppendUt (userCount);
+          positions->Add (GeoCoordinate (coordinates[0], coordinates[1], coordinates[2]));
+        }
+
+      if (!ifs.good ())
+        {
+          NS_FATAL_ERROR ("SimulationHelper::LoadUtLayout - " << fileName << " is truncated");
+        }
+
+      m_utLayoutBeamInfos.insert (std::make_pair (beamId, info));
+      m_utLayoutPositionsByBeam[beamId] = positions;
+    }
+
+  ifs.close ();
+
+  m_utLayoutLoaded = true;
+}
+
 bool
 SimulationHelper::HasSinkInstalled (Ptr<Node> node, uint16_t port)
 {
@@ -1226,6 +1415,13 @@ void SimulationHelper::RunSimulation ()
   Simulator::Stop (m_simTime);
   Simulator::Run ();
 
+  if (m_eventAccounting != NULL)
+    {
+      std::cout << "Event accounting at " << Simulator::Now ().GetSeconds () << " s:" << std::endl
+                << m_eventAccounting->GetReport ();
+      m_eventAccounting = NULL;
+    }
+
   Simulator::Destroy ();
 }
 
@@ -1258,6 +1454,22 @@ SimulationHelper::DisableProgressLogs ()
   m_progressReportEvent.Cancel ();
 }
 
+void
+SimulationHelper::EnableEventAccounting ()
+{
+  NS_LOG_FUNCTION (this);
+
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::SatAccountingSimulatorImpl"));
+
+  // Creates the simulator implementation, if nothing has been scheduled yet
+  m_eventAccounting = DynamicCast<SatAccountingSimulatorImpl> (Simulator::GetImplementation ());
+
+  if (m_eventAccounting == NULL)
+    {
+      NS_FATAL_ERROR ("SimulationHelper: Event accounting must be enabled before anything is scheduled to the simulator");
+    }
+}
+
 void
 SimulationHelper::ReadInputAttributesFromFile (std::string fileName)
 {
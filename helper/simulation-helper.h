@@ -27,6 +27,7 @@
 #include <ns3/satellite-helper.h>
 #include <ns3/satellite-stats-helper-container.h>
 #include <ns3/satellite-enums.h>
+#include <ns3/satellite-accounting-simulator-impl.h>
 
 namespace ns3 {
 
@@ -290,6 +291,18 @@ public:
    */
   void DisableProgressLogs ();
 
+  /**
+   * \brief Enables counting of scheduled events, executed events and heap
+   * allocations per subsystem (channel, PHY rx carrier, MAC, LLC, schedulers,
+   * fading and stats). The counters are printed to stdout together with the
+   * progress logs, if enabled, and at the end of the simulation.
+   *
+   * The counting is done by SatAccountingSimulatorImpl, so this method must be
+   * called before anything is scheduled to the simulator, i.e. before the
+   * scenario is created.
+   */
+  void EnableEventAccounting ();
+
   /**
    * \brief Add default command line arguments for the simulation.
    * This method must be called between creation of the CommandLine helper and CommandLine::Parse () call.
@@ -393,6 +406,28 @@ public:
    */
   void EnableUtListPositionsFromInputFile (std::string inputFile, bool checkBeams = true);
 
+  /**
+   * \brief Save the UT layout of the created scenario to a compact binary
+   * file. The layout contains the enabled beams, the UT and user counts of
+   * every beam and the UT positions drawn at scenario creation. Only UTs
+   * with constant positions can be stored. You MUST have called
+   * CreateSatScenario before calling this method.
+   * \param fileName Layout file path
+   */
+  void SaveUtLayout (std::string fileName) const;
+
+  /**
+   * \brief Load a UT layout stored earlier with SaveUtLayout. The next
+   * CreateSatScenario call uses the stored beams, UT/user counts and UT
+   * positions instead of drawing them again or parsing a position file.
+   * The rest of the scenario (antenna patterns, link results, nodes,
+   * routing) is created as usual. The enabled beams and the UT position
+   * allocators configured to this helper are kept, but they are not used
+   * while a layout is loaded. Must be called before CreateSatScenario.
+   * \param fileName Layout file path
+   */
+  void LoadUtLayout (std::string fileName);
+
   /**
    * \brief If lower layer API access is required, use this to access SatHelper.
    * You MUST have called CreateSatScenario before calling this method.
@@ -523,6 +558,12 @@ protected:
    */
   bool HasSinkInstalled (Ptr<Node> node, uint16_t port);
 
+  /**
+   * \brief Magic number and version identifying a UT layout file.
+   */
+  static const uint32_t UT_LAYOUT_MAGIC = 0x534E5333; // "SNS3"
+  static const uint32_t UT_LAYOUT_VERSION = 1;
+
   /**
    * \brief Check if output path has been set. If not, then create a default
    * output directory inside satellite/data/sims/campaign-name/tag-name.
@@ -549,10 +590,16 @@ private:
   bool                         m_enableInputFileUtListPositions;
   bool                         m_inputFileUtPositionsCheckBeams;
   uint32_t                     m_gwUserId;
+  bool                         m_utLayoutLoaded;
+  SatHelper::BeamUserInfoMap_t m_utLayoutBeamInfos;
+  std::map<uint32_t, Ptr<SatListPositionAllocator> > m_utLayoutPositionsByBeam;
+  std::map<uint32_t, std::vector<GeoCoordinate> > m_createdUtPositionsByBeam;
 
   bool                         m_progressLoggingEnabled;
   Time 												 m_progressUpdateInterval;
   EventId                      m_progressReportEvent;
+
+  Ptr<SatAccountingSimulatorImpl> m_eventAccounting;
 };
 
 } // namespace ns3
@@ -50,6 +50,7 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
    */
   std::string dataPath = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory ();
   std::string path = dataPath + "/antennapatterns/SatAntennaGain72Beams_";
+  Ptr<SatParallelLoader> loader = Create<SatParallelLoader> ();
 
   // Note, that the beam ids start from 1
   for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
@@ -57,7 +58,7 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
       std::ostringstream ss;
       ss << i;
       std::string filePathName = path + ss.str () + ".txt";
-      Ptr<SatAntennaGainPattern> gainPattern = CreateObject<SatAntennaGainPattern> (filePathName);
+      Ptr<SatAntennaGainPattern> gainPattern = CreateObject<SatAntennaGainPattern> (filePathName, loader);
 
       std::pair<std::map<uint32_t,Ptr<SatAntennaGainPattern> >::iterator, bool> ret;
       ret = m_antennaPatternMap.insert (std::pair<uint32_t, Ptr<SatAntennaGainPattern> > (i, gainPattern));
@@ -67,6 +68,9 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer ()
           NS_FATAL_ERROR (this << " an antenna pattern for beam " << i << " already exists!");
         }
     }
+
+  // The patterns are created above in beam order, only the files are parsed concurrently
+  loader->Run ();
 }
 
 Ptr<SatAntennaGainPattern>
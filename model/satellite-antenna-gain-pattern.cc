@@ -86,10 +86,21 @@ SatAntennaGainPattern::SatAntennaGainPattern (std::string filePathName)
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
 }
 
+SatAntennaGainPattern::SatAntennaGainPattern (std::string filePathName, Ptr<SatParallelLoader> loader)
+  : m_nanStrings (m_nanStringArray, m_nanStringArray + (sizeof m_nanStringArray / sizeof m_nanStringArray[0]))
+{
+  NS_LOG_FUNCTION (this << filePathName);
+
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+
+  loader->Add (MakeCallback (&SatAntennaGainPattern::ReadAntennaPatternFromFile, this), filePathName);
+  m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+}
+
 
 void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName)
 {
-  NS_LOG_FUNCTION (this << filePathName);
+  // No logging here, as the file may be parsed on a thread of SatParallelLoader
 
   // READ FROM THE SPECIFIED INPUT FILE
   std::ifstream *ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
@@ -25,6 +25,7 @@
 #include <fstream>
 #include "ns3/random-variable-stream.h"
 #include "ns3/object.h"
+#include "ns3/satellite-parallel-loader.h"
 #include "geo-coordinate.h"
 
 namespace ns3 {
@@ -71,6 +72,15 @@ public:
    * \param filePathName 
    */
   SatAntennaGainPattern (std::string filePathName);
+
+  /**
+   * Constructor, which registers the antenna pattern file to be parsed by
+   * the given loader. The pattern can be used only after the loader has been
+   * run.
+   * \param filePathName
+   * \param loader the loader parsing the file
+   */
+  SatAntennaGainPattern (std::string filePathName, Ptr<SatParallelLoader> loader);
   ~SatAntennaGainPattern ()
   {
   }
@@ -89,7 +99,8 @@ public:
 
 private:
   /**
-   * \brief Read the antenna gain pattern from a file
+   * \brief Read the antenna gain pattern from a file. Does not log, as it
+   * may be run on a thread of SatParallelLoader.
    * \param filePathName Path and file name of the antenna pattern file
    */
   void ReadAntennaPatternFromFile (std::string filePathName);
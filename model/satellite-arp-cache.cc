@@ -66,6 +66,19 @@ SatArpCache::Add (Ipv4Address to, Address macAddress)
   return entry;
 }
 
+void
+SatArpCache::AddEntries (const IpMacTable_t &table)
+{
+  NS_LOG_FUNCTION (this << table.size ());
+
+  for (IpMacTable_t::const_iterator it = table.begin (); it != table.end (); ++it)
+    {
+      ArpCache::Entry *entry = ArpCache::Add (it->first);
+      entry->SetMacAddresss (it->second);
+      entry->MarkPermanent ();
+    }
+}
+
 
 
 } // namespace ns3
@@ -21,6 +21,7 @@
 #ifndef SATELLITE_ARP_CACHE_H
 #define SATELLITE_ARP_CACHE_H
 
+#include <vector>
 #include "ns3/arp-cache.h"
 
 namespace ns3 {
@@ -36,6 +37,11 @@ class SatArpCache : public ArpCache
 {
 public:
 
+  /**
+   * Precomputed table of IPv4 address - MAC address entries
+   */
+  typedef std::vector<std::pair<Ipv4Address, Address> > IpMacTable_t;
+
   /**
    * \brief Get the type ID
    * \return the object TypeId
@@ -59,6 +65,13 @@ public:
    * \return ArpCache entry
    */
   ArpCache::Entry * Add (Ipv4Address to, Address macAddress);
+
+  /**
+   * \brief Add all the entries of a precomputed IPv4 address - MAC address
+   * table to this ARP cache
+   * \param table IP to MAC table
+   */
+  void AddEntries (const IpMacTable_t &table);
 };
 
 
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "satellite-arq-buffer-ring.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatArqBufferRing");
+
+namespace ns3 {
+
+SatArqBufferRing::SatArqBufferRing (uint32_t capacity)
+  : m_slots (capacity),
+    m_occupied ((capacity + 63) / 64, 0),
+    m_freeContexts (),
+    m_count (0)
+{
+  NS_LOG_FUNCTION (this << capacity);
+
+  if (capacity == 0)
+    {
+      NS_FATAL_ERROR ("ARQ buffer ring capacity must be larger than zero!");
+    }
+}
+
+void
+SatArqBufferRing::Reserve (uint32_t count)
+{
+  NS_LOG_FUNCTION (this << count);
+
+  while (m_freeContexts.size () < count)
+    {
+      m_freeContexts.push_back (CreateObject<SatArqBufferContext> ());
+    }
+}
+
+Ptr<SatArqBufferContext>
+SatArqBufferRing::AllocateContext ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_freeContexts.empty ())
+    {
+      return CreateObject<SatArqBufferContext> ();
+    }
+
+  Ptr<SatArqBufferContext> context = m_freeContexts.back ();
+  m_freeContexts.pop_back ();
+  return context;
+}
+
+void
+SatArqBufferRing::RecycleContext (Ptr<SatArqBufferContext> context)
+{
+  NS_LOG_FUNCTION (this << context);
+
+  // Dispose releases the PDU and cancels the timer, the rest is reset here
+  context->DoDispose ();
+  context->m_seqNo = 0;
+  context->m_retransmissionCount = 0;
+  context->m_rxStatus = false;
+
+  m_freeContexts.push_back (context);
+}
+
+void
+SatArqBufferRing::Insert (uint32_t seqNo, Ptr<SatArqBufferContext> context)
+{
+  NS_LOG_FUNCTION (this << seqNo << context);
+
+  uint32_t slot = GetSlot (seqNo);
+
+  if (m_slots[slot])
+    {
+      NS_FATAL_ERROR ("ARQ buffer slot for SN: " << seqNo << " already in use by SN: " << m_slots[slot]->m_seqNo << "!");
+    }
+
+  m_slots[slot] = context;
+  m_occupied[slot / 64] |= ((uint64_t) 1 << (slot % 64));
+  ++m_count;
+}
+
+Ptr<SatArqBufferContext>
+SatArqBufferRing::Find (uint32_t seqNo) const
+{
+  NS_LOG_FUNCTION (this << seqNo);
+
+  Ptr<SatArqBufferContext> context = m_slots[GetSlot (seqNo)];
+
+  if (context && context->m_seqNo == seqNo)
+    {
+      return context;
+    }
+
+  return NULL;
+}
+
+Ptr<SatArqBufferContext>
+SatArqBufferRing::Erase (uint32_t seqNo)
+{
+  NS_LOG_FUNCTION (this << seqNo);
+
+  uint32_t slot = GetSlot (seqNo);
+  Ptr<SatArqBufferContext> context = m_slots[slot];
+
+  if (!context || context->m_seqNo != seqNo)
+    {
+      return NULL;
+    }
+
+  m_slots[slot] = NULL;
+  m_occupied[slot / 64] &= ~((uint64_t) 1 << (slot % 64));
+  --m_count;
+
+  return context;
+}
+
+Ptr<SatArqBufferContext>
+SatArqBufferRing::GetFirst () const
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t i = 0; i < m_occupied.size (); ++i)
+    {
+      uint64_t word = m_occupied[i];
+
+      if (word != 0)
+        {
+          uint32_t bit = 0;
+
+          while ((word & 1) == 0)
+            {
+              word >>= 1;
+              ++bit;
+            }
+
+          return m_slots[i * 64 + bit];
+        }
+    }
+
+  return NULL;
+}
+
+void
+SatArqBufferRing::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  for (std::vector<Ptr<SatArqBufferContext> >::iterator it = m_slots.begin (); it != m_slots.end (); ++it)
+    {
+      if (*it)
+        {
+          (*it)->DoDispose ();
+          *it = NULL;
+        }
+    }
+
+  for (std::vector<Ptr<SatArqBufferContext> >::iterator it = m_freeContexts.begin (); it != m_freeContexts.end (); ++it)
+    {
+      (*it)->DoDispose ();
+    }
+
+  m_freeContexts.clear ();
+  std::fill (m_occupied.begin (), m_occupied.end (), 0);
+  m_count = 0;
+}
+
+} // namespace ns3
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_ARQ_BUFFER_RING_H_
+#define SATELLITE_ARQ_BUFFER_RING_H_
+
+#include <vector>
+#include <stdint.h>
+#include "ns3/ptr.h"
+#include "satellite-arq-buffer-context.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief ARQ buffer storing SatArqBufferContexts in a ring of slots indexed
+ * by the sequence number modulo the ring capacity. Since the sequence numbers
+ * in use are bounded by the ARQ window, the contexts can be accessed, added
+ * and removed in constant time. Released contexts are recycled for later
+ * PDUs instead of allocating a new context for each PDU.
+ *
+ * The sequence numbers stored simultaneously in the ring must map to
+ * different slots, i.e. their span has to be smaller than the capacity.
+ */
+class SatArqBufferRing
+{
+public:
+  /**
+   * Default ring capacity, covering the whole 8-bit sequence number space
+   */
+  static const uint32_t DEFAULT_CAPACITY = 256;
+
+  /**
+   * \brief Constructor
+   * \param capacity Number of slots in the ring
+   */
+  SatArqBufferRing (uint32_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * \brief Preallocate contexts to be used with the ring
+   * \param count Number of contexts to preallocate
+   */
+  void Reserve (uint32_t count);
+
+  /**
+   * \brief Get a context either from the recycled ones or a new one.
+   * \return Context with default values
+   */
+  Ptr<SatArqBufferContext> AllocateContext ();
+
+  /**
+   * \brief Dispose a context and keep it for reuse
+   * \param context Context to recycle
+   */
+  void RecycleContext (Ptr<SatArqBufferContext> context);
+
+  /**
+   * \brief Add a context to the ring
+   * \param seqNo Sequence number of the context
+   * \param context Context to add
+   */
+  void Insert (uint32_t seqNo, Ptr<SatArqBufferContext> context);
+
+  /**
+   * \brief Find a context with a sequence number
+   * \param seqNo Sequence number
+   * \return Context or NULL if not found
+   */
+  Ptr<SatArqBufferContext> Find (uint32_t seqNo) const;
+
+  /**
+   * \brief Remove a context from the ring without disposing it
+   * \param seqNo Sequence number
+   * \return Removed context or NULL if not found
+   */
+  Ptr<SatArqBufferContext> Erase (uint32_t seqNo);
+
+  /**
+   * \brief Get the context in the lowest occupied slot. When the capacity
+   * covers the whole sequence number space, this is the context with the
+   * lowest sequence number.
+   * \return Context or NULL if the ring is empty
+   */
+  Ptr<SatArqBufferContext> GetFirst () const;
+
+  /**
+   * \brief Check whether the ring is empty
+   * \return true if there are no contexts in the ring
+   */
+  inline bool IsEmpty () const
+  {
+    return m_count == 0;
+  }
+
+  /**
+   * \brief Get the number of contexts in the ring
+   * \return Number of contexts
+   */
+  inline uint32_t GetN () const
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Dispose all the contexts of the ring, including the recycled ones
+   */
+  void Clear ();
+
+private:
+  /**
+   * \brief Get the slot of a sequence number
+   * \param seqNo Sequence number
+   * \return Slot index
+   */
+  inline uint32_t GetSlot (uint32_t seqNo) const
+  {
+    return seqNo % m_slots.size ();
+  }
+
+  /**
+   * Contexts by slot
+   */
+  std::vector<Ptr<SatArqBufferContext> > m_slots;
+
+  /**
+   * Bitmap of the occupied slots, used for finding the first context
+   */
+  std::vector<uint64_t> m_occupied;
+
+  /**
+   * Recycled contexts
+   */
+  std::vector<Ptr<SatArqBufferContext> > m_freeContexts;
+
+  /**
+   * Number of contexts in the ring
+   */
+  uint32_t m_count;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_ARQ_BUFFER_RING_H_ */
@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "satellite-const-variables.h"
+#include "satellite-background-load.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatBackgroundLoad");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBackgroundLoad);
+
+TypeId
+SatBackgroundLoad::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatBackgroundLoad")
+    .SetParent<Object> ()
+    .AddConstructor<SatBackgroundLoad> ()
+    .AddAttribute ("MeanRate",
+                   "Mean rate of the aggregate demand of the background terminals.",
+                   DataRateValue (DataRate ("0bps")),
+                   MakeDataRateAccessor (&SatBackgroundLoad::m_meanRate),
+                   MakeDataRateChecker ())
+    .AddAttribute ("RateVariation",
+                   "Random variable for the multiplier of the mean rate drawn every update interval.",
+                   StringValue ("ns3::ConstantRandomVariable[Constant=1.0]"),
+                   MakePointerAccessor (&SatBackgroundLoad::m_rateVariation),
+                   MakePointerChecker<RandomVariableStream> ())
+    .AddAttribute ("UpdateInterval",
+                   "Interval for drawing a new rate and for measuring the activity of the load.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&SatBackgroundLoad::m_updateInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxBacklog",
+                   "Maximum backlog expressed as the time to accumulate it with the mean rate.",
+                   TimeValue (MilliSeconds (500)),
+                   MakeTimeAccessor (&SatBackgroundLoad::m_maxBacklog),
+                   MakeTimeChecker ())
+    .AddAttribute ("InterferenceWrtNoisePercent",
+                   "Interference caused to the co-channel receivers of other beams at full activity, "
+                   "in percents of the noise power of the receiver.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatBackgroundLoad::m_interferenceWrtNoisePercent),
+                   MakeDoubleChecker<double> (0.0))
+    .AddTraceSource ("Rate",
+                     "A new rate drawn for the background demand",
+                     MakeTraceSourceAccessor (&SatBackgroundLoad::m_rateTrace),
+                     "ns3::SatBackgroundLoad::RateTraceCallback")
+    .AddTraceSource ("Drop",
+                     "Background demand dropped due to the backlog limit",
+                     MakeTraceSourceAccessor (&SatBackgroundLoad::m_dropTrace),
+                     "ns3::SatBackgroundLoad::DropTraceCallback")
+  ;
+  return tid;
+}
+
+SatBackgroundLoad::SatBackgroundLoad ()
+  : m_meanRate (DataRate ("0bps")),
+    m_updateInterval (Seconds (1.0)),
+    m_maxBacklog (MilliSeconds (500)),
+    m_interferenceWrtNoisePercent (0.0),
+    m_rate (0.0),
+    m_backlogInBytes (0.0),
+    m_lastUpdate (Seconds (0)),
+    m_intervalStart (Seconds (0)),
+    m_busyTime (Seconds (0)),
+    m_activity (0.0),
+    m_rateDrawn (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatBackgroundLoad::~SatBackgroundLoad ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatBackgroundLoad::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_interferers.clear ();
+  m_rateVariation = 0;
+
+  Object::DoDispose ();
+}
+
+double
+SatBackgroundLoad::GetRate ()
+{
+  Update ();
+  return m_rate;
+}
+
+uint32_t
+SatBackgroundLoad::GetBacklogInBytes ()
+{
+  Update ();
+  return (uint32_t) m_backlogInBytes;
+}
+
+uint32_t
+SatBackgroundLoad::Serve (uint32_t capacityInBytes, Time duration)
+{
+  NS_LOG_FUNCTION (this << capacityInBytes << duration.GetSeconds ());
+
+  Update ();
+
+  uint32_t servedBytes = std::min<uint32_t> (capacityInBytes, (uint32_t) m_backlogInBytes);
+
+  if (servedBytes > 0)
+    {
+      m_backlogInBytes -= servedBytes;
+      m_busyTime += Seconds (duration.GetSeconds () * servedBytes / capacityInBytes);
+    }
+
+  NS_LOG_INFO ("Served " << servedBytes << " bytes, backlog left " << m_backlogInBytes << " bytes");
+
+  return servedBytes;
+}
+
+Time
+SatBackgroundLoad::GetTimeToBacklog (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  Update ();
+
+  if (m_backlogInBytes >= bytes)
+    {
+      return Seconds (0);
+    }
+
+  Time intervalLeft = m_intervalStart + m_updateInterval - Simulator::Now ();
+
+  if (m_rate <= 0.0)
+    {
+      return intervalLeft;
+    }
+
+  // rounded up by a time step, so that the backlog is reached at the returned time
+  Time fillTime = Seconds ((bytes - m_backlogInBytes) * SatConstVariables::BITS_PER_BYTE / m_rate) + TimeStep (1);
+
+  return std::min (fillTime, intervalLeft);
+}
+
+double
+SatBackgroundLoad::GetActivity ()
+{
+  Update ();
+  return m_activity;
+}
+
+void
+SatBackgroundLoad::AddInterferer (Ptr<SatBackgroundLoad> interferer)
+{
+  NS_LOG_FUNCTION (this << interferer);
+  NS_ASSERT (interferer != this);
+
+  m_interferers.push_back (PeekPointer (interferer));
+}
+
+double
+SatBackgroundLoad::GetInterferenceWrtNoise ()
+{
+  double interference = 0.0;
+
+  for (std::vector<SatBackgroundLoad *>::const_iterator it = m_interferers.begin ();
+       it != m_interferers.end ();
+       ++it)
+    {
+      interference += (*it)->GetActivity () * (*it)->m_interferenceWrtNoisePercent / 100.0;
+    }
+
+  return interference;
+}
+
+void
+SatBackgroundLoad::Update ()
+{
+  Time now = Simulator::Now ();
+
+  if (!m_rateDrawn)
+    {
+      m_rate = std::max (0.0, m_meanRate.GetBitRate () * m_rateVariation->GetValue ());
+      m_rateDrawn = true;
+      m_rateTrace (m_rate);
+    }
+
+  // close the update intervals passed since the last update
+  while (now >= m_intervalStart + m_updateInterval)
+    {
+      Time intervalEnd = m_intervalStart + m_updateInterval;
+
+      AddDemand (intervalEnd);
+
+      m_activity = std::min (1.0, m_busyTime.GetSeconds () / m_updateInterval.GetSeconds ());
+      m_busyTime = Seconds (0);
+      m_intervalStart = intervalEnd;
+
+      m_rate = std::max (0.0, m_meanRate.GetBitRate () * m_rateVariation->GetValue ());
+      m_rateTrace (m_rate);
+
+      NS_LOG_INFO ("New rate " << m_rate << " bps, activity of the last interval " << m_activity);
+    }
+
+  AddDemand (now);
+}
+
+void
+SatBackgroundLoad::AddDemand (Time time)
+{
+  if (time > m_lastUpdate)
+    {
+      m_backlogInBytes += m_rate * (time - m_lastUpdate).GetSeconds () / SatConstVariables::BITS_PER_BYTE;
+      m_lastUpdate = time;
+
+      double maxBacklogInBytes = m_meanRate.GetBitRate () * m_maxBacklog.GetSeconds () / SatConstVariables::BITS_PER_BYTE;
+
+      if (m_backlogInBytes > maxBacklogInBytes)
+        {
+          m_dropTrace ((uint32_t) (m_backlogInBytes - maxBacklogInBytes));
+          m_backlogInBytes = maxBacklogInBytes;
+        }
+    }
+}
+
+} // namespace ns3
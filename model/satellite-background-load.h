@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BACKGROUND_LOAD_H
+#define SATELLITE_BACKGROUND_LOAD_H
+
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+#include "ns3/traced-callback.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Flow level model of the aggregate traffic of the background
+ * terminals of a beam in one link direction. The background terminals are
+ * not simulated as nodes; their demand is a fluid, which arrives with a
+ * piecewise constant rate and is queued into a backlog. A new rate is drawn
+ * every UpdateInterval as MeanRate multiplied by a sample of RateVariation.
+ *
+ * The backlog is served by the scheduler of the beam, i.e. SatFwdLinkScheduler
+ * in the forward link and SatBeamScheduler in the return link, which reserve
+ * the served capacity from the packet level terminals. The demand exceeding
+ * MaxBacklog is dropped.
+ *
+ * The fraction of time the background load kept the capacity busy during the
+ * last completed update interval is the activity of the load. The activity
+ * scaled with InterferenceWrtNoisePercent is the interference the load causes
+ * to the co-channel receivers of the other beams, see
+ * GetInterferenceWrtNoise.
+ *
+ * The model is evaluated lazily when it is queried, so it does not schedule
+ * any events.
+ */
+class SatBackgroundLoad : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Default constructor.
+   */
+  SatBackgroundLoad ();
+
+  /**
+   * Destructor for SatBackgroundLoad.
+   */
+  ~SatBackgroundLoad ();
+
+  /**
+   * \brief Get the current rate of the background demand.
+   * \return rate in bits per second
+   */
+  double GetRate ();
+
+  /**
+   * \brief Get the background demand waiting for service.
+   * \return backlog in bytes
+   */
+  uint32_t GetBacklogInBytes ();
+
+  /**
+   * \brief Serve the backlog in a transmission opportunity.
+   * \param capacityInBytes capacity of the transmission opportunity
+   * \param duration duration of the transmission opportunity
+   * \return served bytes, at most capacityInBytes
+   */
+  uint32_t Serve (uint32_t capacityInBytes, Time duration);
+
+  /**
+   * \brief Get the fraction of time the background load kept the capacity
+   * busy during the last completed update interval.
+   * \return activity between 0 and 1
+   */
+  double GetActivity ();
+
+  /**
+   * \brief Get the time until the backlog reaches the given amount with the
+   * current rate. As the rate is redrawn at the end of the update interval,
+   * the time is limited to the end of the current interval.
+   * \param bytes amount of the backlog in bytes
+   * \return time until the backlog is reached or the update interval ends,
+   * zero if the backlog is reached already
+   */
+  Time GetTimeToBacklog (uint32_t bytes);
+
+  /**
+   * \brief Add a background load, whose transmissions interfere with the
+   * receivers this load is associated with. The loads of co-channel beams
+   * interfere with each other, so the interferer is not referenced to avoid
+   * reference cycles. The owner of the loads has to keep the interferer
+   * alive as long as this load, or dispose this load first.
+   * \param interferer interfering background load
+   */
+  void AddInterferer (Ptr<SatBackgroundLoad> interferer);
+
+  /**
+   * \brief Get the interference caused by the interfering background loads.
+   * \return interference power relative to the noise power of the receiver
+   */
+  double GetInterferenceWrtNoise ();
+
+  /**
+   * \brief Callback signature for `Rate` trace source.
+   * \param rate the new rate of the background demand in bits per second
+   */
+  typedef void (* RateTraceCallback)(double rate);
+
+  /**
+   * \brief Callback signature for `Drop` trace source.
+   * \param bytes the amount of dropped background demand in bytes
+   */
+  typedef void (* DropTraceCallback)(uint32_t bytes);
+
+private:
+  /**
+   * Dispose of this class instance
+   */
+  void DoDispose ();
+
+  /**
+   * \brief Advance the demand process to the current time.
+   */
+  void Update ();
+
+  /**
+   * \brief Add demand arrived with the current rate until the given time.
+   * \param time end of the arrival period
+   */
+  void AddDemand (Time time);
+
+  DataRate m_meanRate;
+  Ptr<RandomVariableStream> m_rateVariation;
+  Time m_updateInterval;
+  Time m_maxBacklog;
+  double m_interferenceWrtNoisePercent;
+
+  /**
+   * Current rate of the demand in bits per second.
+   */
+  double m_rate;
+
+  /**
+   * Demand waiting for service in bytes.
+   */
+  double m_backlogInBytes;
+
+  /**
+   * Time until the demand has been added to the backlog.
+   */
+  Time m_lastUpdate;
+
+  /**
+   * Start time of the current update interval.
+   */
+  Time m_intervalStart;
+
+  /**
+   * Time the capacity was used by the load during the current update interval.
+   */
+  Time m_busyTime;
+
+  /**
+   * Activity of the last completed update interval.
+   */
+  double m_activity;
+
+  /**
+   * Flag indicating that the rate of the first update interval has been drawn.
+   */
+  bool m_rateDrawn;
+
+  /**
+   * Interfering background loads, not referenced, see AddInterferer.
+   */
+  std::vector<SatBackgroundLoad *> m_interferers;
+
+  TracedCallback<double> m_rateTrace;
+  TracedCallback<uint32_t> m_dropTrace;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_BACKGROUND_LOAD_H */
@@ -22,7 +22,7 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "satellite-queue.h"
-#include "satellite-time-tag.h"
+#include "satellite-metadata-tag.h"
 #include "satellite-mac-tag.h"
 #include "satellite-base-encapsulator.h"
 
@@ -73,12 +73,14 @@ void
 SatBaseEncapsulator::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_queueSizeChangeCallback.Nullify ();
   if (m_txQueue)
     {
       m_txQueue->DoDispose ();
     }
   m_rxCallback.Nullify ();
   m_ctrlCallback.Nullify ();
+  m_txDataAvailableCallback.Nullify ();
 }
 
 void
@@ -204,10 +206,10 @@ SatBaseEncapsulator::GetHolDelay () const
       // Peek the first PDU from the buffer.
       Ptr<const Packet> peekPacket = m_txQueue->Peek ();
 
-      SatTimeTag timeTag;
-      peekPacket->PeekPacketTag (timeTag);
+      SatMetadataTag metadataTag;
+      peekPacket->PeekPacketTag (metadataTag);
 
-      delay = Simulator::Now () - timeTag.GetSenderTimestamp ();
+      delay = Simulator::Now () - metadataTag.GetTimestamp (SatMetadataTag::TS_LLC);
     }
   return delay;
 }
@@ -228,12 +230,72 @@ SatBaseEncapsulator::SetCtrlMsgCallback (SatBaseEncapsulator::SendCtrlCallback c
   m_ctrlCallback = cb;
 }
 
+void
+SatBaseEncapsulator::SetTxDataAvailableCallback (SatBaseEncapsulator::TxDataAvailableCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+
+  m_txDataAvailableCallback = cb;
+}
+
+void
+SatBaseEncapsulator::SetQueueSizeChangeCallback (SatBaseEncapsulator::QueueSizeChangeCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+
+  // the queue is traced only when somebody is interested in the changes
+  bool connect = m_queueSizeChangeCallback.IsNull () && !cb.IsNull () && (m_txQueue != 0);
+
+  m_queueSizeChangeCallback = cb;
+
+  if (connect)
+    {
+      ConnectQueueTraces ();
+    }
+}
+
 void
 SatBaseEncapsulator::SetQueue (Ptr<SatQueue> queue)
 {
   NS_LOG_FUNCTION (this);
 
   m_txQueue = queue;
+
+  if (!m_queueSizeChangeCallback.IsNull ())
+    {
+      ConnectQueueTraces ();
+    }
+}
+
+void
+SatBaseEncapsulator::ConnectQueueTraces ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_txQueue->TraceConnectWithoutContext ("BytesInQueue",
+                                         MakeCallback (&SatBaseEncapsulator::QueueBytesChanged, this));
+  m_txQueue->TraceConnectWithoutContext ("PacketsInQueue",
+                                         MakeCallback (&SatBaseEncapsulator::QueuePacketsChanged, this));
+}
+
+void
+SatBaseEncapsulator::QueueBytesChanged (uint32_t oldValue, uint32_t newValue)
+{
+  if (!m_queueSizeChangeCallback.IsNull ())
+    {
+      m_queueSizeChangeCallback (m_sourceAddress, m_destAddress,
+                                 static_cast<int32_t> (newValue - oldValue), 0);
+    }
+}
+
+void
+SatBaseEncapsulator::QueuePacketsChanged (uint32_t oldValue, uint32_t newValue)
+{
+  if (!m_queueSizeChangeCallback.IsNull ())
+    {
+      m_queueSizeChangeCallback (m_sourceAddress, m_destAddress,
+                                 0, static_cast<int32_t> (newValue - oldValue));
+    }
 }
 
 Ptr<SatQueue>
@@ -96,6 +96,21 @@ public:
    */
   typedef Callback<bool, Ptr<SatControlMessage>, const Address& > SendCtrlCallback;
 
+  /**
+   * Callback to notify that new data became available for transmission
+   * without a new PDU being enqueued, e.g. due to ARQ retransmission.
+   */
+  typedef Callback<void> TxDataAvailableCallback;
+
+  /**
+   * Callback to notify about a change in the size of the transmission queue.
+   * \param Mac48Address Source MAC address
+   * \param Mac48Address Destination MAC address
+   * \param int32_t Change in the number of bytes in queue
+   * \param int32_t Change in the number of packets in queue
+   */
+  typedef Callback<void, Mac48Address, Mac48Address, int32_t, int32_t> QueueSizeChangeCallback;
+
   /**
    * Set the used queue from outside
    * \param queue Transmission queue
@@ -120,6 +135,17 @@ public:
    */
   void SetCtrlMsgCallback (SatBaseEncapsulator::SendCtrlCallback cb);
 
+  /**
+   * \param cb callback to notify about data becoming available for transmission.
+   */
+  void SetTxDataAvailableCallback (SatBaseEncapsulator::TxDataAvailableCallback cb);
+
+  /**
+   * The queue is traced for the changes only after a callback is set.
+   * \param cb callback to notify about changes in the size of the queue.
+   */
+  void SetQueueSizeChangeCallback (SatBaseEncapsulator::QueueSizeChangeCallback cb);
+
   /**
    * Enqueue a packet to txBuffer.
    * \param p To be buffered packet
@@ -200,6 +226,36 @@ protected:
   */
   SendCtrlCallback m_ctrlCallback;
 
+  /**
+   * Callback to notify about data becoming available for transmission.
+   */
+  TxDataAvailableCallback m_txDataAvailableCallback;
+
+  /**
+   * Callback to notify about changes in the size of the queue.
+   */
+  QueueSizeChangeCallback m_queueSizeChangeCallback;
+
+private:
+  /**
+   * Connect the size trace sources of the queue to the sinks below.
+   */
+  void ConnectQueueTraces ();
+
+  /**
+   * Sink for the BytesInQueue trace source of the queue.
+   * \param oldValue number of bytes before the change
+   * \param newValue number of bytes after the change
+   */
+  void QueueBytesChanged (uint32_t oldValue, uint32_t newValue);
+
+  /**
+   * Sink for the PacketsInQueue trace source of the queue.
+   * \param oldValue number of packets before the change
+   * \param newValue number of packets after the change
+   */
+  void QueuePacketsChanged (uint32_t oldValue, uint32_t newValue);
+
 };
 
 
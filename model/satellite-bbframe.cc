@@ -33,7 +33,8 @@ SatBbFrame::SatBbFrame ()
     m_freeSpaceInBytes (0),
     m_maxSpaceInBytes (0),
     m_headerSizeInBytes (0),
-    m_frameType (SatEnums::NORMAL_FRAME)
+    m_frameType (SatEnums::NORMAL_FRAME),
+    m_isBackgroundFrame (false)
 {
   NS_LOG_FUNCTION (this);
   NS_FATAL_ERROR ("Default constructor of SatBbFrame not supported.");
@@ -42,7 +43,8 @@ SatBbFrame::SatBbFrame ()
 
 SatBbFrame::SatBbFrame (SatEnums::SatModcod_t modCod, SatEnums::SatBbFrameType_t type, Ptr<SatBbFrameConf> conf)
   : m_modCod (modCod),
-    m_frameType (type)
+    m_frameType (type),
+    m_isBackgroundFrame (false)
 {
   NS_LOG_FUNCTION (this << modCod << type);
 
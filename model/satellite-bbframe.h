@@ -183,6 +183,24 @@ public:
     return m_headerSizeInBytes;
   }
 
+  /**
+   * Mark the frame as reserved for the background load. A background frame
+   * carries no packets and is not sent, but it keeps the carrier busy.
+   */
+  inline void SetBackgroundFrame ()
+  {
+    m_isBackgroundFrame = true;
+  }
+
+  /**
+   * Check whether the frame is reserved for the background load.
+   * \return true if the frame is a background frame
+   */
+  inline bool IsBackgroundFrame () const
+  {
+    return m_isBackgroundFrame;
+  }
+
   /**
    * Callback signature for Ptr<SatBbFrame>.
    * \param bbFrame The BB frame.
@@ -205,6 +223,7 @@ private:
   SatBbFramePayload_t m_framePayload;
   Time m_duration;
   SatEnums::SatBbFrameType_t m_frameType;
+  bool m_isBackgroundFrame;
 };
 
 } // namespace ns3
@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "satellite-beam-interference-matrix.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatBeamInterferenceMatrix");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBeamInterferenceMatrix);
+
+TypeId
+SatBeamInterferenceMatrix::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatBeamInterferenceMatrix")
+    .SetParent<Object> ()
+    .AddConstructor<SatBeamInterferenceMatrix> ()
+    .AddAttribute ("TxHistoryLength",
+                   "Time the transmissions of the beams are kept for computing the activity of the beams. "
+                   "Has to exceed the propagation delay from the satellite to the receivers.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&SatBeamInterferenceMatrix::m_txHistoryLength),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+TypeId
+SatBeamInterferenceMatrix::GetInstanceTypeId (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetTypeId ();
+}
+
+SatBeamInterferenceMatrix::SatBeamInterferenceMatrix ()
+  : m_txHistoryLength (Seconds (1.0))
+{
+  NS_LOG_FUNCTION (this);
+
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+}
+
+SatBeamInterferenceMatrix::~SatBeamInterferenceMatrix ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Reset ();
+}
+
+void
+SatBeamInterferenceMatrix::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Reset ();
+
+  Object::DoDispose ();
+}
+
+void
+SatBeamInterferenceMatrix::AddBeam (uint32_t beamId, uint32_t freqId, Ptr<SatAntennaGainPattern> pattern)
+{
+  NS_LOG_FUNCTION (this << beamId << freqId << pattern);
+
+  BeamInfo_t beamInfo;
+  beamInfo.m_freqId = freqId;
+  beamInfo.m_pattern = pattern;
+
+  std::pair<std::map<uint32_t, BeamInfo_t>::iterator, bool> result = m_beams.insert (std::make_pair (beamId, beamInfo));
+
+  if (!result.second)
+    {
+      NS_FATAL_ERROR ("Beam " << beamId << " already added to interference matrix.");
+    }
+
+  const BeamInfo_t *beam = &result.first->second;
+
+  for (std::map<Address, ReceiverInfo_t>::iterator it = m_receivers.begin (); it != m_receivers.end (); ++it)
+    {
+      if (m_beams.at (it->second.m_beamId).m_freqId == freqId)
+        {
+          double ratio = pattern->GetAntennaGain_lin (it->second.m_position) / it->second.m_ownGain;
+          it->second.m_gainRatios.push_back (std::make_pair (beam, ratio));
+        }
+    }
+}
+
+void
+SatBeamInterferenceMatrix::AddReceiver (Address address, uint32_t beamId, GeoCoordinate position, Time delay)
+{
+  NS_LOG_FUNCTION (this << address << beamId << delay.GetSeconds ());
+
+  std::map<uint32_t, BeamInfo_t>::const_iterator ownBeam = m_beams.find (beamId);
+
+  if (ownBeam == m_beams.end ())
+    {
+      NS_FATAL_ERROR ("Beam " << beamId << " of the receiver not added to interference matrix.");
+    }
+
+  ReceiverInfo_t receiverInfo;
+  receiverInfo.m_beamId = beamId;
+  receiverInfo.m_position = position;
+  receiverInfo.m_delay = delay;
+  receiverInfo.m_ownGain = ownBeam->second.m_pattern->GetAntennaGain_lin (position);
+
+  for (std::map<uint32_t, BeamInfo_t>::const_iterator it = m_beams.begin (); it != m_beams.end (); ++it)
+    {
+      if (it != ownBeam && it->second.m_freqId == ownBeam->second.m_freqId)
+        {
+          double ratio = it->second.m_pattern->GetAntennaGain_lin (position) / receiverInfo.m_ownGain;
+          receiverInfo.m_gainRatios.push_back (std::make_pair (&it->second, ratio));
+        }
+    }
+
+  if (!m_receivers.insert (std::make_pair (address, receiverInfo)).second)
+    {
+      NS_FATAL_ERROR ("Receiver " << address << " already added to interference matrix.");
+    }
+}
+
+void
+SatBeamInterferenceMatrix::NotifyBeamTx (uint32_t beamId, Time duration)
+{
+  NS_LOG_FUNCTION (this << beamId << duration.GetSeconds ());
+
+  std::map<uint32_t, BeamInfo_t>::iterator it = m_beams.find (beamId);
+
+  if (it != m_beams.end ())
+    {
+      Time now = Simulator::Now ();
+      std::deque<TxInterval_t>& txIntervals = it->second.m_txIntervals;
+
+      txIntervals.push_back (std::make_pair (now, now + duration));
+
+      while (txIntervals.front ().second < now - m_txHistoryLength)
+        {
+          txIntervals.pop_front ();
+        }
+    }
+}
+
+double
+SatBeamInterferenceMatrix::GetInterferenceWrtCarrier (Address address, Time rxStart, Time rxEnd) const
+{
+  NS_LOG_FUNCTION (this << address << rxStart.GetSeconds () << rxEnd.GetSeconds ());
+
+  std::map<Address, ReceiverInfo_t>::const_iterator receiver = m_receivers.find (address);
+
+  if (receiver == m_receivers.end ())
+    {
+      NS_FATAL_ERROR ("Receiver " << address << " not added to interference matrix.");
+    }
+
+  // all the beams are transmitted from the satellite, so the transmissions
+  // overlapping the reception are found in the time of the satellite
+  Time txStart = rxStart - receiver->second.m_delay;
+  Time txEnd = rxEnd - receiver->second.m_delay;
+
+  double interference = 0.0;
+
+  for (std::vector<std::pair<const BeamInfo_t *, double> >::const_iterator it = receiver->second.m_gainRatios.begin ();
+       it != receiver->second.m_gainRatios.end ();
+       ++it)
+    {
+      interference += it->second * GetActivity (*it->first, txStart, txEnd);
+    }
+
+  return interference;
+}
+
+void
+SatBeamInterferenceMatrix::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_receivers.clear ();
+  m_beams.clear ();
+}
+
+double
+SatBeamInterferenceMatrix::GetActivity (const BeamInfo_t &beam, Time start, Time end)
+{
+  if (end <= start)
+    {
+      return 0.0;
+    }
+
+  // transmissions of a beam do not overlap, so they are ordered by both start and end time
+  std::deque<TxInterval_t>::const_iterator it = std::upper_bound (beam.m_txIntervals.begin (),
+                                                                  beam.m_txIntervals.end (),
+                                                                  std::make_pair (start, start),
+                                                                  CompareEndTime);
+  Time busyTime (0);
+
+  for (; it != beam.m_txIntervals.end () && it->first < end; ++it)
+    {
+      busyTime += std::min (it->second, end) - std::max (it->first, start);
+    }
+
+  return busyTime.GetSeconds () / (end - start).GetSeconds ();
+}
+
+} // namespace ns3
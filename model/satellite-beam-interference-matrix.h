@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BEAM_INTERFERENCE_MATRIX_H
+#define SATELLITE_BEAM_INTERFERENCE_MATRIX_H
+
+#include <deque>
+#include <map>
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/address.h"
+#include "geo-coordinate.h"
+#include "satellite-antenna-gain-pattern.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Precomputed co-channel interference between the beams of the
+ * forward user link. The class is used through
+ * Singleton<SatBeamInterferenceMatrix> by SatPrecomputedInterference.
+ *
+ * The satellite transmits every beam with the same power, and the signals
+ * of all the beams reach a static receiver through the same path. Thus the
+ * interference of beam b relative to the wanted signal of beam j at
+ * position p is G_b(p) / G_j(p), where G is the linear gain of the antenna
+ * pattern of the beam. The ratios are computed once per receiver when the
+ * beams and the receivers are added.
+ *
+ * The activity of the beams is tracked from the transmissions of the
+ * satellite to the forward user link channels, see NotifyBeamTx. The
+ * interference of a reception is the wanted power multiplied by the sum of
+ * the ratios of the co-channel beams, each weighted with the share of the
+ * reception time the beam was transmitting. So the forward user link
+ * channels do not need to deliver the transmissions of every beam to every
+ * UT.
+ */
+class SatBeamInterferenceMatrix : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * \brief Constructor
+   */
+  SatBeamInterferenceMatrix ();
+
+  /**
+   * \brief Destructor
+   */
+  ~SatBeamInterferenceMatrix ();
+
+  /**
+   * \brief Do needed dispose actions.
+   */
+  void DoDispose ();
+
+  /**
+   * \brief Add a beam. Ratios to the already added receivers of the
+   * co-channel beams are computed.
+   * \param beamId ID of the beam
+   * \param freqId ID of the user link frequency of the beam
+   * \param pattern antenna gain pattern of the beam
+   */
+  void AddBeam (uint32_t beamId, uint32_t freqId, Ptr<SatAntennaGainPattern> pattern);
+
+  /**
+   * \brief Add a static receiver. The beam of the receiver has to be added
+   * before the receiver.
+   * \param address MAC address of the receiver
+   * \param beamId ID of the beam of the receiver
+   * \param position position of the receiver
+   * \param delay propagation delay from the satellite to the receiver
+   */
+  void AddReceiver (Address address, uint32_t beamId, GeoCoordinate position, Time delay);
+
+  /**
+   * \brief Notify about a transmission of the satellite to a beam, starting
+   * at the current time.
+   * \param beamId ID of the beam
+   * \param duration duration of the transmission
+   */
+  void NotifyBeamTx (uint32_t beamId, Time duration);
+
+  /**
+   * \brief Get the interference of the co-channel beams during a reception.
+   * \param address MAC address of the receiver
+   * \param rxStart start time of the reception at the receiver
+   * \param rxEnd end time of the reception at the receiver
+   * \return interference power relative to the power of the wanted signal
+   */
+  double GetInterferenceWrtCarrier (Address address, Time rxStart, Time rxEnd) const;
+
+  /**
+   * \brief Remove all the beams and the receivers.
+   */
+  void Reset ();
+
+private:
+  /**
+   * \brief Transmission interval of a beam, start and end time.
+   */
+  typedef std::pair<Time, Time> TxInterval_t;
+
+  /**
+   * \brief Beam information.
+   */
+  typedef struct
+  {
+    uint32_t m_freqId;
+    Ptr<SatAntennaGainPattern> m_pattern;
+    std::deque<TxInterval_t> m_txIntervals;
+  } BeamInfo_t;
+
+  /**
+   * \brief Receiver information, i.e. a row of the matrix.
+   */
+  typedef struct
+  {
+    uint32_t m_beamId;
+    GeoCoordinate m_position;
+    Time m_delay;
+    double m_ownGain;
+    std::vector<std::pair<const BeamInfo_t *, double> > m_gainRatios;
+  } ReceiverInfo_t;
+
+  /**
+   * \brief Get the share of a time interval a beam was transmitting.
+   * \param beam the beam
+   * \param start start of the interval
+   * \param end end of the interval
+   * \return share between 0 and 1
+   */
+  static double GetActivity (const BeamInfo_t &beam, Time start, Time end);
+
+  /**
+   * \brief Compare the end times of two transmission intervals.
+   * \param a first interval
+   * \param b second interval
+   * \return true if the first interval ends before the second one
+   */
+  static bool CompareEndTime (const TxInterval_t &a, const TxInterval_t &b)
+  {
+    return a.second < b.second;
+  }
+
+  std::map<uint32_t, BeamInfo_t> m_beams;
+  std::map<Address, ReceiverInfo_t> m_receivers;
+
+  /**
+   * \brief Time the transmissions are kept for the activity of the beams.
+   */
+  Time m_txHistoryLength;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_BEAM_INTERFERENCE_MATRIX_H */
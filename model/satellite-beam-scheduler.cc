@@ -260,9 +260,18 @@ SatBeamScheduler::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_txCallback.Nullify ();
+  m_backgroundLoad = NULL;
   Object::DoDispose ();
 }
 
+void
+SatBeamScheduler::SetBackgroundLoad (Ptr<SatBackgroundLoad> load)
+{
+  NS_LOG_FUNCTION (this << load);
+
+  m_backgroundLoad = load;
+}
+
 bool
 SatBeamScheduler::Send (Ptr<SatControlMessage> msg)
 {
@@ -435,6 +444,15 @@ SatBeamScheduler::Schedule ()
   uint32_t requestedKbpsSum (0);
   uint32_t offeredKbpsSum (0);
 
+  // serve background load first, whether there are UTs to schedule or not
+  if ( m_backgroundLoad )
+    {
+      uint32_t servedBytes = m_backgroundLoad->Serve (m_superframeAllocator->GetCapacityInBytes (),
+                                                      m_superframeAllocator->GetSuperframeDuration ());
+
+      m_superframeAllocator->ReserveBackgroundCapacity (servedBytes);
+    }
+
   // check that there is UTs to schedule
   if ( m_utInfos.size () > 0 )
     {
@@ -32,6 +32,7 @@
 #include <ns3/traced-callback.h>
 #include <ns3/satellite-cno-estimator.h>
 #include <ns3/satellite-frame-allocator.h>
+#include <ns3/satellite-background-load.h>
 
 namespace ns3 {
 
@@ -143,6 +144,15 @@ public:
    */
   bool Send (Ptr<SatControlMessage> message);
 
+  /**
+   * Set the aggregate background load of the beam in return link. The load
+   * is served from the capacity of every scheduled super frame before the
+   * UTs registered to the scheduler.
+   *
+   * \param load Background load of the beam in return link.
+   */
+  void SetBackgroundLoad (Ptr<SatBackgroundLoad> load);
+
   /**
    * Callback signature for `BacklogRequestsTrace` trace source.
    *
@@ -400,6 +410,11 @@ private:
    */
   Ptr<SatSuperframeAllocator>  m_superframeAllocator;
 
+  /**
+   * Aggregate background load of the beam, NULL if not used.
+   */
+  Ptr<SatBackgroundLoad> m_backgroundLoad;
+
   /**
    * Maximum two-way propagation delay estimate between GW-SAT-UT-SAT-GW.
    * This is used to estimate how much time into the future the scheduler
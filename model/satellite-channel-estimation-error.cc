@@ -20,8 +20,10 @@
 
 #include <fstream>
 #include <cmath>
+#include <algorithm>
 
 #include "ns3/log.h"
+#include "ns3/singleton.h"
 #include "satellite-channel-estimation-error.h"
 #include "satellite-utils.h"
 
@@ -34,9 +36,7 @@ NS_OBJECT_ENSURE_REGISTERED (SatChannelEstimationError);
 SatChannelEstimationError::SatChannelEstimationError ()
   : m_lastSampleIndex (0),
     m_normalRandomVariable (),
-    m_sinrsDb (),
-    m_mueCesDb (),
-    m_stdCesDb ()
+    m_table ()
 {
   m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
 }
@@ -44,12 +44,11 @@ SatChannelEstimationError::SatChannelEstimationError ()
 SatChannelEstimationError::SatChannelEstimationError (std::string filePathName)
   : m_lastSampleIndex (0),
     m_normalRandomVariable (),
-    m_sinrsDb (),
-    m_mueCesDb (),
-    m_stdCesDb ()
+    m_table ()
 {
   m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
-  ReadFile (filePathName);
+  m_table = Singleton<SatDataFileRegistry>::Get ()->Get<SatChannelEstimationErrorTable> (filePathName);
+  m_lastSampleIndex = m_table->m_sinrsDb.size () - 1;
 }
 
 
@@ -74,10 +73,11 @@ void SatChannelEstimationError::DoDispose ()
   NS_LOG_FUNCTION (this);
 
   m_normalRandomVariable = NULL;
+  m_table = NULL;
   Object::DoDispose ();
 }
 
-void SatChannelEstimationError::ReadFile (std::string filePathName)
+SatChannelEstimationErrorTable::SatChannelEstimationErrorTable (std::string filePathName)
 {
   NS_LOG_FUNCTION (this << filePathName);
 
@@ -105,6 +105,11 @@ void SatChannelEstimationError::ReadFile (std::string filePathName)
 
   while (ifs->good ())
     {
+      if (!m_sinrsDb.empty () && (sinrDb <= m_sinrsDb.back ()))
+        {
+          NS_FATAL_ERROR ("The file " << filePathName << " is not properly sorted.");
+        }
+
       m_sinrsDb.push_back (sinrDb);
       m_mueCesDb.push_back (mueCe);
       m_stdCesDb.push_back (stdCe);
@@ -116,7 +121,10 @@ void SatChannelEstimationError::ReadFile (std::string filePathName)
   NS_ASSERT (m_sinrsDb.size () == m_mueCesDb.size ());
   NS_ASSERT (m_mueCesDb.size () == m_stdCesDb.size ());
 
-  m_lastSampleIndex = m_sinrsDb.size () - 1;
+  if (m_sinrsDb.empty ())
+    {
+      NS_FATAL_ERROR ("The file " << filePathName << " contains no samples.");
+    }
 
   ifs->close ();
   delete ifs;
@@ -134,37 +142,40 @@ SatChannelEstimationError::AddError (double sinrInDb) const
   // 5. Add the error from the SINR in
   // 6. Correct with mueCe
 
+  NS_ASSERT (m_table != NULL);
+
+  const std::vector<double> &sinrsDb = m_table->m_sinrsDb;
+  const std::vector<double> &mueCesDb = m_table->m_mueCesDb;
+  const std::vector<double> &stdCesDb = m_table->m_stdCesDb;
+
   double mueCe (0.0);
   double stdCe (0.0);
 
   // If smaller than minimum SINR
-  if (sinrInDb <= m_sinrsDb[0])
+  if (sinrInDb <= sinrsDb[0])
     {
-      mueCe = m_mueCesDb[0];
-      stdCe = m_stdCesDb[0];
+      mueCe = mueCesDb[0];
+      stdCe = stdCesDb[0];
     }
   // If larger than maximum SINR
-  else if (sinrInDb >= m_sinrsDb[m_lastSampleIndex])
+  else if (sinrInDb >= sinrsDb[m_lastSampleIndex])
     {
-      mueCe = m_mueCesDb[m_lastSampleIndex];
-      stdCe = m_stdCesDb[m_lastSampleIndex];
+      mueCe = mueCesDb[m_lastSampleIndex];
+      stdCe = stdCesDb[m_lastSampleIndex];
     }
   // Else find proper point and interpolate
   else
     {
-      for (uint32_t i = 0; i < m_sinrsDb.size (); ++i)
-        {
-          // Trigger the first bigger threshold
-          if (sinrInDb < m_sinrsDb[i])
-            {
-              /**
-               * Interpolate the proper mean and std values
-               */
-              mueCe = SatUtils::Interpolate (sinrInDb, m_sinrsDb[i - 1], m_sinrsDb[i], m_mueCesDb[i - 1], m_mueCesDb[i]);
-              stdCe = SatUtils::Interpolate (sinrInDb, m_sinrsDb[i - 1], m_sinrsDb[i], m_stdCesDb[i - 1], m_stdCesDb[i]);
-              break;
-            }
-        }
+      // Trigger the first bigger threshold. The grid is strictly increasing,
+      // which is verified when the table is read.
+      const uint32_t i = std::upper_bound (sinrsDb.begin (), sinrsDb.end (), sinrInDb) - sinrsDb.begin ();
+      NS_ASSERT ((i > 0) && (i <= m_lastSampleIndex));
+
+      /**
+       * Interpolate the proper mean and std values
+       */
+      mueCe = SatUtils::Interpolate (sinrInDb, sinrsDb[i - 1], sinrsDb[i], mueCesDb[i - 1], mueCesDb[i]);
+      stdCe = SatUtils::Interpolate (sinrInDb, sinrsDb[i - 1], sinrsDb[i], stdCesDb[i - 1], stdCesDb[i]);
     }
 
   // Convert standard deviation to variance
@@ -24,9 +24,43 @@
 
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/satellite-data-file-registry.h"
 
 namespace ns3 {
 
+/**
+ * \ingroup satellite
+ * \brief Read-only table of the channel estimation error mean and standard
+ * deviation values for a set of SINR values. The table is loaded once per
+ * file through SatDataFileRegistry and shared by all SatChannelEstimationError
+ * instances using the same file.
+ */
+class SatChannelEstimationErrorTable : public SatDataFileRegistry::Entry
+{
+public:
+  /**
+   * Constructor
+   * \param filePathName A file containing the gaussian
+   * distribution mean and STD.
+   */
+  SatChannelEstimationErrorTable (std::string filePathName);
+
+  /**
+   * SINR values in dB, strictly increasing
+   */
+  std::vector<double> m_sinrsDb;
+
+  /**
+   * Mean values
+   */
+  std::vector<double> m_mueCesDb;
+
+  /**
+   * Standard deviation values
+   */
+  std::vector<double> m_stdCesDb;
+};
+
 /**
  * \ingroup satellite
  * \brief SatChannelEstimatorError reads from file and stores the channel
@@ -77,13 +111,7 @@ public:
 
 private:
   /**
-   * \brief Read the distribution mean and STD values from file.
-   * \param filePathName File name
-   */
-  void ReadFile (std::string filePathName);
-
-  /**
-   * Last sample index of the containers
+   * Last sample index of the table
    */
   uint32_t m_lastSampleIndex;
 
@@ -94,19 +122,9 @@ private:
   Ptr<NormalRandomVariable> m_normalRandomVariable;
 
   /**
-   * SINR values
+   * Shared table of the distribution mean and STD values
    */
-  std::vector<double> m_sinrsDb;
-
-  /**
-   * Mean values
-   */
-  std::vector<double> m_mueCesDb;
-
-  /**
-   * Standard deviation values
-   */
-  std::vector<double> m_stdCesDb;
+  Ptr<const SatChannelEstimationErrorTable> m_table;
 
 };
 
@@ -80,6 +80,7 @@ SatChannel::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_phyRxContainer.clear ();
+  m_txNotificationCb.Nullify ();
   m_propagationDelay = 0;
   Channel::DoDispose ();
 }
@@ -148,6 +149,11 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
   NS_LOG_FUNCTION (this << txParams);
   NS_ASSERT_MSG (txParams->m_phyTx, "NULL phyTx");
 
+  if (!m_txNotificationCb.IsNull ())
+    {
+      m_txNotificationCb (txParams->m_burst->m_beamId, txParams->m_burst->m_duration);
+    }
+
   switch (m_fwdMode)
     {
     /**
@@ -164,7 +170,7 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
              ++rxPhyIterator)
           {
             // If the same beam
-            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_beamId )
+            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_burst->m_beamId )
               {
                 switch (m_channelType)
                   {
@@ -181,8 +187,8 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
                   case SatEnums::RETURN_FEEDER_CH:
                     {
                       // Go through the packets and check their destination address by peeking the MAC tag
-                      SatSignalParameters::PacketsInBurst_t::const_iterator it = txParams->m_packetsInBurst.begin ();
-                      for (; it != txParams->m_packetsInBurst.end (); ++it )
+                      SatSignalParameters::PacketsInBurst_t::const_iterator it = txParams->m_burst->m_packetsInBurst.begin ();
+                      for (; it != txParams->m_burst->m_packetsInBurst.end (); ++it )
                         {
                           SatMacTag macTag;
                           bool mSuccess = (*it)->PeekPacketTag (macTag);
@@ -227,7 +233,7 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
              ++rxPhyIterator)
           {
             // If the same beam
-            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_beamId )
+            if ( (*rxPhyIterator)->GetBeamId () == txParams->m_burst->m_beamId )
               {
                 ScheduleRx (txParams, *rxPhyIterator);
               }
@@ -268,6 +274,8 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
   Ptr<MobilityModel> senderMobility = txParams->m_phyTx->GetMobility ();
   Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
 
+  // Packets in burst are shared between the receivers, the receiver
+  // specific parameters (e.g. rx power, SINR and interference) are not
   NS_LOG_INFO ("copying signal parameters " << txParams);
   Ptr<SatSignalParameters> rxParams = txParams->Copy ();
 
@@ -292,13 +300,13 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
         case SatEnums::RETURN_FEEDER_CH:
         case SatEnums::FORWARD_USER_CH:
           {
-            if ( delay > txParams->m_duration)
+            if ( delay > txParams->m_burst->m_duration)
               {
-                delay -= txParams->m_duration;
+                delay -= txParams->m_burst->m_duration;
               }
             else
               {
-                NS_FATAL_ERROR ("SatChannel::ScheduleRx - PHY packet burst duration " << (txParams->m_duration).GetSeconds () <<  "s is longer than one-link propagation delay " << delay.GetSeconds () << "s!");
+                NS_FATAL_ERROR ("SatChannel::ScheduleRx - PHY packet burst duration " << (txParams->m_burst->m_duration).GetSeconds () <<  "s is longer than one-link propagation delay " << delay.GetSeconds () << "s!");
               }
             break;
           }
@@ -332,7 +340,7 @@ SatChannel::StartRx (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
 
   rxParams->m_channelType = m_channelType;
 
-  double frequency_hz = m_carrierFreqConverter (m_channelType, m_freqId, rxParams->m_carrierId);
+  double frequency_hz = m_carrierFreqConverter (m_channelType, m_freqId, rxParams->m_burst->m_carrierId);
   rxParams->m_carrierFreq_hz = frequency_hz;
 
   switch (m_rxPowerCalculationMode)
@@ -368,11 +376,11 @@ SatChannel::DoRxPowerOutputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyR
   NS_LOG_FUNCTION (this << rxParams << phyRx);
 
   // Get the bandwidth of the currently used carrier
-  double carrierBandwidthHz = m_carrierBandwidthConverter (m_channelType, rxParams->m_carrierId, SatEnums::EFFECTIVE_BANDWIDTH );
+  double carrierBandwidthHz = m_carrierBandwidthConverter (m_channelType, rxParams->m_burst->m_carrierId, SatEnums::EFFECTIVE_BANDWIDTH );
 
   NS_LOG_INFO ("SatChannel::DoRxPowerOutputTrace - carrier bw: " << carrierBandwidthHz <<
                 ", rxPower: " << SatUtils::LinearToDb (rxParams->m_rxPower_W) <<
-                ", carrierId: " << rxParams->m_carrierId <<
+                ", carrierId: " << rxParams->m_burst->m_carrierId <<
                 ", channelType: " << SatEnums::GetChannelTypeName (m_channelType));
 
   std::vector<double> tempVector;
@@ -409,7 +417,7 @@ SatChannel::DoRxPowerInputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
   NS_LOG_FUNCTION (this << rxParams << phyRx);
 
   // Get the bandwidth of the currently used carrier
-  double carrierBandwidthHz = m_carrierBandwidthConverter (m_channelType, rxParams->m_carrierId, SatEnums::EFFECTIVE_BANDWIDTH );
+  double carrierBandwidthHz = m_carrierBandwidthConverter (m_channelType, rxParams->m_burst->m_carrierId, SatEnums::EFFECTIVE_BANDWIDTH );
 
   switch (m_channelType)
     {
@@ -437,7 +445,7 @@ SatChannel::DoRxPowerInputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
 
   NS_LOG_INFO ("SatChannel::DoRxPowerOutputTrace - carrier bw: " << carrierBandwidthHz <<
                 ", rxPower: " << SatUtils::LinearToDb (rxParams->m_rxPower_W) <<
-                ", carrierId: " << rxParams->m_carrierId <<
+                ", carrierId: " << rxParams->m_burst->m_carrierId <<
                 ", channelType: " << SatEnums::GetChannelTypeName (m_channelType));
 
   // get external fading input trace
@@ -567,13 +575,27 @@ SatChannel::GetExternalFadingTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPh
       }
     case SatEnums::RETURN_USER_CH:
       {
-        nodeId = Singleton<SatIdMapper>::Get ()->GetUtIdWithMac (GetSourceAddress (rxParams));
+        if (rxParams->m_burst->m_sourceTraceId != 0)
+          {
+            nodeId = Singleton<SatIdMapper>::Get ()->GetUtIdWithTraceId (rxParams->m_burst->m_sourceTraceId);
+          }
+        else
+          {
+            nodeId = Singleton<SatIdMapper>::Get ()->GetUtIdWithMac (GetSourceAddress (rxParams));
+          }
         mobility = rxParams->m_phyTx->GetMobility ();
         break;
       }
     case SatEnums::FORWARD_FEEDER_CH:
       {
-        nodeId = Singleton<SatIdMapper>::Get ()->GetGwIdWithMac (GetSourceAddress (rxParams));
+        if (rxParams->m_burst->m_sourceTraceId != 0)
+          {
+            nodeId = Singleton<SatIdMapper>::Get ()->GetGwIdWithTraceId (rxParams->m_burst->m_sourceTraceId);
+          }
+        else
+          {
+            nodeId = Singleton<SatIdMapper>::Get ()->GetGwIdWithMac (GetSourceAddress (rxParams));
+          }
         mobility = rxParams->m_phyTx->GetMobility ();
         break;
       }
@@ -592,15 +614,26 @@ SatChannel::GetExternalFadingTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPh
   return (Singleton<SatFadingExternalInputTraceContainer>::Get ()->GetFadingTrace ((uint32_t)nodeId, m_channelType, mobility))->GetFading ();
 }
 
-/// TODO get rid of source MAC address peeking
 Mac48Address
 SatChannel::GetSourceAddress (Ptr<SatSignalParameters> rxParams)
 {
   NS_LOG_FUNCTION (this << rxParams);
 
+  // The dense trace ID is resolved with direct array access
+  if (rxParams->m_burst->m_sourceTraceId != 0)
+    {
+      Address addr = Singleton<SatIdMapper>::Get ()->GetMacWithTraceId (rxParams->m_burst->m_sourceTraceId);
+
+      if (!addr.IsInvalid ())
+        {
+          return Mac48Address::ConvertFrom (addr);
+        }
+    }
+
+  // Fall back to peeking the MAC tag, if the source has no trace ID
   SatMacTag tag;
 
-  SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
+  SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_burst->m_packetsInBurst.begin ();
 
   if (*i == NULL)
     {
@@ -679,6 +712,13 @@ SatChannel::SetFreeSpaceLoss (Ptr<SatFreeSpaceLoss> loss)
   m_freeSpaceLoss = loss;
 }
 
+void
+SatChannel::SetTxNotificationCallback (TxNotificationCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+  m_txNotificationCb = cb;
+}
+
 uint32_t
 SatChannel::GetNDevices (void) const
 {
@@ -104,6 +104,13 @@ public:
    */
   typedef Callback<double, SatEnums::ChannelType_t, uint32_t, uint32_t  > CarrierFreqConverter;
 
+  /**
+   * \brief
+   * \param beamId         The id of the beam of the transmission
+   * \param duration       The duration of the transmission
+   */
+  typedef Callback<void, uint32_t, Time> TxNotificationCallback;
+
   /**
    * \brief Set the  propagation delay model to be used in the SatChannel
    * \param delay Ptr to the propagation delay model to be used.
@@ -154,6 +161,13 @@ public:
    */
   virtual void SetFreeSpaceLoss (Ptr<SatFreeSpaceLoss> delay);
 
+  /**
+   * \brief Set the callback notified about every transmission to the channel.
+   *
+   * \param cb The transmission notification callback.
+   */
+  virtual void SetTxNotificationCallback (TxNotificationCallback cb);
+
   /**
    * \brief Used by attached SatPhyTx instances to transmit signals to the channel
    * \param params the parameters of the signals being transmitted
@@ -219,6 +233,11 @@ private:
    */
   uint32_t m_freqId;
 
+  /**
+   * \brief Transmission notification callback.
+   */
+  TxNotificationCallback m_txNotificationCb;
+
   /**
    * \brief Propagation delay model to be used with this channel
    */
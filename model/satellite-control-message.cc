@@ -18,9 +18,12 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include "ns3/log.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/enum.h"
 #include "ns3/address-utils.h"
 #include "satellite-enums.h"
@@ -145,7 +148,10 @@ NS_OBJECT_ENSURE_REGISTERED (SatTbtpMessage);
 SatTbtpMessage::SatTbtpMessage ( )
   : m_superframeCounter (0),
     m_superframeSeqId (0),
-    m_assignmentFormat (0)
+    m_assignmentFormat (0),
+    m_compact (false),
+    m_daSlotRangesSorted (true),
+    m_daSlotRangeSlots (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -153,7 +159,10 @@ SatTbtpMessage::SatTbtpMessage ( )
 SatTbtpMessage::SatTbtpMessage ( uint8_t seqId )
   : m_superframeCounter (0),
     m_superframeSeqId (seqId),
-    m_assignmentFormat (0)
+    m_assignmentFormat (0),
+    m_compact (false),
+    m_daSlotRangesSorted (true),
+    m_daSlotRangeSlots (0)
 {
   NS_LOG_FUNCTION (this << (uint32_t) seqId);
 }
@@ -164,6 +173,7 @@ SatTbtpMessage::~SatTbtpMessage ()
 
   m_frameIds.clear ();
   m_daTimeSlots.clear ();
+  m_daSlotRanges.clear ();
 }
 
 TypeId
@@ -177,6 +187,11 @@ SatTbtpMessage::GetTypeId (void)
                    UintegerValue (0),
                    MakeUintegerAccessor (&SatTbtpMessage::m_assignmentFormat),
                    MakeUintegerChecker<uint8_t> ())
+    .AddAttribute ("Compact",
+                   "Describe DA time slots as ranges of consecutive slots instead of time slot configurations.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatTbtpMessage::m_compact),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -237,6 +252,82 @@ SatTbtpMessage::SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSl
   m_frameIds.insert (frameId);
 }
 
+void
+SatTbtpMessage::AddDaSlot (const DaSlotRange_t &slot)
+{
+  NS_LOG_FUNCTION (this << slot.m_utId << (uint32_t) slot.m_frameId << slot.m_carrierId);
+
+  bool merged = false;
+
+  if ( !m_daSlotRanges.empty () )
+    {
+      DaSlotRange_t &last = m_daSlotRanges.back ();
+
+      if ( last.m_utId == slot.m_utId && last.m_frameId == slot.m_frameId
+           && last.m_carrierId == slot.m_carrierId && last.m_predefinedSlots == slot.m_predefinedSlots
+           && last.m_burstSymbols == slot.m_burstSymbols && last.m_waveformId == slot.m_waveformId
+           && last.m_rcIndex == slot.m_rcIndex && last.m_slotType == slot.m_slotType
+           && last.m_count < std::numeric_limits<uint16_t>::max ()
+           && slot.m_carrierSymbolsLeft == last.m_carrierSymbolsLeft - (int64_t) last.m_count * last.m_burstSymbols )
+        {
+          last.m_count++;
+          merged = true;
+        }
+    }
+
+  if ( !merged )
+    {
+      m_daSlotRanges.push_back (slot);
+      m_daSlotRanges.back ().m_count = 1;
+      m_daSlotRangesSorted = false;
+    }
+
+  m_daSlotRangeSlots++;
+
+  // store frame ID to keep track of the used frames count
+  m_frameIds.insert (slot.m_frameId);
+}
+
+static bool
+SatDaSlotRangeUtLess (const SatTbtpMessage::DaSlotRange_t &a, const SatTbtpMessage::DaSlotRange_t &b)
+{
+  return a.m_utId < b.m_utId;
+}
+
+SatTbtpMessage::DaSlotRangeInterval_t
+SatTbtpMessage::GetDaSlotRanges (Mac48Address utId)
+{
+  NS_LOG_FUNCTION (this << utId);
+
+  if ( !m_daSlotRangesSorted )
+    {
+      // stable sort keeps the slots of a UT in the order they were added
+      std::stable_sort (m_daSlotRanges.begin (), m_daSlotRanges.end (), SatDaSlotRangeUtLess);
+      m_daSlotRangesSorted = true;
+    }
+
+  DaSlotRange_t key;
+  key.m_utId = utId;
+
+  const DaSlotRangeContainer_t &ranges = m_daSlotRanges;
+  return std::equal_range (ranges.begin (), ranges.end (), key, SatDaSlotRangeUtLess);
+}
+
+Time
+SatTbtpMessage::GetDaSlotStartTime (const DaSlotRange_t &range, uint16_t slot, Ptr<SatFrameConf> frameConf)
+{
+  int64_t carrierSymbolsLeft = range.m_carrierSymbolsLeft - (int64_t) slot * range.m_burstSymbols;
+  double symbolOffset = frameConf->GetCarrierMaxSymbols () - carrierSymbolsLeft;
+
+  if ( range.m_predefinedSlots )
+    {
+      uint16_t index = symbolOffset / range.m_burstSymbols;
+      return frameConf->GetTimeSlotConf (range.m_carrierId, index)->GetStartTime ();
+    }
+
+  return Seconds (symbolOffset / frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+}
+
 const SatTbtpMessage::RaChannelInfoContainer_t
 SatTbtpMessage::GetRaChannels () const
 {
@@ -345,6 +436,8 @@ uint32_t SatTbtpMessage::GetSizeInBytes () const
       sizeInBytes += (it->second.second.size () * assignmentIdSizeInBytes);
     }
 
+  sizeInBytes += (m_daSlotRangeSlots * assignmentIdSizeInBytes);
+
   // add size of RA time slots
   for (RaChannelMap_t::const_iterator it = m_raChannels.begin (); it != m_raChannels.end (); it++ )
     {
@@ -371,6 +464,17 @@ void SatTbtpMessage::Dump () const
       std::cout << std::endl;
     }
 
+  for (DaSlotRangeContainer_t::const_iterator it = m_daSlotRanges.begin ();
+       it != m_daSlotRanges.end ();
+       ++it)
+    {
+      std::cout << "UT: " << it->m_utId << ": ";
+      std::cout << "Frame ID: " << (uint32_t) it->m_frameId << ": ";
+      std::cout << "Carrier ID: " << it->m_carrierId << ": ";
+      std::cout << it->m_count << " ";
+      std::cout << std::endl;
+    }
+
 }
 
 NS_OBJECT_ENSURE_REGISTERED (SatCrMessage);
@@ -862,4 +966,204 @@ SatControlMsgContainer::CleanUpIdMap (uint32_t recvId)
     }
 }
 
+SatControlMsgRingContainer::SatControlMsgRingContainer (Time storeTime, bool deleteOnRead, uint32_t capacity)
+  : m_slots (),
+    m_mask (0),
+    m_oldestId (0),
+    m_nextId (0),
+    m_storeTime (storeTime),
+    m_deleteOnRead (deleteOnRead)
+{
+  NS_LOG_FUNCTION (this << storeTime << deleteOnRead << capacity);
+
+  uint32_t size = 1;
+  while (size < capacity)
+    {
+      size <<= 1;
+    }
+
+  Slot_t emptySlot;
+  emptySlot.m_id = 0;
+  emptySlot.m_sent = false;
+  m_slots.assign (size, emptySlot);
+  m_mask = size - 1;
+}
+
+SatControlMsgRingContainer::~SatControlMsgRingContainer ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+SatControlMsgRingContainer::ReserveIdAndStore (Ptr<SatControlMessage> ctrlMsg)
+{
+  NS_LOG_FUNCTION (this << ctrlMsg);
+
+  ReleaseOldest ();
+
+  if (m_nextId - m_oldestId > m_mask)
+    {
+      Grow ();
+    }
+
+  uint32_t id = m_nextId++;
+
+  Slot_t &slot = m_slots[id & m_mask];
+  slot.m_id = id;
+  slot.m_msg = ctrlMsg;
+  slot.m_sent = false;
+  slot.m_time = Simulator::Now ();
+
+  NS_LOG_INFO ("At: " << Now ().GetSeconds () << " reserve id (send id): " << id);
+
+  return id;
+}
+
+uint32_t
+SatControlMsgRingContainer::Send (uint32_t sendId)
+{
+  NS_LOG_FUNCTION (this << sendId);
+
+  Slot_t *slot = Find (sendId);
+
+  if (slot == NULL)
+    {
+      NS_FATAL_ERROR ("The id: " << sendId << " not found from SatControlMsgRingContainer!");
+    }
+
+  // The store time starts from the first send, like in SatControlMsgContainer
+  if (!slot->m_sent)
+    {
+      NS_LOG_INFO ("At: " << Now ().GetSeconds () << " send id: " << sendId);
+
+      slot->m_sent = true;
+      slot->m_time = Simulator::Now ();
+    }
+
+  return sendId;
+}
+
+Ptr<SatControlMessage>
+SatControlMsgRingContainer::Read (uint32_t recvId)
+{
+  NS_LOG_FUNCTION (this << recvId);
+
+  NS_LOG_INFO ("At: " << Now ().GetSeconds () << " receive id: " << recvId);
+
+  Slot_t *slot = Find (recvId);
+
+  if (slot == NULL || !slot->m_sent || IsExpired (*slot))
+    {
+      NS_LOG_INFO ("At: " << Now ().GetSeconds () << " id: " << recvId << " not found");
+      return NULL;
+    }
+
+  Ptr<SatControlMessage> msg = slot->m_msg;
+
+  if (m_deleteOnRead)
+    {
+      NS_LOG_INFO ("At: " << Now ().GetSeconds () << " remove id: " << recvId);
+      slot->m_msg = 0;
+      m_stragglers.erase (recvId);
+    }
+
+  return msg;
+}
+
+uint32_t
+SatControlMsgRingContainer::GetCapacity () const
+{
+  return m_slots.size ();
+}
+
+SatControlMsgRingContainer::Slot_t *
+SatControlMsgRingContainer::Find (uint32_t id)
+{
+  // The ids in use are [m_oldestId, m_nextId), the unsigned arithmetic
+  // handles the wrap around of the id space.
+  if (id - m_oldestId >= m_nextId - m_oldestId)
+    {
+      std::map<uint32_t, Slot_t>::iterator it = m_stragglers.find (id);
+      return (it != m_stragglers.end ()) ? &it->second : NULL;
+    }
+
+  Slot_t &slot = m_slots[id & m_mask];
+
+  if (slot.m_id != id || slot.m_msg == NULL)
+    {
+      return NULL;
+    }
+
+  return &slot;
+}
+
+bool
+SatControlMsgRingContainer::IsExpired (const Slot_t &slot) const
+{
+  return slot.m_sent && (Simulator::Now () - slot.m_time > m_storeTime);
+}
+
+void
+SatControlMsgRingContainer::ReleaseOldest ()
+{
+  NS_LOG_FUNCTION (this);
+
+  while (m_oldestId != m_nextId)
+    {
+      Slot_t &slot = m_slots[m_oldestId & m_mask];
+
+      if (slot.m_msg != NULL && !IsExpired (slot))
+        {
+          if (slot.m_sent || Simulator::Now () - slot.m_time <= m_storeTime)
+            {
+              break;
+            }
+
+          // A message reserved long ago but not sent yet, e.g. still waiting
+          // in the LLC, would hold back the ring. It is moved aside.
+          NS_LOG_INFO ("At: " << Now ().GetSeconds () << " move unsent id: " << m_oldestId << " out of the ring");
+          m_stragglers.insert (std::make_pair (m_oldestId, slot));
+        }
+
+      slot.m_msg = 0;
+      ++m_oldestId;
+    }
+
+  std::map<uint32_t, Slot_t>::iterator it = m_stragglers.begin ();
+  while (it != m_stragglers.end ())
+    {
+      if (it->second.m_msg == NULL || IsExpired (it->second))
+        {
+          m_stragglers.erase (it++);
+        }
+      else
+        {
+          ++it;
+        }
+    }
+}
+
+void
+SatControlMsgRingContainer::Grow ()
+{
+  NS_LOG_FUNCTION (this << m_slots.size ());
+
+  Slot_t emptySlot;
+  emptySlot.m_id = 0;
+  emptySlot.m_sent = false;
+
+  std::vector<Slot_t> slots (2 * m_slots.size (), emptySlot);
+  uint32_t mask = 2 * m_mask + 1;
+
+  for (uint32_t id = m_oldestId; id != m_nextId; ++id)
+    {
+      slots[id & mask] = m_slots[id & m_mask];
+    }
+
+  m_slots.swap (slots);
+  m_mask = mask;
+
+  NS_LOG_INFO ("At: " << Now ().GetSeconds () << " ring capacity increased to " << m_slots.size ());
+}
+
 }; // namespace ns3
@@ -213,6 +213,39 @@ public:
    */
   typedef std::set< uint8_t >  RaChannelInfoContainer_t;
 
+  /**
+   * Compact description of consecutive DA time slots of a UT.
+   *
+   * A range covers m_count slots of the same UT, frame, carrier, wave form,
+   * slot type and RC index, which follow each other in the carrier. The slots
+   * are described by their position in the carrier instead of time slot
+   * configuration objects, see GetDaSlotStartTime.
+   */
+  typedef struct
+  {
+    Mac48Address m_utId;                            ///< UT the slots are assigned to
+    uint8_t m_frameId;                              ///< Frame of the slots
+    uint16_t m_carrierId;                           ///< Carrier of the slots in the frame
+    bool m_predefinedSlots;                         ///< Slots are predefined slots of the frame (configuration type 0)
+    int64_t m_carrierSymbolsLeft;                   ///< Unallocated symbols of the carrier at the start of the first slot
+    uint32_t m_burstSymbols;                        ///< Length of a slot in symbols
+    uint16_t m_count;                               ///< Number of the slots
+    uint32_t m_waveformId;                          ///< Wave form of the slots
+    uint8_t m_rcIndex;                              ///< RC index of the slots
+    SatTimeSlotConf::SatTimeSlotType_t m_slotType;  ///< Type of the slots
+  } DaSlotRange_t;
+
+  /**
+   * Container for DA slot ranges.
+   */
+  typedef std::vector<DaSlotRange_t> DaSlotRangeContainer_t;
+
+  /**
+   * Interval of DA slot ranges of a UT, member first is the first range and
+   * member second is past the last range.
+   */
+  typedef std::pair<DaSlotRangeContainer_t::const_iterator, DaSlotRangeContainer_t::const_iterator> DaSlotRangeInterval_t;
+
   /**
    * Size of message body without frame info and slot assignment info
    *
@@ -333,6 +366,43 @@ public:
    */
   void SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSlotConf> conf);
 
+  /**
+   * Check if the TBTP describes the DA time slots as slot ranges instead of
+   * time slot configurations.
+   *
+   * \return true if compact format is used
+   */
+  inline bool IsCompact () const
+  {
+    return m_compact;
+  }
+
+  /**
+   * Add a DA time slot to the compact slot ranges. The slot is merged to the
+   * last range, when it continues the range.
+   *
+   * \param slot Range describing the slot, member m_count is ignored
+   */
+  void AddDaSlot (const DaSlotRange_t &slot);
+
+  /**
+   * Get the DA slot ranges of a UT.
+   *
+   * \param utId id of the UT which slot ranges are requested
+   * \return interval of the slot ranges of the UT in the order the slots were added
+   */
+  DaSlotRangeInterval_t GetDaSlotRanges (Mac48Address utId);
+
+  /**
+   * Get the start time of a slot in a DA slot range.
+   *
+   * \param range Slot range
+   * \param slot Index of the slot in the range
+   * \param frameConf Configuration of the frame of the range
+   * \return Start time of the slot relative to the start of the frame
+   */
+  static Time GetDaSlotStartTime (const DaSlotRange_t &range, uint16_t slot, Ptr<SatFrameConf> frameConf);
+
   /**
    * Get the information of the RA channels.
    *
@@ -378,6 +448,15 @@ private:
   uint8_t           m_superframeSeqId;
   uint8_t           m_assignmentFormat;
   std::set<uint8_t> m_frameIds;
+  bool              m_compact;
+
+  /**
+   * DA slot ranges used instead of m_daTimeSlots in compact format, sorted
+   * by the UT on demand.
+   */
+  DaSlotRangeContainer_t  m_daSlotRanges;
+  bool                    m_daSlotRangesSorted;
+  uint32_t                m_daSlotRangeSlots;
 
   /**
    * Empty DA slot container to be returned if there are not DA time slots
@@ -864,6 +943,127 @@ private:
 
 };
 
+/**
+ * \ingroup satellite
+ * \brief Control message container storing the messages in a ring, offered
+ * as a cheaper alternative to SatControlMsgContainer with the same interface.
+ *
+ * The container hands out monotonically increasing IDs and uses the same ID
+ * both as the send ID and the receive ID. A message is stored in the ring
+ * slot given by its ID modulo the capacity of the ring, so storing, sending
+ * and reading are constant time operations. The store time of a message
+ * starts when it is sent. Expired and read messages are released when the
+ * oldest end of the ring is passed over by new reservations, so no timeout
+ * events are needed. If the ring is full of messages still in use, its
+ * capacity is doubled. Messages not sent within the store time from their
+ * reservation are moved out of the ring to a map.
+ */
+class SatControlMsgRingContainer : public SimpleRefCount<SatControlMsgRingContainer>
+{
+public:
+  /**
+   * Constructor for SatControlMsgRingContainer.
+   * \param storeTime time to store a message after it is sent
+   * \param deleteOnRead flag telling whether a message is deleted when read
+   * \param capacity initial capacity of the ring, rounded up to a power of two
+   */
+  SatControlMsgRingContainer (Time storeTime, bool deleteOnRead, uint32_t capacity);
+
+  /**
+   * Destructor for SatControlMsgRingContainer
+   */
+  ~SatControlMsgRingContainer ();
+
+  /**
+   * \brief Reserve an id and store a control message.
+   *
+   * \param controlMsg Pointer to message to be added.
+   * \return Reserved send ID of the created added message.
+   */
+  uint32_t ReserveIdAndStore (Ptr<SatControlMessage> controlMsg);
+
+  /**
+   * \brief Add a control message.
+   *
+   * \param sendId of the message to add.
+   * \return Receive id given by the container.
+   */
+  uint32_t Send (uint32_t sendId);
+
+  /**
+   * \brief Read a control message.
+   *
+   * \param recvId Id of the message to read.
+   * \return Pointer to message, or NULL if the message is not sent, has
+   * expired or has already been deleted.
+   */
+  Ptr<SatControlMessage> Read (uint32_t recvId);
+
+  /**
+   * \brief Get the current capacity of the ring.
+   * \return number of slots
+   */
+  uint32_t GetCapacity () const;
+
+private:
+  /**
+   * \brief Slot of the ring.
+   */
+  typedef struct
+  {
+    uint32_t m_id;
+    Ptr<SatControlMessage> m_msg;
+    bool m_sent;
+    Time m_time;    ///< reservation time until sent, then send time
+  } Slot_t;
+
+  /**
+   * \brief Find the slot holding a message.
+   * \param id id of the message
+   * \return the slot, or NULL if the message is not in the container
+   */
+  Slot_t * Find (uint32_t id);
+
+  /**
+   * \brief Check whether the store time of a sent message has expired.
+   * \param slot the slot of the message
+   * \return true if expired
+   */
+  bool IsExpired (const Slot_t &slot) const;
+
+  /**
+   * \brief Release the read and expired messages from the oldest end of the
+   * ring, up to the first message still in use. Messages not sent within the
+   * store time from their reservation are moved out of the ring.
+   */
+  void ReleaseOldest ();
+
+  /**
+   * \brief Double the capacity of the ring.
+   */
+  void Grow ();
+
+  std::vector<Slot_t> m_slots;
+  uint32_t m_mask;
+  uint32_t m_oldestId;
+  uint32_t m_nextId;
+
+  /**
+   * Messages reserved but not sent within the store time, moved out of the
+   * ring so that they do not hold back the release of newer messages.
+   */
+  std::map<uint32_t, Slot_t> m_stragglers;
+
+  /**
+   * Time to store a message in container after it is sent.
+   */
+  Time m_storeTime;
+
+  /**
+   * Flag to tell, if message is deleted from container when read (get).
+   */
+  bool m_deleteOnRead;
+};
 
 
 } // namespace ns3
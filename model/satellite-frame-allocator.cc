@@ -526,39 +526,40 @@ SatFrameAllocator::GenerateTimeSlots (SatFrameAllocator::TbtpMsgContainer_t& tbt
 
       while ( utSymbolsLeft > 0 )
         {
-          Ptr<SatTimeSlotConf> timeSlot = NULL;
+          SatTbtpMessage::DaSlotRange_t slot;
+          bool slotCreated = false;
 
           // try to first create Control slot if present in request and is not already created
           // otherwise create TRC slot
           if ( (currentRcIndex == rcIndices.begin ()) && m_utAllocs[*it].m_request.m_ctrlSlotPresent
                && (m_utAllocs[*it].m_allocation.m_ctrlSlotPresent == false ))
             {
-              timeSlot = CreateCtrlTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, rcBasedAllocationEnabled );
+              slotCreated = CreateCtrlTimeSlot (slot, *currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, rcBasedAllocationEnabled );
 
               // if control slot creation fails try to allocate TRC slot,
               // this i because control and TRC slot may use different waveforms (different amount of symbols)
-              if ( timeSlot )
+              if ( slotCreated )
                 {
                   m_utAllocs[*it].m_allocation.m_ctrlSlotPresent = true;
                 }
               else
                 {
-                  timeSlot = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
+                  slotCreated = CreateTimeSlot (slot, *currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
                 }
             }
           else
             {
-              timeSlot = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
+              slotCreated = CreateTimeSlot (slot, *currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
             }
 
           // if creation succeeded, add slot to TBTP and update allocation info container
-          if ( timeSlot )
+          if ( slotCreated )
             {
               // trace first used wave form per UT
               if ( !waveformIdTraced )
                 {
                   waveformIdTraced = true;
-                  waveformTrace (timeSlot->GetWaveFormId ());
+                  waveformTrace (slot.m_waveformId);
                   utCount++;
                 }
 
@@ -567,18 +568,30 @@ SatFrameAllocator::GenerateTimeSlots (SatFrameAllocator::TbtpMsgContainer_t& tbt
                   tbtpToFill = CreateNewTbtp (tbtpContainer);
                 }
 
-              timeSlot->SetRcIndex (*currentRcIndex);
-
               if (timeslotCount > SatFrameConf::m_maxTimeSlotCount)
                 {
                   //NS_FATAL_ERROR ("Maximum limit for time slots in a frame reached. Check frame configuration!!!");
                 }
 
-              tbtpToFill->SetDaTimeslot (Mac48Address::ConvertFrom (*it), m_frameId, timeSlot);
+              slot.m_utId = Mac48Address::ConvertFrom (*it);
+              slot.m_frameId = m_frameId;
+              slot.m_rcIndex = *currentRcIndex;
+
+              if ( tbtpToFill->IsCompact () )
+                {
+                  // slot is described by its position, no time slot configuration is needed
+                  tbtpToFill->AddDaSlot (slot);
+                }
+              else
+                {
+                  Ptr<SatTimeSlotConf> timeSlot = CreateTimeSlotConf (slot);
+                  tbtpToFill->SetDaTimeslot (slot.m_utId, m_frameId, timeSlot);
+                }
+
               timeslotCount++;
 
               // store needed information to UT allocation container
-              Ptr<SatWaveform> waveform = m_waveformConf->GetWaveform (timeSlot->GetWaveFormId ());
+              Ptr<SatWaveform> waveform = m_waveformConf->GetWaveform (slot.m_waveformId);
 
               UtAllocInfoContainer_t::iterator utAlloc = GetUtAllocItem (utAllocContainer, *it);
               utAlloc->second.first.at (*currentRcIndex) += waveform->GetPayloadInBytes ();
@@ -790,13 +803,13 @@ void SatFrameAllocator::ShareSymbols (bool fcaEnabled)
     }
 }
 
-Ptr<SatTimeSlotConf>
-SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
+bool
+SatFrameAllocator::CreateTimeSlot (SatTbtpMessage::DaSlotRange_t& slot, uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
                                    int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> timeSlotConf = NULL;
+  bool slotCreated = false;
   int64_t symbolsToUse = std::min<int64_t> (carrierSymbolsToUse, utSymbolsToUse);
   uint32_t waveformId = 0;
   int64_t timeSlotSymbols = 0;
@@ -824,20 +837,34 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
     }
   else if (rcSymbolsLeft > 0)
     {
+      slot.m_carrierId = carrierId;
+      slot.m_carrierSymbolsLeft = carrierSymbolsToUse;
+      slot.m_burstSymbols = timeSlotSymbols;
+
       switch (m_configType)
         {
         case SatSuperframeConf::CONFIG_TYPE_0:
           {
             uint16_t index = (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / timeSlotSymbols;
-            timeSlotConf = m_frameConf->GetTimeSlotConf (carrierId, index);
+            Ptr<SatTimeSlotConf> timeSlotConf = m_frameConf->GetTimeSlotConf (carrierId, index);
+
+            if (timeSlotConf)
+              {
+                slot.m_predefinedSlots = true;
+                slot.m_waveformId = timeSlotConf->GetWaveFormId ();
+                slot.m_slotType = timeSlotConf->GetSlotType ();
+                slotCreated = true;
+              }
           }
           break;
 
         case SatSuperframeConf::CONFIG_TYPE_1:
         case SatSuperframeConf::CONFIG_TYPE_2:
           {
-            Time startTime = Seconds ( (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / m_frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
-            timeSlotConf = Create<SatTimeSlotConf> (startTime, waveformId, carrierId, SatTimeSlotConf::SLOT_TYPE_TRC);
+            slot.m_predefinedSlots = false;
+            slot.m_waveformId = waveformId;
+            slot.m_slotType = SatTimeSlotConf::SLOT_TYPE_TRC;
+            slotCreated = true;
           }
           break;
 
@@ -847,7 +874,7 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
           break;
         }
 
-      if (timeSlotConf)
+      if (slotCreated)
         {
           carrierSymbolsToUse -= timeSlotSymbols;
           utSymbolsToUse -= timeSlotSymbols;
@@ -865,24 +892,29 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
         }
     }
 
-  return timeSlotConf;
+  return slotCreated;
 }
 
-Ptr<SatTimeSlotConf>
-SatFrameAllocator::CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
+bool
+SatFrameAllocator::CreateCtrlTimeSlot (SatTbtpMessage::DaSlotRange_t& slot, uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
                                        int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> timeSlotConf = NULL;
+  bool slotCreated = false;
   int64_t symbolsToUse = std::min<int64_t> (carrierSymbolsToUse, utSymbolsToUse);
 
   int64_t timeSlotSymbols = m_mostRobustWaveform->GetBurstLengthInSymbols ();
 
   if ( timeSlotSymbols <= symbolsToUse )
     {
-      Time startTime = Seconds ( (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / m_frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
-      timeSlotConf = Create<SatTimeSlotConf> (startTime, m_mostRobustWaveform->GetWaveformId (), carrierId, SatTimeSlotConf::SLOT_TYPE_C);
+      slot.m_carrierId = carrierId;
+      slot.m_predefinedSlots = false;
+      slot.m_carrierSymbolsLeft = carrierSymbolsToUse;
+      slot.m_burstSymbols = timeSlotSymbols;
+      slot.m_waveformId = m_mostRobustWaveform->GetWaveformId ();
+      slot.m_slotType = SatTimeSlotConf::SLOT_TYPE_C;
+      slotCreated = true;
 
       carrierSymbolsToUse -= timeSlotSymbols;
       utSymbolsToUse -= timeSlotSymbols;
@@ -899,7 +931,41 @@ SatFrameAllocator::CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToU
       rcSymbolsLeft -= timeSlotSymbols;
     }
 
-  return timeSlotConf;
+  return slotCreated;
+}
+
+Ptr<SatTimeSlotConf>
+SatFrameAllocator::CreateTimeSlotConf (const SatTbtpMessage::DaSlotRange_t& slot)
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( slot.m_predefinedSlots )
+    {
+      uint16_t index = (m_maxSymbolsPerCarrier - slot.m_carrierSymbolsLeft) / slot.m_burstSymbols;
+      Ptr<SatTimeSlotConf> predefinedSlot = m_frameConf->GetTimeSlotConf (slot.m_carrierId, index);
+
+      /*
+       * The predefined slot is shared by all the allocations of the frame, so
+       * setting its RC index would change the TBTPs not yet read by the UTs.
+       * One copy per RC index is made on first use and shared from then on.
+       */
+      std::pair<PredefinedSlotMap_t::iterator, bool> result =
+        m_predefinedSlots.insert (std::make_pair (std::make_pair (predefinedSlot, slot.m_rcIndex), Ptr<SatTimeSlotConf> ()));
+
+      if ( result.second )
+        {
+          result.first->second = Create<SatTimeSlotConf> (*predefinedSlot);
+          result.first->second->SetRcIndex (slot.m_rcIndex);
+        }
+
+      return result.first->second;
+    }
+
+  Time startTime = SatTbtpMessage::GetDaSlotStartTime (slot, 0, m_frameConf);
+  Ptr<SatTimeSlotConf> timeSlot = Create<SatTimeSlotConf> (startTime, slot.m_waveformId, slot.m_carrierId, slot.m_slotType);
+  timeSlot->SetRcIndex (slot.m_rcIndex);
+
+  return timeSlot;
 }
 
 uint32_t
@@ -1207,6 +1273,7 @@ SatFrameAllocator::CreateNewTbtp (TbtpMsgContainer_t& tbtpContainer)
 
   Ptr<SatTbtpMessage> newTbtp = CreateObject<SatTbtpMessage> (tbtpContainer.back ()->GetSuperframeSeqId ());
   newTbtp->SetSuperframeCounter ( tbtpContainer.back ()->GetSuperframeCounter ());
+  newTbtp->SetAttribute ("Compact", BooleanValue (tbtpContainer.back ()->IsCompact ()));
 
   tbtpContainer.push_back (newTbtp);
 
@@ -442,6 +442,10 @@ private:
   // The most robust waveform
   Ptr<SatWaveform>  m_mostRobustWaveform;
 
+  // Copies of the predefined time slots of the frame per RC index
+  typedef std::map<std::pair<Ptr<SatTimeSlotConf>, uint8_t>, Ptr<SatTimeSlotConf> > PredefinedSlotMap_t;
+  PredefinedSlotMap_t m_predefinedSlots;
+
   /**
    * Share symbols between all UTs and RCs allocated to the frame.
    *
@@ -463,6 +467,7 @@ private:
   /**
    * Create time slot according to configuration type.
    *
+   * \param slot Time slot to fill, if slot is created
    * \param carrierId Id of the carrier into create time slot
    * \param utSymbolsToUse Symbols possible to allocated for the UT
    * \param carrierSymbolsToUse Symbols possible to allocate to carrier
@@ -470,24 +475,35 @@ private:
    * \param rcSymbolsLeft Symbols left for RC
    * \param cno Estimated C/N0 of the UT.
    * \param rcBasedAllocationEnabled If time slot generated per RC
-   * \return Create time slot configuration
+   * \return true if time slot was created
    */
-  Ptr<SatTimeSlotConf> CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
-                                       int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled);
+  bool CreateTimeSlot (SatTbtpMessage::DaSlotRange_t& slot, uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
+                       int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled);
 
   /**
    * Create control time slot.
    *
+   * \param slot Time slot to fill, if slot is created
    * \param carrierId Id of the carrier into create time slot
    * \param utSymbolsToUse Symbols possible to allocated for the UT
    * \param carrierSymbolsToUse Symbols possible to allocate to carrier
    * \param utSymbolsLeft Symbols left for the UT
    * \param rcSymbolsLeft Symbols left for RC
    * \param rcBasedAllocationEnabled If time slot generated per RC
-   * \return Create time slot configuration
+   * \return true if time slot was created
+   */
+  bool CreateCtrlTimeSlot (SatTbtpMessage::DaSlotRange_t& slot, uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
+                           int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled);
+
+  /**
+   * Create time slot configuration of a created time slot. In configuration
+   * type 0 a copy of the predefined time slot of the frame with the RC index
+   * of the slot is returned, see m_predefinedSlots.
+   *
+   * \param slot Created time slot
+   * \return Time slot configuration
    */
-  Ptr<SatTimeSlotConf> CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
-                                           int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled);
+  Ptr<SatTimeSlotConf> CreateTimeSlotConf (const SatTbtpMessage::DaSlotRange_t& slot);
 
   /**
    * Update RC/CC requested according to carrier limit
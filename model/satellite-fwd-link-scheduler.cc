@@ -152,7 +152,8 @@ SatFwdLinkScheduler::GetTypeId (void)
 SatFwdLinkScheduler::SatFwdLinkScheduler ()
   : m_additionalSortCriteria (SatFwdLinkScheduler::NO_SORT),
     m_cnoEstimatorMode (SatCnoEstimator::LAST),
-    m_carrierBandwidthInHz (0.0)
+    m_carrierBandwidthInHz (0.0),
+    m_signallingBytes (0)
 {
   NS_LOG_FUNCTION (this);
   NS_FATAL_ERROR ("Default constructor for SatFwdLinkScheduler not supported");
@@ -163,7 +164,8 @@ SatFwdLinkScheduler::SatFwdLinkScheduler (Ptr<SatBbFrameConf> conf, Mac48Address
     m_bbFrameConf (conf),
     m_additionalSortCriteria (SatFwdLinkScheduler::NO_SORT),
     m_cnoEstimatorMode (SatCnoEstimator::LAST),
-    m_carrierBandwidthInHz (carrierBandwidthInHz)
+    m_carrierBandwidthInHz (carrierBandwidthInHz),
+    m_signallingBytes (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -192,6 +194,8 @@ SatFwdLinkScheduler::DoDispose ()
   m_txOpportunityCallback.Nullify ();
   m_bbFrameContainer = NULL;
   m_cnoEstimatorContainer.clear ();
+  m_backgroundLoad = NULL;
+  m_backgroundFrame = NULL;
 }
 
 void
@@ -219,7 +223,13 @@ SatFwdLinkScheduler::GetNextFrame ()
       ScheduleBbFrames ();
     }
 
-  Ptr<SatBbFrame> frame = m_bbFrameContainer->GetNextFrame ();
+  // background load is served first, whenever it has demand for a whole frame
+  Ptr<SatBbFrame> frame = GetBackgroundFrame ();
+
+  if ( frame == NULL )
+    {
+      frame = m_bbFrameContainer->GetNextFrame ();
+    }
 
   // create dummy frame
   if ( frame == NULL )
@@ -265,6 +275,78 @@ SatFwdLinkScheduler::CnoInfoUpdated (Mac48Address utAddress, double cnoEstimate)
   it->second->AddSample (cnoEstimate);
 }
 
+void
+SatFwdLinkScheduler::SetBackgroundLoad (Ptr<SatBackgroundLoad> load)
+{
+  NS_LOG_FUNCTION (this << load);
+
+  m_backgroundLoad = load;
+}
+
+Ptr<SatBbFrame>
+SatFwdLinkScheduler::GetBackgroundFrame ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_backgroundLoad == NULL )
+    {
+      return NULL;
+    }
+
+  uint32_t frameBytes = GetBackgroundFrameBytes ();
+
+  if ( m_backgroundLoad->GetBacklogInBytes () < frameBytes )
+    {
+      return NULL;
+    }
+
+  m_backgroundLoad->Serve (frameBytes, m_backgroundFrame->GetDuration ());
+
+  return m_backgroundFrame;
+}
+
+Time
+SatFwdLinkScheduler::GetTimeToBackgroundFrame ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_backgroundLoad == NULL )
+    {
+      return Time::Max ();
+    }
+
+  return m_backgroundLoad->GetTimeToBacklog (GetBackgroundFrameBytes ());
+}
+
+uint32_t
+SatFwdLinkScheduler::GetBackgroundFrameBytes ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_backgroundFrame == NULL )
+    {
+      SatEnums::SatBbFrameType_t frameType = SatEnums::NORMAL_FRAME;
+
+      if ( m_bbFrameConf->GetBbFrameUsageMode () == SatBbFrameConf::SHORT_FRAMES )
+        {
+          frameType = SatEnums::SHORT_FRAME;
+        }
+
+      m_backgroundFrame = Create<SatBbFrame> (m_bbFrameConf->GetDefaultModCod (), frameType, m_bbFrameConf);
+      m_backgroundFrame->SetBackgroundFrame ();
+    }
+
+  return m_backgroundFrame->GetMaxSpaceInBytes () - m_bbFrameConf->GetBbFrameHeaderSizeInBytes ();
+}
+
+void
+SatFwdLinkScheduler::ReserveSignallingBytes (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  m_signallingBytes += bytes;
+}
+
 void
 SatFwdLinkScheduler::PeriodicTimerExpired ()
 {
@@ -280,6 +362,31 @@ SatFwdLinkScheduler::ScheduleBbFrames ()
 {
   NS_LOG_FUNCTION (this);
 
+  // The abstracted signalling messages take their space from the control
+  // frames with placeholder packets, which the UTs ignore
+  SatEnums::SatModcod_t ctrlModcod = m_bbFrameContainer->GetModcod (0, NAN);
+  uint32_t maxCtrlBytes = m_bbFrameContainer->GetMaxFramePayloadInBytes (0, ctrlModcod) - m_bbFrameConf->GetBbFrameHeaderSizeInBytes ();
+
+  while ( ( m_signallingBytes > 0 ) && ( m_bbFrameContainer->GetTotalDuration () < m_schedulingStopThresholdTime ) )
+    {
+      uint32_t frameBytes = std::min (m_bbFrameContainer->GetBytesLeftInTailFrame (0, ctrlModcod), maxCtrlBytes);
+
+      if ( frameBytes == 0 )
+        {
+          frameBytes = maxCtrlBytes;
+        }
+
+      Ptr<Packet> p = Create<Packet> (std::min (m_signallingBytes, frameBytes));
+
+      SatMacTag tag;
+      tag.SetDestAddress (Mac48Address::GetBroadcast ());
+      tag.SetSourceAddress (m_macAddress);
+      p->AddPacketTag (tag);
+
+      m_bbFrameContainer->AddData (0, ctrlModcod, p);
+      m_signallingBytes -= p->GetSize ();
+    }
+
   // Get scheduling objects from LLC
   std::vector< Ptr<SatSchedulingObject> > so;
   GetSchedulingObjects (so);
@@ -42,6 +42,7 @@
 #include "satellite-bbframe.h"
 #include "satellite-bbframe-container.h"
 #include "satellite-cno-estimator.h"
+#include "satellite-background-load.h"
 #include "ns3/satellite-bbframe-conf.h"
 
 namespace ns3 {
@@ -180,6 +181,32 @@ public:
    */
   void CnoInfoUpdated (Mac48Address utAddress, double cnoEstimate);
 
+  /**
+   * Set the aggregate background load, which is served by this scheduler
+   * in addition to the scheduling objects of the LLC.
+   *
+   * \param load Background load of the beam in forward link.
+   */
+  void SetBackgroundLoad (Ptr<SatBackgroundLoad> load);
+
+  /**
+   * Get the time until the background load may fill a whole frame. The
+   * backlog has to be checked again at that time, as the rate of the load
+   * may change before the frame is filled.
+   *
+   * \return Time until the next check, zero if the background load fills a
+   * frame already, or Time::Max () if no background load is served.
+   */
+  Time GetTimeToBackgroundFrame ();
+
+  /**
+   * Reserve space for an abstracted signalling message from the control BB
+   * frames. The space is taken when the frames are scheduled next time.
+   *
+   * \param bytes Size of the message.
+   */
+  void ReserveSignallingBytes (uint32_t bytes);
+
 private:
   typedef std::map<Mac48Address, Ptr<SatCnoEstimator> > CnoEstimatorMap_t;
 
@@ -238,6 +265,23 @@ private:
    */
   Ptr<SatCnoEstimator> CreateCnoEstimator ();
 
+  /**
+   * Get a frame for the background load, if the backlog of the load fills
+   * a whole frame. The returned frame carries no packets, so it is not sent,
+   * but it keeps the carrier busy for its duration.
+   *
+   * \return Background frame or NULL, if background load is not served.
+   */
+  Ptr<SatBbFrame> GetBackgroundFrame ();
+
+  /**
+   * Get the bytes the background load needs to fill a background frame.
+   * The background frame is created on the first call.
+   *
+   * \return Payload of the background frame in bytes.
+   */
+  uint32_t GetBackgroundFrameBytes ();
+
   /**
    * MAC address of the this instance (node)
    */
@@ -310,6 +354,23 @@ private:
    */
   double m_carrierBandwidthInHz;
 
+  /**
+   * Aggregate background load of the beam, NULL if not used.
+   */
+  Ptr<SatBackgroundLoad> m_backgroundLoad;
+
+  /**
+   * Frame returned for the background load. As the frame carries no
+   * packets, the same frame is reused.
+   */
+  Ptr<SatBbFrame> m_backgroundFrame;
+
+  /**
+   * Bytes of the abstracted signalling messages not yet taken from the
+   * control BB frames.
+   */
+  uint32_t m_signallingBytes;
+
 };
 
 } // namespace ns3
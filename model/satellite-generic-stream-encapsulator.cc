@@ -28,7 +28,6 @@
 #include "satellite-mac-tag.h"
 #include "satellite-encap-pdu-status-tag.h"
 #include "satellite-gse-header.h"
-#include "satellite-time-tag.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatGenericStreamEncapsulator");
 
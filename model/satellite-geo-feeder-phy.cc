@@ -185,7 +185,7 @@ void
 SatGeoFeederPhy::SendPduWithParams (Ptr<SatSignalParameters> txParams )
 {
   NS_LOG_FUNCTION (this << txParams);
-  NS_LOG_INFO (this << " sending a packet with carrierId: " << txParams->m_carrierId << " duration: " << txParams->m_duration);
+  NS_LOG_INFO (this << " sending a packet with carrierId: " << txParams->m_burst->m_carrierId << " duration: " << txParams->m_burst->m_duration);
 
   // Add packet trace entry:
   m_packetTrace (Simulator::Now (),
@@ -195,7 +195,7 @@ SatGeoFeederPhy::SendPduWithParams (Ptr<SatSignalParameters> txParams )
                  m_nodeInfo->GetMacAddress (),
                  SatEnums::LL_PHY,
                  SatEnums::LD_RETURN,
-                 SatUtils::GetPacketInfo (txParams->m_packetsInBurst));
+                 SatUtils::GetPacketInfo (txParams->m_burst->m_packetsInBurst));
 
   // copy as sender own PhyTx object (at satellite) to ensure right distance calculation
   // and antenna gain getting at receiver (UT or GW)
@@ -235,9 +235,9 @@ SatGeoFeederPhy::Receive (Ptr<SatSignalParameters> rxParams, bool /*phyError*/)
                  m_nodeInfo->GetMacAddress (),
                  SatEnums::LL_PHY,
                  SatEnums::LD_FORWARD,
-                 SatUtils::GetPacketInfo (rxParams->m_packetsInBurst));
+                 SatUtils::GetPacketInfo (rxParams->m_burst->m_packetsInBurst));
 
-  m_rxCallback ( rxParams->m_packetsInBurst, rxParams);
+  m_rxCallback ( rxParams->m_burst->m_packetsInBurst, rxParams);
 }
 
 double
@@ -80,7 +80,7 @@ SatGeoNetDevice::ReceiveUser (SatPhy::PacketContainer_t packets, Ptr<SatSignalPa
 {
   NS_LOG_FUNCTION (this << packets.size () << rxParams);
   NS_LOG_INFO (this << " receiving a packet at the satellite from user link");
-  m_feederPhy[rxParams->m_beamId]->SendPduWithParams (rxParams);
+  m_feederPhy[rxParams->m_burst->m_beamId]->SendPduWithParams (rxParams);
 }
 
 void
@@ -88,7 +88,7 @@ SatGeoNetDevice::ReceiveFeeder (SatPhy::PacketContainer_t packets, Ptr<SatSignal
 {
   NS_LOG_FUNCTION (this << packets.size () << rxParams);
   NS_LOG_INFO (this << " receiving a packet at the satellite from feeder link");
-  m_userPhy[rxParams->m_beamId]->SendPduWithParams (rxParams);
+  m_userPhy[rxParams->m_burst->m_beamId]->SendPduWithParams (rxParams);
 }
 
 void
@@ -178,7 +178,7 @@ void
 SatGeoUserPhy::SendPduWithParams (Ptr<SatSignalParameters> txParams )
 {
   NS_LOG_FUNCTION (this << txParams);
-  NS_LOG_INFO (this << " sending a packet with carrierId: " << txParams->m_carrierId << " duration: " << txParams->m_duration);
+  NS_LOG_INFO (this << " sending a packet with carrierId: " << txParams->m_burst->m_carrierId << " duration: " << txParams->m_burst->m_duration);
 
   // Add packet trace entry:
   m_packetTrace (Simulator::Now (),
@@ -188,7 +188,7 @@ SatGeoUserPhy::SendPduWithParams (Ptr<SatSignalParameters> txParams )
                  m_nodeInfo->GetMacAddress (),
                  SatEnums::LL_PHY,
                  SatEnums::LD_FORWARD,
-                 SatUtils::GetPacketInfo (txParams->m_packetsInBurst));
+                 SatUtils::GetPacketInfo (txParams->m_burst->m_packetsInBurst));
 
   // copy as sender own PhyTx object (at satellite) to ensure right distance calculation
   // and antenna gain getting at receiver (UT or GW)
@@ -212,9 +212,9 @@ SatGeoUserPhy::Receive (Ptr<SatSignalParameters> rxParams, bool /*phyError*/)
                  m_nodeInfo->GetMacAddress (),
                  SatEnums::LL_PHY,
                  SatEnums::LD_RETURN,
-                 SatUtils::GetPacketInfo (rxParams->m_packetsInBurst));
+                 SatUtils::GetPacketInfo (rxParams->m_burst->m_packetsInBurst));
 
-  m_rxCallback ( rxParams->m_packetsInBurst, rxParams);
+  m_rxCallback ( rxParams->m_burst->m_packetsInBurst, rxParams);
 }
 
 double
@@ -121,6 +121,12 @@ SatGwLlc::CreateEncap (Ptr<EncapKey> key)
 
   Ptr<SatQueue> queue = CreateObject<SatQueue> (key->m_flowId);
   gwEncap->SetQueue (queue);
+  gwEncap->SetTxDataAvailableCallback (m_txDataAvailableCallback);
+
+  if (m_queueSizeTrackingEnabled)
+    {
+      gwEncap->SetQueueSizeChangeCallback (MakeCallback (&SatGwLlc::NotifyQueueSizeChange, this));
+    }
 
   NS_LOG_INFO ("Create encapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
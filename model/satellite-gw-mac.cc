@@ -55,6 +55,12 @@ SatGwMac::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&SatGwMac::m_dummyFrameSendingEnabled),
                    MakeBooleanChecker ())
+    .AddAttribute ("IdleCarrierSuspendEnabled",
+                   "Flag to tell, if an idle carrier suspends its frame clock until new data is available "
+                   "or the background load fills a frame. Has effect only when dummy frame sending is disabled.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatGwMac::m_idleCarrierSuspendEnabled),
+                   MakeBooleanChecker ())
     .AddAttribute ("Scheduler",
                    "Forward link scheduler used by this Sat GW MAC.",
                    PointerValue (),
@@ -77,6 +83,8 @@ SatGwMac::SatGwMac ()
   : SatMac (),
     m_fwdScheduler (),
     m_dummyFrameSendingEnabled (false),
+    m_idleCarrierSuspendEnabled (false),
+    m_carrierSuspended (false),
     m_guardTime (MicroSeconds (1))
 {
   NS_LOG_FUNCTION (this);
@@ -86,6 +94,8 @@ SatGwMac::SatGwMac (uint32_t beamId)
   : SatMac (beamId),
     m_fwdScheduler (),
     m_dummyFrameSendingEnabled (false),
+    m_idleCarrierSuspendEnabled (false),
+    m_carrierSuspended (false),
     m_guardTime (MicroSeconds (1))
 {
   NS_LOG_FUNCTION (this);
@@ -102,6 +112,7 @@ SatGwMac::DoDispose ()
   NS_LOG_FUNCTION (this);
 
   m_txOpportunityCallback.Nullify ();
+  m_backgroundCheckEvent.Cancel ();
 
   SatMac::DoDispose ();
 }
@@ -126,6 +137,64 @@ SatGwMac::StartPeriodicTransmissions ()
   Simulator::Schedule (Seconds (0), &SatGwMac::StartTransmission, this, 0);
 }
 
+void
+SatGwMac::NotifyTxDataAvailable ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_carrierSuspended )
+    {
+      ResumeCarrier ();
+    }
+}
+
+void
+SatGwMac::CheckBackgroundLoad ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Time delay = m_fwdScheduler->GetTimeToBackgroundFrame ();
+
+  if ( delay.IsZero () )
+    {
+      NS_LOG_INFO ("Background load fills a frame at: " << Now ().GetSeconds ());
+      ResumeCarrier ();
+    }
+  else
+    {
+      m_backgroundCheckEvent = Simulator::Schedule (delay, &SatGwMac::CheckBackgroundLoad, this);
+    }
+}
+
+void
+SatGwMac::ResumeCarrier ()
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_ASSERT (m_carrierSuspended);
+
+  m_carrierSuspended = false;
+  m_backgroundCheckEvent.Cancel ();
+
+  /**
+   * A never-idle carrier would have started a dummy frame at every
+   * m_idleFrameDuration after the suspension time. Resume at the first
+   * one of those boundaries after the current time. A boundary falling on
+   * the current time is considered passed already, since the never-idle
+   * carrier would have had its event for that instant scheduled earlier.
+   */
+  int64_t elapsedSteps = (Simulator::Now () - m_suspendTime).GetTimeStep ();
+  int64_t frameSteps = m_idleFrameDuration.GetTimeStep ();
+  NS_ASSERT (frameSteps > 0);
+
+  int64_t framesPassed = elapsedSteps / frameSteps + 1;
+  Time resumeTime = m_suspendTime + TimeStep (framesPassed * frameSteps);
+
+  NS_LOG_INFO ("Idle carrier resumed at: " << resumeTime.GetSeconds ());
+
+  Simulator::Schedule (resumeTime - Simulator::Now (), &SatGwMac::StartTransmission, this, 0);
+}
+
 void
 SatGwMac::Receive (SatPhy::PacketContainer_t packets, Ptr<SatSignalParameters> /*rxParams*/)
 {
@@ -206,8 +275,16 @@ SatGwMac::StartTransmission (uint32_t carrierId)
 
   Time txDuration = bbFrame->GetDuration ();
 
+  if ( bbFrame->IsBackgroundFrame () )
+    {
+      /**
+       * Frame reserved for the background load of the beam. There are no
+       * packets to send, but the carrier is kept busy for the frame duration.
+       */
+      NS_LOG_INFO ("Background frame at: " << Now ().GetSeconds ());
+    }
   // Always sent if non dummy frame in question. Dummy frames sent only when sending is enabled
-  if ( ( bbFrame->GetFrameType () != SatEnums::DUMMY_FRAME ) || m_dummyFrameSendingEnabled )
+  else if ( ( bbFrame->GetFrameType () != SatEnums::DUMMY_FRAME ) || m_dummyFrameSendingEnabled )
     {
       // trace out BB frames sent.
       m_bbFrameTxTrace (bbFrame);
@@ -233,6 +310,28 @@ SatGwMac::StartTransmission (uint32_t carrierId)
        */
       SendPacket (bbFrame->GetPayload (), carrierId, txDuration - m_guardTime, txInfo);
     }
+  else if ( m_idleCarrierSuspendEnabled )
+    {
+      /**
+       * Nothing to send and the scheduler has found nothing to schedule from
+       * LLC. Instead of ticking through dummy frames, suspend the carrier
+       * until LLC notifies about new data, see NotifyTxDataAvailable, or
+       * until the background load fills a frame.
+       */
+      NS_LOG_INFO ("Idle carrier suspended at: " << Now ().GetSeconds ());
+
+      m_carrierSuspended = true;
+      m_suspendTime = Simulator::Now ();
+      m_idleFrameDuration = txDuration;
+
+      Time backgroundDelay = m_fwdScheduler->GetTimeToBackgroundFrame ();
+
+      if ( backgroundDelay != Time::Max () )
+        {
+          m_backgroundCheckEvent = Simulator::Schedule (backgroundDelay, &SatGwMac::CheckBackgroundLoad, this);
+        }
+      return;
+    }
 
   /**
    * It is currently assumed that there is only one carrier in FWD link. This
@@ -244,6 +343,17 @@ SatGwMac::StartTransmission (uint32_t carrierId)
   Simulator::Schedule (txDuration, &SatGwMac::StartTransmission, this, 0);
 }
 
+void
+SatGwMac::ReserveSignallingCapacity (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  m_fwdScheduler->ReserveSignallingBytes (bytes);
+
+  // the reserved bytes need frames, as data from the LLC does
+  NotifyTxDataAvailable ();
+}
+
 void
 SatGwMac::ReceiveSignalingPacket (Ptr<Packet> packet)
 {
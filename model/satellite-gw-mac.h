@@ -25,6 +25,7 @@
 #include <ns3/callback.h>
 #include <ns3/traced-callback.h>
 #include <ns3/nstime.h>
+#include <ns3/event-id.h>
 #include <ns3/satellite-mac.h>
 #include <ns3/satellite-phy.h>
 
@@ -83,6 +84,14 @@ public:
    */
   void StartPeriodicTransmissions ();
 
+  /**
+   * Notify MAC that new data is available for transmission at upper layer.
+   * If the carrier has been suspended due to idleness, the transmission is
+   * resumed at the next frame boundary the carrier would have used if it had
+   * kept on running.
+   */
+  void NotifyTxDataAvailable ();
+
   /**
    * Receive packet from lower layer.
    *
@@ -119,6 +128,13 @@ public:
    */
   void SetTxOpportunityCallback (SatGwMac::TxOpportunityCallback cb);
 
+  /**
+   * \brief Reserve space for an abstracted signalling message from the BB
+   * frames of the forward link scheduler.
+   * \param bytes size of the message
+   */
+  virtual void ReserveSignallingCapacity (uint32_t bytes);
+
 private:
   SatGwMac& operator = (const SatGwMac &);
   SatGwMac (const SatGwMac &);
@@ -136,12 +152,24 @@ private:
    */
   void StartTransmission (uint32_t carrierId);
 
+  /**
+   * Resume the suspended carrier, if the background load fills a frame.
+   * Otherwise check again, when the background load may fill a frame.
+   */
+  void CheckBackgroundLoad ();
+
+  /**
+   * Resume the suspended carrier at the next frame boundary of a never-idle
+   * carrier.
+   */
+  void ResumeCarrier ();
+
   /**
    * Signaling packet receiver, which handles all the signaling packet
    * receptions.
    * \param packet Received signaling packet
    */
-  void ReceiveSignalingPacket (Ptr<Packet> packet);
+  virtual void ReceiveSignalingPacket (Ptr<Packet> packet);
 
   /**
    * Scheduler for the forward link.
@@ -154,6 +182,35 @@ private:
    */
   bool m_dummyFrameSendingEnabled;
 
+  /**
+   * Flag indicating if an idle carrier suspends its frame clock, instead of
+   * scheduling a (not sent) dummy frame after another. Has effect only when
+   * dummy frame sending is disabled.
+   */
+  bool m_idleCarrierSuspendEnabled;
+
+  /**
+   * Flag indicating that the carrier is currently suspended.
+   */
+  bool m_carrierSuspended;
+
+  /**
+   * Time of the last frame boundary before suspending the carrier.
+   */
+  Time m_suspendTime;
+
+  /**
+   * Duration of the dummy frame, which determines the frame boundaries
+   * of the suspended carrier.
+   */
+  Time m_idleFrameDuration;
+
+  /**
+   * Event checking whether the background load fills a frame while the
+   * carrier is suspended.
+   */
+  EventId m_backgroundCheckEvent;
+
   /**
    * Guard time for BB frames. The guard time is modeled by shortening
    * the duration of a BB frame by a m_guardTime set by an attribute.
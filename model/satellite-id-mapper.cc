@@ -84,6 +84,7 @@ SatIdMapper::Reset ()
       m_macToTraceIdMap.clear ();
     }
   m_traceIdIndex = 1;
+  m_traceIdEntries.clear ();
 
   // UT ID maps
 
@@ -143,6 +144,16 @@ SatIdMapper::AttachMacToTraceId (Address mac)
 
   NS_LOG_INFO ("SatIdMapper::AttachMacToTraceId - Added MAC " << mac << " with Trace ID " << m_traceIdIndex);
 
+  if (m_traceIdEntries.empty ())
+    {
+      // Trace IDs start from 1, thus the first entry is never used
+      TraceIdEntry_t unused = { Address (), -1, -1 };
+      m_traceIdEntries.push_back (unused);
+    }
+
+  TraceIdEntry_t entry = { mac, -1, -1 };
+  m_traceIdEntries.push_back (entry);
+
   m_traceIdIndex++;
   return ret;
 }
@@ -162,6 +173,12 @@ SatIdMapper::AttachMacToUtId (Address mac)
 
   NS_LOG_INFO ("SatIdMapper::AttachMacToUtId - Added MAC " << mac << " with UT ID " << m_utIdIndex);
 
+  TraceIdEntry_t * entry = GetTraceIdEntry (mac);
+  if (entry != NULL)
+    {
+      entry->m_utId = m_utIdIndex;
+    }
+
   m_utIdIndex++;
   return ret;
 }
@@ -213,6 +230,12 @@ SatIdMapper::AttachMacToGwId (Address mac, uint32_t gwId)
     }
 
   NS_LOG_INFO ("SatIdMapper::AttachMacToGwId - Added MAC " << mac << " with GW ID " << gwId);
+
+  TraceIdEntry_t * entry = GetTraceIdEntry (mac);
+  if (entry != NULL)
+    {
+      entry->m_gwId = gwId;
+    }
 }
 
 uint32_t
@@ -326,6 +349,62 @@ SatIdMapper::GetGwUserIdWithMac (Address mac) const
   return iter->second;
 }
 
+// DENSE TRACE ID GETTERS
+
+SatIdMapper::TraceIdEntry_t *
+SatIdMapper::GetTraceIdEntry (Address mac)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::map<Address, uint32_t>::const_iterator iter = m_macToTraceIdMap.find (mac);
+
+  if (iter == m_macToTraceIdMap.end ())
+    {
+      return NULL;
+    }
+
+  return &m_traceIdEntries[iter->second];
+}
+
+Address
+SatIdMapper::GetMacWithTraceId (uint32_t traceId) const
+{
+  NS_LOG_FUNCTION (this << traceId);
+
+  if (traceId == 0 || traceId >= m_traceIdEntries.size ())
+    {
+      return Address (); // returns an invalid address
+    }
+
+  return m_traceIdEntries[traceId].m_mac;
+}
+
+int32_t
+SatIdMapper::GetUtIdWithTraceId (uint32_t traceId) const
+{
+  NS_LOG_FUNCTION (this << traceId);
+
+  if (traceId == 0 || traceId >= m_traceIdEntries.size ())
+    {
+      return -1;
+    }
+
+  return m_traceIdEntries[traceId].m_utId;
+}
+
+int32_t
+SatIdMapper::GetGwIdWithTraceId (uint32_t traceId) const
+{
+  NS_LOG_FUNCTION (this << traceId);
+
+  if (traceId == 0 || traceId >= m_traceIdEntries.size ())
+    {
+      return -1;
+    }
+
+  return m_traceIdEntries[traceId].m_gwId;
+}
+
 // NODE GETTERS
 
 Address
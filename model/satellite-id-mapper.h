@@ -21,13 +21,14 @@
 #define SATELLITE_ID_MAPPER_H
 
 #include <ns3/object.h>
+#include <ns3/address.h>
 #include <map>
+#include <vector>
 
 namespace ns3 {
 
 
 class Node;
-class Address;
 
 /**
  * \ingroup satellite
@@ -153,6 +154,31 @@ public:
    */
   int32_t GetGwUserIdWithMac (Address mac) const;
 
+  /* DENSE TRACE ID GETTERS */
+
+  /**
+   * \brief Function for getting the MAC address with trace ID. The trace ID
+   *        is a dense index given to every UT and GW at scenario creation,
+   *        thus the lookup is a direct array access.
+   * \param traceId trace ID
+   * \return MAC address, or an invalid address if the trace ID is unknown
+   */
+  Address GetMacWithTraceId (uint32_t traceId) const;
+
+  /**
+   * \brief Function for getting the UT ID with trace ID. Returns -1 if the trace ID does not belong to a UT
+   * \param traceId trace ID
+   * \return UT ID
+   */
+  int32_t GetUtIdWithTraceId (uint32_t traceId) const;
+
+  /**
+   * \brief Function for getting the GW ID with trace ID. Returns -1 if the trace ID does not belong to a GW
+   * \param traceId trace ID
+   * \return GW ID
+   */
+  int32_t GetGwIdWithTraceId (uint32_t traceId) const;
+
   /* NODE GETTERS */
 
   /**
@@ -254,6 +280,31 @@ private:
    */
   std::map <Address, uint32_t> m_macToGwUserIdMap;
 
+  /**
+   * \brief Dense entry describing a MAC address attached to a trace ID.
+   */
+  typedef struct
+  {
+    Address m_mac;
+    int32_t m_utId;
+    int32_t m_gwId;
+  } TraceIdEntry_t;
+
+  /**
+   * \brief Vector for trace ID to MAC/UT/GW ID conversion, indexed
+   *        directly with trace ID (entry zero is unused). Only the IDs
+   *        SatChannel resolves from the source trace ID of the signal
+   *        parameters are kept.
+   */
+  std::vector<TraceIdEntry_t> m_traceIdEntries;
+
+  /**
+   * \brief Get the dense entry of a MAC address already attached to a trace ID
+   * \param mac MAC address
+   * \return pointer to the entry, or NULL if the MAC has no trace ID
+   */
+  TraceIdEntry_t * GetTraceIdEntry (Address mac);
+
   /**
    * \brief Is map printing enabled or not
    */
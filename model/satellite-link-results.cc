@@ -89,13 +89,24 @@ SatLinkResultsDvbRcs2::DoInitialize ()
 {
   NS_LOG_FUNCTION (this);
 
+  Ptr<SatParallelLoader> loader = Create<SatParallelLoader> ();
+
   // Waveform ids 2-22 currently supported
   for (uint32_t i = 2; i <= 22; ++i)
     {
       std::ostringstream ss;
       ss << i;
       std::string filePathName = m_inputPath + "rcs2_waveformat" + ss.str () + ".txt";
-      m_table.insert (std::make_pair (i, CreateObject<SatLookUpTable> (filePathName)));
+      m_table.insert (std::make_pair (i, CreateObject<SatLookUpTable> (filePathName, loader)));
+    }
+
+  loader->Run ();
+
+  m_tableByWaveformId.assign (m_table.rbegin ()->first + 1, Ptr<SatLookUpTable> ());
+  for (std::map<uint32_t, Ptr<SatLookUpTable> >::const_iterator it = m_table.begin ();
+       it != m_table.end (); ++it)
+    {
+      m_tableByWaveformId[it->first] = it->second;
     }
 } // end of void SatLinkResultsDvbRcs2::DoInitialize
 
@@ -109,7 +120,12 @@ SatLinkResultsDvbRcs2::GetBler (uint32_t waveformId, double ebNoDb) const
       NS_FATAL_ERROR ("Error retrieving link results, call Initialize first");
     }
 
-  return m_table.at (waveformId)->GetBler (ebNoDb);
+  if ((waveformId >= m_tableByWaveformId.size ()) || (m_tableByWaveformId[waveformId] == 0))
+    {
+      NS_FATAL_ERROR ("No link results for waveform id " << waveformId);
+    }
+
+  return m_tableByWaveformId[waveformId]->GetBler (ebNoDb);
 }
 
 double
@@ -157,37 +173,48 @@ SatLinkResultsDvbS2::DoInitialize ()
 {
   NS_LOG_FUNCTION (this);
 
+  Ptr<SatParallelLoader> loader = Create<SatParallelLoader> ();
+
   // QPSK
-  m_table[SatEnums::SAT_MODCOD_QPSK_1_TO_2] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_1_to_2.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_2_to_3.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_3_to_4.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_3_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_3_to_5.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_4_to_5.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_5_to_6.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_8_to_9.txt");
-  m_table[SatEnums::SAT_MODCOD_QPSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_9_to_10.txt");
+  m_table[SatEnums::SAT_MODCOD_QPSK_1_TO_2] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_1_to_2.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_2_to_3.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_3_to_4.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_3_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_3_to_5.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_4_to_5.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_5_to_6.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_8_to_9.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_QPSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_qpsk_9_to_10.txt", loader);
 
   // 8PSK
-  m_table[SatEnums::SAT_MODCOD_8PSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_2_to_3.txt");
-  m_table[SatEnums::SAT_MODCOD_8PSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_3_to_4.txt");
-  m_table[SatEnums::SAT_MODCOD_8PSK_3_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_3_to_5.txt");
-  m_table[SatEnums::SAT_MODCOD_8PSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_5_to_6.txt");
-  m_table[SatEnums::SAT_MODCOD_8PSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_8_to_9.txt");
-  m_table[SatEnums::SAT_MODCOD_8PSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_9_to_10.txt");
+  m_table[SatEnums::SAT_MODCOD_8PSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_2_to_3.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_8PSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_3_to_4.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_8PSK_3_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_3_to_5.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_8PSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_5_to_6.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_8PSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_8_to_9.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_8PSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_8psk_9_to_10.txt", loader);
 
   // 16APSK
-  m_table[SatEnums::SAT_MODCOD_16APSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_2_to_3.txt");
-  m_table[SatEnums::SAT_MODCOD_16APSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_3_to_4.txt");
-  m_table[SatEnums::SAT_MODCOD_16APSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_4_to_5.txt");
-  m_table[SatEnums::SAT_MODCOD_16APSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_5_to_6.txt");
-  m_table[SatEnums::SAT_MODCOD_16APSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_8_to_9.txt");
-  m_table[SatEnums::SAT_MODCOD_16APSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_9_to_10.txt");
+  m_table[SatEnums::SAT_MODCOD_16APSK_2_TO_3] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_2_to_3.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_16APSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_3_to_4.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_16APSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_4_to_5.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_16APSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_5_to_6.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_16APSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_8_to_9.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_16APSK_9_TO_10] = CreateObject<SatLookUpTable> (m_inputPath + "s2_16apsk_9_to_10.txt", loader);
 
   // 32APSK
-  m_table[SatEnums::SAT_MODCOD_32APSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_3_to_4.txt");
-  m_table[SatEnums::SAT_MODCOD_32APSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_4_to_5.txt");
-  m_table[SatEnums::SAT_MODCOD_32APSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_5_to_6.txt");
-  m_table[SatEnums::SAT_MODCOD_32APSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_8_to_9.txt");
+  m_table[SatEnums::SAT_MODCOD_32APSK_3_TO_4] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_3_to_4.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_32APSK_4_TO_5] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_4_to_5.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_32APSK_5_TO_6] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_5_to_6.txt", loader);
+  m_table[SatEnums::SAT_MODCOD_32APSK_8_TO_9] = CreateObject<SatLookUpTable> (m_inputPath + "s2_32apsk_8_to_9.txt", loader);
+
+  loader->Run ();
+
+  m_tableByModcod.assign (m_table.rbegin ()->first + 1, Ptr<SatLookUpTable> ());
+  for (std::map<SatEnums::SatModcod_t, Ptr<SatLookUpTable> >::const_iterator it = m_table.begin ();
+       it != m_table.end (); ++it)
+    {
+      m_tableByModcod[it->first] = it->second;
+    }
 
 } // end of void SatLinkResultsDvbS2::DoInitialize
 
@@ -211,7 +238,12 @@ SatLinkResultsDvbS2::GetBler (SatEnums::SatModcod_t modcod, SatEnums::SatBbFrame
       esNoDb -= m_shortFrameOffsetInDb;
     }
 
-  return m_table.at (modcod)->GetBler (esNoDb);
+  if ((static_cast<uint32_t> (modcod) >= m_tableByModcod.size ()) || (m_tableByModcod[modcod] == 0))
+    {
+      NS_FATAL_ERROR ("No link results for modcod " << (uint32_t) modcod);
+    }
+
+  return m_tableByModcod[modcod]->GetBler (esNoDb);
 }
 
 double
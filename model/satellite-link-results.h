@@ -23,6 +23,7 @@
 #define SATELLITE_LINK_RESULTS_H
 
 #include <map>
+#include <vector>
 
 #include <ns3/object.h>
 #include <ns3/ptr.h>
@@ -162,6 +163,13 @@ private:
    * - value = Ptr<SatLookUpTable>, i.e. look-up table containing the link results
    */
   std::map<uint32_t, Ptr<SatLookUpTable> > m_table;
+
+  /**
+   * \brief The look up tables of m_table indexed directly by waveform id,
+   *        for constant time access on every received burst. Null for
+   *        unsupported waveform ids.
+   */
+  std::vector<Ptr<SatLookUpTable> > m_tableByWaveformId;
 };
 
 
@@ -233,6 +241,13 @@ private:
    */
   std::map<SatEnums::SatModcod_t, Ptr<SatLookUpTable> > m_table;
 
+  /**
+   * \brief The look up tables of m_table indexed directly by modulation and
+   *        coding scheme, for constant time access on every received frame.
+   *        Null for unsupported modulation and coding schemes.
+   */
+  std::vector<Ptr<SatLookUpTable> > m_tableByModcod;
+
   double m_shortFrameOffsetInDb;
 };
 
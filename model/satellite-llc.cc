@@ -24,7 +24,7 @@
 #include <ns3/nstime.h>
 
 #include "satellite-llc.h"
-#include <ns3/satellite-time-tag.h>
+#include <ns3/satellite-metadata-tag.h>
 #include <ns3/satellite-scheduling-object.h>
 #include <ns3/satellite-control-message.h>
 #include <ns3/satellite-node-info.h>
@@ -58,6 +58,12 @@ SatLlc::GetTypeId (void)
                      "Packet event trace",
                      MakeTraceSourceAccessor (&SatLlc::m_packetTrace),
                      "ns3::PacketTraceCallback")
+    .AddTraceSource ("QueueSizeChange",
+                     "Change in the number of bytes and packets queued in "
+                     "an encapsulator, with the encapsulator source and "
+                     "destination address.",
+                     MakeTraceSourceAccessor (&SatLlc::m_queueSizeChangeTrace),
+                     "ns3::SatLlc::QueueSizeChangeCallback")
   ;
   return tid;
 }
@@ -68,7 +74,8 @@ SatLlc::SatLlc ()
     m_decaps (),
     m_fwdLinkArqEnabled (false),
     m_rtnLinkArqEnabled (false),
-    m_gwAddress ()
+    m_gwAddress (),
+    m_queueSizeTrackingEnabled (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -83,6 +90,7 @@ SatLlc::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_rxCallback.Nullify ();
+  m_txDataAvailableCallback.Nullify ();
 
   EncapContainer_t::iterator it;
 
@@ -127,11 +135,15 @@ SatLlc::Enque (Ptr<Packet> packet, Address dest, uint8_t flowId)
     }
 
   // Store packet arrival time
-  SatTimeTag timeTag (Simulator::Now ());
-  packet->AddPacketTag (timeTag);
+  SatMetadataTag::StampPacket (packet, SatMetadataTag::TS_LLC, Simulator::Now ());
 
   it->second->EnquePdu (packet, Mac48Address::ConvertFrom (dest));
 
+  if (!m_txDataAvailableCallback.IsNull ())
+    {
+      m_txDataAvailableCallback ();
+    }
+
   SatEnums::SatLinkDir_t ld =
     (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
 
@@ -230,9 +242,8 @@ SatLlc::ReceiveHigherLayerPdu (Ptr<Packet> packet, Mac48Address source, Mac48Add
 {
   NS_LOG_FUNCTION (this << packet << source << dest);
 
-  // Remove time tag
-  SatTimeTag timeTag;
-  packet->RemovePacketTag (timeTag);
+  // Remove time stamp
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_LLC);
 
   // Remove control msg tag
   SatControlMsgTag ctrlTag;
@@ -277,6 +288,13 @@ SatLlc::AddEncap (Mac48Address source, Mac48Address dest, uint8_t flowId, Ptr<Sa
     {
       NS_LOG_INFO ("Add encapsulator with key (" << source << ", " << dest << ", " << (uint32_t) flowId << ")");
 
+      enc->SetTxDataAvailableCallback (m_txDataAvailableCallback);
+
+      if (m_queueSizeTrackingEnabled)
+        {
+          enc->SetQueueSizeChangeCallback (MakeCallback (&SatLlc::NotifyQueueSizeChange, this));
+        }
+
       std::pair<EncapContainer_t::iterator, bool> result = m_encaps.insert (std::make_pair (key, enc));
       if (result.second == false)
         {
@@ -406,6 +424,39 @@ SatLlc::SetReadCtrlCallback (SatLlc::ReadCtrlMsgCallback cb)
   m_readCtrlCallback = cb;
 }
 
+void
+SatLlc::SetTxDataAvailableCallback (SatBaseEncapsulator::TxDataAvailableCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+
+  m_txDataAvailableCallback = cb;
+
+  for (EncapContainer_t::iterator it = m_encaps.begin (); it != m_encaps.end (); ++it)
+    {
+      it->second->SetTxDataAvailableCallback (cb);
+    }
+}
+
+void
+SatLlc::EnableQueueSizeTracking ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_queueSizeTrackingEnabled = true;
+
+  for (EncapContainer_t::iterator it = m_encaps.begin (); it != m_encaps.end (); ++it)
+    {
+      it->second->SetQueueSizeChangeCallback (MakeCallback (&SatLlc::NotifyQueueSizeChange, this));
+    }
+}
+
+void
+SatLlc::NotifyQueueSizeChange (Mac48Address source, Mac48Address dest,
+                               int32_t bytesDelta, int32_t packetsDelta)
+{
+  m_queueSizeChangeTrace (source, dest, bytesDelta, packetsDelta);
+}
+
 void
 SatLlc::SetCtrlMsgCallback (SatBaseEncapsulator::SendCtrlCallback cb)
 {
@@ -144,7 +144,7 @@ public:
    * \brief Receive callback used for sending packet to netdevice layer.
     * \param packet the packet received
     */
-  typedef Callback<void,Ptr<const Packet> > ReceiveCallback;
+  typedef Callback<void,Ptr<Packet> > ReceiveCallback;
 
   /**
    * \brief Callback to read control messages from container storing control messages.
@@ -154,12 +154,36 @@ public:
    */
   typedef Callback<Ptr<SatControlMessage>, uint32_t> ReadCtrlMsgCallback;
 
+  /**
+   * \brief Signature of the QueueSizeChange trace source.
+   * \param source Source MAC address of the encapsulator
+   * \param dest Destination MAC address of the encapsulator
+   * \param bytesDelta Change in the number of bytes in queue
+   * \param packetsDelta Change in the number of packets in queue
+   */
+  typedef void (* QueueSizeChangeCallback)
+    (Mac48Address source, Mac48Address dest, int32_t bytesDelta, int32_t packetsDelta);
+
   /**
    * \brief Method to set read control message callback.
    * \param cb callback to invoke whenever a control message is wanted to read.
    */
   void SetReadCtrlCallback (SatLlc::ReadCtrlMsgCallback cb);
 
+  /**
+   * \brief Method to set the callback invoked whenever new data becomes
+   * available for transmission, either by enqueuing or by ARQ retransmission.
+   * \param cb callback to invoke
+   */
+  void SetTxDataAvailableCallback (SatBaseEncapsulator::TxDataAvailableCallback cb);
+
+  /**
+   * \brief Enable the QueueSizeChange trace source. The queues of the
+   * encapsulators are traced only after this, to keep the cost of the
+   * enqueue and dequeue operations low when nobody uses the trace.
+   */
+  void EnableQueueSizeTracking ();
+
   /**
     * \brief Called from higher layer (SatNetDevice) to enque packet to LLC
     *
@@ -336,6 +360,17 @@ protected:
    */
   virtual void ReceiveAck (Ptr<SatArqAckMessage> ack, Mac48Address source, Mac48Address dest);
 
+  /**
+   * \brief Receive a change in the queue size of an encapsulator and
+   *        forward it to the QueueSizeChange trace source.
+   * \param source Source MAC address of the encapsulator
+   * \param dest Destination MAC address of the encapsulator
+   * \param bytesDelta Change in the number of bytes in queue
+   * \param packetsDelta Change in the number of packets in queue
+   */
+  void NotifyQueueSizeChange (Mac48Address source, Mac48Address dest,
+                              int32_t bytesDelta, int32_t packetsDelta);
+
   /**
    * Trace callback used for packet tracing:
    */
@@ -349,6 +384,13 @@ protected:
                  std::string
                  > m_packetTrace;
 
+  /**
+   * Trace callback used for changes in the queue size of any encapsulator:
+   * source and destination address of the encapsulator, change in bytes
+   * and change in packets.
+   */
+  TracedCallback<Mac48Address, Mac48Address, int32_t, int32_t> m_queueSizeChangeTrace;
+
   /**
    * Node info containing node related information, such as
    * node type, node id and MAC address (of the SatNetDevice)
@@ -380,6 +422,11 @@ protected:
    */
   Mac48Address m_gwAddress;
 
+  /**
+   * Are the queue size changes of the encapsulators traced
+   */
+  bool m_queueSizeTrackingEnabled;
+
   /**
    * The upper layer package receive callback.
    */
@@ -397,6 +444,12 @@ protected:
   */
   SatBaseEncapsulator::SendCtrlCallback m_sendCtrlCallback;
 
+  /**
+   * Callback to notify about data becoming available for transmission.
+   * Passed also to the encapsulators.
+   */
+  SatBaseEncapsulator::TxDataAvailableCallback m_txDataAvailableCallback;
+
 };
 
 } // namespace ns3
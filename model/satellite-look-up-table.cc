@@ -20,6 +20,7 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 #include "ns3/log.h"
 #include "ns3/fatal-error.h"
@@ -34,12 +35,21 @@ NS_OBJECT_ENSURE_REGISTERED (SatLookUpTable);
 
 
 SatLookUpTable::SatLookUpTable (std::string linkResultPath)
+  : m_ifs (0)
 {
   NS_LOG_FUNCTION (this << linkResultPath);
   Load (linkResultPath);
 }
 
 
+SatLookUpTable::SatLookUpTable (std::string linkResultPath, Ptr<SatParallelLoader> loader)
+  : m_ifs (0)
+{
+  NS_LOG_FUNCTION (this << linkResultPath);
+  loader->Add (MakeCallback (&SatLookUpTable::Load, this), linkResultPath);
+}
+
+
 SatLookUpTable::~SatLookUpTable ()
 {
   NS_LOG_FUNCTION (this);
@@ -97,12 +107,9 @@ SatLookUpTable::GetBler (double esNoDb) const
       return 1.0;
     }
 
-  uint16_t i = 1;
-
-  while ((i < n) && (esNoDb > m_esNoDb[i]))
-    {
-      i++;
-    }
+  // First entry from index 1 onwards with Es/No not smaller than the given
+  // one. The table is strictly increasing, which is verified by Load ().
+  uint16_t i = std::lower_bound (m_esNoDb.begin () + 1, m_esNoDb.end (), esNoDb) - m_esNoDb.begin ();
 
   NS_LOG_DEBUG (this << " i=" << i << " esno[i]=" << m_esNoDb[i]
                      << " bler[i]=" << m_bler[i]);
@@ -174,7 +181,7 @@ SatLookUpTable::GetEsNoDb (double blerTarget) const
 void
 SatLookUpTable::Load (std::string linkResultPath)
 {
-  NS_LOG_FUNCTION (this << linkResultPath);
+  // No logging here, as the file may be parsed on a thread of SatParallelLoader
 
   // READ FROM THE SPECIFIED INPUT FILE
 
@@ -201,8 +208,6 @@ SatLookUpTable::Load (std::string linkResultPath)
 
   while (m_ifs->good ())
     {
-      NS_LOG_DEBUG (this << " sinrDb=" << esNoDb << ", bler=" << bler);
-
       // SANITY CHECK PART I
       if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
         {
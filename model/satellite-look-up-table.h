@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "ns3/object.h"
+#include "ns3/satellite-parallel-loader.h"
 
 
 namespace ns3 {
@@ -45,6 +46,14 @@ public:
    */
   SatLookUpTable (std::string linkResultPath);
 
+  /**
+   * Constructor, which registers the link result file to be parsed by the
+   * given loader. The table can be used only after the loader has been run.
+   * \param linkResultPath
+   * \param loader the loader parsing the file
+   */
+  SatLookUpTable (std::string linkResultPath, Ptr<SatParallelLoader> loader);
+
   /**
    * Destructor for SatLookUpTable
    */
@@ -74,7 +83,8 @@ private:
   virtual void DoDispose ();
 
   /**
-   * \brief Load the link results
+   * \brief Load the link results. Does not log, as it may be run on a
+   * thread of SatParallelLoader.
    * \param linkResultsPath Path to a link results file.
    */
   void Load (std::string linkResultPath);
@@ -27,8 +27,7 @@
 #include <ns3/nstime.h>
 #include <ns3/pointer.h>
 #include <ns3/satellite-mac-tag.h>
-#include <ns3/satellite-address-tag.h>
-#include <ns3/satellite-time-tag.h>
+#include <ns3/satellite-metadata-tag.h>
 #include <ns3/satellite-typedefs.h>
 #include "satellite-mac.h"
 
@@ -149,18 +148,34 @@ SatMac::ReceiveQueueEvent (SatQueue::QueueEvent_t /*event*/, uint8_t /*flowIndex
   NS_LOG_FUNCTION (this);
 }
 
+void
+SatMac::ReceiveSignalingPacket (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  NS_FATAL_ERROR ("SatMac::ReceiveSignalingPacket - signalling not supported by this MAC");
+}
+
+void
+SatMac::ReserveSignallingCapacity (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  NS_FATAL_ERROR ("SatMac::ReserveSignallingCapacity - signalling not supported by this MAC");
+}
+
 void
 SatMac::SendPacket (SatPhy::PacketContainer_t packets, uint32_t carrierId, Time duration, SatSignalParameters::txInfo_s txInfo)
 {
   NS_LOG_FUNCTION (this);
 
-  // Add a SatMacTimeTag tag for packet delay computation at the receiver end.
+  // Add a MAC time stamp for packet delay computation at the receiver end.
   if (m_isStatisticsTagsEnabled)
     {
       for (SatPhy::PacketContainer_t::const_iterator it = packets.begin ();
            it != packets.end (); ++it)
         {
-          (*it)->AddPacketTag (SatMacTimeTag (Simulator::Now ()));
+          SatMetadataTag::StampPacket (*it, SatMetadataTag::TS_MAC, Simulator::Now ());
         }
     }
 
@@ -223,35 +238,26 @@ SatMac::RxTraces (SatPhy::PacketContainer_t packets)
           if (destAddress == m_nodeInfo->GetMacAddress ())
             {
               Address addr; // invalid address.
+              SatMetadataTag metadataTag;
+              bool isTagged = (*it1)->PeekPacketTag (metadataTag);
 
-              bool isTaggedWithAddress = false;
-              ByteTagIterator it2 = (*it1)->GetByteTagIterator ();
-
-              while (!isTaggedWithAddress && it2.HasNext ())
+              if (isTagged && metadataTag.HasSourceAddress ())
                 {
-                  ByteTagIterator::Item item = it2.Next ();
-
-                  if (item.GetTypeId () == SatAddressTag::GetTypeId ())
-                    {
-                      NS_LOG_DEBUG (this << " contains a SatAddressTag tag:"
-                                         << " start=" << item.GetStart ()
-                                         << " end=" << item.GetEnd ());
-                      SatAddressTag addrTag;
-                      item.GetTag (addrTag);
-                      addr = addrTag.GetSourceAddress ();
-                      isTaggedWithAddress = true; // this will exit the while loop.
-                    }
+                  NS_LOG_DEBUG (this << " contains a source address " << metadataTag.GetSourceAddress ());
+                  addr = metadataTag.GetSourceAddress ();
                 }
 
               m_rxTrace (*it1, addr);
 
-              SatMacTimeTag timeTag;
-              if ((*it1)->RemovePacketTag (timeTag))
+              if (isTagged && metadataTag.HasTimestamp (SatMetadataTag::TS_MAC))
                 {
-                  NS_LOG_DEBUG (this << " contains a SatMacTimeTag tag");
-                  m_rxDelayTrace (Simulator::Now () - timeTag.GetSenderTimestamp (),
+                  NS_LOG_DEBUG (this << " contains a MAC time stamp");
+                  m_rxDelayTrace (Simulator::Now () - metadataTag.GetTimestamp (SatMetadataTag::TS_MAC),
                                   addr);
                 }
+
+              // Remove the MAC time stamp
+              SatMetadataTag::ClearPacketTimestamp (*it1, SatMetadataTag::TS_MAC);
             } // end of `if (destAddress == m_nodeInfo->GetMacAddress () || destAddress.IsBroadcast ())`
         } // end of `for it1 = packets.begin () -> packets.end ()`
     } // end of `if (m_isStatisticsTagsEnabled)`
@@ -180,6 +180,22 @@ public:
    */
   virtual void ReceiveQueueEvent (SatQueue::QueueEvent_t event, uint8_t flowIndex);
 
+  /**
+   * \brief Receive a signalling packet, i.e. a packet carrying a control
+   * message tag. Used directly by SatSignallingChannel, when the signalling
+   * is abstracted. The packet shall carry a MAC tag.
+   * \param packet the signalling packet
+   */
+  virtual void ReceiveSignalingPacket (Ptr<Packet> packet);
+
+  /**
+   * \brief Reserve transmission capacity for a signalling message sent
+   * through SatSignallingChannel, so that the abstracted messages take the
+   * capacity they would take in the data path.
+   * \param bytes size of the message
+   */
+  virtual void ReserveSignallingCapacity (uint32_t bytes);
+
 private:
   SatMac& operator = (const SatMac &);
   SatMac (const SatMac &);
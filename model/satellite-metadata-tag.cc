@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+#include "satellite-metadata-tag.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatMetadataTag");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatMetadataTag);
+
+SatMetadataTag::SatMetadataTag ()
+  : m_sourceAddress (),
+    m_flags (0)
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t i = 0; i < TS_COUNT; i++)
+    {
+      m_timestamps[i] = 0;
+    }
+}
+
+SatMetadataTag::~SatMetadataTag ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TypeId
+SatMetadataTag::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatMetadataTag")
+    .SetParent<Tag> ()
+    .AddConstructor<SatMetadataTag> ()
+  ;
+  return tid;
+}
+
+TypeId
+SatMetadataTag::GetInstanceTypeId (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetTypeId ();
+}
+
+void
+SatMetadataTag::SetSourceAddress (Mac48Address source)
+{
+  NS_LOG_FUNCTION (this << source);
+
+  m_sourceAddress = source;
+  m_flags |= SOURCE_ADDRESS_FLAG;
+}
+
+bool
+SatMetadataTag::HasSourceAddress () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return (m_flags & SOURCE_ADDRESS_FLAG) != 0;
+}
+
+Mac48Address
+SatMetadataTag::GetSourceAddress () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_sourceAddress;
+}
+
+void
+SatMetadataTag::SetTimestamp (TimestampLayer_t layer, Time timestamp)
+{
+  NS_LOG_FUNCTION (this << layer << timestamp);
+  NS_ASSERT (layer < TS_COUNT);
+
+  m_timestamps[layer] = timestamp.GetNanoSeconds ();
+  m_flags |= (1 << layer);
+}
+
+bool
+SatMetadataTag::HasTimestamp (TimestampLayer_t layer) const
+{
+  NS_LOG_FUNCTION (this << layer);
+  NS_ASSERT (layer < TS_COUNT);
+
+  return (m_flags & (1 << layer)) != 0;
+}
+
+void
+SatMetadataTag::ClearTimestamp (TimestampLayer_t layer)
+{
+  NS_LOG_FUNCTION (this << layer);
+  NS_ASSERT (layer < TS_COUNT);
+
+  m_timestamps[layer] = 0;
+  m_flags &= ~(1 << layer);
+}
+
+Time
+SatMetadataTag::GetTimestamp (TimestampLayer_t layer) const
+{
+  NS_LOG_FUNCTION (this << layer);
+  NS_ASSERT (layer < TS_COUNT);
+
+  return NanoSeconds (m_timestamps[layer]);
+}
+
+void
+SatMetadataTag::StampPacket (Ptr<Packet> packet, TimestampLayer_t layer, Time timestamp)
+{
+  NS_LOG_FUNCTION (packet << layer << timestamp);
+
+  SatMetadataTag tag;
+  packet->PeekPacketTag (tag);
+  tag.SetTimestamp (layer, timestamp);
+  UpdatePacket (packet, tag);
+}
+
+void
+SatMetadataTag::ClearPacketTimestamp (Ptr<Packet> packet, TimestampLayer_t layer)
+{
+  NS_LOG_FUNCTION (packet << layer);
+
+  SatMetadataTag tag;
+
+  if (packet->PeekPacketTag (tag) && tag.HasTimestamp (layer))
+    {
+      tag.ClearTimestamp (layer);
+
+      if (tag.m_flags == 0)
+        {
+          packet->RemovePacketTag (tag);
+        }
+      else
+        {
+          packet->ReplacePacketTag (tag);
+        }
+    }
+}
+
+void
+SatMetadataTag::UpdatePacket (Ptr<Packet> packet, SatMetadataTag &tag)
+{
+  NS_LOG_FUNCTION (packet);
+
+  if (!packet->ReplacePacketTag (tag))
+    {
+      packet->AddPacketTag (tag);
+    }
+}
+
+uint32_t
+SatMetadataTag::GetSerializedSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return ( ADDRESS_LENGTH + sizeof (uint8_t) + TS_COUNT * sizeof (int64_t) );
+}
+
+void
+SatMetadataTag::Serialize (TagBuffer i) const
+{
+  NS_LOG_FUNCTION (this << &i);
+
+  uint8_t buff[ADDRESS_LENGTH];
+
+  m_sourceAddress.CopyTo (buff);
+  i.Write (buff, ADDRESS_LENGTH);
+
+  i.WriteU8 (m_flags);
+
+  for (uint32_t j = 0; j < TS_COUNT; j++)
+    {
+      i.WriteU64 (m_timestamps[j]);
+    }
+}
+
+void
+SatMetadataTag::Deserialize (TagBuffer i)
+{
+  NS_LOG_FUNCTION (this << &i);
+
+  uint8_t buff[ADDRESS_LENGTH];
+
+  i.Read (buff, ADDRESS_LENGTH);
+  m_sourceAddress.CopyFrom (buff);
+
+  m_flags = i.ReadU8 ();
+
+  for (uint32_t j = 0; j < TS_COUNT; j++)
+    {
+      m_timestamps[j] = i.ReadU64 ();
+    }
+}
+
+void
+SatMetadataTag::Print (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+
+  os << "SourceAddress=" << m_sourceAddress << " Flags=" << (uint32_t) m_flags;
+
+  for (uint32_t j = 0; j < TS_COUNT; j++)
+    {
+      os << " Timestamp" << j << "=" << m_timestamps[j];
+    }
+}
+
+} // namespace ns3
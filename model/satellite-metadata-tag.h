@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_METADATA_TAG_H
+#define SATELLITE_METADATA_TAG_H
+
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/tag.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Fixed layout record of the per-packet satellite metadata used for
+ * delay statistics and head-of-line delay: the address of the originating
+ * satellite device and the time stamps set at the LLC, device, MAC and PHY
+ * layers. Each layer updates and reads the record with one packet tag
+ * lookup.
+ *
+ * The receiving layers clear their own time stamps, and the record is
+ * removed from the packet once nothing is left in it. The source address is
+ * kept, so that it is still found when the packet crosses a second
+ * satellite device.
+ *
+ * The record covers only the statistics metadata. The MAC addressing
+ * (SatMacTag), control message (SatControlMsgTag) and encapsulation status
+ * (SatEncapPduStatusTag) tags are separate tags, as they are added and
+ * removed by single layers and are not carried end to end.
+ */
+class SatMetadataTag : public Tag
+{
+public:
+  /**
+   * Layers setting a time stamp to the record
+   */
+  typedef enum
+  {
+    TS_LLC = 0, //!< Packet enqueued at the LLC
+    TS_DEV = 1, //!< Packet sent by the satellite net device
+    TS_MAC = 2, //!< Packet sent by the MAC
+    TS_PHY = 3, //!< Packet sent by the PHY
+    TS_COUNT = 4
+  } TimestampLayer_t;
+
+  /**
+   * Default constructor.
+   */
+  SatMetadataTag ();
+
+  /**
+   * Destructor for SatMetadataTag
+   */
+  ~SatMetadataTag ();
+
+  /**
+   * \brief Set the address of the originating satellite device
+   * \param source Source MAC address
+   */
+  void SetSourceAddress (Mac48Address source);
+
+  /**
+   * \brief Check whether the address of the originating device is set
+   * \return true if the source address is set
+   */
+  bool HasSourceAddress (void) const;
+
+  /**
+   * \brief Get the address of the originating satellite device
+   * \return Source MAC address
+   */
+  Mac48Address GetSourceAddress (void) const;
+
+  /**
+   * \brief Set a layer time stamp
+   * \param layer Layer of the time stamp
+   * \param timestamp Time stamp
+   */
+  void SetTimestamp (TimestampLayer_t layer, Time timestamp);
+
+  /**
+   * \brief Check whether a layer time stamp is set
+   * \param layer Layer of the time stamp
+   * \return true if the time stamp is set
+   */
+  bool HasTimestamp (TimestampLayer_t layer) const;
+
+  /**
+   * \brief Clear a layer time stamp
+   * \param layer Layer of the time stamp
+   */
+  void ClearTimestamp (TimestampLayer_t layer);
+
+  /**
+   * \brief Get a layer time stamp
+   * \param layer Layer of the time stamp
+   * \return Time stamp, zero if not set
+   */
+  Time GetTimestamp (TimestampLayer_t layer) const;
+
+  /**
+   * \brief Set a layer time stamp to the metadata of a packet. The metadata
+   * record is added to the packet if it does not have one yet.
+   * \param packet Packet to stamp
+   * \param layer Layer of the time stamp
+   * \param timestamp Time stamp
+   */
+  static void StampPacket (Ptr<Packet> packet, TimestampLayer_t layer, Time timestamp);
+
+  /**
+   * \brief Clear a layer time stamp from the metadata of a packet. The
+   * metadata record is removed from the packet if nothing is left in it.
+   * \param packet Packet to update
+   * \param layer Layer of the time stamp
+   */
+  static void ClearPacketTimestamp (Ptr<Packet> packet, TimestampLayer_t layer);
+
+  /**
+   * \brief Store the metadata record to a packet, replacing a possible
+   * earlier record.
+   * \param packet Packet to update
+   * \param tag Metadata record
+   */
+  static void UpdatePacket (Ptr<Packet> packet, SatMetadataTag &tag);
+
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Get serialized size of SatMetadataTag
+   * \return Serialized size in bytes
+   */
+  virtual uint32_t GetSerializedSize (void) const;
+
+  /**
+   * Serializes information to buffer from this instance of SatMetadataTag
+   * \param i Buffer in which the information is serialized
+   */
+  virtual void Serialize (TagBuffer i) const;
+
+  /**
+   * Deserializes information from buffer to this instance of SatMetadataTag
+   * \param i Buffer from which the information is deserialized
+   */
+  virtual void Deserialize (TagBuffer i);
+
+  /**
+   * Print the contents of this instance of SatMetadataTag
+   * \param &os Output stream to which the tag is printed.
+   */
+  virtual void Print (std::ostream &os) const;
+
+private:
+  static const uint32_t ADDRESS_LENGTH = 6;
+  static const uint8_t SOURCE_ADDRESS_FLAG = 0x80;
+
+  Mac48Address  m_sourceAddress;
+  uint8_t       m_flags;
+  int64_t       m_timestamps[TS_COUNT];
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_METADATA_TAG_H */
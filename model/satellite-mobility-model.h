@@ -76,6 +76,20 @@ public:
   typedef void (*CourseChangeCallback)
     (const Ptr<const SatMobilityModel> model);
 
+protected:
+  /**
+   * This method is used to force update of cartesian position.
+   * Cartesian position is updated when position is set by method DoSetPosition.
+   * In case that position is updated by method DoSetGeoPosition cartesian position is
+   * updated only if it is requested by method DoGetPosition. Subclasses, which
+   * have already computed the cartesian position, may set it with this method
+   * to avoid the conversion.
+   *
+   * \param position position in cartesian format to set
+   *
+   */
+  void DoSetCartesianPosition (const Vector &position) const;
+
 private:
   /**
    * \return the current position.
@@ -91,16 +105,6 @@ private:
    * implement this method.
    */
   virtual void DoSetGeoPosition (const GeoCoordinate &position) = 0;
-  /**
-   * This method is used to force update of cartesian position.
-   * Cartesian position is updated when position is set by method DoSetPosition.
-   * In case that position is updated by method DoSetGeoPosition cartesian position is
-   * updated only if it is requested by method DoGetPosition.
-   *
-   * \param position position in cartesian format to set
-   *
-   */
-  void DoSetCartesianPosition (const Vector &position) const;
 
   /**
    * \return cartesian format position as vector
@@ -25,7 +25,6 @@
 #include <ns3/boolean.h>
 #include <ns3/error-model.h>
 #include <ns3/trace-source-accessor.h>
-#include <ns3/ipv4-header.h>
 #include <ns3/ipv4-l3-protocol.h>
 #include <ns3/channel.h>
 
@@ -36,9 +35,9 @@
 #include <ns3/satellite-control-message.h>
 #include <ns3/satellite-utils.h>
 #include <ns3/satellite-node-info.h>
-#include <ns3/satellite-address-tag.h>
-#include <ns3/satellite-time-tag.h>
+#include <ns3/satellite-metadata-tag.h>
 #include <ns3/satellite-typedefs.h>
+#include <ns3/satellite-signalling-channel.h>
 
 NS_LOG_COMPONENT_DEFINE ("SatNetDevice");
 
@@ -119,7 +118,7 @@ SatNetDevice::SatNetDevice ()
 }
 
 void
-SatNetDevice::Receive (Ptr<const Packet> packet)
+SatNetDevice::Receive (Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this << packet);
   NS_LOG_INFO ("Time " << Simulator::Now ().GetSeconds () << ": receiving a packet: " << packet->GetUid ());
@@ -138,40 +137,34 @@ SatNetDevice::Receive (Ptr<const Packet> packet)
                  SatUtils::GetPacketInfo (packet));
 
   /*
-   * Invoke the `Rx` and `RxDelay` trace sources. We look at the packet's tags
-   * for information, but cannot remove the tags because the packet is a const.
+   * Invoke the `Rx` and `RxDelay` trace sources. The packet is owned by
+   * this receiver, so the device time stamp is removed in place.
    */
   if (m_isStatisticsTagsEnabled)
     {
       Address addr; // invalid address.
-      bool isTaggedWithAddress = false;
-      ByteTagIterator it = packet->GetByteTagIterator ();
+      SatMetadataTag metadataTag;
+      bool isTagged = packet->PeekPacketTag (metadataTag);
 
-      while (!isTaggedWithAddress && it.HasNext ())
+      if (isTagged && metadataTag.HasSourceAddress ())
         {
-          ByteTagIterator::Item item = it.Next ();
-
-          if (item.GetTypeId () == SatAddressTag::GetTypeId ())
-            {
-              NS_LOG_DEBUG (this << " contains a SatAddressTag tag:"
-                                 << " start=" << item.GetStart ()
-                                 << " end=" << item.GetEnd ());
-              SatAddressTag addrTag;
-              item.GetTag (addrTag);
-              addr = addrTag.GetSourceAddress ();
-              isTaggedWithAddress = true; // this will exit the while loop.
-            }
+          NS_LOG_DEBUG (this << " contains a source address " << metadataTag.GetSourceAddress ());
+          addr = metadataTag.GetSourceAddress ();
         }
 
       m_rxTrace (packet, addr);
 
-      SatDevTimeTag timeTag;
-      if (packet->PeekPacketTag (timeTag))
+      if (isTagged && metadataTag.HasTimestamp (SatMetadataTag::TS_DEV))
         {
-          NS_LOG_DEBUG (this << " contains a SatDevTimeTag tag");
-          m_rxDelayTrace (Simulator::Now () - timeTag.GetSenderTimestamp (),
+          NS_LOG_DEBUG (this << " contains a device time stamp");
+          m_rxDelayTrace (Simulator::Now () - metadataTag.GetTimestamp (SatMetadataTag::TS_DEV),
                           addr);
         }
+
+      if (isTagged)
+        {
+          SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_DEV);
+        }
     }
 
   // Pass the packet to the upper layer.
@@ -205,6 +198,107 @@ SatNetDevice::SetNodeInfo (Ptr<SatNodeInfo> nodeInfo)
   m_nodeInfo = nodeInfo;
 }
 
+void
+SatNetDevice::AddNetworkBlock (Ipv4Address block, Ipv4Mask blockMask, Ipv4Mask networkMask)
+{
+  NS_LOG_FUNCTION (this << block << blockMask << networkMask);
+
+  if (networkMask.GetPrefixLength () < blockMask.GetPrefixLength ())
+    {
+      NS_FATAL_ERROR ("SatNetDevice::AddNetworkBlock - Network mask " << networkMask << " wider than block mask " << blockMask);
+    }
+
+  NetworkBlock_t networkBlock;
+  networkBlock.m_network = block.CombineMask (blockMask).Get ();
+  networkBlock.m_mask = blockMask.Get ();
+  networkBlock.m_shift = 32 - networkMask.GetPrefixLength ();
+
+  m_networkBlocks.push_back (networkBlock);
+}
+
+void
+SatNetDevice::AddNetworkMacAddress (Ipv4Address network, Ipv4Mask mask, Address macAddress)
+{
+  NS_LOG_FUNCTION (this << network << mask << macAddress);
+
+  uint32_t address = network.CombineMask (mask).Get ();
+
+  for (std::vector<NetworkBlock_t>::iterator it = m_networkBlocks.begin (); it != m_networkBlocks.end (); ++it)
+    {
+      if ((address & it->m_mask) == it->m_network)
+        {
+          if (32 - mask.GetPrefixLength () != it->m_shift)
+            {
+              NS_FATAL_ERROR ("SatNetDevice::AddNetworkMacAddress - Mask " << mask << " of network " << network << " differs from its block");
+            }
+
+          uint32_t index = (address - it->m_network) >> it->m_shift;
+
+          if (index >= it->m_macAddresses.size ())
+            {
+              it->m_macAddresses.resize (index + 1);
+            }
+
+          it->m_macAddresses[index] = macAddress;
+          return;
+        }
+    }
+
+  NS_FATAL_ERROR ("SatNetDevice::AddNetworkMacAddress - Network " << network << " outside the added blocks");
+}
+
+bool
+SatNetDevice::ResolveDestination (Ptr<const Packet> packet, uint16_t protocolNumber, Address& dest) const
+{
+  NS_LOG_FUNCTION (this << packet << protocolNumber << dest);
+
+  if (protocolNumber != Ipv4L3Protocol::PROT_NUMBER)
+    {
+      return true;
+    }
+
+  // the destination is at a fixed offset of the IPv4 header, so it is read
+  // without deserializing the whole header
+  uint8_t buffer[20];
+
+  if (packet->CopyData (buffer, sizeof (buffer)) < sizeof (buffer))
+    {
+      return false;
+    }
+
+  Ipv4Address destination = Ipv4Address::Deserialize (buffer + 16);
+
+  if (destination.IsMulticast ())
+    {
+      dest = GetMulticast (destination);
+      return true;
+    }
+
+  if (destination.IsBroadcast ())
+    {
+      dest = GetBroadcast ();
+      return true;
+    }
+
+  uint32_t address = destination.Get ();
+
+  for (std::vector<NetworkBlock_t>::const_iterator it = m_networkBlocks.begin (); it != m_networkBlocks.end (); ++it)
+    {
+      if ((address & it->m_mask) == it->m_network)
+        {
+          uint32_t index = (address - it->m_network) >> it->m_shift;
+
+          if (index < it->m_macAddresses.size () && !it->m_macAddresses[index].IsInvalid ())
+            {
+              dest = it->m_macAddresses[index];
+              return true;
+            }
+        }
+    }
+
+  return false;
+}
+
 void
 SatNetDevice::SetReceiveErrorModel (Ptr<ErrorModel> em)
 {
@@ -251,6 +345,13 @@ SatNetDevice::SetPacketClassifier (Ptr<SatPacketClassifier> classifier)
   m_classifier = classifier;
 }
 
+void
+SatNetDevice::SetSignallingChannel (Ptr<SatSignallingChannel> channel)
+{
+  NS_LOG_FUNCTION (this << channel);
+  m_signallingChannel = channel;
+}
+
 Ptr<SatPacketClassifier>
 SatNetDevice::GetPacketClassifier () const
 {
@@ -347,19 +448,44 @@ SatNetDevice::Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNu
 {
   NS_LOG_FUNCTION (this << packet << dest << protocolNumber);
 
+  SatEnums::SatLinkDir_t ld =
+    (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
+
+  Address destination = dest;
+
+  if (!m_networkBlocks.empty () && !ResolveDestination (packet, protocolNumber, destination))
+    {
+      NS_LOG_WARN ("No MAC address for the destination of packet " << packet->GetUid () << ", packet dropped");
+
+      m_packetTrace (Simulator::Now (),
+                     SatEnums::PACKET_DROP,
+                     m_nodeInfo->GetNodeType (),
+                     m_nodeInfo->GetNodeId (),
+                     m_nodeInfo->GetMacAddress (),
+                     SatEnums::LL_ND,
+                     ld,
+                     SatUtils::GetPacketInfo (packet));
+      return false;
+    }
+
   if (m_isStatisticsTagsEnabled)
     {
-      // Add a SatAddressTag tag with this device's address as the source address.
-      packet->AddByteTag (SatAddressTag (m_nodeInfo->GetMacAddress ()));
+      // Store this device's address as the originating address, unless the
+      // packet has already crossed another satellite device, and the device
+      // time stamp for packet delay computation at the receiver end.
+      SatMetadataTag metadataTag;
+      packet->PeekPacketTag (metadataTag);
 
-      // Add a SatDevTimeTag tag for packet delay computation at the receiver end.
-      packet->AddPacketTag (SatDevTimeTag (Simulator::Now ()));
+      if (!metadataTag.HasSourceAddress ())
+        {
+          metadataTag.SetSourceAddress (m_nodeInfo->GetMacAddress ());
+        }
+
+      metadataTag.SetTimestamp (SatMetadataTag::TS_DEV, Simulator::Now ());
+      SatMetadataTag::UpdatePacket (packet, metadataTag);
     }
 
   // Add packet trace entry:
-  SatEnums::SatLinkDir_t ld =
-    (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
-
   m_packetTrace (Simulator::Now (),
                  SatEnums::PACKET_SENT,
                  m_nodeInfo->GetNodeType (),
@@ -371,8 +497,8 @@ SatNetDevice::Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNu
 
   m_txTrace (packet);
 
-  uint8_t flowId = m_classifier->Classify (packet, dest, protocolNumber);
-  m_llc->Enque (packet, dest, flowId);
+  uint8_t flowId = m_classifier->Classify (packet, destination, protocolNumber);
+  m_llc->Enque (packet, destination, flowId);
 
   return true;
 }
@@ -381,19 +507,44 @@ SatNetDevice::SendFrom (Ptr<Packet> packet, const Address& source, const Address
 {
   NS_LOG_FUNCTION (this << packet << source << dest << protocolNumber);
 
+  SatEnums::SatLinkDir_t ld =
+    (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
+
+  Address destination = dest;
+
+  if (!m_networkBlocks.empty () && !ResolveDestination (packet, protocolNumber, destination))
+    {
+      NS_LOG_WARN ("No MAC address for the destination of packet " << packet->GetUid () << ", packet dropped");
+
+      m_packetTrace (Simulator::Now (),
+                     SatEnums::PACKET_DROP,
+                     m_nodeInfo->GetNodeType (),
+                     m_nodeInfo->GetNodeId (),
+                     m_nodeInfo->GetMacAddress (),
+                     SatEnums::LL_ND,
+                     ld,
+                     SatUtils::GetPacketInfo (packet));
+      return false;
+    }
+
   if (m_isStatisticsTagsEnabled)
     {
-      // Add a SatAddressTag tag with this device's address as the source address.
-      packet->AddByteTag (SatAddressTag (m_nodeInfo->GetMacAddress ()));
+      // Store this device's address as the originating address, unless the
+      // packet has already crossed another satellite device, and the device
+      // time stamp for packet delay computation at the receiver end.
+      SatMetadataTag metadataTag;
+      packet->PeekPacketTag (metadataTag);
 
-      // Add a SatDevTimeTag tag for packet delay computation at the receiver end.
-      packet->AddPacketTag (SatDevTimeTag (Simulator::Now ()));
+      if (!metadataTag.HasSourceAddress ())
+        {
+          metadataTag.SetSourceAddress (m_nodeInfo->GetMacAddress ());
+        }
+
+      metadataTag.SetTimestamp (SatMetadataTag::TS_DEV, Simulator::Now ());
+      SatMetadataTag::UpdatePacket (packet, metadataTag);
     }
 
   // Add packet trace entry:
-  SatEnums::SatLinkDir_t ld =
-    (m_nodeInfo->GetNodeType () == SatEnums::NT_UT) ? SatEnums::LD_RETURN : SatEnums::LD_FORWARD;
-
   m_packetTrace (Simulator::Now (),
                  SatEnums::PACKET_SENT,
                  m_nodeInfo->GetNodeType (),
@@ -405,8 +556,8 @@ SatNetDevice::SendFrom (Ptr<Packet> packet, const Address& source, const Address
 
   m_txTrace (packet);
 
-  uint8_t flowId = m_classifier->Classify (packet, dest, protocolNumber);
-  m_llc->Enque (packet, dest, flowId);
+  uint8_t flowId = m_classifier->Classify (packet, destination, protocolNumber);
+  m_llc->Enque (packet, destination, flowId);
 
   return true;
 }
@@ -420,11 +571,19 @@ SatNetDevice::SendControlMsg (Ptr<SatControlMessage> msg, const Address& dest)
 
   if (m_isStatisticsTagsEnabled)
     {
-      // Add a SatAddressTag tag with this device's address as the source address.
-      packet->AddByteTag (SatAddressTag (m_nodeInfo->GetMacAddress ()));
+      // Store this device's address as the originating address, unless the
+      // packet has already crossed another satellite device, and the device
+      // time stamp for packet delay computation at the receiver end.
+      SatMetadataTag metadataTag;
+      packet->PeekPacketTag (metadataTag);
+
+      if (!metadataTag.HasSourceAddress ())
+        {
+          metadataTag.SetSourceAddress (m_nodeInfo->GetMacAddress ());
+        }
 
-      // Add a SatDevTimeTag tag for packet delay computation at the receiver end.
-      packet->AddPacketTag (SatDevTimeTag (Simulator::Now ()));
+      metadataTag.SetTimestamp (SatMetadataTag::TS_DEV, Simulator::Now ());
+      SatMetadataTag::UpdatePacket (packet, metadataTag);
     }
 
   // Add packet trace entry:
@@ -443,15 +602,32 @@ SatNetDevice::SendControlMsg (Ptr<SatControlMessage> msg, const Address& dest)
   // Add control tag to message and write msg to container in MAC
   SatControlMsgTag tag;
   uint32_t id = m_mac->ReserveIdAndStoreCtrlMsgToContainer (msg);
+
+  bool isAbstracted = (m_signallingChannel != NULL
+                       && SatSignallingChannel::IsAbstracted (msg->GetMsgType ()));
+
+  if (isAbstracted)
+    {
+      // The message is sent right away, so the receive ID is taken here
+      // instead of at the MAC transmission.
+      id = m_mac->SendCtrlMsgFromContainer (id);
+    }
+
   tag.SetMsgId (id);
   tag.SetMsgType (msg->GetMsgType ());
   packet->AddPacketTag (tag);
 
-  uint8_t flowId = m_classifier->Classify (msg->GetMsgType (), dest);
-
   m_signallingTxTrace (packet, dest);
 
-  m_llc->Enque (packet, dest, flowId);
+  if (isAbstracted)
+    {
+      m_signallingChannel->Send (packet, m_nodeInfo->GetMacAddress (), Mac48Address::ConvertFrom (dest));
+    }
+  else
+    {
+      uint8_t flowId = m_classifier->Classify (msg->GetMsgType (), dest);
+      m_llc->Enque (packet, dest, flowId);
+    }
 
   return true;
 }
@@ -472,7 +648,7 @@ bool
 SatNetDevice::NeedsArp (void) const
 {
   NS_LOG_FUNCTION (this);
-  return true;
+  return m_networkBlocks.empty ();
 }
 void
 SatNetDevice::SetReceiveCallback (NetDevice::ReceiveCallback cb)
@@ -495,6 +671,7 @@ SatNetDevice::DoDispose (void)
   m_llc->Dispose ();
   m_llc = 0;
   m_classifier = 0;
+  m_signallingChannel = 0;
 
   NetDevice::DoDispose ();
 }
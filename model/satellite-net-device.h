@@ -23,11 +23,14 @@
 
 #include <stdint.h>
 #include <string>
+#include <map>
+#include <vector>
 
 #include <ns3/nstime.h>
 #include <ns3/simulator.h>
 #include <ns3/net-device.h>
 #include <ns3/mac48-address.h>
+#include <ns3/ipv4-address.h>
 #include <ns3/traced-callback.h>
 #include <ns3/satellite-enums.h>
 #include <ns3/satellite-packet-classifier.h>
@@ -42,6 +45,7 @@ class Node;
 class ErrorModel;
 class SatNodeInfo;
 class SatControlMessage;
+class SatSignallingChannel;
 
 
 /**
@@ -67,7 +71,7 @@ public:
    * \brief Receive the packet from mac layer
    * \param packet Pointer to the packet to be received.
    */
-  void Receive (Ptr<const Packet> packet);
+  void Receive (Ptr<Packet> packet);
 
   /*
    * \brief Attach the SatPhy physical layer to this netdevice.
@@ -114,6 +118,14 @@ public:
    */
   void SetPacketClassifier (Ptr<SatPacketClassifier> classifier);
 
+  /**
+   * \brief Set the abstracted signalling path. When set, the control
+   * messages supported by the path are delivered through it instead of
+   * the LLC.
+   * \param channel the signalling channel of the beam
+   */
+  void SetSignallingChannel (Ptr<SatSignallingChannel> channel);
+
   /**
    * \brief Get a pointer to packet classifier class
    * \return Ptr<SatPacketClassifier Packet classifier
@@ -163,6 +175,28 @@ public:
    */
   void SetNodeInfo (Ptr<SatNodeInfo> nodeInfo);
 
+  /**
+   * \brief Add an aligned block of equally sized IPv4 networks whose
+   * packets are sent to the MAC addresses given with AddNetworkMacAddress.
+   * Once a block is added, the destination MAC addresses of the IPv4
+   * packets are resolved with the blocks instead of ARP, and the packets
+   * to unknown destinations are dropped.
+   * \param block network address of the block
+   * \param blockMask network mask of the block
+   * \param networkMask network mask of the networks in the block
+   */
+  void AddNetworkBlock (Ipv4Address block, Ipv4Mask blockMask, Ipv4Mask networkMask);
+
+  /**
+   * \brief Add a network whose IPv4 packets are sent to the given MAC
+   * address. The network must be in a block added with AddNetworkBlock, so
+   * a whole UT network is covered with a single entry.
+   * \param network IPv4 network
+   * \param mask network mask, the network mask of the block
+   * \param macAddress MAC address the packets to the network are sent to
+   */
+  void AddNetworkMacAddress (Ipv4Address network, Ipv4Mask mask, Address macAddress);
+
 protected:
 
   /**
@@ -176,6 +210,7 @@ private:
   Ptr<SatLlc> m_llc;
   bool m_isStatisticsTagsEnabled;  ///< `EnableStatisticsTags` attribute.
   Ptr<SatPacketClassifier> m_classifier;
+  Ptr<SatSignallingChannel> m_signallingChannel;
   NetDevice::ReceiveCallback m_rxCallback;
   NetDevice::PromiscReceiveCallback m_promiscCallback;
   Ptr<Node> m_node;
@@ -186,6 +221,36 @@ private:
 
   Ptr<SatNodeInfo> m_nodeInfo;
 
+  /**
+   * \brief Resolve the destination MAC address of a packet with the
+   * network blocks added by AddNetworkBlock.
+   * \param packet the packet including the IPv4 header
+   * \param protocolNumber protocol number of the packet
+   * \param dest destination given by the upper layer, replaced with the
+   * MAC address of the network of the IPv4 destination
+   * \return false if the IPv4 destination is not in any of the networks
+   */
+  bool ResolveDestination (Ptr<const Packet> packet, uint16_t protocolNumber, Address& dest) const;
+
+  /**
+   * \brief Aligned block of equally sized networks. The MAC address of a
+   * network is found by indexing with the host part of the destination in
+   * the block, shifted by the host bits of one network.
+   */
+  typedef struct
+  {
+    uint32_t m_network;
+    uint32_t m_mask;
+    uint32_t m_shift;
+    std::vector<Address> m_macAddresses;
+  } NetworkBlock_t;
+
+  /**
+   * Network blocks, usually the UT networks and the satellite network of
+   * the beam of a GW device.
+   */
+  std::vector<NetworkBlock_t> m_networkBlocks;
+
   TracedCallback<Time,
                  SatEnums::SatPacketEvent_t,
                  SatEnums::SatNodeType_t,
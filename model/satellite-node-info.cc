@@ -29,7 +29,8 @@ namespace ns3 {
 SatNodeInfo::SatNodeInfo ()
   : m_nodeId (0),
     m_nodeType (SatEnums::NT_UNDEFINED),
-    m_macAddress ()
+    m_macAddress (),
+    m_traceId (0)
 {
 
 }
@@ -37,7 +38,17 @@ SatNodeInfo::SatNodeInfo ()
 SatNodeInfo::SatNodeInfo (SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress)
   : m_nodeId (nodeId),
     m_nodeType (nodeType),
-    m_macAddress (macAddress)
+    m_macAddress (macAddress),
+    m_traceId (0)
+{
+
+}
+
+SatNodeInfo::SatNodeInfo (SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress, uint32_t traceId)
+  : m_nodeId (nodeId),
+    m_nodeType (nodeType),
+    m_macAddress (macAddress),
+    m_traceId (traceId)
 {
 
 }
@@ -69,6 +80,13 @@ SatNodeInfo::GetMacAddress () const
   return m_macAddress;
 }
 
+uint32_t
+SatNodeInfo::GetTraceId () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_traceId;
+}
+
 } // namespace ns3
 
 
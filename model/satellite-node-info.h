@@ -53,6 +53,15 @@ public:
    */
   SatNodeInfo (SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress);
 
+  /**
+   * Constructor with initialization parameters including the trace ID.
+   * \param nodeType 
+   * \param nodeId 
+   * \param macAddress 
+   * \param traceId dense trace ID given by SatIdMapper
+   */
+  SatNodeInfo (SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress, uint32_t traceId);
+
   /**
    * Destructor for SatNodeInfo
    */
@@ -76,10 +85,18 @@ public:
    */
   Mac48Address GetMacAddress () const;
 
+  /**
+   * \brief Get trace ID. The trace ID is a dense index of UTs and GWs
+   * given by SatIdMapper, thus it can be used to index arrays directly.
+   * \return Trace ID, or zero if the node has no trace ID
+   */
+  uint32_t GetTraceId () const;
+
 private:
   uint32_t m_nodeId;
   SatEnums::SatNodeType_t m_nodeType;
   Mac48Address m_macAddress;
+  uint32_t m_traceId;
 
 };
 
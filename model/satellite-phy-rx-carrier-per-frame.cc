@@ -119,11 +119,11 @@ SatPhyRxCarrierPerFrame::DoDispose ()
 void
 SatPhyRxCarrierPerFrame::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParams, const uint32_t nPackets)
 {
-  NS_ASSERT (packetRxParams.rxParams->m_txInfo.packetType != SatEnums::PACKET_TYPE_DEDICATED_ACCESS);
+  NS_ASSERT (packetRxParams.rxParams->m_burst->m_txInfo.packetType != SatEnums::PACKET_TYPE_DEDICATED_ACCESS);
 
   // If the received random access packet is of type slotted aloha, we
   // receive the packet with the base class ReceiveSlot method.
-  if (packetRxParams.rxParams->m_txInfo.packetType == SatEnums::PACKET_TYPE_SLOTTED_ALOHA)
+  if (packetRxParams.rxParams->m_burst->m_txInfo.packetType == SatEnums::PACKET_TYPE_SLOTTED_ALOHA)
     {
       SatPhyRxCarrierPerSlot::ReceiveSlot (packetRxParams, nPackets);
       return;
@@ -180,14 +180,14 @@ SatPhyRxCarrierPerFrame::DoFrameEnd ()
         {
           NS_LOG_INFO ("SatPhyRxCarrier::DoFrameEnd - Sending a packet to the next layer, slot: " << results[i].ownSlotId
                        << ", UT: " << results[i].sourceAddress
-                       << ", unique CRDSA packet ID: " << results[i].rxParams->m_txInfo.crdsaUniquePacketId
+                       << ", unique CRDSA packet ID: " << results[i].rxParams->m_burst->m_txInfo.crdsaUniquePacketId
                        << ", destination address: " << results[i].destAddress
                        << ", error: " << results[i].phyError
                        << ", SINR: " << results[i].cSinr);
 
-          for (uint32_t j = 0; j < results[i].rxParams->m_packetsInBurst.size (); j++)
+          for (uint32_t j = 0; j < results[i].rxParams->m_burst->m_packetsInBurst.size (); j++)
             {
-              NS_LOG_INFO ("SatPhyRxCarrier::DoFrameEnd - Fragment (HL packet) UID: " << results[i].rxParams->m_packetsInBurst.at (j)->GetUid ());
+              NS_LOG_INFO ("SatPhyRxCarrier::DoFrameEnd - Fragment (HL packet) UID: " << results[i].rxParams->m_burst->m_packetsInBurst.at (j)->GetUid ());
             }
 
           /// uses composite sinr
@@ -197,7 +197,7 @@ SatPhyRxCarrierPerFrame::DoFrameEnd ()
                              results[i].ifPower,
                              results[i].cSinr);
           /// CRDSA trace
-          m_crdsaUniquePayloadRxTrace (results[i].rxParams->m_packetsInBurst.size (),  // number of packets
+          m_crdsaUniquePayloadRxTrace (results[i].rxParams->m_burst->m_packetsInBurst.size (),  // number of packets
                                        results[i].sourceAddress,  // sender address
                                        results[i].phyError        // error flag
           );
@@ -257,7 +257,7 @@ SatPhyRxCarrierPerFrame::UpdateRandomAccessLoad ()
       for (iterList = iter->second.begin (); iterList != iter->second.end (); iterList++)
         {
           // It is sufficient to check the first packet Uid
-          uint64_t uid = iterList->rxParams->m_packetsInBurst.front ()->GetUid();
+          uint64_t uid = iterList->rxParams->m_burst->m_packetsInBurst.front ()->GetUid();
 
           // Check if we have already counted the bytes of this transmission
           std::vector<uint64_t>::iterator it = std::find (uniquePacketIds.begin (),
@@ -270,7 +270,7 @@ SatPhyRxCarrierPerFrame::UpdateRandomAccessLoad ()
               uniquePacketIds.push_back (uid);
 
               // Update the load with FEC block size!
-              uniqueCrdsaBytes += iterList->rxParams->m_txInfo.fecBlockSizeInBytes;
+              uniqueCrdsaBytes += iterList->rxParams->m_burst->m_txInfo.fecBlockSizeInBytes;
             }
           // else, do nothing, i.e. this is a replica
         }
@@ -332,12 +332,12 @@ SatPhyRxCarrierPerFrame::AddCrdsaPacket (SatPhyRxCarrierPerFrame::crdsaPacketRxP
 
   NS_LOG_INFO ("SatPhyRxCarrierPerFrame::AddCrdsaPacket - Time: " << Now ().GetSeconds ());
 
-  if (crdsaPacketParams.rxParams->m_packetsInBurst.size () > 0)
+  if (crdsaPacketParams.rxParams->m_burst->m_packetsInBurst.size () > 0)
     {
       SatCrdsaReplicaTag replicaTag;
 
       /// check the first packet for tag
-      bool result = crdsaPacketParams.rxParams->m_packetsInBurst[0]->PeekPacketTag (replicaTag);
+      bool result = crdsaPacketParams.rxParams->m_burst->m_packetsInBurst[0]->PeekPacketTag (replicaTag);
 
       if (!result)
         {
@@ -366,9 +366,11 @@ SatPhyRxCarrierPerFrame::AddCrdsaPacket (SatPhyRxCarrierPerFrame::crdsaPacketRxP
         }
 
       /// tags are not needed after this
-      for (uint32_t i = 0; i < crdsaPacketParams.rxParams->m_packetsInBurst.size (); i++)
+      crdsaPacketParams.rxParams->DetachPacketsInBurst ();
+
+      for (uint32_t i = 0; i < crdsaPacketParams.rxParams->m_burst->m_packetsInBurst.size (); i++)
         {
-      	crdsaPacketParams.rxParams->m_packetsInBurst[i]->RemovePacketTag (replicaTag);
+      	crdsaPacketParams.rxParams->m_burst->m_packetsInBurst[i]->RemovePacketTag (replicaTag);
         }
     }
   else
@@ -823,7 +825,7 @@ bool
 SatPhyRxCarrierPerFrame::CompareCrdsaPacketId (SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s obj1,
   		SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s obj2)
 {
-  return (bool) (obj1.rxParams->m_txInfo.crdsaUniquePacketId < obj2.rxParams->m_txInfo.crdsaUniquePacketId);
+  return (bool) (obj1.rxParams->m_burst->m_txInfo.crdsaUniquePacketId < obj2.rxParams->m_burst->m_txInfo.crdsaUniquePacketId);
 }
 
 
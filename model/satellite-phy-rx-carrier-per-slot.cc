@@ -112,19 +112,19 @@ SatPhyRxCarrierPerSlot::CreateInterference (Ptr<SatSignalParameters> rxParams, A
 
 	    double rxPower (0.0);
 
-	    if (rxParams->m_beamId != GetBeamId ())
+	    if (rxParams->m_burst->m_beamId != GetBeamId ())
 	      {
 	        rxPower = rxParams->m_rxPower_W * (1 + 1/rxParams->m_sinr);
 	      }
 
 	    // Add the interference even regardless.
-	    return GetInterferenceModel()->Add (rxParams->m_duration,
+	    return GetInterferenceModel()->Add (rxParams->m_burst->m_duration,
 	                                        rxPower,
 	                                        GetOwnAddress ());
 	  }
 	else if (ct == SatEnums::FORWARD_USER_CH)
 	  {
-	    return GetInterferenceModel()->Add (rxParams->m_duration, rxParams->m_rxPower_W, GetOwnAddress ());
+	    return GetInterferenceModel()->Add (rxParams->m_burst->m_duration, rxParams->m_rxPower_W, GetOwnAddress ());
 	  }
 
 	NS_FATAL_ERROR ("SatSatellitePhyRxCarrier::CreateInterference - Invalid channel type!");
@@ -141,14 +141,20 @@ SatPhyRxCarrierPerSlot::EndRxData (uint32_t key)
 
   rxParams_s packetRxParams = GetStoredRxParams (key);
 
-  const uint32_t nPackets = packetRxParams.rxParams->m_packetsInBurst.size ();
+  const uint32_t nPackets = packetRxParams.rxParams->m_burst->m_packetsInBurst.size ();
 
-  DecreaseNumOfRxState (packetRxParams.rxParams->m_txInfo.packetType);
+  DecreaseNumOfRxState (packetRxParams.rxParams->m_burst->m_txInfo.packetType);
 
   NS_ASSERT (packetRxParams.rxParams->m_sinr != 0);
 
   packetRxParams.rxParams->m_ifPower_W = GetInterferenceModel ()->Calculate (packetRxParams.interferenceEvent);
 
+  if (!m_backgroundIfCallback.IsNull ())
+    {
+      // interference of the background loads of the co-channel beams
+      packetRxParams.rxParams->m_ifPower_W += m_rxNoisePowerW * m_backgroundIfCallback ();
+    }
+
   ReceiveSlot (packetRxParams, nPackets);
 
   GetInterferenceModel ()->NotifyRxEnd (packetRxParams.interferenceEvent);
@@ -200,7 +206,7 @@ SatPhyRxCarrierPerSlot::ProcessSlottedAlohaCollisions (double cSinr,
 void
 SatPhyRxCarrierPerSlot::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParams, const uint32_t nPackets)
 {
-  NS_ASSERT (packetRxParams.rxParams->m_txInfo.packetType != SatEnums::PACKET_TYPE_CRDSA);
+  NS_ASSERT (packetRxParams.rxParams->m_burst->m_txInfo.packetType != SatEnums::PACKET_TYPE_CRDSA);
 	/// calculates sinr for 2nd link
 	double sinr = CalculateSinr ( packetRxParams.rxParams->m_rxPower_W,
 																packetRxParams.rxParams->m_ifPower_W,
@@ -228,12 +234,12 @@ SatPhyRxCarrierPerSlot::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParams,
 			DoCompositeSinrOutputTrace (cSinr);
 		}
 
-	if (packetRxParams.rxParams->m_txInfo.packetType == SatEnums::PACKET_TYPE_SLOTTED_ALOHA)
+	if (packetRxParams.rxParams->m_burst->m_txInfo.packetType == SatEnums::PACKET_TYPE_SLOTTED_ALOHA)
 		{
 			NS_LOG_INFO ("SatPhyRxCarrier::EndRxDataNormal - Time: " << Now ().GetSeconds () << " - Slotted ALOHA packet received");
 
 			// Update the load with FEC block size!
-			m_randomAccessBitsInFrame += packetRxParams.rxParams->m_txInfo.fecBlockSizeInBytes * SatConstVariables::BITS_PER_BYTE;
+			m_randomAccessBitsInFrame += packetRxParams.rxParams->m_burst->m_txInfo.fecBlockSizeInBytes * SatConstVariables::BITS_PER_BYTE;
 
 			/// check for slotted aloha packet collisions
 			phyError = ProcessSlottedAlohaCollisions (cSinr, packetRxParams.rxParams, packetRxParams.interferenceEvent);
@@ -292,7 +298,7 @@ SatPhyRxCarrierPerSlot::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParams,
 			else if (GetNodeInfo ()->GetNodeType () == SatEnums::NT_GW)
 				{
 					cno = SatUtils::DbToLinear (GetChannelEstimationErrorContainer ()->AddError (
-							SatUtils::LinearToDb (cno), packetRxParams.rxParams->m_txInfo.waveformId));
+							SatUtils::LinearToDb (cno), packetRxParams.rxParams->m_burst->m_txInfo.waveformId));
 				}
 			else
 				{
@@ -301,7 +307,7 @@ SatPhyRxCarrierPerSlot::ReceiveSlot (SatPhyRxCarrier::rxParams_s packetRxParams,
 
 		cno *= m_rxBandwidthHz;
 
-		m_cnoCallback (packetRxParams.rxParams->m_beamId,
+		m_cnoCallback (packetRxParams.rxParams->m_burst->m_beamId,
 									 packetRxParams.sourceAddress,
 									 GetOwnAddress (),
 									 cno);
@@ -54,7 +54,7 @@ SatPhyRxCarrierUplink::GetTypeId (void)
 Ptr<SatInterference::InterferenceChangeEvent>
 SatPhyRxCarrierUplink::CreateInterference (Ptr<SatSignalParameters> rxParams, Address senderAddress)
 {
-	return GetInterferenceModel()->Add (rxParams->m_duration, rxParams->m_rxPower_W, senderAddress);
+	return GetInterferenceModel()->Add (rxParams->m_burst->m_duration, rxParams->m_rxPower_W, senderAddress);
 }
 
 void
@@ -67,7 +67,7 @@ SatPhyRxCarrierUplink::EndRxData (uint32_t key)
 
   auto packetRxParams = GetStoredRxParams (key);
 
-  DecreaseNumOfRxState (packetRxParams.rxParams->m_txInfo.packetType);
+  DecreaseNumOfRxState (packetRxParams.rxParams->m_burst->m_txInfo.packetType);
 
   packetRxParams.rxParams->m_ifPower_W = GetInterferenceModel ()->Calculate (packetRxParams.interferenceEvent);
 
@@ -25,6 +25,7 @@
 #include <ns3/satellite-constant-interference.h>
 #include <ns3/satellite-per-packet-interference.h>
 #include <ns3/satellite-traced-interference.h>
+#include <ns3/satellite-precomputed-interference.h>
 #include <ns3/satellite-mac-tag.h>
 #include <ns3/singleton.h>
 #include <ns3/satellite-composite-sinr-output-trace-container.h>
@@ -77,6 +78,13 @@ SatPhyRxCarrier::SatPhyRxCarrier (uint32_t carrierId, Ptr<SatPhyRxCarrierConf> c
     {
       NS_LOG_INFO (this << " link results in use in carrier: " << carrierId);
       m_linkResults = carrierConf->GetLinkResults ();
+
+      // Resolve the link results type once instead of on every received burst
+      if (m_linkResults != 0)
+        {
+          m_linkResultsDvbS2 = m_linkResults->GetObject<SatLinkResultsDvbS2> ();
+          m_linkResultsDvbRcs2 = m_linkResults->GetObject<SatLinkResultsDvbRcs2> ();
+        }
     }
 
   m_rxTemperatureK = carrierConf->GetRxTemperatureK ();
@@ -138,6 +146,16 @@ SatPhyRxCarrier::DoCreateInterferenceModel (Ptr<SatPhyRxCarrierConf> carrierConf
         m_satInterference = CreateObject<SatTracedInterference> (GetChannelType (), rxBandwidthHz);
         break;
       }
+    case SatPhyRxCarrierConf::IF_PRECOMPUTED:
+      {
+        NS_LOG_INFO (this << " Precomputed interference model created for carrier: " << carrierId);
+        if (GetChannelType () != SatEnums::FORWARD_USER_CH)
+          {
+            NS_FATAL_ERROR ("Precomputed interference model is supported only in forward user link!");
+          }
+        m_satInterference = CreateObject<SatPrecomputedInterference> ();
+        break;
+      }
     default:
       {
         NS_LOG_ERROR (this << " Not a valid interference model!");
@@ -197,8 +215,11 @@ SatPhyRxCarrier::DoDispose ()
   m_cnoCallback.Nullify ();
   m_sinrCalculate.Nullify ();
   m_avgNormalizedOfferedLoadCallback.Nullify ();
+  m_backgroundIfCallback.Nullify ();
   m_satInterference = NULL;
   m_uniformVariable = NULL;
+  m_linkResultsDvbS2 = NULL;
+  m_linkResultsDvbRcs2 = NULL;
 
   Object::DoDispose ();
 }
@@ -253,8 +274,8 @@ SatPhyRxCarrier::GetReceiveParams (Ptr<SatSignalParameters> rxParams)
   bool receivePacket = GetDefaultReceiveMode ();
   bool ownAddressFound = false;
 
-  for (SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
-       ((i != rxParams->m_packetsInBurst.end ()) && (ownAddressFound == false) ); i++)
+  for (SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_burst->m_packetsInBurst.begin ();
+       ((i != rxParams->m_burst->m_packetsInBurst.end ()) && (ownAddressFound == false) ); i++)
     {
       SatMacTag tag;
       (*i)->PeekPacketTag (tag);
@@ -289,13 +310,13 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
 {
   NS_LOG_FUNCTION (this << rxParams);
   NS_LOG_INFO (this << " state: " << m_state);
-  NS_ASSERT (rxParams->m_carrierId == m_carrierId);
+  NS_ASSERT (rxParams->m_burst->m_carrierId == m_carrierId);
 
   uint32_t key;
 
   NS_LOG_INFO ("Node: " << m_nodeInfo->GetMacAddress ()
 								<< " starts receiving packet at: " << Simulator::Now ().GetSeconds ()
-								<< " in carrier: " << rxParams->m_carrierId);
+								<< " in carrier: " << rxParams->m_burst->m_carrierId);
   NS_LOG_INFO ("Sender: " << rxParams->m_phyTx);
 
   switch (m_state)
@@ -315,9 +336,9 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
         // In case that RX mode is something else than transparent
         // additionally check that whether the packet was intended for this specific receiver
 
-        if ( receivePacket && ( rxParams->m_beamId == GetBeamId () ) )
+        if ( receivePacket && ( rxParams->m_burst->m_beamId == GetBeamId () ) )
           {
-            if (IsReceivingDedicatedAccess () && rxParams->m_txInfo.packetType == SatEnums::PACKET_TYPE_DEDICATED_ACCESS)
+            if (IsReceivingDedicatedAccess () && rxParams->m_burst->m_txInfo.packetType == SatEnums::PACKET_TYPE_DEDICATED_ACCESS)
               {
                 NS_FATAL_ERROR ("Starting reception of a packet when receiving DA transmission!");
               }
@@ -329,14 +350,14 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
 
             StoreRxParams (key, rxParamsStruct);
 
-            NS_LOG_INFO (this << " scheduling EndRx with delay " << rxParams->m_duration.GetSeconds () << "s");
+            NS_LOG_INFO (this << " scheduling EndRx with delay " << rxParams->m_burst->m_duration.GetSeconds () << "s");
 
             // Update link specific received signal power
             m_rxPowerTrace (SatUtils::LinearToDb (rxParams->m_rxPower_W));
 
-            Simulator::Schedule (rxParams->m_duration, &SatPhyRxCarrier::EndRxData, this, key);
+            Simulator::Schedule (rxParams->m_burst->m_duration, &SatPhyRxCarrier::EndRxData, this, key);
 
-            IncreaseNumOfRxState (rxParams->m_txInfo.packetType);
+            IncreaseNumOfRxState (rxParams->m_burst->m_txInfo.packetType);
           }
         break;
       }
@@ -427,9 +448,10 @@ SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSign
 			 * fs = symbol rate in baud
 			*/
 
-			double ber = (GetLinkResults ()->GetObject <SatLinkResultsDvbS2> ())->GetBler (rxParams->m_txInfo.modCod,
-																																								 rxParams->m_txInfo.frameType,
-																																								 SatUtils::LinearToDb (cSinr));
+			NS_ASSERT (m_linkResultsDvbS2 != 0);
+			double ber = m_linkResultsDvbS2->GetBler (rxParams->m_burst->m_txInfo.modCod,
+			                                          rxParams->m_burst->m_txInfo.frameType,
+			                                          SatUtils::LinearToDb (cSinr));
 			double r = GetUniformRandomValue (0, 1);
 
 			if ( r < ber )
@@ -463,11 +485,12 @@ SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSign
 			 * fb = channel bitrate (after FEC) in bps (i.e. burst payloadInBits / burstDurationInSec)
 			*/
 
-			double ebNo = cSinr / (SatUtils::GetCodingRate (rxParams->m_txInfo.modCod) *
-														 SatUtils::GetModulatedBits (rxParams->m_txInfo.modCod));
+			double ebNo = cSinr / (SatUtils::GetCodingRate (rxParams->m_burst->m_txInfo.modCod) *
+														 SatUtils::GetModulatedBits (rxParams->m_burst->m_txInfo.modCod));
 
-			double ber = (GetLinkResults ()->GetObject <SatLinkResultsDvbRcs2> ())->GetBler (rxParams->m_txInfo.waveformId,
-																																									 SatUtils::LinearToDb (ebNo));
+			NS_ASSERT (m_linkResultsDvbRcs2 != 0);
+			double ber = m_linkResultsDvbRcs2->GetBler (rxParams->m_burst->m_txInfo.waveformId,
+			                                            SatUtils::LinearToDb (ebNo));
 			double r = GetUniformRandomValue (0, 1);
 
 			if ( r < ber )
@@ -477,7 +500,7 @@ SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSign
 
 			NS_LOG_INFO ("RETURN cSinr (dB): " << SatUtils::LinearToDb (cSinr)
 									 << " ebNo (dB): " << SatUtils::LinearToDb (ebNo)
-									 << " modulated bits: " << SatUtils::GetModulatedBits (rxParams->m_txInfo.modCod)
+									 << " modulated bits: " << SatUtils::GetModulatedBits (rxParams->m_burst->m_txInfo.modCod)
 									 << " rand: " << r
 									 << " ber: " << ber
 									 << " error: " << error);
@@ -620,5 +643,13 @@ SatPhyRxCarrier::SetAverageNormalizedOfferedLoadCallback (SatPhyRx::AverageNorma
   m_avgNormalizedOfferedLoadCallback = callback;
 }
 
+void
+SatPhyRxCarrier::SetBackgroundInterferenceCallback (SatPhyRx::BackgroundInterferenceCallback callback)
+{
+  NS_LOG_FUNCTION (this << &callback);
+
+  m_backgroundIfCallback = callback;
+}
+
 
 }
@@ -43,6 +43,8 @@ class Address;
 class SatPhy;
 class SatSignalParameters;
 class SatLinkResults;
+class SatLinkResultsDvbS2;
+class SatLinkResultsDvbRcs2;
 class SatChannelEstimationErrorContainer;
 class SatNodeInfo;
 
@@ -203,6 +205,12 @@ public:
    */
   void SetAverageNormalizedOfferedLoadCallback (SatPhyRx::AverageNormalizedOfferedLoadCallback callback);
 
+  /**
+   * \brief Function for setting the BackgroundInterferenceCallback callback
+   * \param callback callback
+   */
+  void SetBackgroundInterferenceCallback (SatPhyRx::BackgroundInterferenceCallback callback);
+
 protected:
 
   /**
@@ -502,6 +510,11 @@ protected:
    */
   SatPhy::AverageNormalizedOfferedLoadCallback m_avgNormalizedOfferedLoadCallback;
 
+  /**
+   * \brief Background interference callback, interference relative to the noise power
+   */
+  SatPhyRx::BackgroundInterferenceCallback m_backgroundIfCallback;
+
 private:
 
   /**
@@ -534,6 +547,8 @@ private:
   Ptr<SatNodeInfo> m_nodeInfo; 									//< NodeInfo of the node where carrier is attached
   SatEnums::ChannelType_t m_channelType;				//< Channel type
   Ptr<SatLinkResults> m_linkResults; 						//< Link results from the carrier configuration
+  Ptr<SatLinkResultsDvbS2> m_linkResultsDvbS2;	//< DVB-S2 view of m_linkResults, resolved once for the FWD link
+  Ptr<SatLinkResultsDvbRcs2> m_linkResultsDvbRcs2;	//< DVB-RCS2 view of m_linkResults, resolved once for the RTN link
   Ptr<UniformRandomVariable> m_uniformVariable;	//< Uniform helper random variable
   SatPhyRxCarrierConf::ErrorModel m_errorModel;	//< Error model
   double m_constantErrorRate;										//< Error rate for constant error model
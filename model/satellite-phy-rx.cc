@@ -22,6 +22,8 @@
 #include "ns3/object-vector.h"
 #include "ns3/antenna-model.h"
 #include "ns3/object-factory.h"
+#include "ns3/boolean.h"
+#include "ns3/trace-source-accessor.h"
 #include "satellite-utils.h"
 #include "satellite-net-device.h"
 #include "satellite-phy.h"
@@ -45,7 +47,9 @@ SatPhyRx::SatPhyRx ()
   : m_beamId (),
     m_maxAntennaGain (),
     m_antennaLoss (),
-    m_defaultFadingValue ()
+    m_defaultFadingValue (),
+    m_lazyRxCarrierCreation (false),
+    m_frameEndSchedulingBegun (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -62,6 +66,13 @@ void SatPhyRx::DoDispose ()
   m_device = 0;
   m_fadingContainer = 0;
   m_rxCarriers.clear ();
+  m_carrierConf = 0;
+  m_superFrameConf = 0;
+  m_nodeInfo = 0;
+  m_receiveCb.Nullify ();
+  m_cnoCb.Nullify ();
+  m_avgNormalizedOfferedLoadCb.Nullify ();
+  m_backgroundIfCb.Nullify ();
   Object::DoDispose ();
 }
 
@@ -72,8 +83,54 @@ SatPhyRx::GetTypeId (void)
     .SetParent<Object> ()
     .AddAttribute ("RxCarrierList", "The list of RX carriers associated to this Phy RX.",
                    ObjectVectorValue (),
-                   MakeObjectVectorAccessor (&SatPhyRx::m_rxCarriers),
+                   MakeObjectVectorAccessor (&SatPhyRx::GetNRxCarriers,
+                                             &SatPhyRx::GetRxCarrier),
                    MakeObjectVectorChecker<SatPhyRxCarrier> ())
+    .AddAttribute ("LazyRxCarrierCreation",
+                   "Create the non random access RX carriers only on their first reception "
+                   "or when they are accessed through RxCarrierList. Saves memory and "
+                   "start-up time with large carrier plans, but changes the order of "
+                   "random variable stream assignment compared to eager creation.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatPhyRx::m_lazyRxCarrierCreation),
+                   MakeBooleanChecker ())
+    .AddTraceSource ("LinkBudgetTrace",
+                     "The trace for link budget related quantities of the RX carriers",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_linkBudgetTrace),
+                     "ns3::SatPhyRxCarrier::LinkBudgetTraceCallback")
+    .AddTraceSource ("RxPowerTrace",
+                     "The trace for received signal power in dBW of the RX carriers",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_rxPowerTrace),
+                     "ns3::SatPhyRxCarrier::RxPowerTraceCallback")
+    .AddTraceSource ("Sinr",
+                     "The trace for composite SINR in dB of the RX carriers",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_sinrTrace),
+                     "ns3::SatPhyRxCarrier::SinrTraceCallback")
+    .AddTraceSource ("LinkSinr",
+                     "The trace for link specific SINR in dB of the RX carriers",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_linkSinrTrace),
+                     "ns3::SatPhyRxCarrier::LinkSinrTraceCallback")
+    .AddTraceSource ("DaRx",
+                     "Received a packet burst through Dedicated Channel",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_daRxTrace),
+                     "ns3::SatPhyRxCarrierPacketProbe::RxStatusCallback")
+    .AddTraceSource ("SlottedAlohaRxCollision",
+                     "Received a packet burst through Random Access Slotted ALOHA",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_slottedAlohaRxCollisionTrace),
+                     "ns3::SatPhyRxCarrierPacketProbe::RxStatusCallback")
+    .AddTraceSource ("SlottedAlohaRxError",
+                     "Received a packet burst through Random Access Slotted ALOHA",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_slottedAlohaRxErrorTrace),
+                     "ns3::SatPhyRxCarrierPacketProbe::RxStatusCallback")
+    .AddTraceSource ("CrdsaReplicaRx",
+                     "Received a CRDSA packet replica through Random Access",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_crdsaReplicaRxTrace),
+                     "ns3::SatPhyRxCarrierPacketProbe::RxStatusCallback")
+    .AddTraceSource ("CrdsaUniquePayloadRx",
+                     "Received a unique CRDSA payload (after frame processing) "
+                     "through Random Access CRDSA",
+                     MakeTraceSourceAccessor (&SatPhyRx::m_crdsaUniquePayloadRxTrace),
+                     "ns3::SatPhyRxCarrierPacketProbe::RxStatusCallback")
   ;
   return tid;
 }
@@ -188,12 +245,16 @@ SatPhyRx::SetNodeInfo (const Ptr<SatNodeInfo> nodeInfo)
   NS_LOG_FUNCTION (this << nodeInfo->GetNodeId ());
 
   m_macAddress = nodeInfo->GetMacAddress ();
+  m_nodeInfo = nodeInfo;
 
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
        it != m_rxCarriers.end ();
        ++it)
     {
-      (*it)->SetNodeInfo (nodeInfo);
+      if (*it != 0)
+        {
+          (*it)->SetNodeInfo (nodeInfo);
+        }
     }
 }
 
@@ -202,10 +263,16 @@ SatPhyRx::BeginFrameEndScheduling ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_frameEndSchedulingBegun = true;
+
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
        it != m_rxCarriers.end ();
        ++it)
     {
+      if (*it == 0)
+        {
+          continue;
+        }
   		Ptr<SatPhyRxCarrierPerFrame> crdsaPrxc = (*it)->GetObject<SatPhyRxCarrierPerFrame> ();
       if (crdsaPrxc != 0) crdsaPrxc->BeginFrameEndScheduling ();
     }
@@ -217,11 +284,16 @@ SatPhyRx::SetReceiveCallback (SatPhyRx::ReceiveCallback cb)
   NS_LOG_FUNCTION (this);
   NS_ASSERT (!m_rxCarriers.empty ());
 
+  m_receiveCb = cb;
+
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
        it != m_rxCarriers.end ();
        ++it)
     {
-      (*it)->SetReceiveCb (cb);
+      if (*it != 0)
+        {
+          (*it)->SetReceiveCb (cb);
+        }
     }
 }
 
@@ -231,11 +303,16 @@ SatPhyRx::SetCnoCallback (SatPhyRx::CnoCallback cb)
   NS_LOG_FUNCTION (this << &cb);
   NS_ASSERT (!m_rxCarriers.empty ());
 
+  m_cnoCb = cb;
+
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
        it != m_rxCarriers.end ();
        ++it)
     {
-      (*it)->SetCnoCb (cb);
+      if (*it != 0)
+        {
+          (*it)->SetCnoCb (cb);
+        }
     }
 }
 
@@ -245,11 +322,35 @@ SatPhyRx::SetAverageNormalizedOfferedLoadCallback (SatPhyRx::AverageNormalizedOf
   NS_LOG_FUNCTION (this << &cb);
   NS_ASSERT (!m_rxCarriers.empty ());
 
+  m_avgNormalizedOfferedLoadCb = cb;
+
+  for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
+       it != m_rxCarriers.end ();
+       ++it)
+    {
+      if (*it != 0)
+        {
+          (*it)->SetAverageNormalizedOfferedLoadCallback (cb);
+        }
+    }
+}
+
+void
+SatPhyRx::SetBackgroundInterferenceCallback (SatPhyRx::BackgroundInterferenceCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
+  NS_ASSERT (!m_rxCarriers.empty ());
+
+  m_backgroundIfCb = cb;
+
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin ();
        it != m_rxCarriers.end ();
        ++it)
     {
-      (*it)->SetAverageNormalizedOfferedLoadCallback (cb);
+      if (*it != 0)
+        {
+          (*it)->SetBackgroundInterferenceCallback (cb);
+        }
     }
 }
 
@@ -284,73 +385,268 @@ SatPhyRx::ConfigurePhyRxCarriers (Ptr<SatPhyRxCarrierConf> carrierConf, Ptr<SatS
   NS_LOG_FUNCTION (this);
   NS_ASSERT (m_rxCarriers.empty ());
 
+  m_carrierConf = carrierConf;
+  m_superFrameConf = superFrameConf;
+  m_rxCarriers.resize (carrierConf->GetCarrierCount ());
+
+  for (uint32_t i = 0; i < carrierConf->GetCarrierCount (); ++i)
+    {
+      // Random access carriers are always created, as they measure the load per frame also when idle
+      if (!m_lazyRxCarrierCreation || IsRandomAccessCarrier (i))
+        {
+          m_rxCarriers[i] = CreateRxCarrier (i);
+        }
+    }
+}
+
+uint32_t
+SatPhyRx::GetNRxCarriers () const
+{
+  return m_rxCarriers.size ();
+}
+
+uint32_t
+SatPhyRx::GetNCreatedRxCarriers () const
+{
+  uint32_t count = 0;
+
+  for (std::vector< Ptr<SatPhyRxCarrier> >::const_iterator it = m_rxCarriers.begin ();
+       it != m_rxCarriers.end ();
+       ++it)
+    {
+      if (*it != 0)
+        {
+          ++count;
+        }
+    }
+
+  return count;
+}
+
+Ptr<SatPhyRxCarrier>
+SatPhyRx::GetRxCarrier (uint32_t carrierId) const
+{
+  NS_ASSERT (carrierId < m_rxCarriers.size ());
+
+  if (m_rxCarriers[carrierId] == 0)
+    {
+      m_rxCarriers[carrierId] = CreateRxCarrier (carrierId);
+    }
+
+  return m_rxCarriers[carrierId];
+}
+
+bool
+SatPhyRx::IsRandomAccessCarrier (uint32_t carrierId) const
+{
+  switch (m_carrierConf->GetChannelType ())
+    {
+    case SatEnums::RETURN_USER_CH:
+    case SatEnums::RETURN_FEEDER_CH:
+      return m_superFrameConf->IsRandomAccessCarrier (carrierId);
+    default:
+      return false;
+    }
+}
+
+Ptr<SatPhyRxCarrier>
+SatPhyRx::CreateRxCarrier (uint32_t carrierId) const
+{
+  NS_LOG_FUNCTION (this << carrierId);
+
   Ptr<SatPhyRxCarrier> rxc (nullptr);
   bool isRandomAccessCarrier (false);
 
-  SatEnums::RandomAccessModel_t raModel = carrierConf->GetRandomAccessModel();
+  SatEnums::RandomAccessModel_t raModel = m_carrierConf->GetRandomAccessModel();
 
-  for (uint32_t i = 0; i < carrierConf->GetCarrierCount (); ++i)
+  switch (m_carrierConf->GetChannelType ())
     {
-      NS_LOG_INFO (this << " Create carrier: " << i);
-
-      switch (carrierConf->GetChannelType ())
-				{
-          case SatEnums::FORWARD_FEEDER_CH:
-            {
-              // Satellite is the receiver in feeder uplink
-              rxc = CreateObject<SatPhyRxCarrierUplink> (i, carrierConf, false);
-              break;
-            }
-					case SatEnums::FORWARD_USER_CH:
-					  {
-					    // UT has only per slot non-random access carriers
-					    rxc = CreateObject<SatPhyRxCarrierPerSlot> (i, carrierConf, false);
-					    break;
-					  }
-          case SatEnums::RETURN_USER_CH:
-            {
-              isRandomAccessCarrier = superFrameConf->IsRandomAccessCarrier (i);
-
-              // Satellite is the receiver in either user or feeder uplink
-              rxc = CreateObject<SatPhyRxCarrierUplink> (i, carrierConf, isRandomAccessCarrier);
-              break;
-            }
-					case SatEnums::RETURN_FEEDER_CH:
-					  {
-					    isRandomAccessCarrier = superFrameConf->IsRandomAccessCarrier (i);
-
-					    // DA carrier
-					    if (!isRandomAccessCarrier)
-                {
-                  rxc = CreateObject<SatPhyRxCarrierPerSlot> (i, carrierConf, false);
-                }
-					    // RA slotted aloha
-					    else if (raModel == SatEnums::RA_MODEL_SLOTTED_ALOHA)
-					      {
-                  rxc = CreateObject<SatPhyRxCarrierPerSlot> (i, carrierConf, true);
-                  DynamicCast<SatPhyRxCarrierPerSlot> (rxc)->
-                      SetRandomAccessAllocationChannelId (superFrameConf->GetRaChannel (i));
-					      }
-					    // Note, that random access model of DVB-RCS2 specification may be configured
-					    // to be either slotted ALOHA and CRDSA (wit no of unique payloads attribute).
-					    // Here we make a short-cut such that the RCS2_SPECIFICATION random access
-					    // always uses the CRDSA frame type receiver.
-					    else if (raModel == SatEnums::RA_MODEL_CRDSA || raModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
-					      {
-                  rxc = CreateObject<SatPhyRxCarrierPerFrame> (i, carrierConf, true);
-                  DynamicCast<SatPhyRxCarrierPerSlot> (rxc)->
-                      SetRandomAccessAllocationChannelId (superFrameConf->GetRaChannel (i));
-					      }
-					    break;
+    case SatEnums::FORWARD_FEEDER_CH:
+      {
+        // Satellite is the receiver in feeder uplink
+        rxc = CreateObject<SatPhyRxCarrierUplink> (carrierId, m_carrierConf, false);
+        break;
+      }
+    case SatEnums::FORWARD_USER_CH:
+      {
+        // UT has only per slot non-random access carriers
+        rxc = CreateObject<SatPhyRxCarrierPerSlot> (carrierId, m_carrierConf, false);
+        break;
+      }
+    case SatEnums::RETURN_USER_CH:
+      {
+        isRandomAccessCarrier = IsRandomAccessCarrier (carrierId);
+
+        // Satellite is the receiver in either user or feeder uplink
+        rxc = CreateObject<SatPhyRxCarrierUplink> (carrierId, m_carrierConf, isRandomAccessCarrier);
+        break;
+      }
+    case SatEnums::RETURN_FEEDER_CH:
+      {
+        isRandomAccessCarrier = IsRandomAccessCarrier (carrierId);
+
+        // DA carrier
+        if (!isRandomAccessCarrier)
+          {
+            rxc = CreateObject<SatPhyRxCarrierPerSlot> (carrierId, m_carrierConf, false);
+          }
+        // RA slotted aloha
+        else if (raModel == SatEnums::RA_MODEL_SLOTTED_ALOHA)
+          {
+            rxc = CreateObject<SatPhyRxCarrierPerSlot> (carrierId, m_carrierConf, true);
+            DynamicCast<SatPhyRxCarrierPerSlot> (rxc)->
+                SetRandomAccessAllocationChannelId (m_superFrameConf->GetRaChannel (carrierId));
           }
-					case SatEnums::UNKNOWN_CH:
-					default:
-					{
-						NS_FATAL_ERROR ("SatPhyRx::ConfigurePhyRxCarriers - Invalid channel type!");
-					}
-				}
-      m_rxCarriers.push_back (rxc);
+        // Note, that random access model of DVB-RCS2 specification may be configured
+        // to be either slotted ALOHA and CRDSA (wit no of unique payloads attribute).
+        // Here we make a short-cut such that the RCS2_SPECIFICATION random access
+        // always uses the CRDSA frame type receiver.
+        else if (raModel == SatEnums::RA_MODEL_CRDSA || raModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
+          {
+            rxc = CreateObject<SatPhyRxCarrierPerFrame> (carrierId, m_carrierConf, true);
+            DynamicCast<SatPhyRxCarrierPerSlot> (rxc)->
+                SetRandomAccessAllocationChannelId (m_superFrameConf->GetRaChannel (carrierId));
+          }
+        break;
+      }
+    case SatEnums::UNKNOWN_CH:
+    default:
+      {
+        NS_FATAL_ERROR ("SatPhyRx::CreateRxCarrier - Invalid channel type!");
+      }
+    }
+
+  if (m_nodeInfo != 0)
+    {
+      rxc->SetNodeInfo (m_nodeInfo);
     }
+
+  rxc->SetBeamId (m_beamId);
+
+  if (!m_receiveCb.IsNull ())
+    {
+      rxc->SetReceiveCb (m_receiveCb);
+    }
+
+  if (!m_cnoCb.IsNull ())
+    {
+      rxc->SetCnoCb (m_cnoCb);
+    }
+
+  if (!m_avgNormalizedOfferedLoadCb.IsNull ())
+    {
+      rxc->SetAverageNormalizedOfferedLoadCallback (m_avgNormalizedOfferedLoadCb);
+    }
+
+  if (!m_backgroundIfCb.IsNull ())
+    {
+      rxc->SetBackgroundInterferenceCallback (m_backgroundIfCb);
+    }
+
+  Ptr<SatPhyRxCarrierPerFrame> crdsaPrxc = rxc->GetObject<SatPhyRxCarrierPerFrame> ();
+  if (m_frameEndSchedulingBegun && crdsaPrxc != 0)
+    {
+      crdsaPrxc->BeginFrameEndScheduling ();
+    }
+
+  ConnectRxCarrierTraces (rxc);
+
+  return rxc;
+}
+
+void
+SatPhyRx::ConnectRxCarrierTraces (Ptr<SatPhyRxCarrier> rxc) const
+{
+  NS_LOG_FUNCTION (this << rxc);
+
+  rxc->TraceConnectWithoutContext ("LinkBudgetTrace", MakeCallback (&SatPhyRx::LinkBudgetTraceForward, this));
+  rxc->TraceConnectWithoutContext ("RxPowerTrace", MakeCallback (&SatPhyRx::RxPowerTraceForward, this));
+  rxc->TraceConnectWithoutContext ("Sinr", MakeCallback (&SatPhyRx::SinrTraceForward, this));
+  rxc->TraceConnectWithoutContext ("LinkSinr", MakeCallback (&SatPhyRx::LinkSinrTraceForward, this));
+
+  switch (rxc->GetCarrierType ())
+    {
+    case SatPhyRxCarrier::DEDICATED_ACCESS:
+      {
+        rxc->TraceConnectWithoutContext ("DaRx", MakeCallback (&SatPhyRx::DaRxTraceForward, this));
+        break;
+      }
+    case SatPhyRxCarrier::RA_SLOTTED_ALOHA:
+      {
+        rxc->TraceConnectWithoutContext ("SlottedAlohaRxCollision",
+                                         MakeCallback (&SatPhyRx::SlottedAlohaRxCollisionTraceForward, this));
+        rxc->TraceConnectWithoutContext ("SlottedAlohaRxError",
+                                         MakeCallback (&SatPhyRx::SlottedAlohaRxErrorTraceForward, this));
+        break;
+      }
+    case SatPhyRxCarrier::RA_CRDSA:
+      {
+        rxc->TraceConnectWithoutContext ("CrdsaReplicaRx",
+                                         MakeCallback (&SatPhyRx::CrdsaReplicaRxTraceForward, this));
+        rxc->TraceConnectWithoutContext ("CrdsaUniquePayloadRx",
+                                         MakeCallback (&SatPhyRx::CrdsaUniquePayloadRxTraceForward, this));
+        break;
+      }
+    default:
+      {
+        break;
+      }
+    }
+}
+
+void
+SatPhyRx::LinkBudgetTraceForward (Ptr<SatSignalParameters> rxParams, Mac48Address receiverAddress,
+                                  Mac48Address destinationAddress, double interference, double sinr) const
+{
+  m_linkBudgetTrace (rxParams, receiverAddress, destinationAddress, interference, sinr);
+}
+
+void
+SatPhyRx::RxPowerTraceForward (double rxPower) const
+{
+  m_rxPowerTrace (rxPower);
+}
+
+void
+SatPhyRx::SinrTraceForward (double sinr, const Address &source) const
+{
+  m_sinrTrace (sinr, source);
+}
+
+void
+SatPhyRx::LinkSinrTraceForward (double sinr) const
+{
+  m_linkSinrTrace (sinr);
+}
+
+void
+SatPhyRx::DaRxTraceForward (uint32_t nPackets, const Address &from, bool isError) const
+{
+  m_daRxTrace (nPackets, from, isError);
+}
+
+void
+SatPhyRx::SlottedAlohaRxCollisionTraceForward (uint32_t nPackets, const Address &from, bool isCollided) const
+{
+  m_slottedAlohaRxCollisionTrace (nPackets, from, isCollided);
+}
+
+void
+SatPhyRx::SlottedAlohaRxErrorTraceForward (uint32_t nPackets, const Address &from, bool isError) const
+{
+  m_slottedAlohaRxErrorTrace (nPackets, from, isError);
+}
+
+void
+SatPhyRx::CrdsaReplicaRxTraceForward (uint32_t nPackets, const Address &from, bool isCollided) const
+{
+  m_crdsaReplicaRxTrace (nPackets, from, isCollided);
+}
+
+void
+SatPhyRx::CrdsaUniquePayloadRxTraceForward (uint32_t nPackets, const Address &from, bool isError) const
+{
+  m_crdsaUniquePayloadRxTrace (nPackets, from, isError);
 }
 
 void
@@ -364,7 +660,10 @@ SatPhyRx::SetBeamId (uint32_t beamId)
 
   for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin (); it != m_rxCarriers.end (); ++it)
     {
-      (*it)->SetBeamId (beamId);
+      if (*it != 0)
+        {
+          (*it)->SetBeamId (beamId);
+        }
     }
 }
 
@@ -381,14 +680,14 @@ SatPhyRx::StartRx (Ptr<SatSignalParameters> rxParams)
 {
   NS_LOG_FUNCTION (this << rxParams);
 
-  uint32_t cId = rxParams->m_carrierId;
+  uint32_t cId = rxParams->m_burst->m_carrierId;
 
   if (cId >= m_rxCarriers.size ())
     {
       NS_FATAL_ERROR ("SatPhyRx::StartRx - unvalid carrier id: " << cId);
     }
 
-  m_rxCarriers[cId]->StartRx (rxParams);
+  GetRxCarrier (cId)->StartRx (rxParams);
 }
 
 } // namespace ns3
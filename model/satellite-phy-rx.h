@@ -24,6 +24,7 @@
 #include "ns3/mobility-model.h"
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
 #include "satellite-net-device.h"
 #include "satellite-signal-parameters.h"
 #include "satellite-antenna-gain-pattern.h"
@@ -144,6 +145,13 @@ public:
   uint32_t GetBeamId () const;
 
   /**
+   * \brief Configure the receiver carriers. By default a SatPhyRxCarrier is
+   * created for each configured carrier. If attribute LazyRxCarrierCreation
+   * is enabled, only the random access carriers are created here and the
+   * rest are created on their first reception or when they are accessed
+   * through attribute RxCarrierList. The trace sources of the carriers are
+   * forwarded through the trace sources of this receiver, so connecting
+   * them does not create the carriers.
    * \param carrierConf Carrier configuration class
    * \param superFrameConf Superframe configuration
    */
@@ -178,6 +186,11 @@ public:
    */
   typedef Callback<void, uint32_t, uint32_t, uint8_t, double > AverageNormalizedOfferedLoadCallback;
 
+  /**
+   * \return interference power of the background load relative to the noise power
+   */
+  typedef Callback<double> BackgroundInterferenceCallback;
+
   /**
    * Set the upper layer receive callback
    * \param cb receive callback funtion pointer
@@ -196,6 +209,12 @@ public:
    */
   void SetAverageNormalizedOfferedLoadCallback (SatPhyRx::AverageNormalizedOfferedLoadCallback cb);
 
+  /**
+   * Set background interference callback
+   * \param cb callback returning the interference of the background load
+   */
+  void SetBackgroundInterferenceCallback (SatPhyRx::BackgroundInterferenceCallback cb);
+
   /**
    * \brief Get MAC address of this PHY/MAC
    * \return Mac48Address MAC address of this PHY
@@ -213,7 +232,119 @@ public:
    */
   void BeginFrameEndScheduling ();
 
+  /**
+   * \brief Get the number of configured receiver carriers
+   * \return number of carriers
+   */
+  uint32_t GetNRxCarriers () const;
+
+  /**
+   * \brief Get a receiver carrier, creating it if it has not been created yet
+   * \param carrierId Id of the carrier
+   * \return the receiver carrier
+   */
+  Ptr<SatPhyRxCarrier> GetRxCarrier (uint32_t carrierId) const;
+
+  /**
+   * \brief Get the number of receiver carriers created so far
+   * \return number of created carriers
+   */
+  uint32_t GetNCreatedRxCarriers () const;
+
 private:
+  /**
+   * \brief Create the receiver carrier matching the configuration of the
+   * carrier and apply the settings given to this receiver so far.
+   * \param carrierId Id of the carrier
+   * \return the created receiver carrier
+   */
+  Ptr<SatPhyRxCarrier> CreateRxCarrier (uint32_t carrierId) const;
+
+  /**
+   * \brief Forward the trace sources of a created carrier to the trace
+   * sources of this receiver. The random access and dedicated access trace
+   * sources are forwarded only from the carriers of the matching type.
+   * \param rxc the receiver carrier
+   */
+  void ConnectRxCarrierTraces (Ptr<SatPhyRxCarrier> rxc) const;
+
+  /**
+   * \brief Forward the `LinkBudgetTrace` trace source of a carrier
+   * \param rxParams RX signalling parameters
+   * \param receiverAddress receiver address
+   * \param destinationAddress packet destination address
+   * \param interference interference power (in W)
+   * \param sinr composite SINR (in linear unit)
+   */
+  void LinkBudgetTraceForward (Ptr<SatSignalParameters> rxParams, Mac48Address receiverAddress,
+                               Mac48Address destinationAddress, double interference, double sinr) const;
+
+  /**
+   * \brief Forward the `RxPowerTrace` trace source of a carrier
+   * \param rxPower received signal power (in dbW)
+   */
+  void RxPowerTraceForward (double rxPower) const;
+
+  /**
+   * \brief Forward the `Sinr` trace source of a carrier
+   * \param sinr composite SINR (in dB)
+   * \param source address of the node the signal originates from
+   */
+  void SinrTraceForward (double sinr, const Address &source) const;
+
+  /**
+   * \brief Forward the `LinkSinr` trace source of a carrier
+   * \param sinr link specific SINR (in dB)
+   */
+  void LinkSinrTraceForward (double sinr) const;
+
+  /**
+   * \brief Forward the `DaRx` trace source of a carrier
+   * \param nPackets number of upper layer packets in the packet burst
+   * \param from the MAC48 address of the sender of the packets
+   * \param isError whether a PHY error has occurred
+   */
+  void DaRxTraceForward (uint32_t nPackets, const Address &from, bool isError) const;
+
+  /**
+   * \brief Forward the `SlottedAlohaRxCollision` trace source of a carrier
+   * \param nPackets number of packets in the packet burst
+   * \param from the MAC48 address of the sender of the packets
+   * \param isCollided whether a collision has occurred
+   */
+  void SlottedAlohaRxCollisionTraceForward (uint32_t nPackets, const Address &from, bool isCollided) const;
+
+  /**
+   * \brief Forward the `SlottedAlohaRxError` trace source of a carrier
+   * \param nPackets number of upper layer packets in the packet burst
+   * \param from the MAC48 address of the sender of the packets
+   * \param isError whether a PHY error has occurred
+   */
+  void SlottedAlohaRxErrorTraceForward (uint32_t nPackets, const Address &from, bool isError) const;
+
+  /**
+   * \brief Forward the `CrdsaReplicaRx` trace source of a carrier
+   * \param nPackets number of packets in the packet burst
+   * \param from the MAC48 address of the sender of the packets
+   * \param isCollided whether a collision has occurred
+   */
+  void CrdsaReplicaRxTraceForward (uint32_t nPackets, const Address &from, bool isCollided) const;
+
+  /**
+   * \brief Forward the `CrdsaUniquePayloadRx` trace source of a carrier
+   * \param nPackets number of upper layer packets in the payload
+   * \param from the MAC48 address of the sender of the packets
+   * \param isError whether a PHY error has occurred
+   */
+  void CrdsaUniquePayloadRxTraceForward (uint32_t nPackets, const Address &from, bool isError) const;
+
+  /**
+   * \brief Check whether a carrier is used for random access
+   * \param carrierId Id of the carrier
+   * \return true if the carrier is a random access carrier
+   */
+  bool IsRandomAccessCarrier (uint32_t carrierId) const;
+
   Ptr<MobilityModel> m_mobility;
   Ptr<NetDevice> m_device;
 
@@ -235,8 +366,32 @@ private:
    */
   double m_antennaLoss;
 
-  // A SatPhyRxCarrier object for receiving packets from each carrier
-  std::vector< Ptr<SatPhyRxCarrier> > m_rxCarriers;
+  /**
+   * A SatPhyRxCarrier object for receiving packets from each carrier. With
+   * lazy creation the carriers not yet created are NULL.
+   */
+  mutable std::vector< Ptr<SatPhyRxCarrier> > m_rxCarriers;
+
+  /**
+   * Create the non random access carriers on first use
+   */
+  bool m_lazyRxCarrierCreation;
+
+  /**
+   * Configurations shared by all the carriers, used for creating them
+   */
+  Ptr<SatPhyRxCarrierConf> m_carrierConf;
+  Ptr<SatSuperframeConf> m_superFrameConf;
+
+  /**
+   * Settings applied to the carriers created after them
+   */
+  Ptr<SatNodeInfo> m_nodeInfo;
+  SatPhyRx::ReceiveCallback m_receiveCb;
+  SatPhyRx::CnoCallback m_cnoCb;
+  SatPhyRx::AverageNormalizedOfferedLoadCallback m_avgNormalizedOfferedLoadCb;
+  SatPhyRx::BackgroundInterferenceCallback m_backgroundIfCb;
+  bool m_frameEndSchedulingBegun;
 
   /**
    * \brief Fading container for fading model
@@ -247,6 +402,20 @@ private:
    * \brief Default fading value
    */
   double m_defaultFadingValue;
+
+  /**
+   * Trace sources forwarded from the carriers, see SatPhyRxCarrier,
+   * SatPhyRxCarrierPerSlot and SatPhyRxCarrierPerFrame
+   */
+  TracedCallback<Ptr<SatSignalParameters>, Mac48Address, Mac48Address, double, double> m_linkBudgetTrace;
+  TracedCallback<double> m_rxPowerTrace;
+  TracedCallback<double, const Address &> m_sinrTrace;
+  TracedCallback<double> m_linkSinrTrace;
+  TracedCallback<uint32_t, const Address &, bool> m_daRxTrace;
+  TracedCallback<uint32_t, const Address &, bool> m_slottedAlohaRxCollisionTrace;
+  TracedCallback<uint32_t, const Address &, bool> m_slottedAlohaRxErrorTrace;
+  TracedCallback<uint32_t, const Address &, bool> m_crdsaReplicaRxTrace;
+  TracedCallback<uint32_t, const Address &, bool> m_crdsaUniquePayloadRxTrace;
 };
 
 
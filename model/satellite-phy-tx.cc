@@ -247,7 +247,7 @@ SatPhyTx::StartTx (Ptr<SatSignalParameters> txParams)
           }
         else
           {
-            Simulator::Schedule (txParams->m_duration, &SatPhyTx::EndTx, this);
+            Simulator::Schedule (txParams->m_burst->m_duration, &SatPhyTx::EndTx, this);
           }
       }
       break;
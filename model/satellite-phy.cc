@@ -35,8 +35,7 @@
 #include <ns3/satellite-signal-parameters.h>
 #include <ns3/satellite-node-info.h>
 #include <ns3/satellite-enums.h>
-#include <ns3/satellite-address-tag.h>
-#include <ns3/satellite-time-tag.h>
+#include <ns3/satellite-metadata-tag.h>
 #include <ns3/satellite-typedefs.h>
 
 
@@ -88,6 +87,10 @@ SatPhy::SatPhy (CreateParam_t & params)
   m_phyTx = CreateObject<SatPhyTx> ();
   m_phyTx->SetChannel (params.m_txCh);
   m_phyRx = CreateObject<SatPhyRx> ();
+  if (params.m_lazyRxCarriers)
+    {
+      m_phyRx->SetAttribute ("LazyRxCarrierCreation", BooleanValue (true));
+    }
   m_beamId = params.m_beamId;
 
   params.m_rxCh->AddRx (m_phyRx);
@@ -130,6 +133,10 @@ SatPhy::GetTypeId (void)
                      "A packet is received with delay information",
                      MakeTraceSourceAccessor (&SatPhy::m_rxDelayTrace),
                      "ns3::SatTypedefs::PacketDelayAddressCallback")
+    .AddTraceSource ("Cno",
+                     "A C/N0 measured from a received packet",
+                     MakeTraceSourceAccessor (&SatPhy::m_cnoTrace),
+                     "ns3::SatPhy::CnoTracedCallback")
   ;
   return tid;
 }
@@ -294,12 +301,12 @@ SatPhy::SendPdu (PacketContainer_t p, uint32_t carrierId, Time duration, SatSign
   NS_LOG_FUNCTION (this << carrierId << duration);
   NS_LOG_INFO (this << " sending a packet with carrierId: " << carrierId << " duration: " << duration);
 
-  // Add a SatPhyTimeTag tag for packet delay computation at the receiver end.
+  // Add a PHY time stamp for packet delay computation at the receiver end.
   if (m_isStatisticsTagsEnabled)
     {
       for (PacketContainer_t::const_iterator it = p.begin (); it != p.end (); ++it)
         {
-          (*it)->AddPacketTag (SatPhyTimeTag (Simulator::Now ()));
+          SatMetadataTag::StampPacket (*it, SatMetadataTag::TS_PHY, Simulator::Now ());
         }
     }
 
@@ -319,19 +326,11 @@ SatPhy::SendPdu (PacketContainer_t p, uint32_t carrierId, Time duration, SatSign
 
   // Create a new SatSignalParameters related to this packet transmission
   Ptr<SatSignalParameters> txParams = Create<SatSignalParameters> ();
-  txParams->m_duration = duration;
+  txParams->m_burst = Create<SatSignalParameters::Burst> (p, txInfo, duration, m_beamId, carrierId,
+                                                         m_nodeInfo->GetTraceId ());
   txParams->m_phyTx = m_phyTx;
-  txParams->m_packetsInBurst = p;
-  txParams->m_beamId = m_beamId;
-  txParams->m_carrierId = carrierId;
   txParams->m_sinr = 0;
   txParams->m_txPower_W = m_eirpWoGainW;
-  txParams->m_txInfo.modCod = txInfo.modCod;
-  txParams->m_txInfo.fecBlockSizeInBytes = txInfo.fecBlockSizeInBytes;
-  txParams->m_txInfo.frameType = txInfo.frameType;
-  txParams->m_txInfo.waveformId = txInfo.waveformId;
-  txParams->m_txInfo.packetType = txInfo.packetType;
-  txParams->m_txInfo.crdsaUniquePacketId = txInfo.crdsaUniquePacketId;
 
   m_phyTx->StartTx (txParams);
 }
@@ -375,59 +374,55 @@ SatPhy::Receive (Ptr<SatSignalParameters> rxParams, bool phyError)
                  m_nodeInfo->GetMacAddress (),
                  SatEnums::LL_PHY,
                  ld,
-                 SatUtils::GetPacketInfo (rxParams->m_packetsInBurst));
+                 SatUtils::GetPacketInfo (rxParams->m_burst->m_packetsInBurst));
 
   if (phyError)
     {
       // If there was a PHY error, the packet is dropped here.
-      NS_LOG_INFO (this << " dropped " << rxParams->m_packetsInBurst.size ()
+      NS_LOG_INFO (this << " dropped " << rxParams->m_burst->m_packetsInBurst.size ()
                          << " packets because of PHY error.");
     }
   else
     {
+      // The packets are modified from here on, thus detach them from the
+      // burst shared with the other receivers of the transmission.
+      rxParams->DetachPacketsInBurst ();
+
       // Invoke the `Rx` and `RxDelay` trace sources.
       if (m_isStatisticsTagsEnabled)
         {
-          SatSignalParameters::PacketsInBurst_t::iterator it1;
-          for (it1 = rxParams->m_packetsInBurst.begin ();
-               it1 != rxParams->m_packetsInBurst.end (); ++it1)
+          SatSignalParameters::PacketsInBurst_t::const_iterator it1;
+          for (it1 = rxParams->m_burst->m_packetsInBurst.begin ();
+               it1 != rxParams->m_burst->m_packetsInBurst.end (); ++it1)
             {
               Address addr; // invalid address.
-              bool isTaggedWithAddress = false;
-              ByteTagIterator it2 = (*it1)->GetByteTagIterator ();
+              SatMetadataTag metadataTag;
+              bool isTagged = (*it1)->PeekPacketTag (metadataTag);
 
-              while (!isTaggedWithAddress && it2.HasNext ())
+              if (isTagged && metadataTag.HasSourceAddress ())
                 {
-                  ByteTagIterator::Item item = it2.Next ();
-
-                  if (item.GetTypeId () == SatAddressTag::GetTypeId ())
-                    {
-                      NS_LOG_DEBUG (this << " contains a SatAddressTag tag:"
-                                         << " start=" << item.GetStart ()
-                                         << " end=" << item.GetEnd ());
-                      SatAddressTag addrTag;
-                      item.GetTag (addrTag);
-                      addr = addrTag.GetSourceAddress ();
-                      isTaggedWithAddress = true; // this will exit the while loop.
-                    }
+                  NS_LOG_DEBUG (this << " contains a source address " << metadataTag.GetSourceAddress ());
+                  addr = metadataTag.GetSourceAddress ();
                 }
 
               m_rxTrace (*it1, addr);
 
-              SatPhyTimeTag timeTag;
-              if ((*it1)->RemovePacketTag (timeTag))
+              if (isTagged && metadataTag.HasTimestamp (SatMetadataTag::TS_PHY))
                 {
-                  NS_LOG_DEBUG (this << " contains a SatPhyTimeTag tag");
-                  m_rxDelayTrace (Simulator::Now () - timeTag.GetSenderTimestamp (),
+                  NS_LOG_DEBUG (this << " contains a PHY time stamp");
+                  m_rxDelayTrace (Simulator::Now () - metadataTag.GetTimestamp (SatMetadataTag::TS_PHY),
                                   addr);
                 }
 
-            } // end of `for (it1 = rxParams->m_packetsInBurst)`
+              // Remove the PHY time stamp
+              SatMetadataTag::ClearPacketTimestamp (*it1, SatMetadataTag::TS_PHY);
+
+            } // end of `for (it1 = rxParams->m_burst->m_packetsInBurst)`
 
         } // end of `if (m_isStatisticsTagsEnabled)`
 
       // Pass the packet to the upper layer.
-      m_rxCallback (rxParams->m_packetsInBurst, rxParams);
+      m_rxCallback (rxParams->m_burst->m_packetsInBurst, rxParams);
 
     } // end of else of `if (phyError)`
 
@@ -438,6 +433,7 @@ SatPhy::CnoInfo (uint32_t beamId, Address source, Address dest, double cno)
 {
   NS_LOG_FUNCTION (this << beamId << source << cno);
   m_cnoCallback ( beamId, source, dest, cno);
+  m_cnoTrace (beamId, source, dest, cno);
 }
 
 void
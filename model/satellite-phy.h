@@ -81,6 +81,15 @@ public:
    */
   typedef Callback<void, uint32_t, Address, Address, double> CnoCallback;
 
+  /**
+   * \brief Callback signature for `Cno` trace source.
+   * \param beamId The id of the beam.
+   * \param source The id (address) of the source or sender
+   * \param destination The id (address) of the destination or receiver
+   * \param cno C/N0 value
+   */
+  typedef void (* CnoTracedCallback)(uint32_t beamId, Address source, Address destination, double cno);
+
   /**
    * \param beam Id
    * \param carrier Id
@@ -98,6 +107,7 @@ public:
     Ptr<SatChannel> m_txCh;
     Ptr<SatChannel> m_rxCh;
     uint32_t m_beamId;
+    bool m_lazyRxCarriers;
   } CreateParam_t;
 
   /**
@@ -509,6 +519,12 @@ private:
    */
   SatPhy::CnoCallback m_cnoCallback;
 
+  /**
+   * Traced callback for the C/N0 measurements passed to the C/N0 info
+   * callback.
+   */
+  TracedCallback<uint32_t, Address, Address, double> m_cnoTrace;
+
   /**
    * Average normalized offered load callback
    */
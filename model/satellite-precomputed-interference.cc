@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/singleton.h"
+#include "satellite-beam-interference-matrix.h"
+#include "satellite-precomputed-interference.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatPrecomputedInterference");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatPrecomputedInterference);
+
+TypeId
+SatPrecomputedInterference::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatPrecomputedInterference")
+    .SetParent<SatInterference> ()
+    .AddConstructor<SatPrecomputedInterference> ()
+  ;
+  return tid;
+}
+
+TypeId
+SatPrecomputedInterference::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+SatPrecomputedInterference::SatPrecomputedInterference ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatPrecomputedInterference::~SatPrecomputedInterference ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Reset ();
+}
+
+Ptr<SatInterference::InterferenceChangeEvent>
+SatPrecomputedInterference::DoAdd (Time duration, double power, Address rxAddress)
+{
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << power << rxAddress);
+
+  Ptr<SatInterference::InterferenceChangeEvent> event;
+  event = Create<SatInterference::InterferenceChangeEvent> (0, duration, power, rxAddress);
+
+  return event;
+}
+
+double
+SatPrecomputedInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  double ifWrtCarrier = Singleton<SatBeamInterferenceMatrix>::Get ()->GetInterferenceWrtCarrier (event->GetSatEarthStationAddress (),
+                                                                                                  event->GetStartTime (),
+                                                                                                  event->GetEndTime ());
+
+  return event->GetRxPower () * ifWrtCarrier;
+}
+
+void
+SatPrecomputedInterference::DoReset ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatPrecomputedInterference::DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatPrecomputedInterference::DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+}
+// namespace ns3
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_PRECOMPUTED_INTERFERENCE_H
+#define SATELLITE_PRECOMPUTED_INTERFERENCE_H
+
+#include "satellite-interference.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Satellite precomputed interference. Interference of the co-channel
+ * beams is computed analytically from the power of the wanted signal, the
+ * precomputed antenna gain ratios of the beams at the receiver and the
+ * activity of the beams, see SatBeamInterferenceMatrix. Only the forward
+ * user link with static receivers is supported.
+ */
+class SatPrecomputedInterference : public SatInterference
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Default constructor.
+   */
+  SatPrecomputedInterference ();
+
+  /**
+   * Destructor for SatPrecomputedInterference
+   */
+  ~SatPrecomputedInterference ();
+
+private:
+  /**
+   * Adds interference power to interference object.
+   * Only the event of the wanted signal is created in this implementation.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   * \param rxAddress Address of the receiver.
+   *
+   * \return the pointer to interference event as a reference of the addition
+   */
+  virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd (Time rxDuration, double rxPower, Address rxAddress);
+
+  /**
+   * Calculates interference power for the given reference
+   *
+   * \param event Reference event which for interference is calculated.
+   *
+   * \return Power of the wanted signal multiplied with the interference of
+   * the active co-channel beams relative to it.
+   */
+  virtual double DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Resets current interference.
+   */
+  virtual void DoReset (void);
+
+  /**
+   * Notifies that RX is started by a receiver.
+   *
+   * \param event Interference reference event of receiver (ignored in this implementation)
+   */
+  virtual void DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Notifies that RX is ended by a receiver.
+   *
+   * \param event Interference reference event of receiver (ignored in this implementation)
+   */
+  virtual void DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  SatPrecomputedInterference (const SatPrecomputedInterference &o);
+  SatPrecomputedInterference &operator = (const SatPrecomputedInterference &o);
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_PRECOMPUTED_INTERFERENCE_H */
@@ -23,6 +23,8 @@
 #include "ns3/enum.h"
 #include "ns3/singleton.h"
 #include "ns3/uinteger.h"
+#include <algorithm>
+#include <sstream>
 #include "satellite-queue.h"
 #include "satellite-utils.h"
 #include "satellite-const-variables.h"
@@ -45,6 +47,13 @@ TypeId SatQueue::GetTypeId (void)
                    UintegerValue (1000),
                    MakeUintegerAccessor (&SatQueue::m_maxPackets),
                    MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("DropLogInterval",
+                   "Minimum interval between the warnings of packets dropped at full queue "
+                   "written to SatLog. Drops in between are counted and reported with the "
+                   "next warning. Zero writes a warning of every drop.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&SatQueue::m_dropLogInterval),
+                   MakeTimeChecker ())
     .AddTraceSource ("Enqueue",
                      "Enqueue a packet in the queue.",
                      MakeTraceSourceAccessor (&SatQueue::m_traceEnqueue),
@@ -57,6 +66,14 @@ TypeId SatQueue::GetTypeId (void)
                      "Drop a packet stored in the queue.",
                      MakeTraceSourceAccessor (&SatQueue::m_traceDrop),
                      "ns3::Packet::TracedCallback")
+    .AddTraceSource ("BytesInQueue",
+                     "Number of bytes currently stored in the queue.",
+                     MakeTraceSourceAccessor (&SatQueue::m_nBytes),
+                     "ns3::TracedValue::Uint32Callback")
+    .AddTraceSource ("PacketsInQueue",
+                     "Number of packets currently stored in the queue.",
+                     MakeTraceSourceAccessor (&SatQueue::m_nPackets),
+                     "ns3::TracedValue::Uint32Callback")
   ;
 
   return tid;
@@ -75,9 +92,17 @@ SatQueue::SatQueue ()
     m_nTotalDroppedPackets (),
     m_nEnqueBytesSinceReset (0),
     m_nDequeBytesSinceReset (0),
-    m_statResetTime (0)
+    m_statResetTime (0),
+    m_dropLogInterval (Seconds (1.0)),
+    m_lastDropLogTime (Seconds (0.0)),
+    m_dropLogged (false),
+    m_suppressedDropLogs (0),
+    m_dropLogSuffix ()
 {
   NS_LOG_FUNCTION (this);
+
+  std::fill (m_sizeClassPackets, m_sizeClassPackets + NUM_SIZE_CLASSES, 0);
+  std::fill (m_sizeClassBytes, m_sizeClassBytes + NUM_SIZE_CLASSES, 0);
 }
 
 
@@ -94,9 +119,17 @@ SatQueue::SatQueue (uint8_t flowId)
     m_nTotalDroppedPackets (),
     m_nEnqueBytesSinceReset (0),
     m_nDequeBytesSinceReset (0),
-    m_statResetTime (Seconds (0.0))
+    m_statResetTime (Seconds (0.0)),
+    m_dropLogInterval (Seconds (1.0)),
+    m_lastDropLogTime (Seconds (0.0)),
+    m_dropLogged (false),
+    m_suppressedDropLogs (0),
+    m_dropLogSuffix ()
 {
   NS_LOG_FUNCTION (this);
+
+  std::fill (m_sizeClassPackets, m_sizeClassPackets + NUM_SIZE_CLASSES, 0);
+  std::fill (m_sizeClassBytes, m_sizeClassBytes + NUM_SIZE_CLASSES, 0);
 }
 
 SatQueue::~SatQueue ()
@@ -144,12 +177,7 @@ SatQueue::Enqueue (Ptr<Packet> p)
     {
       NS_LOG_INFO ("Queue full (at max packets) -- dropping pkt");
 
-      std::stringstream msg;
-      msg << "SatQueue is full: packet dropped!";
-      msg << " at: " << Now ().GetSeconds () << "s";
-      msg << " MaxPackets: " << m_maxPackets;
-      Singleton<SatLog>::Get ()->AddToLog (SatLog::LOG_WARNING, "", msg.str ());
-
+      LogDrop ();
       Drop (p);
       return false;
     }
@@ -164,6 +192,7 @@ SatQueue::Enqueue (Ptr<Packet> p)
 
   m_nEnqueBytesSinceReset += p->GetSize ();
 
+  AddToSizeClass (p->GetSize ());
   m_packets.push_back (p);
 
   NS_LOG_INFO ("Number packets " << m_packets.size ());
@@ -195,6 +224,7 @@ SatQueue::Dequeue ()
 
   Ptr<Packet> p = m_packets.front ();
   m_packets.pop_front ();
+  RemoveFromSizeClass (p->GetSize ());
 
   m_nBytes -= p->GetSize ();
   --m_nPackets;
@@ -234,6 +264,7 @@ SatQueue::PushFront (Ptr<Packet> p)
   NS_LOG_FUNCTION (this << p->GetSize ());
 
   m_packets.push_front (p);
+  AddToSizeClass (p->GetSize ());
 
   ++m_nPackets;
   m_nBytes += p->GetSize ();
@@ -263,6 +294,42 @@ SatQueue::Drop (Ptr<Packet> p)
   m_traceDrop (p);
 }
 
+void
+SatQueue::LogDrop ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Time now = Simulator::Now ();
+
+  if (m_dropLogged && (now - m_lastDropLogTime) < m_dropLogInterval)
+    {
+      ++m_suppressedDropLogs;
+      return;
+    }
+
+  // the constant part of the warning is formatted only once
+  if (m_dropLogSuffix.empty ())
+    {
+      std::stringstream suffix;
+      suffix << "s MaxPackets: " << m_maxPackets;
+      m_dropLogSuffix = suffix.str ();
+    }
+
+  std::stringstream msg;
+  msg << "SatQueue is full: packet dropped! at: " << now.GetSeconds () << m_dropLogSuffix;
+
+  if (m_suppressedDropLogs > 0)
+    {
+      msg << " (" << m_suppressedDropLogs << " drops since previous warning)";
+    }
+
+  Singleton<SatLog>::Get ()->AddToLog (SatLog::LOG_WARNING, "", msg.str ());
+
+  m_dropLogged = true;
+  m_lastDropLogTime = now;
+  m_suppressedDropLogs = 0;
+}
+
 void
 SatQueue::AddQueueEventCallback (SatQueue::QueueEventCallback cb)
 {
@@ -386,6 +453,39 @@ SatQueue::GetNumSmallerPackets (uint32_t maxPacketSizeBytes) const
 {
   NS_LOG_FUNCTION (this << maxPacketSizeBytes);
 
+  if (m_packets.empty ())
+    {
+      return 0;
+    }
+
+  // The size class counters tell whether the queue holds any packet larger
+  // than the threshold. If not, all packets are counted without going
+  // through the queue.
+  uint32_t thresholdClass = GetSizeClass (maxPacketSizeBytes);
+  bool largerPackets = false;
+
+  for (uint32_t sizeClass = thresholdClass + 1; sizeClass < NUM_SIZE_CLASSES; ++sizeClass)
+    {
+      if (m_sizeClassPackets[sizeClass] > 0)
+        {
+          largerPackets = true;
+          break;
+        }
+    }
+
+  // the threshold class may have packets larger than the threshold, unless
+  // the threshold is the largest size of the class
+  if (!largerPackets && m_sizeClassPackets[thresholdClass] > 0)
+    {
+      largerPackets = (thresholdClass == NUM_SIZE_CLASSES - 1)
+        || (maxPacketSizeBytes < (1u << thresholdClass) - 1);
+    }
+
+  if (!largerPackets)
+    {
+      return m_packets.size ();
+    }
+
   uint32_t packets (0);
   for (PacketContainer_t::const_iterator it = m_packets.begin ();
        it != m_packets.end ();
@@ -403,7 +503,59 @@ SatQueue::GetNumSmallerPackets (uint32_t maxPacketSizeBytes) const
   return packets;
 }
 
-} // namespace ns3
+uint32_t
+SatQueue::GetSizeClass (uint32_t packetSizeBytes)
+{
+  uint32_t sizeClass = 0;
+
+  while (packetSizeBytes > 0 && sizeClass < NUM_SIZE_CLASSES - 1)
+    {
+      packetSizeBytes >>= 1;
+      ++sizeClass;
+    }
+
+  return sizeClass;
+}
+
+uint32_t
+SatQueue::GetNPacketsInSizeClass (uint32_t sizeClass) const
+{
+  NS_LOG_FUNCTION (this << sizeClass);
+
+  NS_ASSERT (sizeClass < NUM_SIZE_CLASSES);
+
+  return m_sizeClassPackets[sizeClass];
+}
 
+uint32_t
+SatQueue::GetNBytesInSizeClass (uint32_t sizeClass) const
+{
+  NS_LOG_FUNCTION (this << sizeClass);
 
+  NS_ASSERT (sizeClass < NUM_SIZE_CLASSES);
+
+  return m_sizeClassBytes[sizeClass];
+}
 
+void
+SatQueue::AddToSizeClass (uint32_t packetSizeBytes)
+{
+  uint32_t sizeClass = GetSizeClass (packetSizeBytes);
+
+  ++m_sizeClassPackets[sizeClass];
+  m_sizeClassBytes[sizeClass] += packetSizeBytes;
+}
+
+void
+SatQueue::RemoveFromSizeClass (uint32_t packetSizeBytes)
+{
+  uint32_t sizeClass = GetSizeClass (packetSizeBytes);
+
+  NS_ASSERT (m_sizeClassPackets[sizeClass] > 0);
+  NS_ASSERT (m_sizeClassBytes[sizeClass] >= packetSizeBytes);
+
+  --m_sizeClassPackets[sizeClass];
+  m_sizeClassBytes[sizeClass] -= packetSizeBytes;
+}
+
+} // namespace ns3
@@ -23,10 +23,12 @@
 #define SATELLITE_QUEUE_H_
 
 #include <queue>
+#include <string>
 #include "ns3/nstime.h"
 #include "ns3/packet.h"
 #include "ns3/object.h"
 #include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
 
 
 namespace ns3 {
@@ -79,6 +81,13 @@ public:
     BUFFERED_PKT
   } QueueEvent_t;
 
+  /**
+   * Number of packet size classes. Size class k holds the packets with size
+   * of k significant bits, i.e. sizes [2^(k-1), 2^k - 1]. The last class
+   * holds also all larger packets.
+   */
+  static const uint32_t NUM_SIZE_CLASSES = 18;
+
   /**
    * Default constructor
    */
@@ -222,6 +231,27 @@ public:
    */
   uint32_t GetNumSmallerPackets (uint32_t maxPacketSizeBytes) const;
 
+  /**
+   * \brief Get the size class of a packet size
+   * \param packetSizeBytes Packet size in Bytes
+   * \return Size class
+   */
+  static uint32_t GetSizeClass (uint32_t packetSizeBytes);
+
+  /**
+   * \brief Get number of packets of a size class currently stored in the queue
+   * \param sizeClass Size class
+   * \return Number of packets
+   */
+  uint32_t GetNPacketsInSizeClass (uint32_t sizeClass) const;
+
+  /**
+   * \brief Get number of bytes of a size class currently stored in the queue
+   * \param sizeClass Size class
+   * \return Number of bytes
+   */
+  uint32_t GetNBytesInSizeClass (uint32_t sizeClass) const;
+
 protected:
   /**
    * \brief Drop a packet
@@ -242,6 +272,25 @@ private:
    */
   void ResetShortTermStatistics ();
 
+  /**
+   * \brief Add a packet to the size class counters
+   * \param packetSizeBytes Packet size in Bytes
+   */
+  void AddToSizeClass (uint32_t packetSizeBytes);
+
+  /**
+   * \brief Remove a packet from the size class counters
+   * \param packetSizeBytes Packet size in Bytes
+   */
+  void RemoveFromSizeClass (uint32_t packetSizeBytes);
+
+  /**
+   * \brief Write a warning of a packet dropped at full queue to SatLog, at most
+   * once per drop log interval. The drops in between are counted and reported
+   * with the next warning.
+   */
+  void LogDrop ();
+
   typedef std::vector<QueueEventCallback> EventCallbackContainer_t;
   typedef std::deque<Ptr<Packet> > PacketContainer_t;
 
@@ -266,9 +315,9 @@ private:
   uint8_t m_flowId;
 
   // Statistics
-  uint32_t m_nBytes;
+  TracedValue<uint32_t> m_nBytes;
   uint32_t m_nTotalReceivedBytes;
-  uint32_t m_nPackets;
+  TracedValue<uint32_t> m_nPackets;
   uint32_t m_nTotalReceivedPackets;
   uint32_t m_nTotalDroppedBytes;
   uint32_t m_nTotalDroppedPackets;
@@ -278,6 +327,17 @@ private:
   uint32_t m_nDequeBytesSinceReset;
   Time m_statResetTime;
 
+  // Packets and bytes currently in the queue per size class
+  uint32_t m_sizeClassPackets[NUM_SIZE_CLASSES];
+  uint32_t m_sizeClassBytes[NUM_SIZE_CLASSES];
+
+  // Drop logging
+  Time m_dropLogInterval;
+  Time m_lastDropLogTime;
+  bool m_dropLogged;
+  uint32_t m_suppressedDropLogs;
+  std::string m_dropLogSuffix;
+
   // Trace callbacks
   TracedCallback<Ptr<const Packet> > m_traceEnqueue;
   TracedCallback<Ptr<const Packet> > m_traceDequeue;
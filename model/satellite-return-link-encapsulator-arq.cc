@@ -27,7 +27,6 @@
 #include "satellite-return-link-encapsulator-arq.h"
 #include "satellite-llc.h"
 #include "satellite-mac-tag.h"
-#include "satellite-time-tag.h"
 #include "satellite-encap-pdu-status-tag.h"
 #include "satellite-queue.h"
 #include "satellite-arq-header.h"
@@ -83,6 +82,9 @@ SatReturnLinkEncapsulatorArq::SatReturnLinkEncapsulatorArq (Mac48Address source,
 
   m_seqNo = Create<SatArqSequenceNumber> (m_arqWindowSize);
 
+  // Contexts for the sequence numbers in use at the transmitter
+  m_txedBuffer.Reserve (m_arqWindowSize);
+
 }
 
 SatReturnLinkEncapsulatorArq::~SatReturnLinkEncapsulatorArq ()
@@ -144,35 +146,10 @@ SatReturnLinkEncapsulatorArq::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_seqNo = 0;
 
-  // Clean-up the Tx'ed buffer
-  std::map<uint8_t, Ptr<SatArqBufferContext> >::iterator it = m_txedBuffer.begin ();
-  while (it != m_txedBuffer.end ())
-    {
-      it->second->DoDispose ();
-      it->second = 0;
-      ++it;
-    }
-  m_txedBuffer.clear ();
-
-  // Clean-up the reTx buffer
-  it = m_retxBuffer.begin ();
-  while (it != m_retxBuffer.end ())
-    {
-      it->second->DoDispose ();
-      it->second = 0;
-      ++it;
-    }
-  m_retxBuffer.clear ();
-
-  // Clean-up the reordering buffer
-  std::map<uint32_t, Ptr<SatArqBufferContext> >::iterator it2 = m_reorderingBuffer.begin ();
-  while (it2 != m_reorderingBuffer.end ())
-    {
-      it2->second->DoDispose ();
-      it2->second = 0;
-      ++it2;
-    }
-  m_reorderingBuffer.clear ();
+  // Clean-up the Tx'ed, reTx and reordering buffers
+  m_txedBuffer.Clear ();
+  m_retxBuffer.Clear ();
+  m_reorderingBuffer.Clear ();
 
   SatReturnLinkEncapsulator::DoDispose ();
 }
@@ -192,16 +169,16 @@ SatReturnLinkEncapsulatorArq::NotifyTxOpportunity (uint32_t bytes, uint32_t &byt
    * timer is expired, packet is moved to the retransmission buffer from
    * the transmitted buffer.
    */
-  if (!m_retxBuffer.empty ())
+  if (!m_retxBuffer.IsEmpty ())
     {
       // Oldest seqNo sent first
-      Ptr<SatArqBufferContext> context = m_retxBuffer.begin ()->second;
+      Ptr<SatArqBufferContext> context = m_retxBuffer.GetFirst ();
 
       // If the packet fits into the transmission opportunity
       if (context->m_pdu->GetSize () <= bytes)
         {
           // Pop the front
-          m_retxBuffer.erase (m_retxBuffer.begin ());
+          m_retxBuffer.Erase (context->m_seqNo);
 
           // Increase the retransmission counter
           context->m_retransmissionCount = context->m_retransmissionCount + 1;
@@ -210,7 +187,7 @@ SatReturnLinkEncapsulatorArq::NotifyTxOpportunity (uint32_t bytes, uint32_t &byt
           m_txedBufferSize += context->m_pdu->GetSize ();
 
           // Store it back to the transmitted packet container.
-          m_txedBuffer.insert (std::make_pair (context->m_seqNo, context));
+          m_txedBuffer.Insert (context->m_seqNo, context);
 
           // Create the retransmission event and store it to the context. Event is cancelled if a ACK
           // is received. However, if the event triggers, we shall send the packet again, if the packet still
@@ -258,7 +235,7 @@ SatReturnLinkEncapsulatorArq::NotifyTxOpportunity (uint32_t bytes, uint32_t &byt
           packet->AddHeader (arqHeader);
 
           // Create ARQ context and store it to Tx'ed buffer
-          Ptr<SatArqBufferContext> arqContext = CreateObject<SatArqBufferContext> ();
+          Ptr<SatArqBufferContext> arqContext = m_txedBuffer.AllocateContext ();
           arqContext->m_retransmissionCount = 0;
           Ptr<Packet> copy = packet->Copy ();
           arqContext->m_pdu = copy;
@@ -271,7 +248,7 @@ SatReturnLinkEncapsulatorArq::NotifyTxOpportunity (uint32_t bytes, uint32_t &byt
 
           // Update the buffer status
           m_txedBufferSize += packet->GetSize ();
-          m_txedBuffer.insert (std::make_pair (seqNo, arqContext));
+          m_txedBuffer.Insert (seqNo, arqContext);
 
           if (packet->GetSize () > bytes)
             {
@@ -299,25 +276,28 @@ SatReturnLinkEncapsulatorArq::ArqReTxTimerExpired (uint8_t seqNo)
 
   NS_LOG_INFO ("At UT: " << m_sourceAddress << " ARQ retransmission timer expired for: " << (uint32_t)(seqNo) << " at: " << Now ().GetSeconds ());
 
-  std::map<uint8_t, Ptr<SatArqBufferContext> >::iterator it = m_txedBuffer.find (seqNo);
+  Ptr<SatArqBufferContext> context = m_txedBuffer.Find (seqNo);
 
-  if (it != m_txedBuffer.end ())
+  if (context)
     {
-      NS_ASSERT (seqNo == it->second->m_seqNo);
-      NS_ASSERT (it->second->m_pdu);
+      NS_ASSERT (seqNo == context->m_seqNo);
+      NS_ASSERT (context->m_pdu);
 
       // Retransmission still possible
-      if (it->second->m_retransmissionCount < m_maxNoOfRetransmissions)
+      if (context->m_retransmissionCount < m_maxNoOfRetransmissions)
         {
           NS_LOG_INFO ("Moving the ARQ context to retransmission buffer");
 
-          Ptr<SatArqBufferContext> context = it->second;
-
-          m_txedBuffer.erase (it);
+          m_txedBuffer.Erase (seqNo);
           m_retxBufferSize += context->m_pdu->GetSize ();
 
           // Push to the retransmission buffer
-          m_retxBuffer.insert (std::make_pair (seqNo, context));
+          m_retxBuffer.Insert (seqNo, context);
+
+          if (!m_txDataAvailableCallback.IsNull ())
+            {
+              m_txDataAvailableCallback ();
+            }
         }
       // Maximum retransmissions reached
       else
@@ -343,25 +323,21 @@ SatReturnLinkEncapsulatorArq::CleanUp (uint8_t sequenceNumber)
   m_seqNo->Release (sequenceNumber);
 
   // Clean-up the Tx'ed buffer
-  std::map<uint8_t, Ptr<SatArqBufferContext> >::iterator it = m_txedBuffer.find (sequenceNumber);
-  if (it != m_txedBuffer.end ())
+  Ptr<SatArqBufferContext> context = m_txedBuffer.Erase (sequenceNumber);
+  if (context)
     {
       NS_LOG_INFO ("Sequence no: " << (uint32_t) sequenceNumber << " clean up from txedBuffer!");
-      m_txedBufferSize -= it->second->m_pdu->GetSize ();
-      it->second->DoDispose ();
-      it->second = 0;
-      m_txedBuffer.erase (it);
+      m_txedBufferSize -= context->m_pdu->GetSize ();
+      m_txedBuffer.RecycleContext (context);
     }
 
   // Clean-up the reTx buffer
-  it = m_retxBuffer.find (sequenceNumber);
-  if (it != m_retxBuffer.end ())
+  context = m_retxBuffer.Erase (sequenceNumber);
+  if (context)
     {
       NS_LOG_INFO ("Sequence no: " << (uint32_t) sequenceNumber << " clean up from retxBuffer!");
-      m_retxBufferSize -= it->second->m_pdu->GetSize ();
-      it->second->DoDispose ();
-      it->second = 0;
-      m_retxBuffer.erase (it);
+      m_retxBufferSize -= context->m_pdu->GetSize ();
+      m_txedBuffer.RecycleContext (context);
     }
 }
 
@@ -426,26 +402,26 @@ SatReturnLinkEncapsulatorArq::ReceivePdu (Ptr<Packet> p)
   // nothing is needed to be done.
   if (sn >= m_nextExpectedSeqNo)
     {
-      std::map<uint32_t, Ptr<SatArqBufferContext > >::iterator it = m_reorderingBuffer.find (sn);
+      Ptr<SatArqBufferContext> context = m_reorderingBuffer.Find (sn);
 
       // If the context is not found, then we create a new one.
-      if (it == m_reorderingBuffer.end ())
+      if (!context)
         {
           NS_LOG_INFO ("UT: " << m_sourceAddress << " created a new ARQ buffer entry for SeqNo: " << sn << " at: " << Now ().GetSeconds ());
-          Ptr<SatArqBufferContext> arqContext = CreateObject<SatArqBufferContext> ();
+          Ptr<SatArqBufferContext> arqContext = m_reorderingBuffer.AllocateContext ();
           arqContext->m_pdu = p;
           arqContext->m_rxStatus = true;
           arqContext->m_seqNo = sn;
           arqContext->m_retransmissionCount = 0;
-          m_reorderingBuffer.insert (std::make_pair (sn, arqContext));
+          m_reorderingBuffer.Insert (sn, arqContext);
         }
       // If the context is found, update it.
       else
         {
           NS_LOG_INFO ("UT: " << m_sourceAddress << " reset an existing ARQ entry for SeqNo: " << sn << " at " << Now ().GetSeconds ());
-          it->second->m_waitingTimer.Cancel ();
-          it->second->m_pdu = p;
-          it->second->m_rxStatus = true;
+          context->m_waitingTimer.Cancel ();
+          context->m_pdu = p;
+          context->m_rxStatus = true;
         }
 
       NS_LOG_INFO ("Received a packet with SeqNo: " << sn << ", expecting: " << m_nextExpectedSeqNo);
@@ -456,21 +432,19 @@ SatReturnLinkEncapsulatorArq::ReceivePdu (Ptr<Packet> p)
           // Add context
           for (uint32_t i = m_nextExpectedSeqNo; i < sn; ++i)
             {
-              std::map<uint32_t, Ptr<SatArqBufferContext > >::iterator it2 = m_reorderingBuffer.find (i);
-
               NS_LOG_INFO ("Finding context for " << i);
 
               // If context not found
-              if (it2 == m_reorderingBuffer.end ())
+              if (!m_reorderingBuffer.Find (i))
                 {
                   NS_LOG_INFO ("Context NOT found for SeqNo: " << i);
 
-                  Ptr<SatArqBufferContext> arqContext = CreateObject<SatArqBufferContext> ();
+                  Ptr<SatArqBufferContext> arqContext = m_reorderingBuffer.AllocateContext ();
                   arqContext->m_pdu = NULL;
                   arqContext->m_rxStatus = false;
                   arqContext->m_seqNo = i;
                   arqContext->m_retransmissionCount = 0;
-                  m_reorderingBuffer.insert (std::make_pair (i, arqContext));
+                  m_reorderingBuffer.Insert (i, arqContext);
                   EventId id = Simulator::Schedule (m_rxWaitingTimer, &SatReturnLinkEncapsulatorArq::RxWaitingTimerExpired, this, i);
                   arqContext->m_waitingTimer = id;
                 }
@@ -529,39 +503,34 @@ SatReturnLinkEncapsulatorArq::ReassembleAndReceive ()
 {
   NS_LOG_FUNCTION (this);
 
-  // Start from the expected sequence number iterator
-  std::map<uint32_t, Ptr<SatArqBufferContext> >::iterator it = m_reorderingBuffer.begin ();
-
-  NS_LOG_INFO ("Process SeqNo: " << it->first << ", expected: " << m_nextExpectedSeqNo << ", status: " << it->second->m_rxStatus);
+  // Start from the expected sequence number
+  Ptr<SatArqBufferContext> context = m_reorderingBuffer.Find (m_nextExpectedSeqNo);
 
   /**
    * As long as the PDU is the next expected one, process the PDU
    * and erase it.
    */
-  while (it != m_reorderingBuffer.end () && it->first == m_nextExpectedSeqNo && it->second->m_rxStatus == true)
+  while (context && context->m_rxStatus == true)
     {
-      NS_LOG_INFO ("Process SeqNo: " << it->first << ", expected: " << m_nextExpectedSeqNo << ", status: " << it->second->m_rxStatus);
-
-      // If timer is running, cancel it.
-      if (it->second->m_waitingTimer.IsRunning ())
-        {
-          it->second->m_waitingTimer.Cancel ();
-        }
+      NS_LOG_INFO ("Process SeqNo: " << context->m_seqNo << ", expected: " << m_nextExpectedSeqNo << ", status: " << context->m_rxStatus);
 
       // If PDU == NULL, it means that the RxWaitingTimer has expired
       // without PDU being received
-      if (it->second->m_pdu)
+      if (context->m_pdu)
         {
           // Process the PDU
-          ProcessPdu (it->second->m_pdu);
+          ProcessPdu (context->m_pdu);
         }
 
-      m_reorderingBuffer.erase (it);
-      it = m_reorderingBuffer.begin ();
+      // Recycling the context cancels a possibly running timer
+      m_reorderingBuffer.Erase (m_nextExpectedSeqNo);
+      m_reorderingBuffer.RecycleContext (context);
 
       // Increase the seq no
       ++m_nextExpectedSeqNo;
 
+      context = m_reorderingBuffer.Find (m_nextExpectedSeqNo);
+
       NS_LOG_INFO ("Increasing SeqNo to " << m_nextExpectedSeqNo);
     }
 }
@@ -576,11 +545,11 @@ SatReturnLinkEncapsulatorArq::RxWaitingTimerExpired (uint32_t seqNo)
   NS_LOG_INFO ("Mark the PDU received and move forward!");
 
   // Find waiting timer, erase it and mark the packet received.
-  std::map<uint32_t, Ptr<SatArqBufferContext> >::iterator it = m_reorderingBuffer.find (seqNo);
-  if (it != m_reorderingBuffer.end ())
+  Ptr<SatArqBufferContext> context = m_reorderingBuffer.Find (seqNo);
+  if (context)
     {
-      it->second->m_waitingTimer.Cancel ();
-      it->second->m_rxStatus = true;
+      context->m_waitingTimer.Cancel ();
+      context->m_rxStatus = true;
     }
   else
     {
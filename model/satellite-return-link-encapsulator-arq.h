@@ -22,12 +22,12 @@
 #define SATELLITE_RETURN_LINK_ENCAPSULATOR_ARQ
 
 
-#include <map>
 #include "ns3/event-id.h"
 #include "ns3/mac48-address.h"
 #include "satellite-return-link-encapsulator.h"
 #include "satellite-arq-sequence-number.h"
 #include "satellite-arq-buffer-context.h"
+#include "satellite-arq-buffer-ring.h"
 #include "satellite-control-message.h"
 
 namespace ns3 {
@@ -155,10 +155,11 @@ private:
   Ptr<SatArqSequenceNumber> m_seqNo;
 
   /**
-   * Transmitted and retransmission context buffer
+   * Transmitted and retransmission context buffer, indexed by the 8-bit
+   * sequence number. Contexts are recycled through m_txedBuffer.
    */
-  std::map < uint8_t, Ptr<SatArqBufferContext> > m_txedBuffer;       // Transmitted packets buffer
-  std::map < uint8_t, Ptr<SatArqBufferContext> > m_retxBuffer;       // Retransmission buffer
+  SatArqBufferRing m_txedBuffer;       // Transmitted packets buffer
+  SatArqBufferRing m_retxBuffer;       // Retransmission buffer
   uint32_t m_retxBufferSize;
   uint32_t m_txedBufferSize;
 
@@ -200,10 +201,10 @@ private:
   Time m_rxWaitingTimer;
 
   /**
-   * key = sequence number
-   * value = RLE packet
+   * Reordering buffer of received RLE packets, indexed by the 32-bit
+   * sequence number
    */
-  std::map<uint32_t, Ptr<SatArqBufferContext> > m_reorderingBuffer;
+  SatArqBufferRing m_reorderingBuffer;
 };
 
 
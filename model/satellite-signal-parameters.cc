@@ -20,6 +20,7 @@
 
 #include "ns3/log.h"
 #include "ns3/ptr.h"
+#include <vector>
 
 #include "satellite-signal-parameters.h"
 #include "satellite-phy-tx.h"
@@ -28,11 +29,63 @@ NS_LOG_COMPONENT_DEFINE ("SatSignalParameters");
 
 namespace ns3 {
 
+/**
+ * Set when the pool of the thread has been destroyed at thread or program
+ * exit, after which the instances are allocated and released without
+ * pooling.
+ */
+static thread_local bool g_signalParametersPoolDestroyed = false;
+
+/**
+ * Pool of released SatSignalParameters memory blocks. Signal parameters
+ * are created for every transmission and copied for every receiver, so
+ * the blocks are reused instead of returned to the heap. Every thread has
+ * a pool of its own, so the input file loader threads never share one
+ * with the simulation. A block released in another thread than it was
+ * allocated in simply moves to the pool of the releasing thread.
+ */
+struct SatSignalParametersPool
+{
+  /**
+   * Maximum number of blocks kept in the pool
+   */
+  static const size_t MAX_POOLED_BLOCKS = 4096;
+
+  ~SatSignalParametersPool ()
+  {
+    for (std::vector<void*>::iterator it = m_blocks.begin (); it != m_blocks.end (); ++it)
+      {
+        ::operator delete (*it);
+      }
+
+    m_blocks.clear ();
+    g_signalParametersPoolDestroyed = true;
+  }
+
+  std::vector<void*> m_blocks;
+};
+
+static SatSignalParametersPool&
+GetSignalParametersPool ()
+{
+  static thread_local SatSignalParametersPool pool;
+  return pool;
+}
+
+SatSignalParameters::Burst::Burst (const PacketsInBurst_t& packets, const txInfo_s& txInfo, Time duration,
+                                   uint32_t beamId, uint32_t carrierId, uint32_t sourceTraceId)
+  : m_packetsInBurst (packets),
+    m_txInfo (txInfo),
+    m_duration (duration),
+    m_beamId (beamId),
+    m_carrierId (carrierId),
+    m_sourceTraceId (sourceTraceId)
+{
+}
+
 SatSignalParameters::SatSignalParameters ()
-  : m_beamId (),
-    m_carrierId (),
+  : m_burst (),
     m_carrierFreq_hz (),
-    m_duration (),
     m_txPower_W (),
     m_rxPower_W (),
     m_phyTx (),
@@ -50,27 +103,14 @@ SatSignalParameters::SatSignalParameters ()
 }
 
 SatSignalParameters::SatSignalParameters ( const SatSignalParameters& p )
+  : m_burst (p.m_burst)
 {
-  for ( PacketsInBurst_t::const_iterator i = p.m_packetsInBurst.begin (); i != p.m_packetsInBurst.end (); i++  )
-    {
-      m_packetsInBurst.push_back ((*i)->Copy ());
-    }
-
-  m_beamId = p.m_beamId;
-  m_carrierId = p.m_carrierId;
-  m_duration = p.m_duration;
   m_phyTx = p.m_phyTx;
   m_txPower_W = p.m_txPower_W;
   m_rxPower_W = p.m_rxPower_W;
   m_sinr = p.m_sinr;
   m_channelType = p.m_channelType;
   m_carrierFreq_hz = p.m_carrierFreq_hz;
-  m_txInfo.modCod = p.m_txInfo.modCod;
-  m_txInfo.fecBlockSizeInBytes = p.m_txInfo.fecBlockSizeInBytes;
-  m_txInfo.frameType = p.m_txInfo.frameType;
-  m_txInfo.waveformId = p.m_txInfo.waveformId;
-  m_txInfo.packetType = p.m_txInfo.packetType;
-  m_txInfo.crdsaUniquePacketId = p.m_txInfo.crdsaUniquePacketId;
   m_rxPowerInSatellite_W = p.m_rxPowerInSatellite_W;
   m_ifPower_W = p.m_ifPower_W;
   m_ifPowerInSatellite_W = p.m_ifPowerInSatellite_W;
@@ -89,6 +129,65 @@ SatSignalParameters::Copy ()
   return p;
 }
 
+void
+SatSignalParameters::DetachPacketsInBurst ()
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_burst != NULL);
+
+  PacketsInBurst_t packets;
+  packets.reserve (m_burst->m_packetsInBurst.size ());
+
+  for ( PacketsInBurst_t::const_iterator i = m_burst->m_packetsInBurst.begin (); i != m_burst->m_packetsInBurst.end (); i++  )
+    {
+      packets.push_back ((*i)->Copy ());
+    }
+
+  m_burst = Create<Burst> (packets, m_burst->m_txInfo, m_burst->m_duration,
+                           m_burst->m_beamId, m_burst->m_carrierId, m_burst->m_sourceTraceId);
+}
+
+void*
+SatSignalParameters::operator new (size_t size)
+{
+  SatSignalParametersPool &pool = GetSignalParametersPool ();
+
+  if ((size != sizeof (SatSignalParameters)) || g_signalParametersPoolDestroyed || pool.m_blocks.empty ())
+    {
+      return ::operator new (size);
+    }
+
+  void *block = pool.m_blocks.back ();
+  pool.m_blocks.pop_back ();
+  return block;
+}
+
+void
+SatSignalParameters::operator delete (void* p, size_t size)
+{
+  if (p == NULL)
+    {
+      return;
+    }
+
+  if ((size != sizeof (SatSignalParameters)) || g_signalParametersPoolDestroyed)
+    {
+      ::operator delete (p);
+      return;
+    }
+
+  SatSignalParametersPool &pool = GetSignalParametersPool ();
+
+  if (pool.m_blocks.size () < SatSignalParametersPool::MAX_POOLED_BLOCKS)
+    {
+      pool.m_blocks.push_back (p);
+    }
+  else
+    {
+      ::operator delete (p);
+    }
+}
+
 TypeId
 SatSignalParameters::GetTypeId (void)
 {
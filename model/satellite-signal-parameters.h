@@ -25,6 +25,7 @@
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
+#include "ns3/simple-ref-count.h"
 #include "satellite-enums.h"
 
 namespace ns3 {
@@ -37,6 +38,11 @@ class SatPhyTx;
 * through the SatChannel from the transmitter to the receiver. It includes e.g. the packet
 * container (BBFrame in FWD link, FPDU in RTN link) as well as all the transmission related
 * information (MODCODs, frequency, tx power, etc.).
+*
+* The transmitted burst is shared by all the receivers of a transmission
+* and by the retransmissions of the satellite, see Burst. Every receiver
+* gets a copy of the rest of the parameters, which holds the per receiver
+* values like the RX power, SINR and interference.
 */
 class SatSignalParameters : public Object
 {
@@ -60,51 +66,117 @@ public:
    */
   typedef std::vector< Ptr<Packet> > PacketsInBurst_t;
 
+  /**
+   * \brief Transmitted burst, created once per transmission and never
+   * modified afterwards. The packets must be treated as read-only; a
+   * receiver about to modify them (e.g. to remove tags or to pass them to
+   * the upper layers) shall call DetachPacketsInBurst first.
+   */
+  class Burst : public SimpleRefCount<Burst>
+  {
+  public:
+    /**
+     * Constructor
+     * \param packets the packets being transmitted
+     * \param txInfo transmission information
+     * \param duration duration of the transmission
+     * \param beamId beam of the transmission
+     * \param carrierId carrier of the transmission
+     * \param sourceTraceId trace ID of the originating node
+     */
+    Burst (const PacketsInBurst_t& packets, const txInfo_s& txInfo, Time duration,
+           uint32_t beamId, uint32_t carrierId, uint32_t sourceTraceId);
+
+    /**
+     * The packets being transmitted with this signal i.e.
+     * this is transmit buffer including packet pointers.
+     */
+    const PacketsInBurst_t m_packetsInBurst;
+
+    /**
+     * Transmission information including packet type, modcod and waveform ID
+     */
+    const txInfo_s m_txInfo;
+
+    /**
+     * The duration of the packet transmission.
+     */
+    const Time m_duration;
+
+    /**
+     * The beam for the packet transmission
+     */
+    const uint32_t m_beamId;
+
+    /**
+     * The carrier for the packet transmission
+     */
+    const uint32_t m_carrierId;
+
+    /**
+     * Dense trace ID of the terrestrial node (UT or GW) originating the
+     * transmission, zero if unknown. Enables source lookups without peeking
+     * the packet tags.
+     */
+    const uint32_t m_sourceTraceId;
+  };
+
   /**
    * default constructor
    */
   SatSignalParameters ();
 
   /**
-   * copy constructor
+   * copy constructor. The burst is shared with the copied parameters.
    */
   SatSignalParameters (const SatSignalParameters& p);
 
+  /**
+   * \brief Create a per-receiver copy of the signal parameters. The burst
+   * is shared between the copies.
+   *
+   * \return Copy of the signal parameters
+   */
   Ptr<SatSignalParameters> Copy ();
 
   /**
-   * \brief Get the type ID
-   * \return the object TypeId
+   * \brief Replace the shared burst with a private one holding copies of
+   * the packets. The bursts of the other receivers of the same
+   * transmission are not affected by the later modifications.
    */
-  static TypeId GetTypeId (void);
+  void DetachPacketsInBurst ();
 
   /**
-   * The packets being transmitted with this signal i.e.
-   * this is transmit buffer including packet pointers.
+   * \brief Allocate memory for signal parameters from the pool of
+   * released instances of the calling thread.
+   * \param size Size of the instance to allocate
+   * \return Pointer to the allocated memory
    */
-
-  PacketsInBurst_t m_packetsInBurst;
+  static void* operator new (size_t size);
 
   /**
-   * The beam for the packet transmission
+   * \brief Release memory of signal parameters to the pool of the calling
+   * thread.
+   * \param p Pointer to the released memory
+   * \param size Size of the released instance
    */
-  uint32_t m_beamId;
+  static void operator delete (void* p, size_t size);
 
   /**
-   * The carrier for the packet transmission
+   * \brief Get the type ID
+   * \return the object TypeId
    */
-  uint32_t m_carrierId;
+  static TypeId GetTypeId (void);
 
   /**
-   * The carrier center frequency for the packet transmission
+   * The transmitted burst shared by all the receivers
    */
-  double m_carrierFreq_hz;
+  Ptr<const Burst> m_burst;
 
   /**
-   * The duration of the packet transmission.
-   *
+   * The carrier center frequency for the packet transmission
    */
-  Time m_duration;
+  double m_carrierFreq_hz;
 
   /**
    * The TX power in Watts. Equivalent Isotropically Radiated Power (EIRP).
@@ -133,11 +205,6 @@ public:
    */
   SatEnums::ChannelType_t m_channelType;
 
-  /**
-   * Transmission information including packet type, modcod and waveform ID
-   */
-  txInfo_s m_txInfo;
-
   /**
    * The RX power in the satellite in Watts.
    *
@@ -0,0 +1,342 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "satellite-mac.h"
+#include "satellite-mac-tag.h"
+#include "satellite-utils.h"
+#include "satellite-const-variables.h"
+#include "satellite-signalling-channel.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatSignallingChannel");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatSignallingChannel);
+
+TypeId
+SatSignallingChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatSignallingChannel")
+    .SetParent<Object> ()
+    .AddConstructor<SatSignallingChannel> ()
+    .AddAttribute ("FwdLossProbability",
+                   "Probability of losing an abstracted signalling message at a UT, "
+                   "used until the C/N0 of the UT is known.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatSignallingChannel::m_fwdLossProbability),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("RtnLossProbability",
+                   "Probability of losing an abstracted signalling message of a UT at the GW, "
+                   "used until the C/N0 of the UT is known.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatSignallingChannel::m_rtnLossProbability),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddTraceSource ("Drop",
+                     "A signalling packet lost in the abstracted signalling path",
+                     MakeTraceSourceAccessor (&SatSignallingChannel::m_dropTrace),
+                     "ns3::SatTypedefs::PacketDestinationAddressCallback")
+  ;
+  return tid;
+}
+
+SatSignallingChannel::SatSignallingChannel ()
+  : m_terminals (),
+    m_fwdLossProbability (0.0),
+    m_rtnLossProbability (0.0),
+    m_fwdModcod (SatEnums::SAT_MODCOD_QPSK_1_TO_2),
+    m_fwdFrameType (SatEnums::NORMAL_FRAME),
+    m_fwdBandwidthHz (0.0),
+    m_rtnWaveformId (0),
+    m_rtnModcod (SatEnums::SAT_MODCOD_QPSK_1_TO_3),
+    m_rtnBandwidthHz (0.0)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_lossRandomVariable = CreateObject<UniformRandomVariable> ();
+}
+
+SatSignallingChannel::~SatSignallingChannel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatSignallingChannel::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_terminals.clear ();
+  m_geoMobility = 0;
+  m_feederDelay = 0;
+  m_userDelay = 0;
+  m_lossRandomVariable = 0;
+  m_fwdLinkResults = 0;
+  m_rtnLinkResults = 0;
+
+  Object::DoDispose ();
+}
+
+void
+SatSignallingChannel::SetLinks (Ptr<MobilityModel> geoMobility,
+                                Ptr<PropagationDelayModel> feederDelay,
+                                Ptr<PropagationDelayModel> userDelay)
+{
+  NS_LOG_FUNCTION (this << geoMobility << feederDelay << userDelay);
+
+  m_geoMobility = geoMobility;
+  m_feederDelay = feederDelay;
+  m_userDelay = userDelay;
+}
+
+void
+SatSignallingChannel::AddTerminal (Mac48Address address, Ptr<SatMac> mac, Ptr<MobilityModel> mobility,
+                                   uint32_t nodeId, bool isGw)
+{
+  NS_LOG_FUNCTION (this << address << mac << mobility << nodeId << isGw);
+
+  Terminal_t terminal;
+  terminal.m_address = address;
+  terminal.m_mac = mac;
+  terminal.m_mobility = mobility;
+  terminal.m_nodeId = nodeId;
+  terminal.m_isGw = isGw;
+  terminal.m_txEnd = Seconds (0);
+  terminal.m_fwdCno = NAN;
+  terminal.m_rtnCno = NAN;
+
+  std::pair<std::map<Mac48Address, Terminal_t>::iterator, bool> result = m_terminals.insert (std::make_pair (address, terminal));
+
+  if (result.second == false)
+    {
+      NS_FATAL_ERROR ("Terminal " << address << " already added to the signalling channel!");
+    }
+}
+
+void
+SatSignallingChannel::SetFwdLinkResults (Ptr<SatLinkResultsDvbS2> linkResults, SatEnums::SatModcod_t modcod,
+                                         SatEnums::SatBbFrameType_t frameType, double bandwidthHz)
+{
+  NS_LOG_FUNCTION (this << linkResults << modcod << frameType << bandwidthHz);
+
+  m_fwdLinkResults = linkResults;
+  m_fwdModcod = modcod;
+  m_fwdFrameType = frameType;
+  m_fwdBandwidthHz = bandwidthHz;
+}
+
+void
+SatSignallingChannel::SetRtnLinkResults (Ptr<SatLinkResultsDvbRcs2> linkResults, uint32_t waveformId,
+                                         SatEnums::SatModcod_t modcod, double bandwidthHz)
+{
+  NS_LOG_FUNCTION (this << linkResults << waveformId << modcod << bandwidthHz);
+
+  m_rtnLinkResults = linkResults;
+  m_rtnWaveformId = waveformId;
+  m_rtnModcod = modcod;
+  m_rtnBandwidthHz = bandwidthHz;
+}
+
+void
+SatSignallingChannel::NotifyCno (uint32_t beamId, Address source, Address destination, double cno)
+{
+  NS_LOG_FUNCTION (this << beamId << source << destination << cno);
+
+  std::map<Mac48Address, Terminal_t>::iterator rx = m_terminals.find (Mac48Address::ConvertFrom (destination));
+
+  if (rx == m_terminals.end ())
+    {
+      return;
+    }
+
+  if (rx->second.m_isGw)
+    {
+      // the GW measures the C/N0 of each UT separately
+      std::map<Mac48Address, Terminal_t>::iterator tx = m_terminals.find (Mac48Address::ConvertFrom (source));
+
+      if (tx != m_terminals.end ())
+        {
+          tx->second.m_rtnCno = cno;
+        }
+    }
+  else
+    {
+      rx->second.m_fwdCno = cno;
+    }
+}
+
+double
+SatSignallingChannel::GetLossProbability (Mac48Address source, Mac48Address dest) const
+{
+  NS_LOG_FUNCTION (this << source << dest);
+
+  std::map<Mac48Address, Terminal_t>::const_iterator tx = m_terminals.find (source);
+  std::map<Mac48Address, Terminal_t>::const_iterator rx = m_terminals.find (dest);
+
+  if (tx == m_terminals.end () || rx == m_terminals.end ())
+    {
+      NS_FATAL_ERROR ("Terminal " << source << " or " << dest << " not added to the signalling channel!");
+    }
+
+  return GetLossProbability (tx->second, rx->second);
+}
+
+double
+SatSignallingChannel::GetLossProbability (const Terminal_t &tx, const Terminal_t &rx) const
+{
+  if (tx.m_isGw)
+    {
+      if (m_fwdLinkResults == NULL || std::isnan (rx.m_fwdCno))
+        {
+          return m_fwdLossProbability;
+        }
+
+      // Forward link results are in Es/No, which equals C/N
+      double esNo = rx.m_fwdCno / m_fwdBandwidthHz;
+      return m_fwdLinkResults->GetBler (m_fwdModcod, m_fwdFrameType, SatUtils::LinearToDb (esNo));
+    }
+
+  if (rx.m_isGw)
+    {
+      if (m_rtnLinkResults == NULL || std::isnan (tx.m_rtnCno))
+        {
+          return m_rtnLossProbability;
+        }
+
+      // Return link results are in Eb/No, i.e. C/N per bit of a symbol
+      double ebNo = tx.m_rtnCno / m_rtnBandwidthHz
+        / (SatUtils::GetCodingRate (m_rtnModcod) * SatUtils::GetModulatedBits (m_rtnModcod));
+      return m_rtnLinkResults->GetBler (m_rtnWaveformId, SatUtils::LinearToDb (ebNo));
+    }
+
+  return m_rtnLossProbability;
+}
+
+Time
+SatSignallingChannel::GetAirTime (const Terminal_t &tx, uint32_t bytes) const
+{
+  SatEnums::SatModcod_t modcod = tx.m_isGw ? m_fwdModcod : m_rtnModcod;
+  double bandwidthHz = tx.m_isGw ? m_fwdBandwidthHz : m_rtnBandwidthHz;
+
+  if (bandwidthHz <= 0.0)
+    {
+      NS_FATAL_ERROR ("Link results of the signalling channel not set!");
+    }
+
+  // The effective bandwidth equals the symbol rate of the carrier
+  double bitRate = bandwidthHz * SatUtils::GetModulatedBits (modcod) * SatUtils::GetCodingRate (modcod);
+
+  return Seconds (bytes * SatConstVariables::BITS_PER_BYTE / bitRate);
+}
+
+bool
+SatSignallingChannel::IsAbstracted (SatControlMsgTag::SatControlMsgType_t msgType)
+{
+  switch (msgType)
+    {
+    case SatControlMsgTag::SAT_CR_CTRL_MSG:
+    case SatControlMsgTag::SAT_CN0_REPORT:
+    case SatControlMsgTag::SAT_RA_CTRL_MSG:
+    case SatControlMsgTag::SAT_TBTP_CTRL_MSG:
+      return true;
+    default:
+      return false;
+    }
+}
+
+void
+SatSignallingChannel::Send (Ptr<Packet> packet, Mac48Address source, Mac48Address dest)
+{
+  NS_LOG_FUNCTION (this << packet << source << dest);
+
+  std::map<Mac48Address, Terminal_t>::iterator tx = m_terminals.find (source);
+
+  if (tx == m_terminals.end ())
+    {
+      NS_FATAL_ERROR ("Sender " << source << " not added to the signalling channel!");
+    }
+
+  // The receiving MAC finds the sender and the receiver from the MAC tag
+  SatMacTag macTag;
+  macTag.SetSourceAddress (source);
+  macTag.SetDestAddress (dest);
+  packet->AddPacketTag (macTag);
+
+  // The capacity of the message is taken from the data path of the sender
+  tx->second.m_mac->ReserveSignallingCapacity (packet->GetSize ());
+
+  // The messages of a sender are transmitted one after another
+  Time txStart = std::max (Simulator::Now (), tx->second.m_txEnd);
+  Time txEnd = txStart + GetAirTime (tx->second, packet->GetSize ());
+  tx->second.m_txEnd = txEnd;
+
+  if (dest.IsBroadcast () || dest.IsGroup ())
+    {
+      for (std::map<Mac48Address, Terminal_t>::const_iterator rx = m_terminals.begin ();
+           rx != m_terminals.end (); ++rx)
+        {
+          if (rx != tx)
+            {
+              Deliver (tx->second, rx->second, packet, txEnd);
+            }
+        }
+    }
+  else
+    {
+      std::map<Mac48Address, Terminal_t>::const_iterator rx = m_terminals.find (dest);
+
+      if (rx == m_terminals.end ())
+        {
+          NS_FATAL_ERROR ("Receiver " << dest << " not added to the signalling channel!");
+        }
+
+      Deliver (tx->second, rx->second, packet, txEnd);
+    }
+}
+
+void
+SatSignallingChannel::Deliver (const Terminal_t &tx, const Terminal_t &rx, Ptr<Packet> packet, Time txEnd)
+{
+  NS_LOG_FUNCTION (this << packet << txEnd);
+
+  double lossProbability = GetLossProbability (tx, rx);
+
+  if (lossProbability > 0.0 && m_lossRandomVariable->GetValue (0.0, 1.0) < lossProbability)
+    {
+      NS_LOG_INFO ("Signalling packet from " << tx.m_address << " lost at " << rx.m_address);
+      m_dropTrace (packet, rx.m_address);
+      return;
+    }
+
+  // Propagation from the sender to the satellite and from the satellite to the receiver
+  Ptr<PropagationDelayModel> txDelay = tx.m_isGw ? m_feederDelay : m_userDelay;
+  Ptr<PropagationDelayModel> rxDelay = rx.m_isGw ? m_feederDelay : m_userDelay;
+
+  Time delay = txEnd - Simulator::Now ()
+    + txDelay->GetDelay (tx.m_mobility, m_geoMobility)
+    + rxDelay->GetDelay (m_geoMobility, rx.m_mobility);
+
+  Simulator::ScheduleWithContext (rx.m_nodeId, delay, &SatMac::ReceiveSignalingPacket, rx.m_mac, packet->Copy ());
+}
+
+} // namespace ns3
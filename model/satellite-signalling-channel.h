@@ -0,0 +1,237 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_SIGNALLING_CHANNEL_H
+#define SATELLITE_SIGNALLING_CHANNEL_H
+
+#include <map>
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/mac48-address.h"
+#include "ns3/traced-callback.h"
+#include "ns3/mobility-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/random-variable-stream.h"
+#include "satellite-enums.h"
+#include "satellite-control-message.h"
+#include "satellite-link-results.h"
+
+namespace ns3 {
+
+class SatMac;
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Abstracted signalling path of one beam. When the abstracted
+ * signalling is enabled with SatBeamHelper::AbstractSignalling attribute,
+ * capacity requests, C/N0 reports, random access control messages and TBTPs
+ * are not sent through the LLC, MAC scheduling and PHY of the sender and the
+ * channel. Instead, SatNetDevice hands them to this object, which delivers
+ * them directly to the MAC of the receiver(s).
+ *
+ * The delivery time of a message consists of the air time of the message with
+ * the MODCOD and the carrier bandwidth set for the link direction, the queueing
+ * behind the previous signalling messages of the same sender, and the
+ * propagation delay of the feeder and user links via the satellite. The
+ * capacity of the message is reserved from the BB frames of the GW or from
+ * the time slots of the UT with SatMac::ReserveSignallingCapacity.
+ *
+ * A message is lost independently for each receiver with the BLER given by
+ * the link results for the latest C/N0 of the link, see NotifyCno. The GW
+ * messages use the most robust MODCOD and the UT messages the most robust
+ * waveform. Until the C/N0 of a link is known, the configured loss
+ * probability of the link direction is used. ARQ ACKs still use the full
+ * data path, as they are processed by the LLC.
+ */
+class SatSignallingChannel : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Default constructor.
+   */
+  SatSignallingChannel ();
+
+  /**
+   * Destructor for SatSignallingChannel.
+   */
+  ~SatSignallingChannel ();
+
+  /**
+   * \brief Set the mobility of the satellite and the propagation delay models
+   * of the feeder and user links of the beam.
+   * \param geoMobility mobility model of the satellite
+   * \param feederDelay propagation delay model of the feeder link
+   * \param userDelay propagation delay model of the user link
+   */
+  void SetLinks (Ptr<MobilityModel> geoMobility,
+                 Ptr<PropagationDelayModel> feederDelay,
+                 Ptr<PropagationDelayModel> userDelay);
+
+  /**
+   * \brief Add a GW or UT of the beam.
+   * \param address MAC address of the terminal
+   * \param mac MAC receiving the signalling messages
+   * \param mobility mobility model of the terminal
+   * \param nodeId id of the node, used as the context of the reception
+   * \param isGw flag indicating whether the terminal is the GW of the beam
+   */
+  void AddTerminal (Mac48Address address, Ptr<SatMac> mac, Ptr<MobilityModel> mobility,
+                    uint32_t nodeId, bool isGw);
+
+  /**
+   * \brief Set the link results of the forward link messages.
+   * \param linkResults DVB-S2 link results
+   * \param modcod MODCOD of the messages
+   * \param frameType BB frame type of the messages
+   * \param bandwidthHz effective bandwidth of the forward link carrier
+   */
+  void SetFwdLinkResults (Ptr<SatLinkResultsDvbS2> linkResults, SatEnums::SatModcod_t modcod,
+                          SatEnums::SatBbFrameType_t frameType, double bandwidthHz);
+
+  /**
+   * \brief Set the link results of the return link messages.
+   * \param linkResults DVB-RCS2 link results
+   * \param waveformId id of the waveform of the messages
+   * \param modcod MODCOD of the waveform
+   * \param bandwidthHz effective bandwidth of the return link carrier
+   */
+  void SetRtnLinkResults (Ptr<SatLinkResultsDvbRcs2> linkResults, uint32_t waveformId,
+                          SatEnums::SatModcod_t modcod, double bandwidthHz);
+
+  /**
+   * \brief Update the C/N0 of a link, measured by the receiver of a packet.
+   * Signature matches SatPhy::CnoCallback, so the method can be connected to
+   * the `Cno` trace source of the PHYs.
+   * \param beamId id of the beam
+   * \param source address of the sender of the packet
+   * \param destination address of the receiver of the packet
+   * \param cno C/N0 value
+   */
+  void NotifyCno (uint32_t beamId, Address source, Address destination, double cno);
+
+  /**
+   * \brief Get the probability of losing a message between two terminals.
+   * \param source MAC address of the sender
+   * \param dest MAC address of the receiver
+   * \return loss probability
+   */
+  double GetLossProbability (Mac48Address source, Mac48Address dest) const;
+
+  /**
+   * \brief Check whether a control message type is delivered through the
+   * abstracted path.
+   * \param msgType type of the control message
+   * \return true, if the messages of the type are abstracted
+   */
+  static bool IsAbstracted (SatControlMsgTag::SatControlMsgType_t msgType);
+
+  /**
+   * \brief Send a signalling packet. The packet shall already carry the
+   * control message tag with the receive ID of the message.
+   * \param packet the packet
+   * \param source MAC address of the sender
+   * \param dest MAC address of the receiver, or broadcast address to send
+   *        the packet to all the other terminals of the beam
+   */
+  void Send (Ptr<Packet> packet, Mac48Address source, Mac48Address dest);
+
+private:
+  /**
+   * \brief Terminal of the beam.
+   */
+  typedef struct
+  {
+    Mac48Address m_address;
+    Ptr<SatMac> m_mac;
+    Ptr<MobilityModel> m_mobility;
+    uint32_t m_nodeId;
+    bool m_isGw;
+    Time m_txEnd;   ///< end of the ongoing signalling transmission of the terminal
+    double m_fwdCno;  ///< C/N0 measured by a UT from the GW, NaN if not known
+    double m_rtnCno;  ///< C/N0 measured by the GW from a UT, NaN if not known
+  } Terminal_t;
+
+  virtual void DoDispose ();
+
+  /**
+   * \brief Deliver a copy of the packet to a receiver, unless it is lost.
+   * \param tx the sender
+   * \param rx the receiver
+   * \param packet the packet
+   * \param txEnd end time of the transmission
+   */
+  void Deliver (const Terminal_t &tx, const Terminal_t &rx, Ptr<Packet> packet, Time txEnd);
+
+  /**
+   * \brief Get the probability of losing a message between two terminals.
+   * \param tx the sender
+   * \param rx the receiver
+   * \return loss probability
+   */
+  double GetLossProbability (const Terminal_t &tx, const Terminal_t &rx) const;
+
+  /**
+   * \brief Get the air time of a message with the MODCOD and the carrier
+   * bandwidth of the link direction of the sender.
+   * \param tx the sender
+   * \param bytes size of the message
+   * \return air time of the message
+   */
+  Time GetAirTime (const Terminal_t &tx, uint32_t bytes) const;
+
+  std::map<Mac48Address, Terminal_t> m_terminals;
+
+  Ptr<MobilityModel> m_geoMobility;
+  Ptr<PropagationDelayModel> m_feederDelay;
+  Ptr<PropagationDelayModel> m_userDelay;
+
+  double m_fwdLossProbability;    ///< `FwdLossProbability` attribute.
+  double m_rtnLossProbability;    ///< `RtnLossProbability` attribute.
+
+  Ptr<SatLinkResultsDvbS2> m_fwdLinkResults;
+  SatEnums::SatModcod_t m_fwdModcod;
+  SatEnums::SatBbFrameType_t m_fwdFrameType;
+  double m_fwdBandwidthHz;
+
+  Ptr<SatLinkResultsDvbRcs2> m_rtnLinkResults;
+  uint32_t m_rtnWaveformId;
+  SatEnums::SatModcod_t m_rtnModcod;
+  double m_rtnBandwidthHz;
+
+  Ptr<UniformRandomVariable> m_lossRandomVariable;
+
+  /**
+   * Traced callback for signalling packets lost in the abstracted path,
+   * including the address of the receiver.
+   */
+  TracedCallback<Ptr<const Packet>, const Address &> m_dropTrace;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_SIGNALLING_CHANNEL_H */
@@ -70,7 +70,9 @@ SatSuperframeAllocator::SatSuperframeAllocator (Ptr<SatSuperframeConf> superFram
     m_fcaEnabled (false),
     m_minCarrierPayloadInBytes (0),
     m_minimumRateBasedBytesLeft (0),
-    m_rcBasedAllocationEnabled (false)
+    m_rcBasedAllocationEnabled (false),
+    m_capacityInBytes (0),
+    m_backgroundShare (0.0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -105,6 +107,8 @@ SatSuperframeAllocator::SatSuperframeAllocator (Ptr<SatSuperframeConf> superFram
           m_minimumRateBasedBytesLeft += frameConf->GetCarrierCount () * minCarrierPayloadInBytes;
         }
     }
+
+  m_capacityInBytes = m_minimumRateBasedBytesLeft;
 }
 
 SatSuperframeAllocator::~SatSuperframeAllocator ()
@@ -154,7 +158,20 @@ SatSuperframeAllocator::PreAllocateSymbols (SatFrameAllocator::SatFrameAllocCont
 
   for (FrameAllocatorContainer_t::iterator it = m_frameAllocators.begin (); it != m_frameAllocators.end (); it++  )
     {
-      (*it)->PreAllocateSymbols (m_targetLoad, m_fcaEnabled);
+      (*it)->PreAllocateSymbols (m_targetLoad * (1.0 - m_backgroundShare), m_fcaEnabled);
+    }
+}
+
+void
+SatSuperframeAllocator::ReserveBackgroundCapacity (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  m_backgroundShare = 0.0;
+
+  if ( m_capacityInBytes > 0 )
+    {
+      m_backgroundShare = std::min (1.0, (double) bytes / (double) m_capacityInBytes);
     }
 }
 
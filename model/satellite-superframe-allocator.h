@@ -91,6 +91,25 @@ public:
    */
   void PreAllocateSymbols (SatFrameAllocator::SatFrameAllocContainer_t& allocReqs);
 
+  /**
+   * \brief Get the capacity of the super frame with the most robust carrier payloads.
+   *
+   * \return Capacity in bytes.
+   */
+  inline uint32_t GetCapacityInBytes () const
+  {
+    return m_capacityInBytes;
+  }
+
+  /**
+   * \brief Reserve capacity of the next super frame for the background load.
+   * The reserved share of the capacity is excluded from the target load of the
+   * frames in the following pre-allocations.
+   *
+   * \param bytes Bytes to reserve, capped to the capacity of the super frame
+   */
+  void ReserveBackgroundCapacity (uint32_t bytes);
+
   /**
    * \brief Generate time slots in TBTP(s) for the UT/RC.
    *
@@ -140,6 +159,12 @@ private:
   // the most robust
   uint32_t m_mostRobustSlotPayloadInBytes;
 
+  // capacity of the super frame in bytes with minimum carrier payloads
+  uint32_t m_capacityInBytes;
+
+  // share of the capacity reserved for the background load
+  double m_backgroundShare;
+
   /**
    *  Allocate given request according to type.
    *
@@ -142,9 +142,10 @@ SatTbtpContainer::HasScheduledTimeSlots ()
            ++it)
         {
           info = it->second->GetDaTimeslots (m_address);
+          SatTbtpMessage::DaSlotRangeInterval_t ranges = it->second->GetDaSlotRanges (m_address);
 
           // This TBTP has time slots for this UT
-          if (!info.second.empty ())
+          if (!info.second.empty () || ranges.first != ranges.second)
             {
               Time superframeStartTime = it->first;
 
@@ -160,25 +161,48 @@ SatTbtpContainer::HasScheduledTimeSlots ()
               // On-going superframe
               else
                 {
-                  /**
-                   * The time slots are not necessarily in increasing order in the TBTP.
-                   * Sort the time slots into increasing order based on time.
-                   */
-                  std::sort (info.second.begin (), info.second.end (), SortTimeSlots ());
-
-                  // Start time offset for the last time slot for this UT
-                  Time startTimeOffsetForLastSlot = (*(info.second.rbegin ()))->GetStartTime ();
-
-                  /**
-                   * Calculate the duration of the last slot. To be able to do that we need the
-                   * superframe conf, frame conf, time slot conf and symbol rate.
-                   */
                   Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
-                  uint8_t frameId = info.first;
-                  Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
-                  uint32_t wfId = (*(info.second.rbegin ()))->GetWaveFormId ();
-                  Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (wfId);
-                  Time lastSlotDuration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+                  Time startTimeOffsetForLastSlot;
+                  Time lastSlotDuration;
+
+                  if (!info.second.empty ())
+                    {
+                      /**
+                       * The time slots are not necessarily in increasing order in the TBTP.
+                       * Sort the time slots into increasing order based on time.
+                       */
+                      std::sort (info.second.begin (), info.second.end (), SortTimeSlots ());
+
+                      // Start time offset for the last time slot for this UT
+                      startTimeOffsetForLastSlot = (*(info.second.rbegin ()))->GetStartTime ();
+
+                      /**
+                       * Calculate the duration of the last slot. To be able to do that we need the
+                       * superframe conf, frame conf, time slot conf and symbol rate.
+                       */
+                      uint8_t frameId = info.first;
+                      Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
+                      uint32_t wfId = (*(info.second.rbegin ()))->GetWaveFormId ();
+                      Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (wfId);
+                      lastSlotDuration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+                    }
+                  else
+                    {
+                      // Slots of a range are in time order, but the ranges of
+                      // different carriers are not, so check the last slot of each range.
+                      for (SatTbtpMessage::DaSlotRangeContainer_t::const_iterator rit = ranges.first; rit != ranges.second; ++rit)
+                        {
+                          Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (rit->m_frameId);
+                          Time startTimeOffset = SatTbtpMessage::GetDaSlotStartTime (*rit, rit->m_count - 1, frameConf);
+
+                          if (startTimeOffset >= startTimeOffsetForLastSlot)
+                            {
+                              Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (rit->m_waveformId);
+                              startTimeOffsetForLastSlot = startTimeOffset;
+                              lastSlotDuration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+                            }
+                        }
+                    }
 
                   NS_LOG_INFO ("Superframe counter: " << it->second->GetSuperframeCounter () <<
                                ", start time: " << superframeStartTime.GetSeconds () <<
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+#include "satellite-trajectory-mobility-model.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatTrajectoryMobilityModel");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatTrajectoryMobilityModel);
+
+TypeId
+SatTrajectoryMobilityModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatTrajectoryMobilityModel")
+    .SetParent<SatMobilityModel> ()
+    .AddConstructor<SatTrajectoryMobilityModel> ()
+  ;
+  return tid;
+}
+
+SatTrajectoryMobilityModel::SatTrajectoryMobilityModel ()
+  : m_velocity (0.0, 0.0, 0.0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatTrajectoryMobilityModel::~SatTrajectoryMobilityModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatTrajectoryMobilityModel::SetTrajectoryPosition (const GeoCoordinate &position, const Vector &cartesian, const Vector &velocity)
+{
+  NS_LOG_FUNCTION (this << position << cartesian << velocity);
+
+  m_geoPosition = position;
+  m_velocity = velocity;
+
+  // Cartesian position is already known, so avoid the lazy conversion
+  DoSetCartesianPosition (cartesian);
+  NotifyGeoCourseChange ();
+}
+
+GeoCoordinate
+SatTrajectoryMobilityModel::DoGetGeoPosition (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_geoPosition;
+}
+
+void
+SatTrajectoryMobilityModel::DoSetGeoPosition (const GeoCoordinate &position)
+{
+  NS_LOG_FUNCTION (this << position);
+
+  m_geoPosition = position;
+  m_velocity = Vector (0.0, 0.0, 0.0);
+  NotifyGeoCourseChange ();
+}
+
+Vector
+SatTrajectoryMobilityModel::DoGetVelocity (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_velocity;
+}
+
+} // namespace ns3
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_TRAJECTORY_MOBILITY_MODEL_H
+#define SATELLITE_TRAJECTORY_MOBILITY_MODEL_H
+
+#include "satellite-mobility-model.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Satellite mobility model for terminals moving along a trajectory.
+ *
+ * The position of the model is not advanced by the model itself, but by
+ * SatTrajectoryMobilityUpdater, which updates all trajectory driven terminals
+ * in one batch. The updater gives the position both in geodetic and Cartesian
+ * format together with the velocity, so that no conversion is needed when
+ * the position is requested.
+ */
+class SatTrajectoryMobilityModel : public SatMobilityModel
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Create a position located at coordinates (0,0,0)
+   */
+  SatTrajectoryMobilityModel ();
+
+  /**
+   * Destructor for SatTrajectoryMobilityModel
+   */
+  virtual ~SatTrajectoryMobilityModel ();
+
+  /**
+   * \brief Set the position of the model given by the trajectory and notify
+   * the course change.
+   *
+   * \param position the position in geodetic format
+   * \param cartesian the same position in Cartesian format
+   * \param velocity the velocity in Cartesian format
+   */
+  void SetTrajectoryPosition (const GeoCoordinate &position, const Vector &cartesian, const Vector &velocity);
+
+private:
+  Vector DoGetVelocity (void) const;
+  virtual GeoCoordinate DoGetGeoPosition (void) const;
+  virtual void DoSetGeoPosition (const GeoCoordinate &position);
+
+  mutable GeoCoordinate m_geoPosition;
+  Vector m_velocity;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_TRAJECTORY_MOBILITY_MODEL_H */
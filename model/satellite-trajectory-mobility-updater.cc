@@ -0,0 +1,322 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <cmath>
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
+#include "satellite-utils.h"
+#include "satellite-trajectory-mobility-updater.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatTrajectoryMobilityUpdater");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatTrajectoryMobilityUpdater);
+
+TypeId
+SatTrajectoryMobilityUpdater::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatTrajectoryMobilityUpdater")
+    .SetParent<Object> ()
+    .AddAttribute ("UpdateInterval",
+                   "Interval between the batched position updates of the terminals.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&SatTrajectoryMobilityUpdater::m_updateInterval),
+                   MakeTimeChecker (MilliSeconds (1)))
+    .AddAttribute ("PositionTolerance",
+                   "Distance in meters a terminal shall move before its new position is notified.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatTrajectoryMobilityUpdater::m_positionTolerance),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("ElevationAngleTolerance",
+                   "Change of the elevation angle in degrees, which causes the new position of a terminal to be notified.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatTrajectoryMobilityUpdater::m_elevationAngleTolerance),
+                   MakeDoubleChecker<double> (0.0))
+  ;
+  return tid;
+}
+
+SatTrajectoryMobilityUpdater::SatTrajectoryMobilityUpdater ()
+{
+  NS_LOG_FUNCTION (this);
+
+  // this constructor version should not be used
+  NS_ASSERT (false);
+}
+
+SatTrajectoryMobilityUpdater::SatTrajectoryMobilityUpdater (Ptr<SatMobilityModel> geoSatMobility)
+  : m_geoSatMobility (geoSatMobility),
+    m_refEllipsoid (GeoCoordinate::SPHERE),
+    m_e2Param (0.0),
+    m_earthRadius (0.0),
+    m_updateInterval (Seconds (1.0)),
+    m_positionTolerance (0.0),
+    m_elevationAngleTolerance (0.0)
+{
+  NS_LOG_FUNCTION (this << geoSatMobility);
+
+  NS_ASSERT (m_geoSatMobility != NULL);
+
+  GeoCoordinate satellitePosition = m_geoSatMobility->GetGeoPosition ();
+
+  // satellite is expected to be in the sky
+  NS_ASSERT ( satellitePosition.GetAltitude () > 0.0 );
+
+  // terminals use the same reference ellipsoide as the satellite
+  m_refEllipsoid = satellitePosition.GetRefEllipsoid ();
+
+  double polarRadius = GeoCoordinate::polarRadius_sphere;
+
+  switch ( m_refEllipsoid )
+    {
+    case GeoCoordinate::SPHERE:
+      polarRadius = GeoCoordinate::polarRadius_sphere;
+      break;
+
+    case GeoCoordinate::WGS84:
+      polarRadius = GeoCoordinate::polarRadius_wgs84;
+      break;
+
+    case GeoCoordinate::GRS80:
+      polarRadius = GeoCoordinate::polarRadius_grs80;
+      break;
+
+    default:
+      NS_FATAL_ERROR ("Invalid Reference Ellipsoid!!!");
+      break;
+    }
+
+  const double equatorRadius = GeoCoordinate::equatorRadius;
+  m_e2Param = ( ( equatorRadius * equatorRadius ) - ( polarRadius * polarRadius ) ) / ( equatorRadius * equatorRadius );
+
+  // calculate radius of the earth using satellite information, like SatMobilityObserver does
+  m_earthRadius = CalculateDistance (satellitePosition.ToVector (), Vector (0, 0, 0)) - satellitePosition.GetAltitude ();
+}
+
+SatTrajectoryMobilityUpdater::~SatTrajectoryMobilityUpdater ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatTrajectoryMobilityUpdater::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_updateEvent.Cancel ();
+
+  m_geoSatMobility = NULL;
+  m_mobilities.clear ();
+  m_trajectories.clear ();
+
+  Object::DoDispose ();
+}
+
+void
+SatTrajectoryMobilityUpdater::Add (Ptr<SatTrajectoryMobilityModel> mobility, std::string trajectoryFileName)
+{
+  NS_LOG_FUNCTION (this << mobility << trajectoryFileName);
+
+  NS_ASSERT (mobility != NULL);
+
+  m_mobilities.push_back (mobility);
+  m_trajectories.push_back (CreateObject<SatInputFileStreamTimeDoubleContainer> (trajectoryFileName, std::ios::in, TRAJECTORY_NUMBER_OF_COLUMNS));
+
+  m_latitude.push_back (0.0);
+  m_longitude.push_back (0.0);
+  m_altitude.push_back (0.0);
+  m_x.push_back (0.0);
+  m_y.push_back (0.0);
+  m_z.push_back (0.0);
+  m_elevationAngle.push_back (NAN);
+  m_committedPosition.push_back (Vector (0.0, 0.0, 0.0));
+  m_committedElevationAngle.push_back (NAN);
+
+  const uint32_t index = m_mobilities.size () - 1;
+
+  ComputePositions (index, index + 1);
+
+  m_previousPosition.push_back (Vector (m_x[index], m_y[index], m_z[index]));
+
+  CommitPosition (index, true);
+
+  if (!m_updateEvent.IsRunning ())
+    {
+      m_updateEvent = Simulator::Schedule (m_updateInterval, &SatTrajectoryMobilityUpdater::Update, this);
+    }
+}
+
+uint32_t
+SatTrajectoryMobilityUpdater::GetN () const
+{
+  return m_mobilities.size ();
+}
+
+void
+SatTrajectoryMobilityUpdater::Update ()
+{
+  NS_LOG_FUNCTION (this);
+
+  const uint32_t count = m_mobilities.size ();
+
+  ComputePositions (0, count);
+
+  uint32_t committed = 0;
+
+  for (uint32_t i = 0; i < count; i++)
+    {
+      if (CommitPosition (i, false))
+        {
+          committed++;
+        }
+
+      m_previousPosition[i] = Vector (m_x[i], m_y[i], m_z[i]);
+    }
+
+  NS_LOG_INFO ("Updated " << count << " terminals, " << committed << " positions notified");
+
+  m_updateEvent = Simulator::Schedule (m_updateInterval, &SatTrajectoryMobilityUpdater::Update, this);
+}
+
+void
+SatTrajectoryMobilityUpdater::ComputePositions (uint32_t first, uint32_t last)
+{
+  NS_LOG_FUNCTION (this << first << last);
+
+  // read the positions of the current time from the trajectories
+  for (uint32_t i = first; i < last; i++)
+    {
+      std::vector<double> row = m_trajectories[i]->ProceedToNextClosestTimeSample ();
+
+      // column 0 is the time of the sample
+      m_latitude[i] = row[1];
+      m_longitude[i] = row[2];
+      m_altitude[i] = row[3];
+    }
+
+  GeoCoordinate satellitePosition = m_geoSatMobility->GetGeoPosition ();
+  Vector satelliteVector = m_geoSatMobility->GetPosition ();
+
+  const double satLatitude = SatUtils::DegreesToRadians (satellitePosition.GetLatitude ());
+  const double satLongitude = SatUtils::DegreesToRadians (satellitePosition.GetLongitude ());
+  const double satLatitudeCos = std::cos (satLatitude);
+  const double satLatitudeSin = std::sin (satLatitude);
+
+  const double satelliteRadius = satellitePosition.GetAltitude () + m_earthRadius;
+  const double maxDistanceToSatellite = std::sqrt ( (satelliteRadius * satelliteRadius) - (m_earthRadius * m_earthRadius) );
+  const double radiusRatio = m_earthRadius / satelliteRadius;
+  const double radiusRatioTerm = 1 + ( radiusRatio * radiusRatio );
+
+  const double equatorRadius = GeoCoordinate::equatorRadius;
+  const double e2Param = m_e2Param;
+
+  // convert all positions to Cartesian format and calculate the elevation angles
+  // in one pass over the arrays
+  for (uint32_t i = first; i < last; i++)
+    {
+      const double latRads = SatUtils::DegreesToRadians (m_latitude[i]);
+      const double lonRads = SatUtils::DegreesToRadians (m_longitude[i]);
+      const double latCos = std::cos (latRads);
+      const double latSin = std::sin (latRads);
+      const double lonCos = std::cos (lonRads);
+      const double lonSin = std::sin (lonRads);
+
+      // radius of the curvature in the prime vertical
+      const double radiusCurvature = equatorRadius / std::sqrt (1 - e2Param * latSin * latSin);
+
+      m_x[i] = ( radiusCurvature + m_altitude[i] ) * latCos * lonCos;
+      m_y[i] = ( radiusCurvature + m_altitude[i] ) * latCos * lonSin;
+      m_z[i] = ( radiusCurvature * (1 - e2Param) + m_altitude[i] ) * latSin;
+
+      // elevation angle is always calculated at earth surface, so altitude is zero
+      const double dx = radiusCurvature * latCos * lonCos - satelliteVector.x;
+      const double dy = radiusCurvature * latCos * lonSin - satelliteVector.y;
+      const double dz = radiusCurvature * (1 - e2Param) * latSin - satelliteVector.z;
+      const double distanceToSatellite = std::sqrt ( dx * dx + dy * dy + dz * dz );
+
+      double elevationAngle = NAN;
+
+      // calculate elevation angle only, if satellite can be seen from own position
+      if ( distanceToSatellite <= maxDistanceToSatellite )
+        {
+          const double centralAngleCos = ( latCos * satLatitudeCos * std::cos (satLongitude - lonRads) ) +
+            ( latSin * satLatitudeSin );
+
+          const double elCos = std::sin ( std::acos (centralAngleCos)) / std::sqrt ( radiusRatioTerm - 2 * radiusRatio * centralAngleCos);
+
+          elevationAngle = SatUtils::RadiansToDegrees (std::acos (elCos) );
+        }
+
+      m_elevationAngle[i] = elevationAngle;
+    }
+}
+
+bool
+SatTrajectoryMobilityUpdater::CommitPosition (uint32_t index, bool force)
+{
+  NS_LOG_FUNCTION (this << index << force);
+
+  Vector position (m_x[index], m_y[index], m_z[index]);
+
+  if (!force)
+    {
+      const double elevationAngle = m_elevationAngle[index];
+      const double committedElevationAngle = m_committedElevationAngle[index];
+
+      bool elevationChanged;
+
+      if (std::isnan (elevationAngle) || std::isnan (committedElevationAngle))
+        {
+          elevationChanged = ( std::isnan (elevationAngle) != std::isnan (committedElevationAngle) );
+        }
+      else
+        {
+          elevationChanged = ( std::fabs (elevationAngle - committedElevationAngle) > m_elevationAngleTolerance );
+        }
+
+      const double distance = CalculateDistance (position, m_committedPosition[index]);
+
+      if ( !elevationChanged && ( distance <= m_positionTolerance ) )
+        {
+          return false;
+        }
+    }
+
+  Vector velocity (0.0, 0.0, 0.0);
+  const double interval = m_updateInterval.GetSeconds ();
+
+  if (!force)
+    {
+      velocity.x = ( position.x - m_previousPosition[index].x ) / interval;
+      velocity.y = ( position.y - m_previousPosition[index].y ) / interval;
+      velocity.z = ( position.z - m_previousPosition[index].z ) / interval;
+    }
+
+  GeoCoordinate geoPosition (m_latitude[index], m_longitude[index], m_altitude[index], m_refEllipsoid);
+  m_mobilities[index]->SetTrajectoryPosition (geoPosition, position, velocity);
+
+  m_committedPosition[index] = position;
+  m_committedElevationAngle[index] = m_elevationAngle[index];
+
+  return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_TRAJECTORY_MOBILITY_UPDATER_H
+#define SATELLITE_TRAJECTORY_MOBILITY_UPDATER_H
+
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "satellite-mobility-model.h"
+#include "satellite-trajectory-mobility-model.h"
+#include "../utils/satellite-input-fstream-time-double-container.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Advances the positions of all trajectory driven terminals
+ * (SatTrajectoryMobilityModel) in one batched update per tick.
+ *
+ * Each terminal has a trajectory file with row format
+ * [time, latitude, longitude, altitude]. On every tick the positions of all
+ * terminals are read from the trajectories, and the geodetic to Cartesian
+ * conversion and the elevation angle towards the satellite are computed for
+ * all terminals in one loop over plain arrays. A new position is given to the
+ * mobility model of a terminal, and thus to its course change listeners like
+ * SatMobilityObserver, only when the terminal has moved more than
+ * `PositionTolerance` or its elevation angle has changed more than
+ * `ElevationAngleTolerance` since the last notified position.
+ *
+ * The elevation angle is computed in the same way as in SatMobilityObserver.
+ */
+class SatTrajectoryMobilityUpdater : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Default constructor, which is not used.
+   */
+  SatTrajectoryMobilityUpdater ();
+
+  /**
+   * Constructor.
+   *
+   * \param geoSatMobility the mobility of the satellite
+   */
+  SatTrajectoryMobilityUpdater (Ptr<SatMobilityModel> geoSatMobility);
+
+  /**
+   * Destructor for SatTrajectoryMobilityUpdater
+   */
+  virtual ~SatTrajectoryMobilityUpdater ();
+
+  /**
+   * \brief Add a terminal to be updated. The position of the current
+   * simulation time is set to the mobility immediately and the periodic
+   * updates are started, when the first terminal is added.
+   *
+   * \param mobility the mobility of the terminal
+   * \param trajectoryFileName the trajectory file of the terminal
+   */
+  void Add (Ptr<SatTrajectoryMobilityModel> mobility, std::string trajectoryFileName);
+
+  /**
+   * \return number of terminals updated
+   */
+  uint32_t GetN () const;
+
+protected:
+  /**
+   * Dispose of this class instance
+   */
+  virtual void DoDispose ();
+
+private:
+  /**
+   * Number of columns in the trajectory file, including time
+   */
+  static const uint32_t TRAJECTORY_NUMBER_OF_COLUMNS = 4;
+
+  /**
+   * \brief Update the positions of all terminals and schedule the next update.
+   */
+  void Update ();
+
+  /**
+   * \brief Read the positions of the current simulation time from the
+   * trajectories and compute the Cartesian positions and elevation angles
+   * of the given range of terminals.
+   *
+   * \param first index of the first terminal
+   * \param last index after the last terminal
+   */
+  void ComputePositions (uint32_t first, uint32_t last);
+
+  /**
+   * \brief Set the computed position of a terminal to its mobility, if the
+   * change since the last set position exceeds the tolerances.
+   *
+   * \param index index of the terminal
+   * \param force set the position regardless of the tolerances
+   * \return true if the position was set
+   */
+  bool CommitPosition (uint32_t index, bool force);
+
+  Ptr<SatMobilityModel> m_geoSatMobility;
+  GeoCoordinate::ReferenceEllipsoid_t m_refEllipsoid;
+  double m_e2Param;
+  double m_earthRadius;
+
+  Time m_updateInterval;
+  double m_positionTolerance;
+  double m_elevationAngleTolerance;
+  EventId m_updateEvent;
+
+  std::vector<Ptr<SatTrajectoryMobilityModel> > m_mobilities;
+  std::vector<Ptr<SatInputFileStreamTimeDoubleContainer> > m_trajectories;
+
+  // positions and elevation angles computed on the latest update
+  std::vector<double> m_latitude;
+  std::vector<double> m_longitude;
+  std::vector<double> m_altitude;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<double> m_elevationAngle;
+
+  // positions computed on the previous update, used for velocity
+  std::vector<Vector> m_previousPosition;
+
+  // positions and elevation angles last set to the mobilities
+  std::vector<Vector> m_committedPosition;
+  std::vector<double> m_committedElevationAngle;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_TRAJECTORY_MOBILITY_UPDATER_H */
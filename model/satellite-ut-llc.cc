@@ -260,6 +260,11 @@ SatUtLlc::CreateEncap (Ptr<EncapKey> key)
 
   utEncap->SetQueue (queue);
 
+  if (m_queueSizeTrackingEnabled)
+    {
+      utEncap->SetQueueSizeChangeCallback (MakeCallback (&SatUtLlc::NotifyQueueSizeChange, this));
+    }
+
   NS_LOG_INFO ("Create encapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
 
   // Store the encapsulator
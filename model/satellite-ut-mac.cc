@@ -18,12 +18,14 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
+#include <algorithm>
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/simulator.h>
 #include <ns3/mac48-address.h>
 #include <ns3/boolean.h>
 #include <ns3/pointer.h>
+#include <ns3/uinteger.h>
 #include <ns3/packet.h>
 #include <ns3/singleton.h>
 
@@ -67,10 +69,21 @@ SatUtMac::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&SatUtMac::m_utScheduler),
                    MakePointerChecker<SatUtScheduler> ())
+    .AddAttribute ("MaxReservedSignallingBytes",
+                   "Maximum number of bytes of the abstracted signalling messages waiting "
+                   "for dedicated access time slots. The bytes above are not reserved, as "
+                   "the messages would not fit the control queue of the LLC.",
+                   UintegerValue (10000),
+                   MakeUintegerAccessor (&SatUtMac::m_maxReservedSignallingBytes),
+                   MakeUintegerChecker<uint32_t> ())
     .AddTraceSource ("DaResourcesTrace",
                      "Assigned dedicated access resources in return link to this UT.",
                      MakeTraceSourceAccessor (&SatUtMac::m_tbtpResourcesTrace),
                      "ns3::SatUtMac::TbtpResourcesTraceCallback")
+    .AddTraceSource ("DaTxOpportunity",
+                     "A dedicated access time slot of this UT starts.",
+                     MakeTraceSourceAccessor (&SatUtMac::m_daTxOpportunityTrace),
+                     "ns3::SatUtMac::DaTxOpportunityTraceCallback")
   ;
   return tid;
 }
@@ -91,7 +104,9 @@ SatUtMac::SatUtMac ()
     m_guardTime (MicroSeconds (1)),
     m_raChannel (0),
     m_crdsaUniquePacketId (1),
-    m_crdsaOnlyForControl (false)
+    m_crdsaOnlyForControl (false),
+    m_reservedSignallingBytes (0),
+    m_maxReservedSignallingBytes (10000)
 {
   NS_LOG_FUNCTION (this);
 
@@ -106,7 +121,9 @@ SatUtMac::SatUtMac (Ptr<SatSuperframeSeq> seq, uint32_t beamId, bool crdsaOnlyFo
     m_guardTime (MicroSeconds (1)),
     m_raChannel (0),
     m_crdsaUniquePacketId (1),
-    m_crdsaOnlyForControl (crdsaOnlyForControl)
+    m_crdsaOnlyForControl (crdsaOnlyForControl),
+    m_reservedSignallingBytes (0),
+    m_maxReservedSignallingBytes (10000)
 {
   NS_LOG_FUNCTION (this);
 
@@ -291,13 +308,44 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
           uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf->GetCarrierId () );
 
           // Schedule individual time slot
-          ScheduleDaTxOpportunity (slotDelay, duration, wf, timeSlotConf, carrierId);
+          ScheduleDaTxOpportunity (slotDelay, duration, wf, timeSlotConf->GetSlotType (), timeSlotConf->GetRcIndex (), carrierId);
 
           payloadSumInSuperFrame += wf->GetPayloadInBytes ();
           payloadSumPerRcIndex [timeSlotConf->GetRcIndex ()] += wf->GetPayloadInBytes ();
         }
     }
 
+  // DA time slots of compact TBTP are described by slot ranges
+  SatTbtpMessage::DaSlotRangeInterval_t ranges = tbtp->GetDaSlotRanges (m_nodeInfo->GetMacAddress ());
+
+  for ( SatTbtpMessage::DaSlotRangeContainer_t::const_iterator it = ranges.first; it != ranges.second; it++ )
+    {
+      NS_LOG_INFO ("TBTP contains range of " << it->m_count << " timeslots for UT: " << m_nodeInfo->GetMacAddress ());
+
+      Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
+      Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (it->m_frameId);
+
+      // Duration
+      Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (it->m_waveformId);
+      Time duration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+
+      // Carrier
+      uint32_t carrierId = m_superframeSeq->GetCarrierId (0, it->m_frameId, it->m_carrierId);
+
+      for (uint16_t i = 0; i < it->m_count; i++)
+        {
+          // Start time
+          Time slotDelay = startDelay + SatTbtpMessage::GetDaSlotStartTime (*it, i, frameConf);
+          NS_LOG_INFO ("Slot start delay: " << slotDelay.GetSeconds ());
+
+          // Schedule individual time slot
+          ScheduleDaTxOpportunity (slotDelay, duration, wf, it->m_slotType, it->m_rcIndex, carrierId);
+        }
+
+      payloadSumInSuperFrame += it->m_count * wf->GetPayloadInBytes ();
+      payloadSumPerRcIndex [it->m_rcIndex] += it->m_count * wf->GetPayloadInBytes ();
+    }
+
   // Assigned TBTP resources
   m_tbtpResourcesTrace (payloadSumInSuperFrame);
 
@@ -309,20 +357,24 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
 }
 
 void
-SatUtMac::ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId)
+SatUtMac::ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf,
+                                   SatTimeSlotConf::SatTimeSlotType_t slotType, uint8_t rcIndex, uint32_t carrierId)
 {
-  NS_LOG_FUNCTION (this << transmitDelay.GetSeconds () << duration.GetSeconds () << wf->GetPayloadInBytes () << (uint32_t)(tsConf->GetRcIndex ()) << carrierId);
-  NS_LOG_INFO ("SatUtMac::ScheduleDaTxOpportunity - after delay: " << transmitDelay.GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", rcIndex: " << (uint32_t)(tsConf->GetRcIndex ()) << ", carrier: " << carrierId);
+  NS_LOG_FUNCTION (this << transmitDelay.GetSeconds () << duration.GetSeconds () << wf->GetPayloadInBytes () << (uint32_t)(rcIndex) << carrierId);
+  NS_LOG_INFO ("SatUtMac::ScheduleDaTxOpportunity - after delay: " << transmitDelay.GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", rcIndex: " << (uint32_t)(rcIndex) << ", carrier: " << carrierId);
 
-  Simulator::Schedule (transmitDelay, &SatUtMac::DoTransmit, this, duration, carrierId, wf, tsConf, SatUtScheduler::LOOSE);
+  Simulator::Schedule (transmitDelay, &SatUtMac::DoTransmit, this, duration, carrierId, wf, slotType, rcIndex, SatUtScheduler::LOOSE);
 }
 
 
 void
-SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, SatUtScheduler::SatCompliancePolicy_t policy)
+SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, SatTimeSlotConf::SatTimeSlotType_t slotType,
+                      uint8_t rcIndex, SatUtScheduler::SatCompliancePolicy_t policy)
 {
-  NS_LOG_FUNCTION (this << duration.GetSeconds () << wf->GetPayloadInBytes () << carrierId << (uint32_t)(tsConf->GetRcIndex ()));
-  NS_LOG_INFO ("DA Tx opportunity for UT: " << m_nodeInfo->GetMacAddress () << " at time: " << Simulator::Now ().GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", carrier: " << carrierId << ", RC index: " << (uint32_t)(tsConf->GetRcIndex ()));
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << wf->GetPayloadInBytes () << carrierId << (uint32_t)(rcIndex));
+  NS_LOG_INFO ("DA Tx opportunity for UT: " << m_nodeInfo->GetMacAddress () << " at time: " << Simulator::Now ().GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", carrier: " << carrierId << ", RC index: " << (uint32_t)(rcIndex));
+
+  m_daTxOpportunityTrace (carrierId, rcIndex);
 
   SatSignalParameters::txInfo_s txInfo;
   txInfo.packetType = SatEnums::PACKET_TYPE_DEDICATED_ACCESS;
@@ -331,7 +383,7 @@ SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Pt
   txInfo.frameType = SatEnums::UNDEFINED_FRAME;
   txInfo.waveformId = wf->GetWaveformId ();
 
-  TransmitPackets (FetchPackets (wf->GetPayloadInBytes (), tsConf->GetSlotType (), tsConf->GetRcIndex (), policy), duration, carrierId, txInfo);
+  TransmitPackets (FetchPackets (wf->GetPayloadInBytes (), slotType, rcIndex, policy), duration, carrierId, txInfo);
 }
 
 void
@@ -401,7 +453,17 @@ SatUtMac::FetchPackets (uint32_t payloadBytes, SatTimeSlotConf::SatTimeSlotType_
       NS_FATAL_ERROR ("SatUtMac::FetchPackets - unvalid slot payload: " << payloadBytes);
     }
 
-  m_utScheduler->DoScheduling (packets, payloadBytes, type, rcIndex, policy);
+  // The abstracted signalling messages sent since the previous time slots
+  // take their share of the slot, as they would in the data path. What does
+  // not fit is carried to the next slots, up to the reservation limit.
+  uint32_t reservedBytes = std::min (m_reservedSignallingBytes, payloadBytes);
+  m_reservedSignallingBytes = std::min (m_reservedSignallingBytes - reservedBytes, m_maxReservedSignallingBytes);
+  payloadBytes -= reservedBytes;
+
+  if (payloadBytes > 0)
+    {
+      m_utScheduler->DoScheduling (packets, payloadBytes, type, rcIndex, policy);
+    }
 
   // A valid packet received
   if ( !packets.empty () )
@@ -539,6 +601,14 @@ SatUtMac::Receive (SatPhy::PacketContainer_t packets, Ptr<SatSignalParameters> /
     }
 }
 
+void
+SatUtMac::ReserveSignallingCapacity (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+
+  m_reservedSignallingBytes = std::min (m_reservedSignallingBytes + bytes, m_maxReservedSignallingBytes);
+}
+
 void
 SatUtMac::ReceiveSignalingPacket (Ptr<Packet> packet)
 {
@@ -193,6 +193,20 @@ public:
    */
   typedef void (* TbtpResourcesTraceCallback)(uint32_t size);
 
+  /**
+   * \brief Callback signature for `DaTxOpportunity` trace source.
+   * \param carrierId id of the carrier of the time slot
+   * \param rcIndex RC index of the time slot
+   */
+  typedef void (* DaTxOpportunityTraceCallback)(uint32_t carrierId, uint8_t rcIndex);
+
+  /**
+   * \brief Reserve space for an abstracted signalling message from the next
+   * dedicated access time slots of the UT.
+   * \param bytes size of the message
+   */
+  virtual void ReserveSignallingCapacity (uint32_t bytes);
+
 protected:
 
   /**
@@ -309,10 +323,12 @@ private:
    * \param transmitDelay time when transmit possibility starts
    * \param duration duration of the burst
    * \param wf waveform
-   * \param tsConf Time slot conf
+   * \param slotType Type of the time slot
+   * \param rcIndex RC index of the time slot
    * \param carrierId Carrier id used for the transmission
    */
-  void ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId);
+  void ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf,
+                                SatTimeSlotConf::SatTimeSlotType_t slotType, uint8_t rcIndex, uint32_t carrierId);
 
   /**
    * Notify the upper layer about the Tx opportunity. If upper layer
@@ -321,10 +337,12 @@ private:
    * \param duration duration of the burst
    * \param carrierId Carrier id used for the transmission
    * \param wf waveform
-   * \param tsConf Time slot conf
+   * \param slotType Type of the time slot
+   * \param rcIndex RC index of the time slot
    * \param policy UT scheduler policy
    */
-  void DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, SatUtScheduler::SatCompliancePolicy_t policy = SatUtScheduler::LOOSE);
+  void DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, SatTimeSlotConf::SatTimeSlotType_t slotType,
+                   uint8_t rcIndex, SatUtScheduler::SatCompliancePolicy_t policy = SatUtScheduler::LOOSE);
 
   /**
    * Notify the upper layer about the Slotted ALOHA Tx opportunity. If upper layer
@@ -361,7 +379,7 @@ private:
    * receptions.
    * \param packet Received signaling packet
    */
-  void ReceiveSignalingPacket (Ptr<Packet> packet);
+  virtual void ReceiveSignalingPacket (Ptr<Packet> packet);
 
   /**
    * \brief Function which is executed at every frame start.
@@ -427,6 +445,11 @@ private:
    */
   TracedCallback<uint32_t> m_tbtpResourcesTrace;
 
+  /**
+   * Dedicated access time slots at their start time.
+   */
+  TracedCallback<uint32_t, uint8_t> m_daTxOpportunityTrace;
+
   /**
    * CRDSA packet ID (per frame)
    */
@@ -438,6 +461,17 @@ private:
    * - false -> for control and user data
    */
   bool m_crdsaOnlyForControl;
+
+  /**
+   * Bytes of the abstracted signalling messages not yet taken from the
+   * dedicated access time slots.
+   */
+  uint32_t m_reservedSignallingBytes;
+
+  /**
+   * Maximum number of bytes in m_reservedSignallingBytes. Set as an attribute.
+   */
+  uint32_t m_maxReservedSignallingBytes;
 };
 
 } // namespace ns3
@@ -0,0 +1,324 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "satellite-binary-file-aggregator.h"
+#include <ns3/log.h>
+#include <ns3/string.h>
+#include <ns3/boolean.h>
+#include <ns3/uinteger.h>
+
+NS_LOG_COMPONENT_DEFINE ("SatBinaryFileAggregator");
+
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBinaryFileAggregator);
+
+const uint32_t SatBinaryFileAggregator::MAGIC_NUMBER = 0x53415453; // "SATS"
+const uint32_t SatBinaryFileAggregator::FORMAT_VERSION = 1;
+const std::string SatBinaryFileAggregator::BINARY_FILE_SUFFIX = ".bin";
+
+
+SatBinaryFileAggregator::SatBinaryFileAggregator ()
+  : m_outputFileName ("untitled"),
+    m_generalHeading (""),
+    m_multiFileMode (true),
+    m_isContextPrinted (false),
+    m_bufferSize (4096),
+    m_isDisposed (false),
+    m_dimension (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+
+SatBinaryFileAggregator::~SatBinaryFileAggregator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+
+TypeId // static
+SatBinaryFileAggregator::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::SatBinaryFileAggregator")
+    .SetParent<DataCollectionObject> ()
+    .AddConstructor<SatBinaryFileAggregator> ()
+    .AddAttribute ("OutputFileName",
+                   "The path and name of the output file, without the "
+                   "binary file suffix.",
+                   StringValue ("untitled"),
+                   MakeStringAccessor (&SatBinaryFileAggregator::m_outputFileName),
+                   MakeStringChecker ())
+    .AddAttribute ("GeneralHeading",
+                   "Heading to be printed as the first line of every text "
+                   "output file produced from the binary file.",
+                   StringValue (""),
+                   MakeStringAccessor (&SatBinaryFileAggregator::m_generalHeading),
+                   MakeStringChecker ())
+    .AddAttribute ("MultiFileMode",
+                   "Default mode of the text conversion: one text file per "
+                   "context, or all contexts in a single text file.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatBinaryFileAggregator::m_multiFileMode),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EnableContextPrinting",
+                   "Default of the text conversion whether to print the "
+                   "context as the first column of every line.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatBinaryFileAggregator::m_isContextPrinted),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BufferSize",
+                   "Number of records buffered before they are written into "
+                   "the file as one chunk.",
+                   UintegerValue (4096),
+                   MakeUintegerAccessor (&SatBinaryFileAggregator::m_bufferSize),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+
+void
+SatBinaryFileAggregator::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  FlushRecords ();
+
+  if (m_file.is_open ())
+    {
+      m_file.close ();
+    }
+
+  m_contextIds.clear ();
+  m_isDisposed = true;
+
+  DataCollectionObject::DoDispose ();
+}
+
+
+void
+SatBinaryFileAggregator::Write1d (std::string context, double v1)
+{
+  if (IsEnabled ())
+    {
+      AddRecord (1, GetContextId (context), v1, 0.0);
+    }
+}
+
+
+void
+SatBinaryFileAggregator::Write2d (std::string context, double v1, double v2)
+{
+  if (IsEnabled ())
+    {
+      AddRecord (2, GetContextId (context), v1, v2);
+    }
+}
+
+
+void
+SatBinaryFileAggregator::AddContextHeading (std::string context, std::string heading)
+{
+  NS_LOG_FUNCTION (this << context << heading);
+
+  // keep the chunks in the order of the calls
+  FlushRecords ();
+  OpenFile ();
+
+  const uint32_t contextId = GetContextId (context);
+  const uint8_t chunkType = CHUNK_HEADING;
+  m_file.write (reinterpret_cast<const char*> (&chunkType), sizeof (chunkType));
+  m_file.write (reinterpret_cast<const char*> (&contextId), sizeof (contextId));
+  WriteString (heading);
+  CheckFile ();
+}
+
+
+void
+SatBinaryFileAggregator::EnableContextWarning (std::string context, bool isEnabled)
+{
+  NS_LOG_FUNCTION (this << context << isEnabled);
+
+  // keep the chunks in the order of the calls
+  FlushRecords ();
+  OpenFile ();
+
+  const uint32_t contextId = GetContextId (context);
+  const uint8_t chunkType = CHUNK_WARNING;
+  const uint8_t flag = isEnabled ? 1 : 0;
+  m_file.write (reinterpret_cast<const char*> (&chunkType), sizeof (chunkType));
+  m_file.write (reinterpret_cast<const char*> (&contextId), sizeof (contextId));
+  m_file.write (reinterpret_cast<const char*> (&flag), sizeof (flag));
+  CheckFile ();
+}
+
+
+uint32_t
+SatBinaryFileAggregator::GetContextId (const std::string &context)
+{
+  std::map<std::string, uint32_t>::const_iterator it = m_contextIds.find (context);
+
+  if (it != m_contextIds.end ())
+    {
+      return it->second;
+    }
+
+  OpenFile ();
+
+  const uint32_t contextId = m_contextIds.size ();
+  m_contextIds.insert (std::make_pair (context, contextId));
+
+  const uint8_t chunkType = CHUNK_CONTEXT;
+  m_file.write (reinterpret_cast<const char*> (&chunkType), sizeof (chunkType));
+  m_file.write (reinterpret_cast<const char*> (&contextId), sizeof (contextId));
+  WriteString (context);
+  CheckFile ();
+
+  return contextId;
+}
+
+
+void
+SatBinaryFileAggregator::AddRecord (uint8_t dimension, uint32_t contextId, double v1, double v2)
+{
+  if (m_isDisposed)
+    {
+      NS_FATAL_ERROR ("Sample written to binary statistics file " << m_outputFileName
+                                                                  << BINARY_FILE_SUFFIX << " after the aggregator was disposed!");
+    }
+
+  if (m_dimension != dimension)
+    {
+      FlushRecords ();
+      m_dimension = dimension;
+    }
+
+  m_contexts.push_back (contextId);
+  m_values1.push_back (v1);
+
+  if (dimension > 1)
+    {
+      m_values2.push_back (v2);
+    }
+
+  if (m_contexts.size () >= m_bufferSize)
+    {
+      FlushRecords ();
+    }
+}
+
+
+void
+SatBinaryFileAggregator::FlushRecords ()
+{
+  if (m_contexts.empty ())
+    {
+      return;
+    }
+
+  NS_LOG_FUNCTION (this << m_contexts.size ());
+
+  OpenFile ();
+
+  const uint8_t chunkType = CHUNK_RECORDS;
+  const uint32_t numOfRecords = m_contexts.size ();
+  m_file.write (reinterpret_cast<const char*> (&chunkType), sizeof (chunkType));
+  m_file.write (reinterpret_cast<const char*> (&m_dimension), sizeof (m_dimension));
+  m_file.write (reinterpret_cast<const char*> (&numOfRecords), sizeof (numOfRecords));
+  m_file.write (reinterpret_cast<const char*> (&m_contexts[0]),
+                numOfRecords * sizeof (uint32_t));
+  m_file.write (reinterpret_cast<const char*> (&m_values1[0]),
+                numOfRecords * sizeof (double));
+
+  if (m_dimension > 1)
+    {
+      m_file.write (reinterpret_cast<const char*> (&m_values2[0]),
+                    numOfRecords * sizeof (double));
+    }
+
+  CheckFile ();
+
+  m_contexts.clear ();
+  m_values1.clear ();
+  m_values2.clear ();
+}
+
+
+void
+SatBinaryFileAggregator::OpenFile ()
+{
+  if (m_file.is_open ())
+    {
+      return;
+    }
+
+  /*
+   * The file is truncated when opened, thus opening it again after dispose
+   * would lose everything written before.
+   */
+  if (m_isDisposed)
+    {
+      NS_FATAL_ERROR ("Binary statistics file " << m_outputFileName << BINARY_FILE_SUFFIX
+                                                << " written after the aggregator was disposed!");
+    }
+
+  const std::string fileName = m_outputFileName + BINARY_FILE_SUFFIX;
+  NS_LOG_INFO (this << " creating binary statistics file " << fileName);
+
+  m_file.open (fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!m_file.is_open ())
+    {
+      NS_FATAL_ERROR ("Unable to open binary statistics file " << fileName);
+    }
+
+  const uint8_t multiFileMode = m_multiFileMode ? 1 : 0;
+  const uint8_t contextPrinting = m_isContextPrinted ? 1 : 0;
+  m_file.write (reinterpret_cast<const char*> (&MAGIC_NUMBER), sizeof (MAGIC_NUMBER));
+  m_file.write (reinterpret_cast<const char*> (&FORMAT_VERSION), sizeof (FORMAT_VERSION));
+  m_file.write (reinterpret_cast<const char*> (&multiFileMode), sizeof (multiFileMode));
+  m_file.write (reinterpret_cast<const char*> (&contextPrinting), sizeof (contextPrinting));
+  WriteString (m_generalHeading);
+  CheckFile ();
+}
+
+
+void
+SatBinaryFileAggregator::CheckFile ()
+{
+  if (!m_file.good ())
+    {
+      NS_FATAL_ERROR ("Writing to the binary statistics file " << m_outputFileName
+                                                               << BINARY_FILE_SUFFIX << " failed!");
+    }
+}
+
+
+void
+SatBinaryFileAggregator::WriteString (const std::string &str)
+{
+  const uint32_t length = str.size ();
+  m_file.write (reinterpret_cast<const char*> (&length), sizeof (length));
+  m_file.write (str.data (), length);
+}
+
+
+} // end of namespace ns3
@@ -0,0 +1,187 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BINARY_FILE_AGGREGATOR_H
+#define SATELLITE_BINARY_FILE_AGGREGATOR_H
+
+#include <ns3/data-collection-object.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+/**
+ * \ingroup satstats
+ * \brief Aggregator which appends raw samples of all contexts into a single
+ *        columnar binary file.
+ *
+ * Provides the same sinks as MultiFileAggregator (Write1d(), Write2d(),
+ * AddContextHeading() and EnableContextWarning()), but instead of formatting
+ * every sample as text into one file per context, the samples are buffered
+ * as (context, x, y) records and written in column-wise chunks into one
+ * binary file `<OutputFileName>.bin`. The text and Gnuplot outputs are
+ * produced offline from the binary file by SatBinaryFileConverter.
+ *
+ * File format (little endian, native sizes):
+ * - header: magic (uint32), version (uint32), multi-file mode flag (uint8),
+ *   context printing flag (uint8), general heading (string)
+ * - followed by chunks, each starting with a chunk type (uint8):
+ *   - CHUNK_CONTEXT: context id (uint32), context name (string)
+ *   - CHUNK_HEADING: context id (uint32), heading (string)
+ *   - CHUNK_WARNING: context id (uint32), flag (uint8)
+ *   - CHUNK_RECORDS: dimension (uint8), number of records N (uint32),
+ *     N context ids (uint32), N x values (double) and, if dimension is 2,
+ *     N y values (double)
+ *
+ * Strings are stored as length (uint32) followed by the characters.
+ */
+class SatBinaryFileAggregator : public DataCollectionObject
+{
+public:
+  /**
+   * \brief Chunk types of the binary file.
+   */
+  typedef enum
+  {
+    CHUNK_CONTEXT = 1,
+    CHUNK_HEADING = 2,
+    CHUNK_WARNING = 3,
+    CHUNK_RECORDS = 4
+  } ChunkType_t;
+
+  /// Magic number identifying the binary statistics file
+  static const uint32_t MAGIC_NUMBER;
+
+  /// Version of the binary statistics file format
+  static const uint32_t FORMAT_VERSION;
+
+  /// Suffix added to the output file name
+  static const std::string BINARY_FILE_SUFFIX;
+
+  /**
+   * \brief Creates a new instance of aggregator.
+   */
+  SatBinaryFileAggregator ();
+
+  /**
+   * \brief Destructor
+   */
+  virtual ~SatBinaryFileAggregator ();
+
+  /**
+   * inherited from ObjectBase base class
+   */
+  static TypeId GetTypeId ();
+
+  // FILE SINK METHODS, MATCHING MultiFileAggregator
+
+  /**
+   * \brief Store a single value.
+   * \param context specifies the context of the value
+   * \param v1 the value
+   */
+  void Write1d (std::string context, double v1);
+
+  /**
+   * \brief Store a pair of values, e.g. time and sample.
+   * \param context specifies the context of the values
+   * \param v1 the first value
+   * \param v2 the second value
+   */
+  void Write2d (std::string context, double v1, double v2);
+
+  /**
+   * \brief Store a heading to be printed in the output of the context.
+   * \param context specifies the context of the heading
+   * \param heading the heading
+   */
+  void AddContextHeading (std::string context, std::string heading);
+
+  /**
+   * \brief Store a warning flag of the context.
+   * \param context specifies the context of the warning
+   * \param isEnabled the warning flag
+   */
+  void EnableContextWarning (std::string context, bool isEnabled);
+
+protected:
+  // inherited from Object base class
+  virtual void DoDispose ();
+
+private:
+  /**
+   * \param context the context name
+   * \return id of the context, which is assigned and written to the file at
+   *         the first time the context is seen
+   */
+  uint32_t GetContextId (const std::string &context);
+
+  /**
+   * \brief Store a record into the column buffers.
+   * \param dimension number of values in the record
+   * \param contextId id of the context
+   * \param v1 the first value
+   * \param v2 the second value, ignored with dimension 1
+   */
+  void AddRecord (uint8_t dimension, uint32_t contextId, double v1, double v2);
+
+  /// \brief Write the buffered records as one chunk.
+  void FlushRecords ();
+
+  /**
+   * \brief Open the output file and write the header, if not done yet.
+   *
+   * The file can be opened only once, writing after dispose is a fatal
+   * error.
+   */
+  void OpenFile ();
+
+  /// \brief Check that the writes into the output file succeeded.
+  void CheckFile ();
+
+  /**
+   * \brief Write a string into the file.
+   * \param str the string
+   */
+  void WriteString (const std::string &str);
+
+  std::string m_outputFileName;      ///< `OutputFileName` attribute.
+  std::string m_generalHeading;      ///< `GeneralHeading` attribute.
+  bool m_multiFileMode;              ///< `MultiFileMode` attribute.
+  bool m_isContextPrinted;           ///< `EnableContextPrinting` attribute.
+  uint32_t m_bufferSize;             ///< `BufferSize` attribute.
+  bool m_isDisposed;                 ///< True after the file is closed at dispose.
+
+  std::ofstream m_file;              ///< The output file.
+  std::map<std::string, uint32_t> m_contextIds; ///< Ids of known contexts.
+
+  uint8_t m_dimension;               ///< Dimension of the buffered records.
+  std::vector<uint32_t> m_contexts;  ///< Context column of the buffered records.
+  std::vector<double> m_values1;     ///< First value column of the buffered records.
+  std::vector<double> m_values2;     ///< Second value column of the buffered records.
+
+}; // end of class SatBinaryFileAggregator
+
+
+} // end of namespace ns3
+
+
+#endif /* SATELLITE_BINARY_FILE_AGGREGATOR_H */
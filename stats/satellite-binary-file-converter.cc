@@ -0,0 +1,368 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "satellite-binary-file-converter.h"
+#include "satellite-binary-file-aggregator.h"
+#include <ns3/log.h>
+#include <ns3/gnuplot.h>
+
+NS_LOG_COMPONENT_DEFINE ("SatBinaryFileConverter");
+
+
+namespace ns3 {
+
+
+SatBinaryFileConverter::SatBinaryFileConverter (std::string binaryFileName)
+  : m_generalHeading (""),
+    m_multiFileMode (true),
+    m_contextPrinting (false),
+    m_dimension (0)
+{
+  NS_LOG_FUNCTION (this << binaryFileName);
+  ReadFile (binaryFileName);
+}
+
+
+uint32_t
+SatBinaryFileConverter::GetNumOfContexts () const
+{
+  return m_contexts.size ();
+}
+
+
+std::string
+SatBinaryFileConverter::GetContextName (uint32_t contextId) const
+{
+  NS_ASSERT (contextId < m_contexts.size ());
+  return m_contexts[contextId].name;
+}
+
+
+uint32_t
+SatBinaryFileConverter::GetNumOfRecords (uint32_t contextId) const
+{
+  NS_ASSERT (contextId < m_contexts.size ());
+  return m_contexts[contextId].values1.size ();
+}
+
+
+void
+SatBinaryFileConverter::ReadFile (std::string binaryFileName)
+{
+  NS_LOG_FUNCTION (this << binaryFileName);
+
+  std::ifstream ifs (binaryFileName.c_str (), std::ios::in | std::ios::binary);
+
+  if (!ifs.is_open ())
+    {
+      NS_FATAL_ERROR ("Unable to open binary statistics file " << binaryFileName);
+    }
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint8_t multiFileMode = 0;
+  uint8_t contextPrinting = 0;
+  ifs.read (reinterpret_cast<char*> (&magic), sizeof (magic));
+  ifs.read (reinterpret_cast<char*> (&version), sizeof (version));
+  ifs.read (reinterpret_cast<char*> (&multiFileMode), sizeof (multiFileMode));
+  ifs.read (reinterpret_cast<char*> (&contextPrinting), sizeof (contextPrinting));
+
+  if (!ifs.good ()
+      || (magic != SatBinaryFileAggregator::MAGIC_NUMBER)
+      || (version != SatBinaryFileAggregator::FORMAT_VERSION))
+    {
+      NS_FATAL_ERROR ("File " << binaryFileName << " is not a binary statistics file of a supported version");
+    }
+
+  m_multiFileMode = (multiFileMode != 0);
+  m_contextPrinting = (contextPrinting != 0);
+  m_generalHeading = ReadString (ifs);
+
+  uint8_t chunkType = 0;
+
+  while (ifs.read (reinterpret_cast<char*> (&chunkType), sizeof (chunkType)))
+    {
+      switch (chunkType)
+        {
+        case SatBinaryFileAggregator::CHUNK_CONTEXT:
+          {
+            uint32_t contextId = 0;
+            ifs.read (reinterpret_cast<char*> (&contextId), sizeof (contextId));
+
+            if (contextId != m_contexts.size ())
+              {
+                NS_FATAL_ERROR ("Unexpected context id " << contextId << " in " << binaryFileName);
+              }
+
+            Context_t context;
+            context.name = ReadString (ifs);
+            context.warning = false;
+            m_contexts.push_back (context);
+            break;
+          }
+
+        case SatBinaryFileAggregator::CHUNK_HEADING:
+          {
+            uint32_t contextId = 0;
+            ifs.read (reinterpret_cast<char*> (&contextId), sizeof (contextId));
+            NS_ASSERT (contextId < m_contexts.size ());
+            m_contexts[contextId].headings.push_back (ReadString (ifs));
+            break;
+          }
+
+        case SatBinaryFileAggregator::CHUNK_WARNING:
+          {
+            uint32_t contextId = 0;
+            uint8_t flag = 0;
+            ifs.read (reinterpret_cast<char*> (&contextId), sizeof (contextId));
+            ifs.read (reinterpret_cast<char*> (&flag), sizeof (flag));
+            NS_ASSERT (contextId < m_contexts.size ());
+            m_contexts[contextId].warning = (flag != 0);
+            break;
+          }
+
+        case SatBinaryFileAggregator::CHUNK_RECORDS:
+          {
+            uint8_t dimension = 0;
+            uint32_t numOfRecords = 0;
+            ifs.read (reinterpret_cast<char*> (&dimension), sizeof (dimension));
+            ifs.read (reinterpret_cast<char*> (&numOfRecords), sizeof (numOfRecords));
+
+            if ((dimension != 1) && (dimension != 2))
+              {
+                NS_FATAL_ERROR ("Invalid record dimension " << (uint32_t) dimension << " in " << binaryFileName);
+              }
+
+            if ((m_dimension != 0) && (m_dimension != dimension))
+              {
+                NS_FATAL_ERROR ("Mixed record dimensions in " << binaryFileName);
+              }
+            m_dimension = dimension;
+
+            std::vector<uint32_t> contextIds (numOfRecords);
+            std::vector<double> values1 (numOfRecords);
+            std::vector<double> values2 (dimension > 1 ? numOfRecords : 0);
+
+            if (numOfRecords > 0)
+              {
+                ifs.read (reinterpret_cast<char*> (&contextIds[0]), numOfRecords * sizeof (uint32_t));
+                ifs.read (reinterpret_cast<char*> (&values1[0]), numOfRecords * sizeof (double));
+                if (dimension > 1)
+                  {
+                    ifs.read (reinterpret_cast<char*> (&values2[0]), numOfRecords * sizeof (double));
+                  }
+              }
+
+            if (!ifs.good ())
+              {
+                NS_FATAL_ERROR ("Truncated record chunk in " << binaryFileName);
+              }
+
+            for (uint32_t i = 0; i < numOfRecords; ++i)
+              {
+                NS_ASSERT (contextIds[i] < m_contexts.size ());
+                Context_t &context = m_contexts[contextIds[i]];
+                context.values1.push_back (values1[i]);
+                if (dimension > 1)
+                  {
+                    context.values2.push_back (values2[i]);
+                  }
+              }
+            break;
+          }
+
+        default:
+          NS_FATAL_ERROR ("Unknown chunk type " << (uint32_t) chunkType << " in " << binaryFileName);
+          break;
+        }
+
+      if (!ifs.good ())
+        {
+          NS_FATAL_ERROR ("Truncated chunk in " << binaryFileName);
+        }
+    }
+}
+
+
+std::string // static
+SatBinaryFileConverter::ReadString (std::ifstream &ifs)
+{
+  uint32_t length = 0;
+  ifs.read (reinterpret_cast<char*> (&length), sizeof (length));
+
+  std::string str (length, '\0');
+  if (length > 0)
+    {
+      ifs.read (&str[0], length);
+    }
+
+  return str;
+}
+
+
+void
+SatBinaryFileConverter::WriteTextFiles (std::string outputFileName) const
+{
+  WriteTextFiles (outputFileName, m_multiFileMode, m_contextPrinting);
+}
+
+
+void
+SatBinaryFileConverter::WriteTextFiles (std::string outputFileName,
+                                        bool multiFileMode,
+                                        bool contextPrinting) const
+{
+  NS_LOG_FUNCTION (this << outputFileName << multiFileMode << contextPrinting);
+
+  if (multiFileMode)
+    {
+      for (std::vector<Context_t>::const_iterator it = m_contexts.begin ();
+           it != m_contexts.end (); ++it)
+        {
+          const std::string fileName = outputFileName + "-" + it->name + ".txt";
+          std::ofstream ofs (fileName.c_str ());
+
+          if (!ofs.is_open ())
+            {
+              NS_FATAL_ERROR ("Unable to open output file " << fileName);
+            }
+
+          if (!m_generalHeading.empty ())
+            {
+              ofs << m_generalHeading << std::endl;
+            }
+
+          WriteContext (ofs, *it, contextPrinting);
+        }
+    }
+  else
+    {
+      const std::string fileName = outputFileName + ".txt";
+      std::ofstream ofs (fileName.c_str ());
+
+      if (!ofs.is_open ())
+        {
+          NS_FATAL_ERROR ("Unable to open output file " << fileName);
+        }
+
+      if (!m_generalHeading.empty ())
+        {
+          ofs << m_generalHeading << std::endl;
+        }
+
+      for (std::vector<Context_t>::const_iterator it = m_contexts.begin ();
+           it != m_contexts.end (); ++it)
+        {
+          WriteContext (ofs, *it, contextPrinting);
+        }
+    }
+}
+
+
+void
+SatBinaryFileConverter::WriteContext (std::ofstream &ofs,
+                                      const Context_t &context,
+                                      bool contextPrinting) const
+{
+  for (std::vector<std::string>::const_iterator it = context.headings.begin ();
+       it != context.headings.end (); ++it)
+    {
+      ofs << *it;
+      if (it->empty () || ((*it)[it->size () - 1] != '\n'))
+        {
+          ofs << std::endl;
+        }
+    }
+
+  if (context.warning)
+    {
+      ofs << "% warning: some samples are outside of the output range" << std::endl;
+    }
+
+  for (uint32_t i = 0; i < context.values1.size (); ++i)
+    {
+      if (contextPrinting)
+        {
+          ofs << context.name << " ";
+        }
+
+      ofs << context.values1[i];
+
+      if (m_dimension > 1)
+        {
+          ofs << " " << context.values2[i];
+        }
+
+      ofs << std::endl;
+    }
+}
+
+
+void
+SatBinaryFileConverter::WriteGnuplotFile (std::string outputFileName,
+                                          std::string xLegend,
+                                          std::string yLegend) const
+{
+  NS_LOG_FUNCTION (this << outputFileName << xLegend << yLegend);
+
+  if (m_dimension != 2)
+    {
+      NS_FATAL_ERROR ("Gnuplot output requires two-dimensional records");
+    }
+
+  Gnuplot plot (outputFileName + ".png");
+  plot.SetTerminal ("png");
+  plot.SetLegend (xLegend, yLegend);
+
+  for (std::vector<Context_t>::const_iterator it = m_contexts.begin ();
+       it != m_contexts.end (); ++it)
+    {
+      Gnuplot2dDataset dataset (it->name);
+      dataset.SetStyle (Gnuplot2dDataset::LINES);
+
+      for (uint32_t i = 0; i < it->values1.size (); ++i)
+        {
+          dataset.Add (it->values1[i], it->values2[i]);
+        }
+
+      plot.AddDataset (dataset);
+    }
+
+  const std::string plotFileName = outputFileName + ".plt";
+  std::ofstream plotFile (plotFileName.c_str ());
+
+  if (!plotFile.is_open ())
+    {
+      NS_FATAL_ERROR ("Unable to open output file " << plotFileName);
+    }
+
+  const std::string dataFileName = outputFileName + ".dat";
+  std::ofstream dataFile (dataFileName.c_str ());
+
+  if (!dataFile.is_open ())
+    {
+      NS_FATAL_ERROR ("Unable to open output file " << dataFileName);
+    }
+
+  // the script refers to the datasets in the data file by index
+  plot.GenerateOutput (plotFile, dataFile, dataFileName);
+}
+
+
+} // end of namespace ns3
@@ -0,0 +1,140 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BINARY_FILE_CONVERTER_H
+#define SATELLITE_BINARY_FILE_CONVERTER_H
+
+#include <ns3/simple-ref-count.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup satstats
+ * \brief Offline converter of binary statistics files written by
+ *        SatBinaryFileAggregator.
+ *
+ * The whole binary file is read into memory at construction. The contents
+ * can then be written as text files, in the same layout as
+ * MultiFileAggregator produces them, or as a Gnuplot script with one
+ * dataset per context, like MagisterGnuplotAggregator produces it.
+ */
+class SatBinaryFileConverter : public SimpleRefCount<SatBinaryFileConverter>
+{
+public:
+  /**
+   * \brief Constructor, which reads the given binary statistics file.
+   * \param binaryFileName path and name of the binary file, including the
+   *                       binary file suffix
+   */
+  SatBinaryFileConverter (std::string binaryFileName);
+
+  /**
+   * \return number of contexts found in the binary file
+   */
+  uint32_t GetNumOfContexts () const;
+
+  /**
+   * \param contextId index of the context
+   * \return name of the context
+   */
+  std::string GetContextName (uint32_t contextId) const;
+
+  /**
+   * \param contextId index of the context
+   * \return number of records of the context
+   */
+  uint32_t GetNumOfRecords (uint32_t contextId) const;
+
+  /**
+   * \brief Write the contents as text files, using the mode stored in the
+   *        binary file by the aggregator.
+   * \param outputFileName path and name of the output, without extension
+   */
+  void WriteTextFiles (std::string outputFileName) const;
+
+  /**
+   * \brief Write the contents as text files.
+   * \param outputFileName path and name of the output, without extension
+   * \param multiFileMode if true, one file `<outputFileName>-<context>.txt`
+   *                      is written per context, otherwise all contexts are
+   *                      written into `<outputFileName>.txt`
+   * \param contextPrinting if true, the context is printed as the first
+   *                        column of every line
+   */
+  void WriteTextFiles (std::string outputFileName, bool multiFileMode, bool contextPrinting) const;
+
+  /**
+   * \brief Write the two-dimensional contents as a Gnuplot script
+   *        `<outputFileName>.plt` and its data file `<outputFileName>.dat`,
+   *        with one dataset per context, producing `<outputFileName>.png`.
+   * \param outputFileName path and name of the output, without extension
+   * \param xLegend legend of the x axis
+   * \param yLegend legend of the y axis
+   */
+  void WriteGnuplotFile (std::string outputFileName, std::string xLegend, std::string yLegend) const;
+
+private:
+  /**
+   * \brief Contents of a single context.
+   */
+  typedef struct
+  {
+    std::string name;
+    std::vector<std::string> headings;
+    bool warning;
+    std::vector<double> values1;
+    std::vector<double> values2;
+  } Context_t;
+
+  /**
+   * \brief Read the whole binary file.
+   * \param binaryFileName path and name of the binary file
+   */
+  void ReadFile (std::string binaryFileName);
+
+  /**
+   * \param ifs the input stream
+   * \return a string read from the stream
+   */
+  static std::string ReadString (std::ifstream &ifs);
+
+  /**
+   * \brief Write the heading lines and records of a context.
+   * \param ofs the output stream
+   * \param context the context
+   * \param contextPrinting whether to print the context name on every line
+   */
+  void WriteContext (std::ofstream &ofs, const Context_t &context, bool contextPrinting) const;
+
+  std::string m_generalHeading;
+  bool m_multiFileMode;
+  bool m_contextPrinting;
+  uint8_t m_dimension;
+  std::vector<Context_t> m_contexts;
+
+}; // end of class SatBinaryFileConverter
+
+
+} // end of namespace ns3
+
+
+#endif /* SATELLITE_BINARY_FILE_CONVERTER_H */
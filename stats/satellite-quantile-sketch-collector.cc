@@ -0,0 +1,607 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "satellite-quantile-sketch-collector.h"
+#include <ns3/log.h>
+#include <ns3/enum.h>
+#include <ns3/double.h>
+#include <ns3/uinteger.h>
+#include <ns3/trace-source-accessor.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE ("SatQuantileSketchCollector");
+
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatQuantileSketchCollector);
+
+/*
+ * Samples with smaller magnitude than this are counted as zero, since they
+ * cannot be indexed with a finite bucket index range.
+ */
+static const double SAT_SKETCH_ZERO_THRESHOLD = 1e-12;
+
+
+SatQuantileSketchCollector::BinStore::BinStore ()
+  : m_counts (),
+    m_minIndex (0)
+{
+}
+
+
+void
+SatQuantileSketchCollector::BinStore::Add (int32_t index, uint64_t count, uint32_t maxNumOfBins)
+{
+  NS_ASSERT (maxNumOfBins > 0);
+
+  if (m_counts.empty ())
+    {
+      m_minIndex = index;
+      m_counts.push_back (count);
+      return;
+    }
+
+  const int32_t maxIndex = GetMaxIndex ();
+
+  if (index < m_minIndex)
+    {
+      // The lowest buckets absorb anything below the allowed span.
+      const int32_t lowestAllowed = maxIndex - static_cast<int32_t> (maxNumOfBins) + 1;
+      if (index < lowestAllowed)
+        {
+          index = lowestAllowed;
+        }
+
+      if (index < m_minIndex)
+        {
+          m_counts.insert (m_counts.begin (), m_minIndex - index, 0);
+          m_minIndex = index;
+        }
+    }
+  else if (index > maxIndex)
+    {
+      const int32_t newMinIndex = index - static_cast<int32_t> (maxNumOfBins) + 1;
+
+      if (newMinIndex > m_minIndex)
+        {
+          // Collapse the lowest buckets into the new lowest bucket.
+          uint64_t collapsed = 0;
+          const uint32_t numToCollapse
+            = std::min<uint32_t> (newMinIndex - m_minIndex, m_counts.size ());
+          for (uint32_t i = 0; i < numToCollapse; ++i)
+            {
+              collapsed += m_counts[i];
+            }
+          m_counts.erase (m_counts.begin (), m_counts.begin () + numToCollapse);
+
+          if (m_counts.empty ())
+            {
+              m_counts.push_back (0);
+            }
+
+          m_minIndex = newMinIndex;
+          m_counts[0] += collapsed;
+        }
+
+      m_counts.resize (index - m_minIndex + 1, 0);
+    }
+
+  m_counts[index - m_minIndex] += count;
+}
+
+
+bool
+SatQuantileSketchCollector::BinStore::IsEmpty () const
+{
+  return m_counts.empty ();
+}
+
+
+int32_t
+SatQuantileSketchCollector::BinStore::GetMinIndex () const
+{
+  return m_minIndex;
+}
+
+
+int32_t
+SatQuantileSketchCollector::BinStore::GetMaxIndex () const
+{
+  return m_minIndex + static_cast<int32_t> (m_counts.size ()) - 1;
+}
+
+
+uint64_t
+SatQuantileSketchCollector::BinStore::GetCount (int32_t index) const
+{
+  if (m_counts.empty () || (index < m_minIndex) || (index > GetMaxIndex ()))
+    {
+      return 0;
+    }
+
+  return m_counts[index - m_minIndex];
+}
+
+
+uint32_t
+SatQuantileSketchCollector::BinStore::GetNumOfBins () const
+{
+  return m_counts.size ();
+}
+
+
+SatQuantileSketchCollector::SatQuantileSketchCollector ()
+  : m_outputType (DistributionCollector::OUTPUT_TYPE_HISTOGRAM),
+    m_minValue (0.0),
+    m_maxValue (1.0),
+    m_binLength (0.02),
+    m_relativeAccuracy (0.01),
+    m_maxNumOfBins (1024),
+    m_logGamma (std::log (1.0 + 2.0 * 0.01 / (1.0 - 0.01))),
+    m_zeroCount (0),
+    m_count (0),
+    m_numOfOutliers (0),
+    m_sum (0.0),
+    m_sumSquared (0.0),
+    m_min (std::numeric_limits<double>::max ()),
+    m_max (-std::numeric_limits<double>::max ())
+{
+  NS_LOG_FUNCTION (this << GetName ());
+}
+
+
+SatQuantileSketchCollector::~SatQuantileSketchCollector ()
+{
+  NS_LOG_FUNCTION (this << GetName ());
+}
+
+
+TypeId // static
+SatQuantileSketchCollector::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::SatQuantileSketchCollector")
+    .SetParent<DataCollectionObject> ()
+    .AddConstructor<SatQuantileSketchCollector> ()
+    .AddAttribute ("MinValue",
+                   "Lower bound of the output range. Samples below this "
+                   "value are counted in the first output bin.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&SatQuantileSketchCollector::m_minValue),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("MaxValue",
+                   "Upper bound of the output range. Samples above this "
+                   "value are counted in the last output bin.",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&SatQuantileSketchCollector::m_maxValue),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("BinLength",
+                   "The length of every output bin.",
+                   DoubleValue (0.02),
+                   MakeDoubleAccessor (&SatQuantileSketchCollector::m_binLength),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("OutputType",
+                   "Determines the mechanism of processing the incoming samples.",
+                   EnumValue (DistributionCollector::OUTPUT_TYPE_HISTOGRAM),
+                   MakeEnumAccessor (&SatQuantileSketchCollector::SetOutputType,
+                                     &SatQuantileSketchCollector::GetOutputType),
+                   MakeEnumChecker (DistributionCollector::OUTPUT_TYPE_HISTOGRAM,   "HISTOGRAM",
+                                    DistributionCollector::OUTPUT_TYPE_PROBABILITY, "PROBABILITY",
+                                    DistributionCollector::OUTPUT_TYPE_CUMULATIVE,  "CUMULATIVE"))
+    .AddAttribute ("RelativeAccuracy",
+                   "Relative accuracy guaranteed for every quantile of the "
+                   "distribution, e.g. 0.01 for 1% accuracy.",
+                   DoubleValue (0.01),
+                   MakeDoubleAccessor (&SatQuantileSketchCollector::SetRelativeAccuracy,
+                                       &SatQuantileSketchCollector::GetRelativeAccuracy),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("MaxNumOfBins",
+                   "Maximum number of sketch buckets per sign of the samples. "
+                   "Bounds the memory consumption of the collector.",
+                   UintegerValue (1024),
+                   MakeUintegerAccessor (&SatQuantileSketchCollector::m_maxNumOfBins),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddTraceSource ("Output",
+                     "The center value and the value of every output bin.",
+                     MakeTraceSourceAccessor (&SatQuantileSketchCollector::m_output),
+                     "ns3::SatQuantileSketchCollector::BinCallback")
+    .AddTraceSource ("OutputString",
+                     "Summary of the received samples, such as count, mean, "
+                     "standard deviation, and percentiles.",
+                     MakeTraceSourceAccessor (&SatQuantileSketchCollector::m_outputString),
+                     "ns3::SatQuantileSketchCollector::StringCallback")
+    .AddTraceSource ("Warning",
+                     "Invoked if some samples were outside of the output range.",
+                     MakeTraceSourceAccessor (&SatQuantileSketchCollector::m_warning),
+                     "ns3::SatQuantileSketchCollector::WarningCallback")
+  ;
+  return tid;
+}
+
+
+void
+SatQuantileSketchCollector::DoDispose ()
+{
+  NS_LOG_FUNCTION (this << GetName ());
+
+  if (IsEnabled () && (m_count > 0) && (m_binLength > 0.0))
+    {
+      m_outputString (GetSummary ());
+
+      if (m_numOfOutliers > 0)
+        {
+          m_warning (true);
+        }
+
+      // Evaluate the sketch at the output bins.
+      uint32_t numOfOutputBins
+        = static_cast<uint32_t> (std::ceil ((m_maxValue - m_minValue) / m_binLength));
+      if (numOfOutputBins == 0)
+        {
+          numOfOutputBins = 1;
+        }
+
+      std::vector<uint64_t> outputBins (numOfOutputBins, 0);
+      std::vector<double> values;
+      std::vector<uint64_t> counts;
+      GetSortedBins (values, counts);
+
+      for (uint32_t i = 0; i < values.size (); ++i)
+        {
+          double pos = std::floor ((values[i] - m_minValue) / m_binLength);
+          uint32_t bin = 0;
+          if (pos >= numOfOutputBins)
+            {
+              bin = numOfOutputBins - 1;
+            }
+          else if (pos > 0.0)
+            {
+              bin = static_cast<uint32_t> (pos);
+            }
+          outputBins[bin] += counts[i];
+        }
+
+      uint64_t cumulative = 0;
+      for (uint32_t bin = 0; bin < numOfOutputBins; ++bin)
+        {
+          const double binCenter = m_minValue + (bin + 0.5) * m_binLength;
+          cumulative += outputBins[bin];
+
+          switch (m_outputType)
+            {
+            case DistributionCollector::OUTPUT_TYPE_HISTOGRAM:
+              m_output (binCenter, static_cast<double> (outputBins[bin]));
+              break;
+            case DistributionCollector::OUTPUT_TYPE_PROBABILITY:
+              m_output (binCenter, static_cast<double> (outputBins[bin]) / m_count);
+              break;
+            case DistributionCollector::OUTPUT_TYPE_CUMULATIVE:
+              m_output (binCenter, static_cast<double> (cumulative) / m_count);
+              break;
+            default:
+              NS_FATAL_ERROR ("SatQuantileSketchCollector - Invalid output type");
+              break;
+            }
+        }
+    }
+
+  DataCollectionObject::DoDispose ();
+}
+
+
+void
+SatQuantileSketchCollector::SetOutputType (DistributionCollector::OutputType_t outputType)
+{
+  NS_LOG_FUNCTION (this << outputType);
+  m_outputType = outputType;
+}
+
+
+DistributionCollector::OutputType_t
+SatQuantileSketchCollector::GetOutputType () const
+{
+  return m_outputType;
+}
+
+
+void
+SatQuantileSketchCollector::SetRelativeAccuracy (double relativeAccuracy)
+{
+  NS_LOG_FUNCTION (this << relativeAccuracy);
+
+  if (m_count > 0)
+    {
+      NS_FATAL_ERROR ("Relative accuracy cannot be changed after receiving samples");
+    }
+
+  m_relativeAccuracy = relativeAccuracy;
+
+  // gamma = (1 + alpha) / (1 - alpha)
+  m_logGamma = std::log (1.0 + 2.0 * relativeAccuracy / (1.0 - relativeAccuracy));
+}
+
+
+double
+SatQuantileSketchCollector::GetRelativeAccuracy () const
+{
+  return m_relativeAccuracy;
+}
+
+
+uint64_t
+SatQuantileSketchCollector::GetCount () const
+{
+  return m_count;
+}
+
+
+uint32_t
+SatQuantileSketchCollector::GetNumOfBins () const
+{
+  return m_positiveBins.GetNumOfBins () + m_negativeBins.GetNumOfBins ()
+         + ((m_zeroCount > 0) ? 1 : 0);
+}
+
+
+double
+SatQuantileSketchCollector::GetQuantile (double quantile) const
+{
+  NS_LOG_FUNCTION (this << quantile);
+
+  if (m_count == 0)
+    {
+      return 0.0;
+    }
+
+  NS_ASSERT ((quantile >= 0.0) && (quantile <= 1.0));
+
+  if (quantile <= 0.0)
+    {
+      return m_min;
+    }
+  if (quantile >= 1.0)
+    {
+      return m_max;
+    }
+
+  const double rank = quantile * (m_count - 1);
+  std::vector<double> values;
+  std::vector<uint64_t> counts;
+  GetSortedBins (values, counts);
+
+  uint64_t cumulative = 0;
+  double ret = m_max;
+  for (uint32_t i = 0; i < values.size (); ++i)
+    {
+      cumulative += counts[i];
+      if (cumulative > rank)
+        {
+          ret = values[i];
+          break;
+        }
+    }
+
+  // The representative values may slightly exceed the exact extremes.
+  return std::max (m_min, std::min (m_max, ret));
+}
+
+
+void
+SatQuantileSketchCollector::Merge (Ptr<const SatQuantileSketchCollector> other)
+{
+  NS_LOG_FUNCTION (this << other);
+  NS_ASSERT (other != 0);
+
+  if (other->m_relativeAccuracy != m_relativeAccuracy)
+    {
+      NS_FATAL_ERROR ("Cannot merge sketches with different relative accuracy");
+    }
+
+  if (other->m_count == 0)
+    {
+      return;
+    }
+
+  if (!other->m_positiveBins.IsEmpty ())
+    {
+      for (int32_t i = other->m_positiveBins.GetMinIndex ();
+           i <= other->m_positiveBins.GetMaxIndex (); ++i)
+        {
+          const uint64_t c = other->m_positiveBins.GetCount (i);
+          if (c > 0)
+            {
+              m_positiveBins.Add (i, c, m_maxNumOfBins);
+            }
+        }
+    }
+
+  if (!other->m_negativeBins.IsEmpty ())
+    {
+      for (int32_t i = other->m_negativeBins.GetMinIndex ();
+           i <= other->m_negativeBins.GetMaxIndex (); ++i)
+        {
+          const uint64_t c = other->m_negativeBins.GetCount (i);
+          if (c > 0)
+            {
+              m_negativeBins.Add (i, c, m_maxNumOfBins);
+            }
+        }
+    }
+
+  m_zeroCount += other->m_zeroCount;
+  m_count += other->m_count;
+  m_numOfOutliers += other->m_numOfOutliers;
+  m_sum += other->m_sum;
+  m_sumSquared += other->m_sumSquared;
+  m_min = std::min (m_min, other->m_min);
+  m_max = std::max (m_max, other->m_max);
+}
+
+
+void
+SatQuantileSketchCollector::TraceSinkDouble (double oldData, double newData)
+{
+  NS_LOG_FUNCTION (this << GetName () << newData);
+
+  if (IsEnabled ())
+    {
+      AddSample (newData);
+    }
+}
+
+
+void
+SatQuantileSketchCollector::TraceSinkDouble1 (double data)
+{
+  TraceSinkDouble (0.0, data);
+}
+
+
+void
+SatQuantileSketchCollector::TraceSinkUinteger32 (uint32_t oldData, uint32_t newData)
+{
+  TraceSinkDouble (static_cast<double> (oldData), static_cast<double> (newData));
+}
+
+
+void
+SatQuantileSketchCollector::AddSample (double sample)
+{
+  const double absValue = std::fabs (sample);
+
+  if (absValue < SAT_SKETCH_ZERO_THRESHOLD)
+    {
+      m_zeroCount++;
+    }
+  else if (sample > 0.0)
+    {
+      m_positiveBins.Add (GetIndex (absValue), 1, m_maxNumOfBins);
+    }
+  else
+    {
+      m_negativeBins.Add (GetIndex (absValue), 1, m_maxNumOfBins);
+    }
+
+  if ((sample < m_minValue) || (sample > m_maxValue))
+    {
+      m_numOfOutliers++;
+    }
+
+  m_count++;
+  m_sum += sample;
+  m_sumSquared += sample * sample;
+  m_min = std::min (m_min, sample);
+  m_max = std::max (m_max, sample);
+}
+
+
+int32_t
+SatQuantileSketchCollector::GetIndex (double absValue) const
+{
+  // Bucket i covers the values (gamma^(i-1), gamma^i].
+  return static_cast<int32_t> (std::ceil (std::log (absValue) / m_logGamma));
+}
+
+
+double
+SatQuantileSketchCollector::GetBinValue (int32_t index) const
+{
+  // The value in the middle of the bucket, in the relative sense.
+  const double gamma = std::exp (m_logGamma);
+  return 2.0 * std::exp (index * m_logGamma) / (1.0 + gamma);
+}
+
+
+void
+SatQuantileSketchCollector::GetSortedBins (std::vector<double> &values,
+                                           std::vector<uint64_t> &counts) const
+{
+  values.clear ();
+  counts.clear ();
+
+  // Negative samples first, the largest magnitude being the smallest value.
+  if (!m_negativeBins.IsEmpty ())
+    {
+      for (int32_t i = m_negativeBins.GetMaxIndex ();
+           i >= m_negativeBins.GetMinIndex (); --i)
+        {
+          const uint64_t c = m_negativeBins.GetCount (i);
+          if (c > 0)
+            {
+              values.push_back (-GetBinValue (i));
+              counts.push_back (c);
+            }
+        }
+    }
+
+  if (m_zeroCount > 0)
+    {
+      values.push_back (0.0);
+      counts.push_back (m_zeroCount);
+    }
+
+  if (!m_positiveBins.IsEmpty ())
+    {
+      for (int32_t i = m_positiveBins.GetMinIndex ();
+           i <= m_positiveBins.GetMaxIndex (); ++i)
+        {
+          const uint64_t c = m_positiveBins.GetCount (i);
+          if (c > 0)
+            {
+              values.push_back (GetBinValue (i));
+              counts.push_back (c);
+            }
+        }
+    }
+}
+
+
+std::string
+SatQuantileSketchCollector::GetSummary () const
+{
+  const double mean = m_sum / m_count;
+  double variance = (m_sumSquared / m_count) - (mean * mean);
+  if (variance < 0.0)
+    {
+      variance = 0.0;
+    }
+
+  std::ostringstream oss;
+  oss << "% count " << m_count << std::endl
+      << "% sum " << m_sum << std::endl
+      << "% min " << m_min << std::endl
+      << "% max " << m_max << std::endl
+      << "% mean " << mean << std::endl
+      << "% stddev " << std::sqrt (variance) << std::endl
+      << "% 5th_percentile " << GetQuantile (0.05) << std::endl
+      << "% 25th_percentile " << GetQuantile (0.25) << std::endl
+      << "% median " << GetQuantile (0.5) << std::endl
+      << "% 75th_percentile " << GetQuantile (0.75) << std::endl
+      << "% 95th_percentile " << GetQuantile (0.95) << std::endl
+      << "% 99th_percentile " << GetQuantile (0.99) << std::endl
+      << "% relative_accuracy " << m_relativeAccuracy << std::endl
+      << "% outliers " << m_numOfOutliers << std::endl;
+  return oss.str ();
+}
+
+
+} // end of namespace ns3
@@ -0,0 +1,280 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_QUANTILE_SKETCH_COLLECTOR_H
+#define SATELLITE_QUANTILE_SKETCH_COLLECTOR_H
+
+#include <ns3/data-collection-object.h>
+#include <ns3/distribution-collector.h>
+#include <ns3/traced-callback.h>
+#include <vector>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * \ingroup satstats
+ * \brief Collector which summarizes the distribution of the received samples
+ *        into a bounded-memory quantile sketch.
+ *
+ * A drop-in alternative to DistributionCollector for statistics with a large
+ * number of identifiers. The samples are not binned into a fixed grid while
+ * the simulation runs. Instead each sample is mapped to a logarithmically
+ * spaced bucket (DDSketch style), which guarantees that every quantile is
+ * reproduced within the relative accuracy given by the `RelativeAccuracy`
+ * attribute. The number of buckets is limited by the `MaxNumOfBins`
+ * attribute; if the limit is reached, the buckets of the smallest magnitude
+ * are collapsed together, sacrificing accuracy only on the lower tail.
+ *
+ * Sketches of different collectors can be combined with Merge(), e.g. to
+ * produce a global distribution out of per-UT sketches.
+ *
+ * Input samples are received through TraceSinkDouble() and
+ * TraceSinkDouble1() methods. At the end of the simulation, the collector
+ * produces the same output as DistributionCollector: the sketch is
+ * evaluated at the bins defined by the `MinValue`, `MaxValue` and
+ * `BinLength` attributes, and emitted through the `Output` trace source as
+ * a histogram, a probability distribution, or a cumulative distribution,
+ * depending on the `OutputType` attribute. The `OutputString` trace source
+ * emits a summary of the samples, including a set of percentiles, and the
+ * `Warning` trace source is invoked if some samples were outside of the
+ * output range.
+ */
+class SatQuantileSketchCollector : public DataCollectionObject
+{
+public:
+  /**
+   * \brief Creates a new collector instance.
+   */
+  SatQuantileSketchCollector ();
+
+  /**
+   * \brief Destructor
+   */
+  virtual ~SatQuantileSketchCollector ();
+
+  /**
+   * inherited from ObjectBase base class
+   */
+  static TypeId GetTypeId ();
+
+  // SETTERS AND GETTERS
+
+  /**
+   * \param outputType the processing mechanism used by this instance.
+   */
+  void SetOutputType (DistributionCollector::OutputType_t outputType);
+
+  /**
+   * \return the processing mechanism used by this instance.
+   */
+  DistributionCollector::OutputType_t GetOutputType () const;
+
+  /**
+   * \param relativeAccuracy the relative accuracy of the quantiles, must be
+   *                         set before receiving any samples
+   */
+  void SetRelativeAccuracy (double relativeAccuracy);
+
+  /**
+   * \return the relative accuracy of the quantiles
+   */
+  double GetRelativeAccuracy () const;
+
+  /**
+   * \return number of samples received so far.
+   */
+  uint64_t GetCount () const;
+
+  /**
+   * \brief Estimate a quantile of the received samples.
+   * \param quantile the requested quantile, between 0 and 1
+   * \return estimated value of the quantile, or zero if no samples have
+   *         been received
+   */
+  double GetQuantile (double quantile) const;
+
+  /**
+   * \return number of sketch buckets currently in use.
+   */
+  uint32_t GetNumOfBins () const;
+
+  /**
+   * \brief Merge the samples summarized by another collector into this one.
+   * \param other the collector to be merged
+   *
+   * Both collectors must use the same relative accuracy.
+   */
+  void Merge (Ptr<const SatQuantileSketchCollector> other);
+
+  // TRACE SINKS
+
+  /**
+   * \brief Trace sink for receiving data from `double` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkDouble (double oldData, double newData);
+
+  /**
+   * \brief Trace sink for receiving data from `double` valued trace sources.
+   * \param data the new value.
+   */
+  void TraceSinkDouble1 (double data);
+
+  /**
+   * \brief Trace sink for receiving data from `uint32_t` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkUinteger32 (uint32_t oldData, uint32_t newData);
+
+  /**
+   * \brief Common callback signature for trace sources related to bins.
+   * \param binCenter the center value of the bin
+   * \param binValue the value of the bin, depending on the output type
+   */
+  typedef void (*BinCallback)(double binCenter, double binValue);
+
+  /**
+   * \brief Callback signature for the summary output.
+   * \param summary the summary of the received samples
+   */
+  typedef void (*StringCallback)(std::string summary);
+
+  /**
+   * \brief Callback signature for out-of-range warning.
+   * \param isWarning always true
+   */
+  typedef void (*WarningCallback)(bool isWarning);
+
+protected:
+  // inherited from Object base class
+  virtual void DoDispose ();
+
+private:
+  /**
+   * \brief Dense store of sketch bucket counters with a limited span of
+   *        bucket indices.
+   */
+  class BinStore
+  {
+  public:
+    BinStore ();
+
+    /**
+     * \brief Add to the counter of the given bucket. If the span of the
+     *        store would exceed the limit, the lowest buckets are collapsed.
+     * \param index bucket index
+     * \param count number of samples to add
+     * \param maxNumOfBins maximum span of the bucket indices
+     */
+    void Add (int32_t index, uint64_t count, uint32_t maxNumOfBins);
+
+    /// \return true if no samples have been stored
+    bool IsEmpty () const;
+
+    /// \return the lowest bucket index in use
+    int32_t GetMinIndex () const;
+
+    /// \return the highest bucket index in use
+    int32_t GetMaxIndex () const;
+
+    /**
+     * \param index bucket index
+     * \return counter of the bucket
+     */
+    uint64_t GetCount (int32_t index) const;
+
+    /// \return number of buckets in use
+    uint32_t GetNumOfBins () const;
+
+  private:
+    std::vector<uint64_t> m_counts;
+    int32_t m_minIndex;
+  };
+
+  /**
+   * \brief Add a single sample to the sketch.
+   * \param sample the sample value
+   */
+  void AddSample (double sample);
+
+  /**
+   * \param absValue absolute value of a sample, larger than zero threshold
+   * \return bucket index of the value
+   */
+  int32_t GetIndex (double absValue) const;
+
+  /**
+   * \param index bucket index
+   * \return the representative absolute value of the bucket
+   */
+  double GetBinValue (int32_t index) const;
+
+  /**
+   * \brief Collect all sketch buckets in ascending order of value.
+   * \param values receives the representative values of the buckets
+   * \param counts receives the counters of the buckets
+   */
+  void GetSortedBins (std::vector<double> &values, std::vector<uint64_t> &counts) const;
+
+  /// \return the summary of the samples as written to `OutputString`
+  std::string GetSummary () const;
+
+  // ATTRIBUTES
+
+  DistributionCollector::OutputType_t m_outputType;  ///< `OutputType` attribute.
+  double m_minValue;                                 ///< `MinValue` attribute.
+  double m_maxValue;                                 ///< `MaxValue` attribute.
+  double m_binLength;                                ///< `BinLength` attribute.
+  double m_relativeAccuracy;                         ///< `RelativeAccuracy` attribute.
+  uint32_t m_maxNumOfBins;                           ///< `MaxNumOfBins` attribute.
+
+  // SKETCH STATE
+
+  double m_logGamma;            ///< Logarithm of the bucket growth factor.
+  BinStore m_positiveBins;      ///< Buckets of positive samples.
+  BinStore m_negativeBins;      ///< Buckets of negative samples, by magnitude.
+  uint64_t m_zeroCount;         ///< Number of samples of (nearly) zero value.
+  uint64_t m_count;             ///< Total number of samples.
+  uint64_t m_numOfOutliers;     ///< Samples outside of the output range.
+  double m_sum;                 ///< Sum of the samples.
+  double m_sumSquared;          ///< Sum of the squared samples.
+  double m_min;                 ///< Smallest sample.
+  double m_max;                 ///< Largest sample.
+
+  // TRACE SOURCES
+
+  /// `Output` trace source.
+  TracedCallback<double, double> m_output;
+
+  /// `OutputString` trace source.
+  TracedCallback<std::string> m_outputString;
+
+  /// `Warning` trace source.
+  TracedCallback<bool> m_warning;
+
+}; // end of class SatQuantileSketchCollector
+
+
+} // end of namespace ns3
+
+
+#endif /* SATELLITE_QUANTILE_SKETCH_COLLECTOR_H */
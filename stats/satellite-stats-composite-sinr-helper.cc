@@ -23,7 +23,6 @@
 #include <ns3/enum.h>
 #include <ns3/string.h>
 #include <ns3/boolean.h>
-#include <ns3/object-vector.h>
 #include <ns3/callback.h>
 
 #include <ns3/node-container.h>
@@ -43,6 +42,7 @@
 #include <ns3/satellite-sinr-probe.h>
 #include <ns3/unit-conversion-collector.h>
 #include <ns3/distribution-collector.h>
+#include <ns3/satellite-quantile-sketch-collector.h>
 #include <ns3/scalar-collector.h>
 #include <ns3/multi-file-aggregator.h>
 #include <ns3/magister-gnuplot-aggregator.h>
@@ -116,18 +116,14 @@ SatStatsCompositeSinrHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("sinr_db")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("sinr_db"));
 
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::UnitConversionCollector");
         m_terminalCollectors.SetAttribute ("ConversionType",
                                            EnumValue (UnitConversionCollector::TRANSPARENT));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputTimeValue",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator, "OutputTimeValue");
         break;
       }
 
@@ -141,7 +137,7 @@ SatStatsCompositeSinrHelper::DoInstall ()
                                          "GeneralHeading", StringValue (GetDistributionHeading ("sinr_db")));
 
         // Setup collectors.
-        m_terminalCollectors.SetType ("ns3::DistributionCollector");
+        m_terminalCollectors.SetType (GetDistributionCollectorTypeName ());
         DistributionCollector::OutputType_t outputType
           = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
         if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_FILE)
@@ -219,7 +215,7 @@ SatStatsCompositeSinrHelper::DoInstall ()
         plotAggregator->Set2dDatasetDefaultStyle (Gnuplot2dDataset::LINES);
 
         // Setup collectors.
-        m_terminalCollectors.SetType ("ns3::DistributionCollector");
+        m_terminalCollectors.SetType (GetDistributionCollectorTypeName ());
         DistributionCollector::OutputType_t outputType
           = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
         if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_PLOT)
@@ -316,79 +312,77 @@ SatStatsFwdCompositeSinrHelper::DoInstallProbes ()
       NS_ASSERT (satPhy != 0);
       Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
       NS_ASSERT (satPhyRx != 0);
-      ObjectVectorValue carriers;
-      satPhyRx->GetAttribute ("RxCarrierList", carriers);
-      NS_LOG_DEBUG (this << " Node ID " << (*it)->GetId ()
-                         << " device #" << dev->GetIfIndex ()
-                         << " has " << carriers.GetN () << " RX carriers");
-
-      for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-           itCarrier != carriers.End (); ++itCarrier)
+      // Connect the object to the probe.
+      if (probe->ConnectByObject ("Sinr", satPhyRx))
         {
-          // Connect the object to the probe.
-          if (probe->ConnectByObject ("Sinr", itCarrier->second))
+          // Connect the probe to the right collector.
+          bool ret = false;
+          switch (GetOutputType ())
             {
-              // Connect the probe to the right collector.
-              bool ret = false;
-              switch (GetOutputType ())
-                {
-                case SatStatsHelper::OUTPUT_SCALAR_FILE:
-                case SatStatsHelper::OUTPUT_SCALAR_PLOT:
-                  ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
-                                                               "OutputSinr",
-                                                               identifier,
-                                                               &ScalarCollector::TraceSinkDouble);
-                  break;
+            case SatStatsHelper::OUTPUT_SCALAR_FILE:
+            case SatStatsHelper::OUTPUT_SCALAR_PLOT:
+              ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
+                                                           "OutputSinr",
+                                                           identifier,
+                                                           &ScalarCollector::TraceSinkDouble);
+              break;
+
+            case SatStatsHelper::OUTPUT_SCATTER_FILE:
+            case SatStatsHelper::OUTPUT_SCATTER_PLOT:
+              ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
+                                                           "OutputSinr",
+                                                           identifier,
+                                                           &UnitConversionCollector::TraceSinkDouble);
+              break;
 
-                case SatStatsHelper::OUTPUT_SCATTER_FILE:
-                case SatStatsHelper::OUTPUT_SCATTER_PLOT:
+            case SatStatsHelper::OUTPUT_HISTOGRAM_FILE:
+            case SatStatsHelper::OUTPUT_HISTOGRAM_PLOT:
+            case SatStatsHelper::OUTPUT_PDF_FILE:
+            case SatStatsHelper::OUTPUT_PDF_PLOT:
+            case SatStatsHelper::OUTPUT_CDF_FILE:
+            case SatStatsHelper::OUTPUT_CDF_PLOT:
+              if (IsSketchDistributionEnabled ())
+                {
                   ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
                                                                "OutputSinr",
                                                                identifier,
-                                                               &UnitConversionCollector::TraceSinkDouble);
-                  break;
-
-                case SatStatsHelper::OUTPUT_HISTOGRAM_FILE:
-                case SatStatsHelper::OUTPUT_HISTOGRAM_PLOT:
-                case SatStatsHelper::OUTPUT_PDF_FILE:
-                case SatStatsHelper::OUTPUT_PDF_PLOT:
-                case SatStatsHelper::OUTPUT_CDF_FILE:
-                case SatStatsHelper::OUTPUT_CDF_PLOT:
+                                                               &SatQuantileSketchCollector::TraceSinkDouble);
+                }
+              else
+                {
                   ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
                                                                "OutputSinr",
                                                                identifier,
                                                                &DistributionCollector::TraceSinkDouble);
-                  break;
-
-                default:
-                  NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
-                  break;
+                }
+              break;
 
-                } // end of `switch (GetOutputType ())`
+            default:
+              NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
+              break;
 
-              if (ret)
-                {
-                  NS_LOG_INFO (this << " created probe " << probeName.str ()
-                                    << ", connected to collector " << identifier);
-                  m_probes.push_back (probe->GetObject<Probe> ());
-                }
-              else
-                {
-                  NS_LOG_WARN (this << " unable to connect probe " << probeName.str ()
-                                    << " to collector " << identifier);
-                }
+            } // end of `switch (GetOutputType ())`
 
-            } // end of `if (probe->ConnectByObject ("Sinr", itCarrier->second))`
+          if (ret)
+            {
+              NS_LOG_INFO (this << " created probe " << probeName.str ()
+                                << ", connected to collector " << identifier);
+              m_probes.push_back (probe->GetObject<Probe> ());
+            }
           else
             {
-              NS_FATAL_ERROR ("Error connecting to Sinr trace source"
-                              << " of SatPhyRxCarrier"
-                              << " at node ID " << (*it)->GetId ()
-                              << " device #" << dev->GetIfIndex ()
-                              << " RX carrier #" << itCarrier->first);
+              NS_LOG_WARN (this << " unable to connect probe " << probeName.str ()
+                                << " to collector " << identifier);
             }
 
-        } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+        } // end of `if (probe->ConnectByObject ("Sinr", satPhyRx))`
+      else
+        {
+          NS_FATAL_ERROR ("Error connecting to Sinr trace source"
+                          << " of SatPhyRx"
+                          << " at node ID " << (*it)->GetId ()
+                          << " device #" << dev->GetIfIndex ());
+        }
 
     } // end of `for (it = uts.Begin(); it != uts.End (); ++it)`
 
@@ -453,33 +447,19 @@ SatStatsRtnCompositeSinrHelper::DoInstallProbes ()
           NS_ASSERT (satPhy != 0);
           Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
           NS_ASSERT (satPhyRx != 0);
-          ObjectVectorValue carriers;
-          satPhyRx->GetAttribute ("RxCarrierList", carriers);
-          NS_LOG_DEBUG (this << " Node ID " << (*it)->GetId ()
-                             << " device #" << (*itDev)->GetIfIndex ()
-                             << " has " << carriers.GetN () << " RX carriers");
-
-          for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-               itCarrier != carriers.End (); ++itCarrier)
+          if (satPhyRx->TraceConnectWithoutContext ("Sinr", callback))
             {
-              if (itCarrier->second->TraceConnectWithoutContext ("Sinr",
-                                                                 callback))
-                {
-                  NS_LOG_INFO (this << " successfully connected with node ID "
-                                    << (*it)->GetId ()
-                                    << " device #" << (*itDev)->GetIfIndex ()
-                                    << " RX carrier #" << itCarrier->first);
-                }
-              else
-                {
-                  NS_FATAL_ERROR ("Error connecting to Sinr trace source"
-                                  << " of SatPhyRxCarrier"
-                                  << " at node ID " << (*it)->GetId ()
-                                  << " device #" << (*itDev)->GetIfIndex ()
-                                  << " RX carrier #" << itCarrier->first);
-                }
-
-            } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+              NS_LOG_INFO (this << " successfully connected with node ID "
+                                << (*it)->GetId ()
+                                << " device #" << (*itDev)->GetIfIndex ());
+            }
+          else
+            {
+              NS_FATAL_ERROR ("Error connecting to Sinr trace source"
+                              << " of SatPhyRx"
+                              << " at node ID " << (*it)->GetId ()
+                              << " device #" << (*itDev)->GetIfIndex ());
+            }
 
         } // end of `for (NetDeviceContainer::Iterator itDev = devs)`
 
@@ -544,9 +524,7 @@ SatStatsRtnCompositeSinrHelper::SinrCallback (double sinrDb, const Address &from
             case SatStatsHelper::OUTPUT_CDF_FILE:
             case SatStatsHelper::OUTPUT_CDF_PLOT:
               {
-                Ptr<DistributionCollector> c = collector->GetObject<DistributionCollector> ();
-                NS_ASSERT (c != 0);
-                c->TraceSinkDouble (0.0, sinrDb);
+                PassSampleToDistributionCollector (collector, sinrDb);
                 break;
               }
 
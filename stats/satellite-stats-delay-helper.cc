@@ -36,7 +36,6 @@
 #include <ns3/satellite-mac.h>
 #include <ns3/satellite-phy.h>
 
-#include <ns3/satellite-time-tag.h>
 #include <ns3/satellite-helper.h>
 #include <ns3/satellite-id-mapper.h>
 #include <ns3/singleton.h>
@@ -46,6 +45,7 @@
 #include <ns3/application-delay-probe.h>
 #include <ns3/unit-conversion-collector.h>
 #include <ns3/distribution-collector.h>
+#include <ns3/satellite-quantile-sketch-collector.h>
 #include <ns3/scalar-collector.h>
 #include <ns3/multi-file-aggregator.h>
 #include <ns3/magister-gnuplot-aggregator.h>
@@ -143,18 +143,14 @@ SatStatsDelayHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("delay_sec")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("delay_sec"));
 
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::UnitConversionCollector");
         m_terminalCollectors.SetAttribute ("ConversionType",
                                            EnumValue (UnitConversionCollector::TRANSPARENT));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputTimeValue",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator, "OutputTimeValue");
         break;
       }
 
@@ -221,7 +217,7 @@ SatStatsDelayHelper::DoInstall ()
                                              "GeneralHeading", StringValue (GetDistributionHeading ("delay_sec")));
 
             // Setup collectors.
-            m_terminalCollectors.SetType ("ns3::DistributionCollector");
+            m_terminalCollectors.SetType (GetDistributionCollectorTypeName ());
             DistributionCollector::OutputType_t outputType
               = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
             if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_FILE)
@@ -355,7 +351,7 @@ SatStatsDelayHelper::DoInstall ()
             plotAggregator->Set2dDatasetDefaultStyle (Gnuplot2dDataset::LINES);
 
             // Setup collectors.
-            m_terminalCollectors.SetType ("ns3::DistributionCollector");
+            m_terminalCollectors.SetType (GetDistributionCollectorTypeName ());
             DistributionCollector::OutputType_t outputType
               = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
             if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_PLOT)
@@ -495,10 +491,20 @@ SatStatsDelayHelper::ConnectProbeToCollector (Ptr<Probe> probe,
         }
       else
         {
-          ret = m_terminalCollectors.ConnectWithProbe (probe,
-                                                       "OutputSeconds",
-                                                       identifier,
-                                                       &DistributionCollector::TraceSinkDouble);
+          if (IsSketchDistributionEnabled ())
+            {
+              ret = m_terminalCollectors.ConnectWithProbe (probe,
+                                                           "OutputSeconds",
+                                                           identifier,
+                                                           &SatQuantileSketchCollector::TraceSinkDouble);
+            }
+          else
+            {
+              ret = m_terminalCollectors.ConnectWithProbe (probe,
+                                                           "OutputSeconds",
+                                                           identifier,
+                                                           &DistributionCollector::TraceSinkDouble);
+            }
         }
       break;
 
@@ -565,9 +571,7 @@ SatStatsDelayHelper::PassSampleToCollector (const Time &delay, uint32_t identifi
         }
       else
         {
-          Ptr<DistributionCollector> c = collector->GetObject<DistributionCollector> ();
-          NS_ASSERT (c != 0);
-          c->TraceSinkDouble (0.0, delay.GetSeconds ());
+          PassSampleToDistributionCollector (collector, delay.GetSeconds ());
         }
       break;
 
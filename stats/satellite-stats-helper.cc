@@ -31,11 +31,17 @@
 #include <ns3/node-container.h>
 #include <ns3/collector-map.h>
 #include <ns3/data-collection-object.h>
+#include <ns3/distribution-collector.h>
+#include <ns3/satellite-quantile-sketch-collector.h>
+#include <ns3/satellite-binary-file-aggregator.h>
+#include <ns3/multi-file-aggregator.h>
+#include <ns3/callback.h>
 #include <ns3/log.h>
 #include <ns3/type-id.h>
 #include <ns3/object-factory.h>
 #include <ns3/string.h>
 #include <ns3/enum.h>
+#include <ns3/boolean.h>
 #include <sstream>
 
 NS_LOG_COMPONENT_DEFINE ("SatStatsHelper");
@@ -112,6 +118,8 @@ SatStatsHelper::SatStatsHelper (Ptr<const SatHelper> satHelper)
     m_identifierType (SatStatsHelper::IDENTIFIER_GLOBAL),
     m_outputType (SatStatsHelper::OUTPUT_SCATTER_FILE),
     m_isInstalled (false),
+    m_sketchDistributionEnabled (false),
+    m_binaryOutputEnabled (false),
     m_satHelper (satHelper)
 {
   NS_LOG_FUNCTION (this << satHelper);
@@ -160,6 +168,23 @@ SatStatsHelper::GetTypeId ()
                                     SatStatsHelper::OUTPUT_HISTOGRAM_PLOT, "HISTOGRAM_PLOT",
                                     SatStatsHelper::OUTPUT_PDF_PLOT,       "PDF_PLOT",
                                     SatStatsHelper::OUTPUT_CDF_PLOT,       "CDF_PLOT"))
+    .AddAttribute ("SketchDistributionEnabled",
+                   "Produce histogram, PDF, and CDF outputs using bounded-memory "
+                   "quantile sketches (SatQuantileSketchCollector) instead of "
+                   "DistributionCollector. Makes per-UT distributions affordable "
+                   "in scenarios with a large number of UTs.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatStatsHelper::m_sketchDistributionEnabled),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BinaryOutputEnabled",
+                   "Write scatter file outputs as raw records into a single "
+                   "binary file per statistics (SatBinaryFileAggregator), "
+                   "instead of formatting them into text files during the "
+                   "simulation. Text output is produced offline by "
+                   "SatBinaryFileConverter.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatStatsHelper::m_binaryOutputEnabled),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -257,6 +282,20 @@ SatStatsHelper::GetOutputType () const
 }
 
 
+bool
+SatStatsHelper::IsSketchDistributionEnabled () const
+{
+  return m_sketchDistributionEnabled;
+}
+
+
+bool
+SatStatsHelper::IsBinaryOutputEnabled () const
+{
+  return m_binaryOutputEnabled;
+}
+
+
 bool
 SatStatsHelper::IsInstalled () const
 {
@@ -293,6 +332,129 @@ SatStatsHelper::CreateAggregator (std::string aggregatorTypeId,
 }
 
 
+Ptr<DataCollectionObject>
+SatStatsHelper::CreateScatterFileAggregator (std::string generalHeading)
+{
+  NS_LOG_FUNCTION (this << generalHeading);
+
+  if (m_binaryOutputEnabled)
+    {
+      return CreateAggregator ("ns3::SatBinaryFileAggregator",
+                               "OutputFileName", StringValue (GetOutputFileName ()),
+                               "GeneralHeading", StringValue (generalHeading));
+    }
+
+  return CreateAggregator ("ns3::MultiFileAggregator",
+                           "OutputFileName", StringValue (GetOutputFileName ()),
+                           "GeneralHeading", StringValue (generalHeading));
+}
+
+
+void
+SatStatsHelper::ConnectScatterFileAggregator (Ptr<DataCollectionObject> collector,
+                                              Ptr<DataCollectionObject> aggregator,
+                                              std::string outputTraceSource,
+                                              std::string headingTraceSource) const
+{
+  NS_LOG_FUNCTION (this << collector->GetName () << outputTraceSource << headingTraceSource);
+
+  const std::string context = collector->GetName ();
+  bool ret = true;
+
+  if (m_binaryOutputEnabled)
+    {
+      Ptr<SatBinaryFileAggregator> a = aggregator->GetObject<SatBinaryFileAggregator> ();
+      NS_ASSERT (a != 0);
+      ret = collector->TraceConnect (outputTraceSource, context,
+                                     MakeCallback (&SatBinaryFileAggregator::Write2d, a));
+      if (!headingTraceSource.empty ())
+        {
+          ret = ret && collector->TraceConnect (headingTraceSource, context,
+                                                MakeCallback (&SatBinaryFileAggregator::AddContextHeading, a));
+        }
+    }
+  else
+    {
+      Ptr<MultiFileAggregator> a = aggregator->GetObject<MultiFileAggregator> ();
+      NS_ASSERT (a != 0);
+      ret = collector->TraceConnect (outputTraceSource, context,
+                                     MakeCallback (&MultiFileAggregator::Write2d, a));
+      if (!headingTraceSource.empty ())
+        {
+          ret = ret && collector->TraceConnect (headingTraceSource, context,
+                                                MakeCallback (&MultiFileAggregator::AddContextHeading, a));
+        }
+    }
+
+  if (!ret)
+    {
+      NS_LOG_WARN (this << " unable to connect collector " << context
+                        << " to the scatter file aggregator");
+    }
+}
+
+
+void
+SatStatsHelper::ConnectScatterFileAggregator (CollectorMap &collectorMap,
+                                              Ptr<DataCollectionObject> aggregator,
+                                              std::string outputTraceSource,
+                                              std::string headingTraceSource) const
+{
+  NS_LOG_FUNCTION (this << outputTraceSource << headingTraceSource);
+
+  for (CollectorMap::Iterator it = collectorMap.Begin ();
+       it != collectorMap.End (); ++it)
+    {
+      ConnectScatterFileAggregator (it->second, aggregator,
+                                    outputTraceSource, headingTraceSource);
+    }
+}
+
+
+std::string
+SatStatsHelper::GetDistributionCollectorTypeName () const
+{
+  if (m_sketchDistributionEnabled)
+    {
+      return "ns3::SatQuantileSketchCollector";
+    }
+
+  return "ns3::DistributionCollector";
+}
+
+
+Ptr<DataCollectionObject>
+SatStatsHelper::CreateDistributionCollector (DistributionCollector::OutputType_t outputType) const
+{
+  NS_LOG_FUNCTION (this << outputType);
+
+  ObjectFactory factory;
+  factory.SetTypeId (TypeId::LookupByName (GetDistributionCollectorTypeName ()));
+  factory.Set ("OutputType", EnumValue (outputType));
+  return factory.Create ()->GetObject<DataCollectionObject> ();
+}
+
+
+void // static
+SatStatsHelper::PassSampleToDistributionCollector (Ptr<DataCollectionObject> collector,
+                                                   double sample)
+{
+  NS_ASSERT (collector != 0);
+
+  Ptr<DistributionCollector> c = collector->GetObject<DistributionCollector> ();
+  if (c != 0)
+    {
+      c->TraceSinkDouble (0.0, sample);
+    }
+  else
+    {
+      Ptr<SatQuantileSketchCollector> s = collector->GetObject<SatQuantileSketchCollector> ();
+      NS_ASSERT (s != 0);
+      s->TraceSinkDouble (0.0, sample);
+    }
+}
+
+
 uint32_t
 SatStatsHelper::CreateCollectorPerIdentifier (CollectorMap &collectorMap) const
 {
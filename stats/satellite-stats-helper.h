@@ -26,6 +26,7 @@
 #include <ns3/object.h>
 #include <ns3/attribute.h>
 #include <ns3/net-device-container.h>
+#include <ns3/distribution-collector.h>
 #include <map>
 
 
@@ -198,6 +199,20 @@ public:
    */
   OutputType_t GetOutputType () const;
 
+  /**
+   * \return true if distribution outputs (histogram, PDF, and CDF) are
+   *         produced by bounded-memory SatQuantileSketchCollector instances
+   *         instead of DistributionCollector instances.
+   */
+  bool IsSketchDistributionEnabled () const;
+
+  /**
+   * \return true if scatter file outputs are written as raw records into a
+   *         single binary file by SatBinaryFileAggregator, instead of text
+   *         files by MultiFileAggregator.
+   */
+  bool IsBinaryOutputEnabled () const;
+
   /**
    * \return true if Install() has been invoked, otherwise false.
    */
@@ -298,6 +313,70 @@ protected:
    */
   uint32_t CreateCollectorPerIdentifier (CollectorMap &collectorMap) const;
 
+  /**
+   * \brief Create the aggregator for scatter file output, i.e. either
+   *        MultiFileAggregator or SatBinaryFileAggregator, depending on the
+   *        `BinaryOutputEnabled` attribute.
+   * \param generalHeading the heading of the output
+   * \return a pointer to the created aggregator.
+   */
+  Ptr<DataCollectionObject> CreateScatterFileAggregator (std::string generalHeading);
+
+  /**
+   * \brief Connect a collector to an aggregator created by
+   *        CreateScatterFileAggregator().
+   * \param collector the collector.
+   * \param aggregator the aggregator.
+   * \param outputTraceSource name of the collector's trace source producing
+   *        (time, value) pairs.
+   * \param headingTraceSource name of the collector's trace source producing
+   *        the context heading, or empty if not used.
+   */
+  void ConnectScatterFileAggregator (Ptr<DataCollectionObject> collector,
+                                     Ptr<DataCollectionObject> aggregator,
+                                     std::string outputTraceSource,
+                                     std::string headingTraceSource = "") const;
+
+  /**
+   * \brief Connect every collector of a CollectorMap to an aggregator
+   *        created by CreateScatterFileAggregator().
+   * \param collectorMap the collectors.
+   * \param aggregator the aggregator.
+   * \param outputTraceSource name of the collectors' trace source producing
+   *        (time, value) pairs.
+   * \param headingTraceSource name of the collectors' trace source producing
+   *        the context heading, or empty if not used.
+   */
+  void ConnectScatterFileAggregator (CollectorMap &collectorMap,
+                                     Ptr<DataCollectionObject> aggregator,
+                                     std::string outputTraceSource,
+                                     std::string headingTraceSource = "") const;
+
+  /**
+   * \return the type name of the collector to be used for distribution
+   *         outputs, i.e. either `ns3::DistributionCollector` or
+   *         `ns3::SatQuantileSketchCollector`, depending on the
+   *         `SketchDistributionEnabled` attribute.
+   */
+  std::string GetDistributionCollectorTypeName () const;
+
+  /**
+   * \brief Create a single collector for distribution outputs.
+   * \param outputType the processing mechanism of the collector.
+   * \return a pointer to the created collector, of the type given by
+   *         GetDistributionCollectorTypeName().
+   */
+  Ptr<DataCollectionObject> CreateDistributionCollector (DistributionCollector::OutputType_t outputType) const;
+
+  /**
+   * \brief Pass a sample to a collector created for distribution outputs,
+   *        regardless of its actual type.
+   * \param collector the collector.
+   * \param sample the sample value.
+   */
+  static void PassSampleToDistributionCollector (Ptr<DataCollectionObject> collector,
+                                                 double sample);
+
   // IDENTIFIER RELATED METHODS ///////////////////////////////////////////////
 
   /**
@@ -365,6 +444,8 @@ private:
   IdentifierType_t      m_identifierType;  ///<
   OutputType_t          m_outputType;      ///<
   bool                  m_isInstalled;     ///<
+  bool                  m_sketchDistributionEnabled; ///<
+  bool                  m_binaryOutputEnabled; ///<
   Ptr<const SatHelper>  m_satHelper;       ///<
 
 }; // end of class SatStatsHelper
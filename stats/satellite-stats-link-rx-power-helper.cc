@@ -24,7 +24,6 @@
 #include <ns3/string.h>
 #include <ns3/boolean.h>
 #include <ns3/object-map.h>
-#include <ns3/object-vector.h>
 
 #include <ns3/node.h>
 #include <ns3/satellite-geo-net-device.h>
@@ -106,9 +105,7 @@ SatStatsLinkRxPowerHelper::RxPowerCallback (double rxPowerDb)
     case SatStatsHelper::OUTPUT_CDF_FILE:
     case SatStatsHelper::OUTPUT_CDF_PLOT:
       {
-        Ptr<DistributionCollector> c = m_collector->GetObject<DistributionCollector> ();
-        NS_ASSERT (c != 0);
-        c->TraceSinkDouble (0.0, rxPowerDb);
+        PassSampleToDistributionCollector (m_collector, rxPowerDb);
         break;
       }
 
@@ -165,18 +162,13 @@ SatStatsLinkRxPowerHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("rx_power_db")));
-        Ptr<MultiFileAggregator> aggregator = m_aggregator->GetObject<MultiFileAggregator> ();
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("rx_power_db"));
 
         // Setup collector.
         Ptr<UnitConversionCollector> collector = CreateObject<UnitConversionCollector> ();
         collector->SetName ("0");
         collector->SetConversionType (UnitConversionCollector::TRANSPARENT);
-        collector->TraceConnect ("OutputTimeValue", "0",
-                                 MakeCallback (&MultiFileAggregator::Write2d,
-                                               aggregator));
+        ConnectScatterFileAggregator (collector, m_aggregator, "OutputTimeValue");
         m_collector = collector->GetObject<DataCollectionObject> ();
 
         break;
@@ -193,20 +185,18 @@ SatStatsLinkRxPowerHelper::DoInstall ()
         Ptr<MultiFileAggregator> aggregator = m_aggregator->GetObject<MultiFileAggregator> ();
 
         // Setup collector.
-        Ptr<DistributionCollector> collector = CreateObject<DistributionCollector> ();
-        collector->SetName ("0");
-        if (GetOutputType () == SatStatsHelper::OUTPUT_HISTOGRAM_FILE)
+        DistributionCollector::OutputType_t outputType
+          = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
+        if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_FILE)
           {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_HISTOGRAM);
-          }
-        else if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_FILE)
-          {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_PROBABILITY);
+            outputType = DistributionCollector::OUTPUT_TYPE_PROBABILITY;
           }
         else if (GetOutputType () == SatStatsHelper::OUTPUT_CDF_FILE)
           {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_CUMULATIVE);
+            outputType = DistributionCollector::OUTPUT_TYPE_CUMULATIVE;
           }
+        Ptr<DataCollectionObject> collector = CreateDistributionCollector (outputType);
+        collector->SetName ("0");
         collector->TraceConnect ("Output", "0",
                                  MakeCallback (&MultiFileAggregator::Write2d,
                                                aggregator));
@@ -271,20 +261,18 @@ SatStatsLinkRxPowerHelper::DoInstall ()
         plotAggregator->Set2dDatasetDefaultStyle (Gnuplot2dDataset::LINES);
 
         // Setup collector.
-        Ptr<DistributionCollector> collector = CreateObject<DistributionCollector> ();
-        collector->SetName ("0");
-        if (GetOutputType () == SatStatsHelper::OUTPUT_HISTOGRAM_PLOT)
+        DistributionCollector::OutputType_t outputType
+          = DistributionCollector::OUTPUT_TYPE_HISTOGRAM;
+        if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_PLOT)
           {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_HISTOGRAM);
-          }
-        else if (GetOutputType () == SatStatsHelper::OUTPUT_PDF_PLOT)
-          {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_PROBABILITY);
+            outputType = DistributionCollector::OUTPUT_TYPE_PROBABILITY;
           }
         else if (GetOutputType () == SatStatsHelper::OUTPUT_CDF_PLOT)
           {
-            collector->SetOutputType (DistributionCollector::OUTPUT_TYPE_CUMULATIVE);
+            outputType = DistributionCollector::OUTPUT_TYPE_CUMULATIVE;
           }
+        Ptr<DataCollectionObject> collector = CreateDistributionCollector (outputType);
+        collector->SetName ("0");
         collector->TraceConnect ("Output", "0",
                                  MakeCallback (&MagisterGnuplotAggregator::Write2d,
                                                plotAggregator));
@@ -362,27 +350,14 @@ SatStatsFwdFeederLinkRxPowerHelper::DoInstallProbes ()
       NS_ASSERT (satPhy != 0);
       Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
       NS_ASSERT (satPhyRx != 0);
-      ObjectVectorValue carriers;
-      satPhyRx->GetAttribute ("RxCarrierList", carriers);
-      NS_LOG_DEBUG (this << " PHY #" << itPhy->first
-                         << " has " << carriers.GetN () << " RX carrier(s)");
-
-      for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-           itCarrier != carriers.End (); ++itCarrier)
+      if (!satPhyRx->TraceConnectWithoutContext ("RxPowerTrace", GetTraceSinkCallback ()))
         {
-          //NS_ASSERT (itCarrier->second->m_channelType == SatEnums::FORWARD_FEEDER_CH)
-          if (!itCarrier->second->TraceConnectWithoutContext ("RxPowerTrace",
-                                                              GetTraceSinkCallback ()))
-            {
-              NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
-                              << " of SatPhyRxCarrier"
-                              << " at GeoSat node ID " << geoSat->GetId ()
-                              << " device #" << dev->GetIfIndex ()
-                              << " PHY #" << itPhy->first
-                              << " RX carrier #" << itCarrier->first);
-            }
-
-        } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+          NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
+                          << " of SatPhyRx"
+                          << " at GeoSat node ID " << geoSat->GetId ()
+                          << " device #" << dev->GetIfIndex ()
+                          << " PHY #" << itPhy->first);
+        }
 
     } // end of `for (ObjectMapValue::Iterator itPhy = phys)`
 
@@ -435,27 +410,13 @@ SatStatsFwdUserLinkRxPowerHelper::DoInstallProbes ()
       NS_ASSERT (satPhy != 0);
       Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
       NS_ASSERT (satPhyRx != 0);
-      ObjectVectorValue carriers;
-      satPhyRx->GetAttribute ("RxCarrierList", carriers);
-      NS_LOG_DEBUG (this << " Node ID " << (*it)->GetId ()
-                         << " device #" << dev->GetIfIndex ()
-                         << " has " << carriers.GetN () << " RX carriers");
-
-      for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-           itCarrier != carriers.End (); ++itCarrier)
+      if (!satPhyRx->TraceConnectWithoutContext ("RxPowerTrace", GetTraceSinkCallback ()))
         {
-          //NS_ASSERT (itCarrier->second->m_channelType == SatEnums::FORWARD_USER_CH)
-          if (!itCarrier->second->TraceConnectWithoutContext ("RxPowerTrace",
-                                                              GetTraceSinkCallback ()))
-            {
-              NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
-                              << " of SatPhyRxCarrier"
-                              << " at node ID " << (*it)->GetId ()
-                              << " device #" << dev->GetIfIndex ()
-                              << " RX carrier #" << itCarrier->first);
-            }
-
-        } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+          NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
+                          << " of SatPhyRx"
+                          << " at node ID " << (*it)->GetId ()
+                          << " device #" << dev->GetIfIndex ());
+        }
 
     } // end of `for (it = uts.Begin(); it != uts.End (); ++it)`
 
@@ -508,27 +469,13 @@ SatStatsRtnFeederLinkRxPowerHelper::DoInstallProbes ()
           NS_ASSERT (satPhy != 0);
           Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
           NS_ASSERT (satPhyRx != 0);
-          ObjectVectorValue carriers;
-          satPhyRx->GetAttribute ("RxCarrierList", carriers);
-          NS_LOG_DEBUG (this << " Node ID " << (*it)->GetId ()
-                             << " device #" << (*itDev)->GetIfIndex ()
-                             << " has " << carriers.GetN () << " RX carriers");
-
-          for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-               itCarrier != carriers.End (); ++itCarrier)
+          if (!satPhyRx->TraceConnectWithoutContext ("RxPowerTrace", GetTraceSinkCallback ()))
             {
-              //NS_ASSERT (itCarrier->second->m_channelType == SatEnums::RETURN_FEEDER_CH)
-              if (!itCarrier->second->TraceConnectWithoutContext ("RxPowerTrace",
-                                                                  GetTraceSinkCallback ()))
-                {
-                  NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
-                                  << " of SatPhyRxCarrier"
-                                  << " at node ID " << (*it)->GetId ()
-                                  << " device #" << (*itDev)->GetIfIndex ()
-                                  << " RX carrier #" << itCarrier->first);
-                }
-
-            } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+              NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
+                              << " of SatPhyRx"
+                              << " at node ID " << (*it)->GetId ()
+                              << " device #" << (*itDev)->GetIfIndex ());
+            }
 
         } // end of `for (it = gws.Begin(); it != gws.End (); ++it)`
 
@@ -587,27 +534,14 @@ SatStatsRtnUserLinkRxPowerHelper::DoInstallProbes ()
       NS_ASSERT (satPhy != 0);
       Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
       NS_ASSERT (satPhyRx != 0);
-      ObjectVectorValue carriers;
-      satPhyRx->GetAttribute ("RxCarrierList", carriers);
-      NS_LOG_DEBUG (this << " PHY #" << itPhy->first
-                         << " has " << carriers.GetN () << " RX carrier(s)");
-
-      for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-           itCarrier != carriers.End (); ++itCarrier)
+      if (!satPhyRx->TraceConnectWithoutContext ("RxPowerTrace", GetTraceSinkCallback ()))
         {
-          //NS_ASSERT (itCarrier->second->m_channelType == SatEnums::RETURN_USER_CH)
-          if (!itCarrier->second->TraceConnectWithoutContext ("RxPowerTrace",
-                                                              GetTraceSinkCallback ()))
-            {
-              NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
-                              << " of SatPhyRxCarrier"
-                              << " at GeoSat node ID " << geoSat->GetId ()
-                              << " device #" << dev->GetIfIndex ()
-                              << " PHY #" << itPhy->first
-                              << " RX carrier #" << itCarrier->first);
-            }
-
-        } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+          NS_FATAL_ERROR ("Error connecting to RxPowerTrace trace source"
+                          << " of SatPhyRx"
+                          << " at GeoSat node ID " << geoSat->GetId ()
+                          << " device #" << dev->GetIfIndex ()
+                          << " PHY #" << itPhy->first);
+        }
 
     } // end of `for (ObjectMapValue::Iterator itPhy = phys)`
 
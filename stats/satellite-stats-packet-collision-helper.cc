@@ -23,7 +23,6 @@
 #include <ns3/enum.h>
 #include <ns3/string.h>
 #include <ns3/boolean.h>
-#include <ns3/object-vector.h>
 #include <ns3/callback.h>
 
 #include <ns3/node-container.h>
@@ -130,9 +129,7 @@ SatStatsPacketCollisionHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("collision_rate")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("collision_rate"));
 
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::IntervalRateCollector");
@@ -141,12 +138,8 @@ SatStatsPacketCollisionHelper::DoInstall ()
         m_terminalCollectors.SetAttribute ("OutputType",
                                            EnumValue (IntervalRateCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputWithTime",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
-        m_terminalCollectors.ConnectToAggregator ("OutputString",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::AddContextHeading);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator,
+                                      "OutputWithTime", "OutputString");
         break;
       }
 
@@ -232,38 +225,22 @@ SatStatsPacketCollisionHelper::DoInstall ()
           NS_ASSERT (satPhy != 0);
           Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
           NS_ASSERT (satPhyRx != 0);
-          ObjectVectorValue carriers;
-          satPhyRx->GetAttribute ("RxCarrierList", carriers);
-          NS_LOG_DEBUG (this << " Node ID " << (*it)->GetId ()
-                             << " device #" << (*itDev)->GetIfIndex ()
-                             << " has " << carriers.GetN () << " RX carriers");
-
-          for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-               itCarrier != carriers.End (); ++itCarrier)
+          const bool ret = satPhyRx->TraceConnectWithoutContext (
+              GetTraceSourceName (), callback);
+          if (ret)
+            {
+              NS_LOG_INFO (this << " successfully connected with node ID "
+                                << (*it)->GetId ()
+                                << " device #" << (*itDev)->GetIfIndex ());
+            }
+          else
             {
-          		SatPhyRxCarrier::CarrierType ct = DynamicCast<SatPhyRxCarrier> (itCarrier->second)->GetCarrierType ();
-          		if (ct != GetValidCarrierType ()) continue;
-
-              const bool ret = itCarrier->second->TraceConnectWithoutContext (
-                  GetTraceSourceName (), callback);
-              if (ret)
-                {
-                  NS_LOG_INFO (this << " successfully connected with node ID "
-                                    << (*it)->GetId ()
-                                    << " device #" << (*itDev)->GetIfIndex ()
-                                    << " RX carrier #" << itCarrier->first);
-                }
-              else
-                {
-                  NS_FATAL_ERROR ("Error connecting to "
-                                  << GetTraceSourceName () << " trace source"
-                                  << " of SatPhyRxCarrier"
-                                  << " at node ID " << (*it)->GetId ()
-                                  << " device #" << (*itDev)->GetIfIndex ()
-                                  << " RX carrier #" << itCarrier->first);
-                }
-
-            } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+              NS_FATAL_ERROR ("Error connecting to "
+                              << GetTraceSourceName () << " trace source"
+                              << " of SatPhyRx"
+                              << " at node ID " << (*it)->GetId ()
+                              << " device #" << (*itDev)->GetIfIndex ());
+            }
 
         } // end of `for (NetDeviceContainer::Iterator itDev = devs)`
 
@@ -369,7 +346,6 @@ SatStatsSlottedAlohaPacketCollisionHelper::SatStatsSlottedAlohaPacketCollisionHe
 {
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("SlottedAlohaRxCollision");
-  SetValidCarrierType (SatPhyRxCarrier::RA_SLOTTED_ALOHA);
 }
 
 
@@ -398,7 +374,6 @@ SatStatsCrdsaPacketCollisionHelper::SatStatsCrdsaPacketCollisionHelper (Ptr<cons
 {
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("CrdsaReplicaRx");
-  SetValidCarrierType (SatPhyRxCarrier::RA_CRDSA);
 }
 
 
@@ -23,7 +23,6 @@
 #define SATELLITE_STATS_PACKET_COLLISION_HELPER_H
 
 #include <ns3/satellite-stats-helper.h>
-#include <ns3/satellite-phy-rx-carrier.h>
 #include <ns3/ptr.h>
 #include <ns3/address.h>
 #include <ns3/collector-map.h>
@@ -77,12 +76,6 @@ public:
    */
   std::string GetTraceSourceName () const;
 
-  /**
-   * \brief Get the valid carrier type
-   * \return the valid carrier type
-   */
-  inline SatPhyRxCarrier::CarrierType GetValidCarrierType () const { return m_carrierType; };
-
 protected:
   // inherited from SatStatsHelper base class
   void DoInstall ();
@@ -92,12 +85,6 @@ protected:
    */
   void SetTraceSourceName (std::string traceSourceName);
 
-  /**
-   * \brief Set valid carrier type for this statistics helper type.
-   * \param carrierType
-   */
-  inline void SetValidCarrierType (SatPhyRxCarrier::CarrierType carrierType) { m_carrierType = carrierType; };
-
 private:
   /**
    * \brief Save the address and the proper identifier from the given UT node.
@@ -119,8 +106,6 @@ private:
 
   std::string m_traceSourceName;
 
-  SatPhyRxCarrier::CarrierType m_carrierType;
-
 }; // end of class SatStatsPacketCollisionHelper
 
 
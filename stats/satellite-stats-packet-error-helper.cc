@@ -23,7 +23,6 @@
 #include <ns3/enum.h>
 #include <ns3/string.h>
 #include <ns3/boolean.h>
-#include <ns3/object-vector.h>
 #include <ns3/callback.h>
 
 #include <ns3/node-container.h>
@@ -148,9 +147,7 @@ SatStatsPacketErrorHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("error_rate")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("error_rate"));
 
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::IntervalRateCollector");
@@ -159,12 +156,8 @@ SatStatsPacketErrorHelper::DoInstall ()
         m_terminalCollectors.SetAttribute ("OutputType",
                                            EnumValue (IntervalRateCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputWithTime",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
-        m_terminalCollectors.ConnectToAggregator ("OutputString",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::AddContextHeading);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator,
+                                      "OutputWithTime", "OutputString");
         break;
       }
 
@@ -370,37 +363,22 @@ SatStatsPacketErrorHelper::InstallProbeOnGw (Ptr<Node> gwNode)
       NS_ASSERT (satPhy != 0);
       Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
       NS_ASSERT (satPhyRx != 0);
-      ObjectVectorValue carriers;
-      satPhyRx->GetAttribute ("RxCarrierList", carriers);
-      NS_LOG_DEBUG (this << " Node ID " << gwNode->GetId ()
-                         << " device #" << (*itDev)->GetIfIndex ()
-                         << " has " << carriers.GetN () << " RX carriers");
-
-      for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-           itCarrier != carriers.End (); ++itCarrier)
+      const bool ret = satPhyRx->TraceConnectWithoutContext (
+          GetTraceSourceName (), callback);
+      if (ret)
         {
-					if (DynamicCast<SatPhyRxCarrier> (itCarrier->second)->GetCarrierType () != GetValidCarrierType ())
-						continue;
-          const bool ret = itCarrier->second->TraceConnectWithoutContext (
-              GetTraceSourceName (), callback);
-          if (ret)
-            {
-              NS_LOG_INFO (this << " successfully connected with node ID "
-                                << gwNode->GetId ()
-                                << " device #" << (*itDev)->GetIfIndex ()
-                                << " RX carrier #" << itCarrier->first);
-            }
-          else
-            {
-              NS_FATAL_ERROR ("Error connecting to "
-                              << GetTraceSourceName () << " trace source"
-                              << " of SatPhyRxCarrier"
-                              << " at node ID " << gwNode->GetId ()
-                              << " device #" << (*itDev)->GetIfIndex ()
-                              << " RX carrier #" << itCarrier->first);
-            }
-
-        } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+          NS_LOG_INFO (this << " successfully connected with node ID "
+                            << gwNode->GetId ()
+                            << " device #" << (*itDev)->GetIfIndex ());
+        }
+      else
+        {
+          NS_FATAL_ERROR ("Error connecting to "
+                          << GetTraceSourceName () << " trace source"
+                          << " of SatPhyRx"
+                          << " at node ID " << gwNode->GetId ()
+                          << " device #" << (*itDev)->GetIfIndex ());
+        }
 
     } // end of `for (NetDeviceContainer::Iterator itDev = devs)`
 
@@ -430,70 +408,56 @@ SatStatsPacketErrorHelper::InstallProbeOnUt (Ptr<Node> utNode)
   NS_ASSERT (satPhy != 0);
   Ptr<SatPhyRx> satPhyRx = satPhy->GetPhyRx ();
   NS_ASSERT (satPhyRx != 0);
-  ObjectVectorValue carriers;
-  satPhyRx->GetAttribute ("RxCarrierList", carriers);
-  NS_LOG_DEBUG (this << " Node ID " << utNode->GetId ()
-                     << " device #" << dev->GetIfIndex ()
-                     << " has " << carriers.GetN () << " RX carriers");
-
-  for (ObjectVectorValue::Iterator itCarrier = carriers.Begin ();
-       itCarrier != carriers.End (); ++itCarrier)
+  // Connect the object to the probe.
+  if (probe->ConnectByObject (GetTraceSourceName (), satPhyRx))
     {
-  		if (DynamicCast<SatPhyRxCarrier> (itCarrier->second)->GetCarrierType () != GetValidCarrierType ())
-  			continue;
-      // Connect the object to the probe.
-      if (probe->ConnectByObject (GetTraceSourceName (), itCarrier->second))
+      // Connect the probe to the right collector.
+      bool ret = false;
+      switch (GetOutputType ())
         {
-          // Connect the probe to the right collector.
-          bool ret = false;
-          switch (GetOutputType ())
-            {
-            case SatStatsHelper::OUTPUT_SCALAR_FILE:
-            case SatStatsHelper::OUTPUT_SCALAR_PLOT:
-              ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
-                                                           "OutputBool",
-                                                           identifier,
-                                                           &ScalarCollector::TraceSinkBoolean);
-              break;
-
-            case SatStatsHelper::OUTPUT_SCATTER_FILE:
-            case SatStatsHelper::OUTPUT_SCATTER_PLOT:
-              ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
-                                                           "OutputBool",
-                                                           identifier,
-                                                           &IntervalRateCollector::TraceSinkBoolean);
-              break;
-
-            default:
-              NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
-              break;
-
-            } // end of `switch (GetOutputType ())`
-
-          if (ret)
-            {
-              NS_LOG_INFO (this << " created probe " << probeName.str ()
-                                << ", connected to collector " << identifier);
-              m_probes.push_back (probe->GetObject<Probe> ());
-            }
-          else
-            {
-              NS_LOG_WARN (this << " unable to connect probe " << probeName.str ()
-                                << " to collector " << identifier);
-            }
-
-        } // end of `if (probe->ConnectByObject (GetTraceSourceName (), itCarrier->second))`
+        case SatStatsHelper::OUTPUT_SCALAR_FILE:
+        case SatStatsHelper::OUTPUT_SCALAR_PLOT:
+          ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
+                                                       "OutputBool",
+                                                       identifier,
+                                                       &ScalarCollector::TraceSinkBoolean);
+          break;
+
+        case SatStatsHelper::OUTPUT_SCATTER_FILE:
+        case SatStatsHelper::OUTPUT_SCATTER_PLOT:
+          ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
+                                                       "OutputBool",
+                                                       identifier,
+                                                       &IntervalRateCollector::TraceSinkBoolean);
+          break;
+
+        default:
+          NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
+          break;
+
+        } // end of `switch (GetOutputType ())`
+
+      if (ret)
+        {
+          NS_LOG_INFO (this << " created probe " << probeName.str ()
+                            << ", connected to collector " << identifier);
+          m_probes.push_back (probe->GetObject<Probe> ());
+        }
       else
         {
-          NS_FATAL_ERROR ("Error connecting to "
-                          << GetTraceSourceName () << " trace source"
-                          << " of SatPhyRxCarrier"
-                          << " at node ID " << utNode->GetId ()
-                          << " device #" << dev->GetIfIndex ()
-                          << " RX carrier #" << itCarrier->first);
+          NS_LOG_WARN (this << " unable to connect probe " << probeName.str ()
+                            << " to collector " << identifier);
         }
 
-    } // end of `for (ObjectVectorValue::Iterator itCarrier = carriers)`
+    } // end of `if (probe->ConnectByObject (GetTraceSourceName (), satPhyRx))`
+  else
+    {
+      NS_FATAL_ERROR ("Error connecting to "
+                      << GetTraceSourceName () << " trace source"
+                      << " of SatPhyRx"
+                      << " at node ID " << utNode->GetId ()
+                      << " device #" << dev->GetIfIndex ());
+    }
 
 } // end of `void InstallProbeOnUt (Ptr<Node>)`
 
@@ -508,7 +472,6 @@ SatStatsFwdDaPacketErrorHelper::SatStatsFwdDaPacketErrorHelper (Ptr<const SatHel
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("DaRx");
   SetLinkDirection (SatEnums::LD_FORWARD);
-  SetValidCarrierType (SatPhyRxCarrier::DEDICATED_ACCESS);
 }
 
 
@@ -538,7 +501,6 @@ SatStatsRtnDaPacketErrorHelper::SatStatsRtnDaPacketErrorHelper (Ptr<const SatHel
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("DaRx");
   SetLinkDirection (SatEnums::LD_RETURN);
-  SetValidCarrierType (SatPhyRxCarrier::DEDICATED_ACCESS);
 }
 
 
@@ -568,7 +530,6 @@ SatStatsSlottedAlohaPacketErrorHelper::SatStatsSlottedAlohaPacketErrorHelper (Pt
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("SlottedAlohaRxError");
   SetLinkDirection (SatEnums::LD_RETURN);
-  SetValidCarrierType (SatPhyRxCarrier::RA_SLOTTED_ALOHA);
 }
 
 
@@ -598,7 +559,6 @@ SatStatsCrdsaPacketErrorHelper::SatStatsCrdsaPacketErrorHelper (Ptr<const SatHel
   NS_LOG_FUNCTION (this << satHelper);
   SetTraceSourceName ("CrdsaUniquePayloadRx");
   SetLinkDirection (SatEnums::LD_RETURN);
-  SetValidCarrierType (SatPhyRxCarrier::RA_CRDSA);
 }
 
 
@@ -80,9 +80,11 @@ SatStatsQueueHelper::GetUnitTypeName (SatStatsQueueHelper::UnitType_t unitType)
 SatStatsQueueHelper::SatStatsQueueHelper (Ptr<const SatHelper> satHelper)
   : SatStatsHelper (satHelper),
     m_pollInterval (MilliSeconds (10)),
+    m_eventDriven (false),
     m_unitType (SatStatsQueueHelper::UNIT_BYTES),
     m_shortLabel (""),
-    m_longLabel ("")
+    m_longLabel (""),
+    m_lastPoll (Seconds (0))
 {
   NS_LOG_FUNCTION (this << satHelper);
 }
@@ -105,6 +107,14 @@ SatStatsQueueHelper::GetTypeId ()
                    MakeTimeAccessor (&SatStatsQueueHelper::SetPollInterval,
                                      &SatStatsQueueHelper::GetPollInterval),
                    MakeTimeChecker ())
+    .AddAttribute ("EventDriven",
+                   "Track the queue size from enqueue and dequeue events and "
+                   "output its time-weighted average over every poll "
+                   "interval, instead of sampling the size of every "
+                   "encapsulator queue at every poll interval.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatStatsQueueHelper::m_eventDriven),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -156,6 +166,13 @@ SatStatsQueueHelper::GetPollInterval () const
 }
 
 
+bool
+SatStatsQueueHelper::IsEventDriven () const
+{
+  return m_eventDriven;
+}
+
+
 void
 SatStatsQueueHelper::DoInstall ()
 {
@@ -179,7 +196,9 @@ SatStatsQueueHelper::DoInstall ()
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::ScalarCollector");
         m_terminalCollectors.SetAttribute ("InputDataType",
-                                           EnumValue (ScalarCollector::INPUT_DATA_TYPE_UINTEGER));
+                                           EnumValue (m_eventDriven ?
+                                                      ScalarCollector::INPUT_DATA_TYPE_DOUBLE :
+                                                      ScalarCollector::INPUT_DATA_TYPE_UINTEGER));
         m_terminalCollectors.SetAttribute ("OutputType",
                                            EnumValue (ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE));
         CreateCollectorPerIdentifier (m_terminalCollectors);
@@ -192,21 +211,17 @@ SatStatsQueueHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
           // Setup aggregator.
-          m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                           "OutputFileName", StringValue (GetOutputFileName ()),
-                                           "GeneralHeading", StringValue (GetTimeHeading (m_shortLabel)));
+          m_aggregator = CreateScatterFileAggregator (GetTimeHeading (m_shortLabel));
 
           // Setup second-level collectors.
           m_terminalCollectors.SetType ("ns3::IntervalRateCollector");
           m_terminalCollectors.SetAttribute ("InputDataType",
-                                             EnumValue (IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER));
+                                             EnumValue (m_eventDriven ?
+                                                        IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE :
+                                                        IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER));
           CreateCollectorPerIdentifier (m_terminalCollectors);
-          m_terminalCollectors.ConnectToAggregator ("OutputWithTime",
-                                                    m_aggregator,
-                                                    &MultiFileAggregator::Write2d);
-          m_terminalCollectors.ConnectToAggregator ("OutputString",
-                                                    m_aggregator,
-                                                    &MultiFileAggregator::AddContextHeading);
+          ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator,
+                                        "OutputWithTime", "OutputString");
 
           break;
       }
@@ -268,7 +283,9 @@ SatStatsQueueHelper::DoInstall ()
           // Setup second-level collectors.
           m_terminalCollectors.SetType ("ns3::IntervalRateCollector");
           m_terminalCollectors.SetAttribute ("InputDataType",
-                                             EnumValue (IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER));
+                                             EnumValue (m_eventDriven ?
+                                                        IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE :
+                                                        IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER));
           CreateCollectorPerIdentifier (m_terminalCollectors);
           for (CollectorMap::Iterator it = m_terminalCollectors.Begin ();
                it != m_terminalCollectors.End (); ++it)
@@ -330,6 +347,7 @@ SatStatsQueueHelper::DoInstall ()
     }
 
   // Identify the list of source of queue events.
+  m_lastPoll = Simulator::Now ();
   EnlistSource ();
 
   // Schedule the first polling session.
@@ -353,8 +371,15 @@ SatStatsQueueHelper::Poll ()
 {
   NS_LOG_FUNCTION (this);
 
-  // The method below is supposed to be implemented by the child class.
-  DoPoll ();
+  if (m_eventDriven)
+    {
+      PushAccumulators ();
+    }
+  else
+    {
+      // The method below is supposed to be implemented by the child class.
+      DoPoll ();
+    }
 
   // Schedule the next polling session.
   Simulator::Schedule (m_pollInterval, &SatStatsQueueHelper::Poll, this);
@@ -413,6 +438,131 @@ SatStatsQueueHelper::PushToCollector (uint32_t identifier, uint32_t value)
 } // end of `void PushToCollector (uint32_t, uint32_t)`
 
 
+void
+SatStatsQueueHelper::PushAverageToCollector (uint32_t identifier, double value)
+{
+  //NS_LOG_FUNCTION (this << identifier << value);
+
+  // Find the collector with the right identifier.
+  Ptr<DataCollectionObject> collector = m_terminalCollectors.Get (identifier);
+  NS_ASSERT_MSG (collector != 0,
+                 "Unable to find collector with identifier " << identifier);
+
+  switch (GetOutputType ())
+    {
+    case SatStatsHelper::OUTPUT_SCALAR_FILE:
+    case SatStatsHelper::OUTPUT_SCALAR_PLOT:
+      {
+        Ptr<ScalarCollector> c = collector->GetObject<ScalarCollector> ();
+        NS_ASSERT (c != 0);
+        c->TraceSinkDouble (0.0, value);
+        break;
+      }
+
+    case SatStatsHelper::OUTPUT_SCATTER_FILE:
+    case SatStatsHelper::OUTPUT_SCATTER_PLOT:
+      {
+        Ptr<IntervalRateCollector> c = collector->GetObject<IntervalRateCollector> ();
+        NS_ASSERT (c != 0);
+        c->TraceSinkDouble (0.0, value);
+        break;
+      }
+
+    case SatStatsHelper::OUTPUT_HISTOGRAM_FILE:
+    case SatStatsHelper::OUTPUT_HISTOGRAM_PLOT:
+    case SatStatsHelper::OUTPUT_PDF_FILE:
+    case SatStatsHelper::OUTPUT_PDF_PLOT:
+    case SatStatsHelper::OUTPUT_CDF_FILE:
+    case SatStatsHelper::OUTPUT_CDF_PLOT:
+      {
+        Ptr<DistributionCollector> c = collector->GetObject<DistributionCollector> ();
+        NS_ASSERT (c != 0);
+        c->TraceSinkDouble (0.0, value);
+        break;
+      }
+
+    default:
+      NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
+      break;
+
+    } // end of `switch (GetOutputType ())`
+
+} // end of `void PushAverageToCollector (uint32_t, double)`
+
+
+void
+SatStatsQueueHelper::AddQueueAccumulator (Mac48Address utAddress,
+                                          uint32_t identifier,
+                                          uint32_t initialValue)
+{
+  NS_LOG_FUNCTION (this << utAddress << identifier << initialValue);
+
+  QueueAccumulator_t accumulator;
+  accumulator.identifier = identifier;
+  accumulator.value = initialValue;
+  accumulator.lastUpdate = m_lastPoll;
+  accumulator.integral = 0.0;
+
+  if (!m_accumulators.insert (std::make_pair (utAddress, accumulator)).second)
+    {
+      NS_FATAL_ERROR ("UT " << utAddress << " is already tracked");
+    }
+}
+
+
+void
+SatStatsQueueHelper::UpdateQueueAccumulator (Mac48Address utAddress,
+                                             int32_t bytesDelta,
+                                             int32_t packetsDelta)
+{
+  const int32_t delta = (m_unitType == SatStatsQueueHelper::UNIT_BYTES) ?
+    bytesDelta : packetsDelta;
+
+  if (delta == 0)
+    {
+      return;
+    }
+
+  std::map<Mac48Address, QueueAccumulator_t>::iterator it = m_accumulators.find (utAddress);
+
+  if (it != m_accumulators.end ())
+    {
+      const Time now = Simulator::Now ();
+      QueueAccumulator_t &accumulator = it->second;
+      accumulator.integral += accumulator.value * (now - accumulator.lastUpdate).GetSeconds ();
+      accumulator.lastUpdate = now;
+      NS_ASSERT ((delta > 0) || (accumulator.value >= static_cast<uint32_t> (-delta)));
+      accumulator.value += delta;
+    }
+}
+
+
+void
+SatStatsQueueHelper::PushAccumulators ()
+{
+  //NS_LOG_FUNCTION (this);
+
+  const Time now = Simulator::Now ();
+  const double duration = (now - m_lastPoll).GetSeconds ();
+
+  for (std::map<Mac48Address, QueueAccumulator_t>::iterator it = m_accumulators.begin ();
+       it != m_accumulators.end (); ++it)
+    {
+      QueueAccumulator_t &accumulator = it->second;
+      accumulator.integral += accumulator.value * (now - accumulator.lastUpdate).GetSeconds ();
+
+      const double average = (duration > 0.0) ?
+        accumulator.integral / duration : accumulator.value;
+      PushAverageToCollector (accumulator.identifier, average);
+
+      accumulator.integral = 0.0;
+      accumulator.lastUpdate = now;
+    }
+
+  m_lastPoll = now;
+}
+
+
 // FORWARD LINK ///////////////////////////////////////////////////////////////
 
 NS_OBJECT_ENSURE_REGISTERED (SatStatsFwdQueueHelper);
@@ -492,6 +642,27 @@ SatStatsFwdQueueHelper::DoEnlistSource ()
           NS_ASSERT (satLlc != 0);
           m_llc.push_back (std::make_pair (satLlc, listOfUt));
 
+          if (IsEventDriven ())
+            {
+              for (ListOfUt_t::const_iterator it3 = listOfUt.begin ();
+                   it3 != listOfUt.end (); ++it3)
+                {
+                  const uint32_t value = (GetUnitType () == SatStatsQueueHelper::UNIT_BYTES) ?
+                    satLlc->GetNBytesInQueue (it3->first) :
+                    satLlc->GetNPacketsInQueue (it3->first);
+                  AddQueueAccumulator (it3->first, it3->second, value);
+                }
+
+              satLlc->EnableQueueSizeTracking ();
+              const bool ret = satLlc->TraceConnectWithoutContext (
+                  "QueueSizeChange",
+                  MakeCallback (&SatStatsFwdQueueHelper::QueueSizeChangeCallback, this));
+              if (!ret)
+                {
+                  NS_FATAL_ERROR ("Unable to connect to QueueSizeChange trace source of GW LLC");
+                }
+            }
+
         } // end of `for (NetDeviceContainer::Iterator itDev = devs)`
 
     } // end of `for (it1 = gws.Begin(); it1 != gws.End (); ++it1)`
@@ -529,6 +700,17 @@ SatStatsFwdQueueHelper::DoPoll ()
 }
 
 
+void
+SatStatsFwdQueueHelper::QueueSizeChangeCallback (Mac48Address source,
+                                                 Mac48Address dest,
+                                                 int32_t bytesDelta,
+                                                 int32_t packetsDelta)
+{
+  // Forward link queues are tracked per destination UT.
+  UpdateQueueAccumulator (dest, bytesDelta, packetsDelta);
+}
+
+
 // FORWARD LINK IN BYTES //////////////////////////////////////////////////////
 
 NS_OBJECT_ENSURE_REGISTERED (SatStatsFwdQueueBytesHelper);
@@ -627,6 +809,23 @@ SatStatsRtnQueueHelper::DoEnlistSource ()
       Ptr<SatLlc> satLlc = satDev->GetLlc ();
       NS_ASSERT (satLlc != 0);
       m_llc.push_back (std::make_pair (satLlc, identifier));
+
+      if (IsEventDriven ())
+        {
+          const uint32_t value = (GetUnitType () == SatStatsQueueHelper::UNIT_BYTES) ?
+            satLlc->GetNBytesInQueue () : satLlc->GetNPacketsInQueue ();
+          AddQueueAccumulator (Mac48Address::ConvertFrom (satDev->GetAddress ()),
+                               identifier, value);
+
+          satLlc->EnableQueueSizeTracking ();
+          const bool ret = satLlc->TraceConnectWithoutContext (
+              "QueueSizeChange",
+              MakeCallback (&SatStatsRtnQueueHelper::QueueSizeChangeCallback, this));
+          if (!ret)
+            {
+              NS_FATAL_ERROR ("Unable to connect to QueueSizeChange trace source of UT LLC");
+            }
+        }
     }
 
 } // end of `void DoInstall ();`
@@ -654,6 +853,17 @@ SatStatsRtnQueueHelper::DoPoll ()
     }
 }
 
+
+void
+SatStatsRtnQueueHelper::QueueSizeChangeCallback (Mac48Address source,
+                                                 Mac48Address dest,
+                                                 int32_t bytesDelta,
+                                                 int32_t packetsDelta)
+{
+  // Return link queues are tracked per source UT.
+  UpdateQueueAccumulator (source, bytesDelta, packetsDelta);
+}
+
 // RETURN LINK IN BYTES ///////////////////////////////////////////////////////
 
 NS_OBJECT_ENSURE_REGISTERED (SatStatsRtnQueueBytesHelper);
@@ -26,7 +26,9 @@
 #include <ns3/nstime.h>
 #include <ns3/satellite-stats-helper.h>
 #include <ns3/collector-map.h>
+#include <ns3/mac48-address.h>
 #include <list>
+#include <map>
 #include <utility>
 
 
@@ -36,7 +38,6 @@ namespace ns3 {
 // BASE CLASS /////////////////////////////////////////////////////////////////
 
 class SatHelper;
-class Mac48Address;
 class DataCollectionObject;
 
 /**
@@ -97,6 +98,12 @@ public:
    */
   UnitType_t GetUnitType () const;
 
+  /**
+   * \return true if the queue size is collected from queue events instead of
+   *         polling the encapsulators.
+   */
+  bool IsEventDriven () const;
+
   /**
    * \brief Identify the list of source of queue events.
    */
@@ -105,6 +112,9 @@ public:
   /**
    * \brief Retrieve the queue size of every relevant encapsulator and push the
    *        values to the right collectors.
+   *
+   * In event-driven mode, the time-weighted average queue size of every UT
+   * since the previous call is pushed instead.
    */
   void Poll ();
 
@@ -129,6 +139,31 @@ protected:
    */
   void PushToCollector (uint32_t identifier, uint32_t value);
 
+  /**
+   * \param identifier
+   * \param value time-weighted average queue size
+   */
+  void PushAverageToCollector (uint32_t identifier, double value);
+
+  /**
+   * \brief Start tracking the queue size of a UT in event-driven mode.
+   * \param utAddress MAC address of the UT
+   * \param identifier identifier of the collector for the UT
+   * \param initialValue current queue size of the UT
+   */
+  void AddQueueAccumulator (Mac48Address utAddress, uint32_t identifier,
+                            uint32_t initialValue);
+
+  /**
+   * \brief Update the queue size of a UT in event-driven mode. Changes of
+   *        UTs not added by AddQueueAccumulator() are ignored.
+   * \param utAddress MAC address of the UT
+   * \param bytesDelta change in the number of bytes in queue
+   * \param packetsDelta change in the number of packets in queue
+   */
+  void UpdateQueueAccumulator (Mac48Address utAddress, int32_t bytesDelta,
+                               int32_t packetsDelta);
+
   /// Maintains a list of collectors created by this helper.
   CollectorMap m_terminalCollectors;
 
@@ -136,10 +171,32 @@ protected:
   Ptr<DataCollectionObject> m_aggregator;
 
 private:
+  /**
+   * \brief Time-weighted queue size of a single UT.
+   */
+  typedef struct
+  {
+    uint32_t identifier;  ///< Identifier of the collector.
+    uint32_t value;       ///< Current queue size.
+    Time     lastUpdate;  ///< Time of the last change of the queue size.
+    double   integral;    ///< Queue size integrated over time since the last poll.
+  } QueueAccumulator_t;
+
+  /**
+   * \brief Push the time-weighted average queue size of every UT since the
+   *        previous poll to the collectors and restart the averaging.
+   */
+  void PushAccumulators ();
+
   Time         m_pollInterval;  ///< `PollInterval` attribute.
+  bool         m_eventDriven;   ///< `EventDriven` attribute.
   UnitType_t   m_unitType;      ///<
   std::string  m_shortLabel;    ///<
   std::string  m_longLabel;     ///<
+  Time         m_lastPoll;      ///< Time of the previous poll.
+
+  /// Queue size accumulators of UTs in event-driven mode, indexed by UT address.
+  std::map<Mac48Address, QueueAccumulator_t> m_accumulators;
 
 }; // end of class SatStatsQueueHelper
 
@@ -176,6 +233,16 @@ protected:
   void DoPoll ();
 
 private:
+  /**
+   * \brief Receive a queue size change of a GW LLC in event-driven mode.
+   * \param source address of the GW
+   * \param dest address of the UT
+   * \param bytesDelta change in the number of bytes in queue
+   * \param packetsDelta change in the number of packets in queue
+   */
+  void QueueSizeChangeCallback (Mac48Address source, Mac48Address dest,
+                                int32_t bytesDelta, int32_t packetsDelta);
+
   ///
   typedef std::list<std::pair<Mac48Address, uint32_t> > ListOfUt_t;
 
@@ -265,6 +332,15 @@ protected:
   void DoPoll ();
 
 private:
+  /**
+   * \brief Receive a queue size change of a UT LLC in event-driven mode.
+   * \param source address of the UT
+   * \param dest address of the GW
+   * \param bytesDelta change in the number of bytes in queue
+   * \param packetsDelta change in the number of packets in queue
+   */
+  void QueueSizeChangeCallback (Mac48Address source, Mac48Address dest,
+                                int32_t bytesDelta, int32_t packetsDelta);
 
   /// Maintains a list of UT LLC and its identifier.
   std::list<std::pair<Ptr<SatLlc>, uint32_t> > m_llc;
@@ -116,18 +116,14 @@ SatStatsResourcesGrantedHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("resources_bytes")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("resources_bytes"));
 
         // Setup collectors.
         m_terminalCollectors.SetType ("ns3::UnitConversionCollector");
         m_terminalCollectors.SetAttribute ("ConversionType",
                                            EnumValue (UnitConversionCollector::TRANSPARENT));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputTimeValue",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator, "OutputTimeValue");
 
         // Setup a probe in each UT MAC.
         NodeContainer uts = GetSatHelper ()->GetBeamHelper ()->GetUtNodes ();
@@ -122,21 +122,15 @@ SatStatsSignallingLoadHelper::DoInstall ()
     case SatStatsHelper::OUTPUT_SCATTER_FILE:
       {
         // Setup aggregator.
-        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
-                                         "OutputFileName", StringValue (GetOutputFileName ()),
-                                         "GeneralHeading", StringValue (GetTimeHeading ("signalling_kbps")));
+        m_aggregator = CreateScatterFileAggregator (GetTimeHeading ("signalling_kbps"));
 
         // Setup second-level collectors.
         m_terminalCollectors.SetType ("ns3::IntervalRateCollector");
         m_terminalCollectors.SetAttribute ("InputDataType",
                                            EnumValue (IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE));
         CreateCollectorPerIdentifier (m_terminalCollectors);
-        m_terminalCollectors.ConnectToAggregator ("OutputWithTime",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::Write2d);
-        m_terminalCollectors.ConnectToAggregator ("OutputString",
-                                                  m_aggregator,
-                                                  &MultiFileAggregator::AddContextHeading);
+        ConnectScatterFileAggregator (m_terminalCollectors, m_aggregator,
+                                      "OutputWithTime", "OutputString");
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType ("ns3::UnitConversionCollector");
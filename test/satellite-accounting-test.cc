@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-accounting-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the per subsystem counters of
+ *        SatAccountingSimulatorImpl.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "../model/satellite-queue.h"
+#include "../utils/satellite-accounting-simulator-impl.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the per subsystem event and allocation counters.
+ *
+ *  1.  Take the accounting simulator implementation into use.
+ *  2.  Schedule events enqueueing packets to a satellite queue, and events
+ *      calling a free function, of which some are cancelled.
+ *  3.  Run the simulation and reset the counters.
+ *
+ *  Expected result:
+ *   The queue events are counted to the LLC and the free function events to
+ *   the other subsystem, both when scheduled and when executed, cancelled
+ *   events are not counted as executed, the allocations of the queue events
+ *   are counted to the LLC, and everything is zero after reset.
+ */
+class SatAccountingCountersTestCase : public TestCase
+{
+public:
+  SatAccountingCountersTestCase ();
+  virtual ~SatAccountingCountersTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatAccountingCountersTestCase::SatAccountingCountersTestCase ()
+  : TestCase ("Test per subsystem counters of the accounting simulator implementation.")
+{
+}
+
+SatAccountingCountersTestCase::~SatAccountingCountersTestCase ()
+{
+}
+
+static uint32_t g_otherEvents = 0;
+
+static void
+OtherEvent ()
+{
+  g_otherEvents++;
+}
+
+void
+SatAccountingCountersTestCase::DoRun (void)
+{
+  // the implementation can be set only when the simulator is not in use
+  Simulator::Destroy ();
+
+  Ptr<SatAccountingSimulatorImpl> impl = CreateObject<SatAccountingSimulatorImpl> ();
+  Simulator::SetImplementation (impl);
+
+  Ptr<SatQueue> queue = CreateObject<SatQueue> ();
+
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      Simulator::Schedule (MilliSeconds (i), &SatQueue::Enqueue, queue, Create<Packet> (100));
+    }
+
+  g_otherEvents = 0;
+
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      EventId event = Simulator::Schedule (MilliSeconds (i), &OtherEvent);
+
+      if (i % 2 == 1)
+        {
+          Simulator::Cancel (event);
+        }
+    }
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (queue->GetNPackets (), 10, "Queue events not executed");
+  NS_TEST_ASSERT_MSG_EQ (g_otherEvents, 3, "Other events not executed");
+
+  NS_TEST_ASSERT_MSG_EQ (impl->GetScheduledEvents (SatAccountingSimulatorImpl::SUBSYSTEM_LLC), 10, "LLC events not counted when scheduled");
+  NS_TEST_ASSERT_MSG_EQ (impl->GetExecutedEvents (SatAccountingSimulatorImpl::SUBSYSTEM_LLC), 10, "LLC events not counted when executed");
+  NS_TEST_ASSERT_MSG_EQ (impl->GetScheduledEvents (SatAccountingSimulatorImpl::SUBSYSTEM_OTHER), 5, "Other events not counted when scheduled");
+  NS_TEST_ASSERT_MSG_EQ (impl->GetExecutedEvents (SatAccountingSimulatorImpl::SUBSYSTEM_OTHER), 3, "Cancelled events counted as executed");
+
+  for (uint32_t i = 0; i < SatAccountingSimulatorImpl::SUBSYSTEM_COUNT; i++)
+    {
+      SatAccountingSimulatorImpl::Subsystem_t subsystem = (SatAccountingSimulatorImpl::Subsystem_t) i;
+
+      if (subsystem != SatAccountingSimulatorImpl::SUBSYSTEM_LLC && subsystem != SatAccountingSimulatorImpl::SUBSYSTEM_OTHER)
+        {
+          NS_TEST_ASSERT_MSG_EQ (impl->GetScheduledEvents (subsystem), 0,
+                                 "Events counted to " << SatAccountingSimulatorImpl::GetSubsystemName (subsystem));
+          NS_TEST_ASSERT_MSG_EQ (impl->GetAllocations (subsystem), 0,
+                                 "Allocations counted to " << SatAccountingSimulatorImpl::GetSubsystemName (subsystem));
+        }
+    }
+
+  // the allocation test runner is linked with the counting operator new
+  NS_TEST_ASSERT_MSG_EQ (SatAccountingSimulatorImpl::IsAllocationCountingEnabled (), true, "Allocations not counted");
+  NS_TEST_ASSERT_MSG_GT (impl->GetAllocations (SatAccountingSimulatorImpl::SUBSYSTEM_LLC), 0, "Allocations of the queue events not counted");
+
+  impl->ResetCounters ();
+
+  for (uint32_t i = 0; i < SatAccountingSimulatorImpl::SUBSYSTEM_COUNT; i++)
+    {
+      SatAccountingSimulatorImpl::Subsystem_t subsystem = (SatAccountingSimulatorImpl::Subsystem_t) i;
+
+      NS_TEST_ASSERT_MSG_EQ (impl->GetScheduledEvents (subsystem), 0, "Scheduled events not reset");
+      NS_TEST_ASSERT_MSG_EQ (impl->GetExecutedEvents (subsystem), 0, "Executed events not reset");
+      NS_TEST_ASSERT_MSG_EQ (impl->GetAllocations (subsystem), 0, "Allocations not reset");
+    }
+
+  queue->Dispose ();
+
+  // the next user of the simulator gets the default implementation again
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatAccountingSimulatorImpl unit test cases.
+ */
+class SatAccountingTestSuite : public TestSuite
+{
+public:
+  SatAccountingTestSuite ();
+};
+
+SatAccountingTestSuite::SatAccountingTestSuite ()
+  : TestSuite ("sat-accounting-unit-test", UNIT)
+{
+  AddTestCase (new SatAccountingCountersTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatAccountingTestSuite satAccountingUnit;
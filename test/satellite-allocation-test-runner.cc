@@ -0,0 +1,37 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-allocation-test-runner.cc
+ * \ingroup satellite
+ * \brief Test runner for the test suites measuring heap allocations. The
+ * runner is linked with the counting operator new of
+ * utils/satellite-allocation-counter.cc, which is kept out of the shared
+ * test library. Accepts the arguments of the ns-3 test runner, e.g.
+ *
+ * ./waf --run "sat-allocation-test-runner --suite=sat-accounting-unit-test"
+ */
+
+#include "ns3/test.h"
+
+int
+main (int argc, char *argv[])
+{
+  return ns3::TestRunner::Run (argc, argv);
+}
@@ -30,6 +30,7 @@
 #include "ns3/test.h"
 #include "ns3/ptr.h"
 #include "../model/satellite-arq-sequence-number.h"
+#include "../model/satellite-arq-buffer-ring.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
 
@@ -98,6 +99,79 @@ SatSeqNoTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief ARQ buffer ring test. Contexts are inserted, found and erased
+ * by sequence number and the first context has the lowest sequence number.
+ */
+class SatArqBufferRingTestCase : public TestCase
+{
+public:
+  SatArqBufferRingTestCase ();
+  virtual ~SatArqBufferRingTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+};
+
+SatArqBufferRingTestCase::SatArqBufferRingTestCase ()
+  : TestCase ("Test ARQ buffer ring.")
+{
+}
+
+SatArqBufferRingTestCase::~SatArqBufferRingTestCase ()
+{
+}
+
+void
+SatArqBufferRingTestCase::DoRun (void)
+{
+  SatArqBufferRing ring;
+  ring.Reserve (10);
+
+  NS_TEST_ASSERT_MSG_EQ (ring.IsEmpty (), true, "New ring is not empty");
+  NS_TEST_ASSERT_MSG_EQ ((ring.GetFirst () == 0), true, "First context found from an empty ring");
+
+  uint32_t seqNos[] = { 250, 3, 77, 128, 64 };
+
+  for (uint32_t i = 0; i < 5; ++i)
+    {
+      Ptr<SatArqBufferContext> context = ring.AllocateContext ();
+      context->m_seqNo = seqNos[i];
+      ring.Insert (seqNos[i], context);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (ring.GetN (), 5, "Unexpected number of contexts");
+  NS_TEST_ASSERT_MSG_EQ (ring.GetFirst ()->m_seqNo, 3, "Unexpected first context");
+  NS_TEST_ASSERT_MSG_EQ (ring.Find (77)->m_seqNo, 77, "Context not found");
+  NS_TEST_ASSERT_MSG_EQ ((ring.Find (78) == 0), true, "Context found for unused SN");
+
+  // Same slot, but different sequence number
+  NS_TEST_ASSERT_MSG_EQ ((ring.Find (77 + SatArqBufferRing::DEFAULT_CAPACITY) == 0), true, "Context found for wrapped SN");
+
+  Ptr<SatArqBufferContext> context = ring.Erase (3);
+  NS_TEST_ASSERT_MSG_EQ (context->m_seqNo, 3, "Unexpected erased context");
+  NS_TEST_ASSERT_MSG_EQ ((ring.Erase (3) == 0), true, "Context erased twice");
+  NS_TEST_ASSERT_MSG_EQ (ring.GetFirst ()->m_seqNo, 64, "Unexpected first context after erase");
+  NS_TEST_ASSERT_MSG_EQ (ring.GetN (), 4, "Unexpected number of contexts after erase");
+
+  // Recycled context is reused with default values
+  ring.RecycleContext (context);
+  Ptr<SatArqBufferContext> reused = ring.AllocateContext ();
+  NS_TEST_ASSERT_MSG_EQ ((reused == context), true, "Recycled context not reused");
+  NS_TEST_ASSERT_MSG_EQ (reused->m_seqNo, 0, "Recycled context not reset");
+
+  // 32-bit sequence numbers beyond the capacity map to the ring slots
+  reused->m_seqNo = 1000;
+  ring.Insert (1000, reused);
+  NS_TEST_ASSERT_MSG_EQ ((ring.Find (1000) == reused), true, "Context with 32-bit SN not found");
+
+  ring.Clear ();
+  NS_TEST_ASSERT_MSG_EQ (ring.IsEmpty (), true, "Ring not empty after clear");
+  NS_TEST_ASSERT_MSG_EQ ((ring.Find (77) == 0), true, "Context found after clear");
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for RLE.
@@ -112,6 +186,7 @@ SatArqSeqNoTraceSuite::SatArqSeqNoTraceSuite ()
   : TestSuite ("sat-arq-seqno-test", UNIT)
 {
   AddTestCase (new SatSeqNoTestCase, TestCase::QUICK);
+  AddTestCase (new SatArqBufferRingTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
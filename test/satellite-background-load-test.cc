@@ -0,0 +1,445 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-background-load-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the flow level background load and its
+ * service by the schedulers of the beam.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/string.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/data-rate.h"
+#include "ns3/singleton.h"
+#include "ns3/cbr-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "../helper/satellite-helper.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-background-load.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the backlog of the background load.
+ *
+ *  1.  Create a load with a mean rate of 80 kbps and no rate variation.
+ *  2.  Query the backlog after 0.5 seconds and serve it in two transmission
+ *      opportunities.
+ *
+ *  Expected result:
+ *   The backlog is the demand of 0.5 seconds, the first opportunity is served
+ *   full and the second one gets the rest of the backlog.
+ */
+class SatBackgroundLoadBacklogTestCase : public TestCase
+{
+public:
+  SatBackgroundLoadBacklogTestCase ();
+  virtual ~SatBackgroundLoadBacklogTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Check ();
+
+  Ptr<SatBackgroundLoad> m_load;
+};
+
+SatBackgroundLoadBacklogTestCase::SatBackgroundLoadBacklogTestCase ()
+  : TestCase ("Test the backlog of the background load.")
+{
+}
+
+SatBackgroundLoadBacklogTestCase::~SatBackgroundLoadBacklogTestCase ()
+{
+}
+
+void
+SatBackgroundLoadBacklogTestCase::Check ()
+{
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetRate (), 80000.0, 1e-6, "unexpected rate");
+  NS_TEST_ASSERT_MSG_EQ (m_load->GetBacklogInBytes (), 5000, "unexpected backlog");
+
+  NS_TEST_ASSERT_MSG_EQ (m_load->Serve (2000, MilliSeconds (10)), 2000, "opportunity not served full");
+  NS_TEST_ASSERT_MSG_EQ (m_load->GetBacklogInBytes (), 3000, "served bytes not removed from backlog");
+
+  NS_TEST_ASSERT_MSG_EQ (m_load->Serve (10000, MilliSeconds (10)), 3000, "more than the backlog served");
+  NS_TEST_ASSERT_MSG_EQ (m_load->GetBacklogInBytes (), 0, "backlog left after service");
+}
+
+void
+SatBackgroundLoadBacklogTestCase::DoRun (void)
+{
+  m_load = CreateObject<SatBackgroundLoad> ();
+  m_load->SetAttribute ("MeanRate", DataRateValue (DataRate ("80kbps")));
+
+  Simulator::Schedule (MilliSeconds (500), &SatBackgroundLoadBacklogTestCase::Check, this);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_load->Dispose ();
+  m_load = 0;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the dropping of the background demand.
+ *
+ *  1.  Create a load with a mean rate of 80 kbps, no rate variation and a
+ *      maximum backlog of 100 ms.
+ *  2.  Query the backlog after 0.5 seconds.
+ *
+ *  Expected result:
+ *   The backlog is limited to the demand of 100 ms, and the rest of the
+ *   demand is reported by the `Drop` trace source.
+ */
+class SatBackgroundLoadDropTestCase : public TestCase
+{
+public:
+  SatBackgroundLoadDropTestCase ();
+  virtual ~SatBackgroundLoadDropTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Check ();
+  void Dropped (uint32_t bytes);
+
+  Ptr<SatBackgroundLoad> m_load;
+  uint32_t m_droppedBytes;
+};
+
+SatBackgroundLoadDropTestCase::SatBackgroundLoadDropTestCase ()
+  : TestCase ("Test the dropping of the background demand."),
+    m_droppedBytes (0)
+{
+}
+
+SatBackgroundLoadDropTestCase::~SatBackgroundLoadDropTestCase ()
+{
+}
+
+void
+SatBackgroundLoadDropTestCase::Dropped (uint32_t bytes)
+{
+  m_droppedBytes += bytes;
+}
+
+void
+SatBackgroundLoadDropTestCase::Check ()
+{
+  NS_TEST_ASSERT_MSG_EQ (m_load->GetBacklogInBytes (), 1000, "backlog not limited");
+  NS_TEST_ASSERT_MSG_EQ (m_droppedBytes, 4000, "unexpected amount of dropped demand");
+}
+
+void
+SatBackgroundLoadDropTestCase::DoRun (void)
+{
+  m_load = CreateObject<SatBackgroundLoad> ();
+  m_load->SetAttribute ("MeanRate", DataRateValue (DataRate ("80kbps")));
+  m_load->SetAttribute ("MaxBacklog", TimeValue (MilliSeconds (100)));
+  m_load->TraceConnectWithoutContext ("Drop", MakeCallback (&SatBackgroundLoadDropTestCase::Dropped, this));
+
+  Simulator::Schedule (MilliSeconds (500), &SatBackgroundLoadDropTestCase::Check, this);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_load->Dispose ();
+  m_load = 0;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the activity and the interference of the
+ * background load.
+ *
+ *  1.  Create two loads with a mean rate of 80 kbps, no rate variation and an
+ *      update interval of one second. The second load interferes the first
+ *      one with 40 percent of the noise at full activity.
+ *  2.  Serve the second load for 0.25 seconds in the first update interval.
+ *  3.  Query the activities and the interference in both intervals, and the
+ *      time until the backlog of the first load reaches given amounts.
+ *
+ *  Expected result:
+ *   The activity and the interference are zero in the first interval. In the
+ *   second interval the activity of the second load is 0.25 and the
+ *   interference of the first load is 0.1. The time to the backlog is the
+ *   time to accumulate it with the rate, limited to the end of the interval.
+ */
+class SatBackgroundLoadActivityTestCase : public TestCase
+{
+public:
+  SatBackgroundLoadActivityTestCase ();
+  virtual ~SatBackgroundLoadActivityTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Serve ();
+  void Check ();
+
+  Ptr<SatBackgroundLoad> m_load;
+  Ptr<SatBackgroundLoad> m_interferer;
+};
+
+SatBackgroundLoadActivityTestCase::SatBackgroundLoadActivityTestCase ()
+  : TestCase ("Test the activity and the interference of the background load.")
+{
+}
+
+SatBackgroundLoadActivityTestCase::~SatBackgroundLoadActivityTestCase ()
+{
+}
+
+void
+SatBackgroundLoadActivityTestCase::Serve ()
+{
+  NS_TEST_ASSERT_MSG_EQ (m_interferer->Serve (1000, MilliSeconds (250)), 1000, "opportunity not served full");
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_interferer->GetActivity (), 0.0, 1e-9, "activity before the end of the interval");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetInterferenceWrtNoise (), 0.0, 1e-9, "interference before the end of the interval");
+
+  // 5000 bytes accumulated, 1000 more take 0.1 seconds, and the interval ends in 0.5 seconds
+  NS_TEST_ASSERT_MSG_EQ (m_load->GetTimeToBacklog (4000).IsZero (), true, "backlog not reached");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetTimeToBacklog (6000).GetSeconds (), 0.1, 1e-6, "unexpected time to backlog");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetTimeToBacklog (20000).GetSeconds (), 0.5, 1e-9, "time to backlog beyond the interval");
+}
+
+void
+SatBackgroundLoadActivityTestCase::Check ()
+{
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_interferer->GetActivity (), 0.25, 1e-9, "unexpected activity");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetActivity (), 0.0, 1e-9, "activity without service");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_load->GetInterferenceWrtNoise (), 0.1, 1e-9, "unexpected interference");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_interferer->GetInterferenceWrtNoise (), 0.0, 1e-9, "interference without interferers");
+}
+
+void
+SatBackgroundLoadActivityTestCase::DoRun (void)
+{
+  m_load = CreateObject<SatBackgroundLoad> ();
+  m_load->SetAttribute ("MeanRate", DataRateValue (DataRate ("80kbps")));
+  m_load->SetAttribute ("UpdateInterval", TimeValue (Seconds (1.0)));
+  m_load->SetAttribute ("MaxBacklog", TimeValue (Seconds (1.0)));
+
+  m_interferer = CreateObject<SatBackgroundLoad> ();
+  m_interferer->SetAttribute ("MeanRate", DataRateValue (DataRate ("80kbps")));
+  m_interferer->SetAttribute ("UpdateInterval", TimeValue (Seconds (1.0)));
+  m_interferer->SetAttribute ("InterferenceWrtNoisePercent", DoubleValue (40.0));
+
+  m_load->AddInterferer (m_interferer);
+
+  Simulator::Schedule (MilliSeconds (500), &SatBackgroundLoadActivityTestCase::Serve, this);
+  Simulator::Schedule (MilliSeconds (1500), &SatBackgroundLoadActivityTestCase::Check, this);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_load->Dispose ();
+  m_interferer->Dispose ();
+  m_load = 0;
+  m_interferer = 0;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the schedulers of the beam serve the
+ * background load from the capacity of the packet level terminals.
+ *
+ *  1.  Simple test scenario set with helper and a saturating CBR flow from
+ *      the UT connected user to the GW connected user.
+ *  2.  The scenario is run without and with a return link background load
+ *      exceeding the capacity of the beam.
+ *  3.  Simple test scenario set with helper, idle carrier suspension enabled
+ *      and a forward link background load, but no traffic.
+ *
+ *  Expected result:
+ *   The dedicated access resources assigned to the UT shrink with the return
+ *   link background load. The forward link background load is served by the
+ *   suspended carrier, so none of its demand is dropped.
+ */
+class SatBackgroundLoadSchedulerTestCase : public TestCase
+{
+public:
+  SatBackgroundLoadSchedulerTestCase ();
+  virtual ~SatBackgroundLoadSchedulerTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void DaResources (uint32_t bytes);
+  void Dropped (uint32_t bytes);
+  uint32_t RunReturnLink (bool backgroundEnabled);
+  uint32_t RunForwardLink ();
+
+  uint32_t m_assignedBytes;
+  uint32_t m_droppedBytes;
+};
+
+SatBackgroundLoadSchedulerTestCase::SatBackgroundLoadSchedulerTestCase ()
+  : TestCase ("Test that the schedulers serve the background load."),
+    m_assignedBytes (0),
+    m_droppedBytes (0)
+{
+}
+
+SatBackgroundLoadSchedulerTestCase::~SatBackgroundLoadSchedulerTestCase ()
+{
+}
+
+void
+SatBackgroundLoadSchedulerTestCase::DaResources (uint32_t bytes)
+{
+  m_assignedBytes += bytes;
+}
+
+void
+SatBackgroundLoadSchedulerTestCase::Dropped (uint32_t bytes)
+{
+  m_droppedBytes += bytes;
+}
+
+uint32_t
+SatBackgroundLoadSchedulerTestCase::RunReturnLink (bool backgroundEnabled)
+{
+  Config::SetDefault ("ns3::SatBeamHelper::BackgroundLoadEnabled", BooleanValue (backgroundEnabled));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  Config::SetDefault ("ns3::SatBeamHelper::BackgroundLoadEnabled", BooleanValue (false));
+
+  if (backgroundEnabled)
+    {
+      uint32_t beamId = helper->GetBeamHelper ()->GetBeams ().front ();
+      Ptr<SatBackgroundLoad> load = helper->GetBeamHelper ()->GetBackgroundLoad (beamId, SatEnums::LD_RETURN);
+      load->SetAttribute ("MeanRate", DataRateValue (DataRate ("100Mbps")));
+    }
+
+  Ptr<Node> ut = helper->GetBeamHelper ()->GetUtNodes ().Get (0);
+
+  for (uint32_t i = 0; i < ut->GetNDevices (); i++)
+    {
+      Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> (ut->GetDevice (i));
+
+      if (satNd != NULL)
+        {
+          satNd->GetMac ()->TraceConnectWithoutContext ("DaResourcesTrace", MakeCallback (&SatBackgroundLoadSchedulerTestCase::DaResources, this));
+        }
+    }
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("1ms"));
+
+  ApplicationContainer utApps = cbr.Install (helper->GetUtUsers ().Get (0));
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (3.0));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+
+  ApplicationContainer gwApps = sink.Install (gwUsers.Get (0));
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (3.0));
+
+  m_assignedBytes = 0;
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  return m_assignedBytes;
+}
+
+uint32_t
+SatBackgroundLoadSchedulerTestCase::RunForwardLink ()
+{
+  Config::SetDefault ("ns3::SatBeamHelper::BackgroundLoadEnabled", BooleanValue (true));
+  Config::SetDefault ("ns3::SatGwMac::DummyFrameSendingEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwMac::IdleCarrierSuspendEnabled", BooleanValue (true));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  Config::SetDefault ("ns3::SatBeamHelper::BackgroundLoadEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwMac::IdleCarrierSuspendEnabled", BooleanValue (false));
+
+  uint32_t beamId = helper->GetBeamHelper ()->GetBeams ().front ();
+  Ptr<SatBackgroundLoad> load = helper->GetBeamHelper ()->GetBackgroundLoad (beamId, SatEnums::LD_FORWARD);
+  load->SetAttribute ("MeanRate", DataRateValue (DataRate ("2Mbps")));
+  load->SetAttribute ("UpdateInterval", TimeValue (MilliSeconds (100)));
+  load->TraceConnectWithoutContext ("Drop", MakeCallback (&SatBackgroundLoadSchedulerTestCase::Dropped, this));
+
+  m_droppedBytes = 0;
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_GT (load->GetActivity (), 0.0, "Background load not served by the suspended carrier!");
+
+  Simulator::Destroy ();
+
+  return m_droppedBytes;
+}
+
+void
+SatBackgroundLoadSchedulerTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-background-load", "scheduler", true);
+
+  uint32_t refAssignedBytes = RunReturnLink (false);
+  uint32_t assignedBytes = RunReturnLink (true);
+
+  NS_TEST_ASSERT_MSG_GT (refAssignedBytes, 0, "No resources assigned to the UT!");
+  NS_TEST_ASSERT_MSG_LT (assignedBytes, refAssignedBytes, "Resources of the UT not shrunk by the background load!");
+
+  uint32_t droppedBytes = RunForwardLink ();
+
+  NS_TEST_ASSERT_MSG_EQ (droppedBytes, 0, "Background load dropped while the carrier was suspended!");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatBackgroundLoad unit test cases.
+ */
+class SatBackgroundLoadTestSuite : public TestSuite
+{
+public:
+  SatBackgroundLoadTestSuite ();
+};
+
+SatBackgroundLoadTestSuite::SatBackgroundLoadTestSuite ()
+  : TestSuite ("sat-background-load-unit-test", UNIT)
+{
+  AddTestCase (new SatBackgroundLoadBacklogTestCase, TestCase::QUICK);
+  AddTestCase (new SatBackgroundLoadDropTestCase, TestCase::QUICK);
+  AddTestCase (new SatBackgroundLoadActivityTestCase, TestCase::QUICK);
+  AddTestCase (new SatBackgroundLoadSchedulerTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatBackgroundLoadTestSuite satBackgroundLoadUnit;
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-binary-file-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the binary statistics file aggregator and
+ *        converter.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/singleton.h"
+#include "../stats/satellite-binary-file-aggregator.h"
+#include "../stats/satellite-binary-file-converter.h"
+#include "../utils/satellite-env-variables.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that samples written by the binary aggregator
+ *        are read back by the converter.
+ *
+ *  1.  Write samples of two contexts with a small buffer, so that the records
+ *      are split into several chunks, and add headings and a warning between
+ *      the samples.
+ *  2.  Dispose the aggregator and read the file with the converter.
+ *  3.  Write the text files and the Gnuplot files.
+ *
+ *  Expected result:
+ *    The contexts, the number of records, the headings, the warning and the
+ *    values of the text files and the Gnuplot data file match the samples.
+ */
+class SatBinaryFileRoundTripTestCase : public TestCase
+{
+public:
+  SatBinaryFileRoundTripTestCase ();
+  virtual ~SatBinaryFileRoundTripTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \param fileName name of the file
+   * \return lines of the file
+   */
+  static std::vector<std::string> ReadLines (std::string fileName);
+};
+
+SatBinaryFileRoundTripTestCase::SatBinaryFileRoundTripTestCase ()
+  : TestCase ("Test round trip from the binary aggregator to the converter.")
+{
+}
+
+SatBinaryFileRoundTripTestCase::~SatBinaryFileRoundTripTestCase ()
+{
+}
+
+std::vector<std::string>
+SatBinaryFileRoundTripTestCase::ReadLines (std::string fileName)
+{
+  std::vector<std::string> lines;
+  std::ifstream ifs (fileName.c_str ());
+  std::string line;
+
+  while (std::getline (ifs, line))
+    {
+      lines.push_back (line);
+    }
+
+  return lines;
+}
+
+void
+SatBinaryFileRoundTripTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-binary-file", "round-trip", true);
+
+  std::string outputName = Singleton<SatEnvVariables>::Get ()->GetOutputPath () + "/stat";
+
+  Ptr<SatBinaryFileAggregator> aggregator = CreateObject<SatBinaryFileAggregator> ();
+  aggregator->SetAttribute ("OutputFileName", StringValue (outputName));
+  aggregator->SetAttribute ("GeneralHeading", StringValue ("% time value"));
+  aggregator->SetAttribute ("BufferSize", UintegerValue (3));
+
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      aggregator->Write2d ("a", i, 10.0 * i);
+
+      if (i % 2 == 0)
+        {
+          aggregator->Write2d ("b", i, -1.0 * i);
+        }
+
+      if (i == 4)
+        {
+          aggregator->AddContextHeading ("b", "% heading of b");
+          aggregator->EnableContextWarning ("a", true);
+        }
+    }
+
+  aggregator->Dispose ();
+
+  SatBinaryFileConverter converter (outputName + SatBinaryFileAggregator::BINARY_FILE_SUFFIX);
+
+  NS_TEST_ASSERT_MSG_EQ (converter.GetNumOfContexts (), 2, "wrong number of contexts");
+  NS_TEST_ASSERT_MSG_EQ (converter.GetContextName (0), "a", "wrong context name");
+  NS_TEST_ASSERT_MSG_EQ (converter.GetContextName (1), "b", "wrong context name");
+  NS_TEST_ASSERT_MSG_EQ (converter.GetNumOfRecords (0), 10, "wrong number of records");
+  NS_TEST_ASSERT_MSG_EQ (converter.GetNumOfRecords (1), 5, "wrong number of records");
+
+  // text output in the default multi file mode
+  converter.WriteTextFiles (outputName);
+
+  std::vector<std::string> linesA = ReadLines (outputName + "-a.txt");
+  NS_TEST_ASSERT_MSG_EQ (linesA.size (), 12, "wrong number of lines in the text file of a");
+  NS_TEST_ASSERT_MSG_EQ (linesA[0], "% time value", "wrong general heading");
+  NS_TEST_ASSERT_MSG_EQ (linesA[1].find ("warning") != std::string::npos, true, "warning missing");
+  NS_TEST_ASSERT_MSG_EQ (linesA[2], "0 0", "wrong first record");
+  NS_TEST_ASSERT_MSG_EQ (linesA[11], "9 90", "wrong last record");
+
+  std::vector<std::string> linesB = ReadLines (outputName + "-b.txt");
+  NS_TEST_ASSERT_MSG_EQ (linesB.size (), 7, "wrong number of lines in the text file of b");
+  NS_TEST_ASSERT_MSG_EQ (linesB[1], "% heading of b", "wrong context heading");
+  NS_TEST_ASSERT_MSG_EQ (linesB[3], "2 -2", "wrong record");
+
+  // Gnuplot output has a data set per context in the data file
+  converter.WriteGnuplotFile (outputName, "time", "value");
+
+  std::vector<std::string> plotLines = ReadLines (outputName + ".plt");
+  NS_TEST_ASSERT_MSG_NE (plotLines.size (), 0, "empty Gnuplot script");
+
+  std::vector<std::string> dataLines = ReadLines (outputName + ".dat");
+  uint32_t dataPoints = 0;
+
+  for (std::vector<std::string>::const_iterator it = dataLines.begin (); it != dataLines.end (); ++it)
+    {
+      if (!it->empty () && (*it)[0] != '#' && *it != "e")
+        {
+          dataPoints++;
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (dataPoints, 15, "wrong number of points in the Gnuplot data file");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the binary statistics file unit test cases.
+ */
+class SatBinaryFileTestSuite : public TestSuite
+{
+public:
+  SatBinaryFileTestSuite ();
+};
+
+SatBinaryFileTestSuite::SatBinaryFileTestSuite ()
+  : TestSuite ("sat-binary-file-unit-test", UNIT)
+{
+  AddTestCase (new SatBinaryFileRoundTripTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatBinaryFileTestSuite satBinaryFileUnit;
@@ -32,6 +32,7 @@
 #include "../model/satellite-channel-estimation-error-container.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
+#include "../utils/satellite-data-file-registry.h"
 
 using namespace ns3;
 
@@ -126,6 +127,56 @@ SatRtnChannelEstimationErrorTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case for sharing the channel estimation error tables between
+ * containers through SatDataFileRegistry
+ */
+class SatSharedChannelEstimationErrorTestCase : public TestCase
+{
+public:
+  SatSharedChannelEstimationErrorTestCase ();
+  virtual ~SatSharedChannelEstimationErrorTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+};
+
+SatSharedChannelEstimationErrorTestCase::SatSharedChannelEstimationErrorTestCase ()
+  : TestCase ("Test sharing of channel estimation error tables between containers.")
+{
+}
+
+SatSharedChannelEstimationErrorTestCase::~SatSharedChannelEstimationErrorTestCase ()
+{
+}
+
+void
+SatSharedChannelEstimationErrorTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-channel-estimation-error", "shared", true);
+
+  Singleton<SatDataFileRegistry>::Get ()->Clear ();
+
+  Ptr<SatChannelEstimationErrorContainer> fwd1 = Create<SatFwdLinkChannelEstimationErrorContainer> ();
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatDataFileRegistry>::Get ()->GetN (), 1, "FWD link table not registered");
+
+  Ptr<SatChannelEstimationErrorContainer> fwd2 = Create<SatFwdLinkChannelEstimationErrorContainer> ();
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatDataFileRegistry>::Get ()->GetN (), 1, "FWD link table loaded twice");
+
+  Ptr<SatChannelEstimationErrorContainer> rtn1 = Create<SatRtnLinkChannelEstimationErrorContainer> (3, 12);
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatDataFileRegistry>::Get ()->GetN (), 11, "RTN link tables not registered");
+
+  Ptr<SatChannelEstimationErrorContainer> rtn2 = Create<SatRtnLinkChannelEstimationErrorContainer> (3, 12);
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatDataFileRegistry>::Get ()->GetN (), 11, "RTN link tables loaded twice");
+
+  Singleton<SatDataFileRegistry>::Get ()->Clear ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for satellite channel estimation error
@@ -141,6 +192,7 @@ SatChannelEstimationErrorTestSuite::SatChannelEstimationErrorTestSuite ()
 {
   AddTestCase (new SatFwdChannelEstimationErrorTestCase, TestCase::QUICK);
   AddTestCase (new SatRtnChannelEstimationErrorTestCase, TestCase::QUICK);
+  AddTestCase (new SatSharedChannelEstimationErrorTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
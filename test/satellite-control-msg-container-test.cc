@@ -227,6 +227,119 @@ SatCtrlMsgContDelOffTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the ring based satellite control message container.
+ *
+ * This case tests that SatControlMsgRingContainer stores and expires the
+ * messages like SatControlMsgContainer and reuses its slots.
+ *  1.  Create SatControlMsgRingContainer object with capacity 2 and deletedOnRead flag not set.
+ *  2.  Add three messages at the same time and read them within the store time.
+ *  3.  Add four messages after the first ones have expired and read them.
+ *  4.  Read an expired message, a released message and a message never added.
+ *
+ *  Expected result:
+ *   Messages are read correctly. The capacity is doubled to four when three
+ *   messages are in use, and the slots of the expired messages are reused
+ *   without increasing the capacity further. Reading a message not in the
+ *   container gives NULL.
+ */
+class SatCtrlMsgRingContTestCase : public TestCase
+{
+public:
+  SatCtrlMsgRingContTestCase () : TestCase ("Test ring based satellite control message container.")
+  {
+  }
+  virtual ~SatCtrlMsgRingContTestCase ()
+  {
+  }
+
+  // add messages to container
+  void AddMessages (Ptr<SatControlMessage> msg, uint32_t count);
+
+  // get messages
+  void GetMessages (uint32_t firstId, uint32_t count);
+
+protected:
+  virtual void DoRun (void);
+
+private:
+  Ptr<SatControlMsgRingContainer> m_container;
+  std::vector<uint32_t> m_recvIds;
+  std::vector<Ptr<SatControlMessage> > m_msgsRead;
+  std::vector<uint32_t> m_capacities;
+};
+
+void
+SatCtrlMsgRingContTestCase::AddMessages (Ptr<SatControlMessage> msg, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      uint32_t sendId = m_container->ReserveIdAndStore (msg);
+      m_recvIds.push_back (m_container->Send (sendId));
+    }
+
+  m_capacities.push_back (m_container->GetCapacity ());
+}
+
+void
+SatCtrlMsgRingContTestCase::GetMessages (uint32_t firstId, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      m_msgsRead.push_back (m_container->Read (firstId + i));
+    }
+}
+
+void
+SatCtrlMsgRingContTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-ctrl-msg-container-unit", "ring", true);
+
+  // create container with store time 100 ms, capacity 2 and flag deletedOnRead NOT set
+  m_container = Create<SatControlMsgRingContainer> (Seconds (0.10), false, 2);
+  Ptr<SatControlMessage> crMsg = Create<SatCrMessage> ();
+  Ptr<SatControlMessage> tbtpMsg = Create<SatTbtpMessage> ();
+
+  // simulate message additions
+  Simulator::Schedule (Seconds (0.01), &SatCtrlMsgRingContTestCase::AddMessages, this, crMsg, 3); // ids 0-2
+  Simulator::Schedule (Seconds (0.20), &SatCtrlMsgRingContTestCase::AddMessages, this, tbtpMsg, 4); // ids 3-6
+
+  // simulate get operations
+  Simulator::Schedule (Seconds (0.10), &SatCtrlMsgRingContTestCase::GetMessages, this, 0, 3); // crMsg expected
+  Simulator::Schedule (Seconds (0.25), &SatCtrlMsgRingContTestCase::GetMessages, this, 3, 4); // tbtpMsg expected
+  Simulator::Schedule (Seconds (0.40), &SatCtrlMsgRingContTestCase::GetMessages, this, 5, 1); // expired, NULL expected
+  Simulator::Schedule (Seconds (0.40), &SatCtrlMsgRingContTestCase::GetMessages, this, 1, 1); // released, NULL expected
+  Simulator::Schedule (Seconds (0.40), &SatCtrlMsgRingContTestCase::GetMessages, this, 7, 1); // never added, NULL expected
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_recvIds.size (), 7, "unexpected number of messages added");
+  for (uint32_t i = 0; i < m_recvIds.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_recvIds[i], i, "unexpected receive id");
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (m_msgsRead.size (), 10, "unexpected number of messages read");
+  for (uint32_t i = 0; i < 7; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((m_msgsRead[i] == (i < 3 ? crMsg : tbtpMsg)), true, "message " << i << " incorrect");
+    }
+  for (uint32_t i = 7; i < m_msgsRead.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((m_msgsRead[i] == NULL), true, "message " << i << " not in container but read");
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (m_capacities[0], 4, "capacity not increased for messages in use");
+  NS_TEST_ASSERT_MSG_EQ (m_capacities[1], 4, "slots of the expired messages not reused");
+
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite control message container unit test cases.
@@ -242,6 +355,7 @@ SatCtrlMsgContainerTestSuite::SatCtrlMsgContainerTestSuite ()
 {
   AddTestCase (new SatCtrlMsgContDelOnTestCase, TestCase::QUICK);
   AddTestCase (new SatCtrlMsgContDelOffTestCase, TestCase::QUICK);
+  AddTestCase (new SatCtrlMsgRingContTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
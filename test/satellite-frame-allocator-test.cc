@@ -256,6 +256,18 @@ SatFrameAllocatorTestCase::RunSingleUtTest (SatSuperframeConf::ConfigType_t conf
               m_frameAllocator->GenerateTimeSlots (tbtpContainer, 1000, utAllocContainer, true, TracedCallback<uint32_t> (), TracedCallback<uint32_t, uint32_t> (), TracedCallback<uint32_t, double> () );
 
               CheckSingleUtTestResults (bytesReq, req, allocationResult, configType, tbtpContainer, utAllocContainer, true, fcaEnabled, acmEnabled);
+
+              // generate time slots in compact TBTP format and check results against request, RC based allocation on
+
+              tbtpContainer.clear ();
+              tptp = CreateObject<SatTbtpMessage> ();
+              tptp->SetAttribute ("Compact", BooleanValue (true));
+              tbtpContainer.push_back (tptp);
+              utAllocContainer.clear ();
+
+              m_frameAllocator->GenerateTimeSlots (tbtpContainer, 1000, utAllocContainer, true, TracedCallback<uint32_t> (), TracedCallback<uint32_t, uint32_t> (), TracedCallback<uint32_t, double> () );
+
+              CheckSingleUtTestResults (bytesReq, req, allocationResult, configType, tbtpContainer, utAllocContainer, true, fcaEnabled, acmEnabled);
             }
         }
     }
@@ -285,6 +297,14 @@ SatFrameAllocatorTestCase::CheckSingleUtTestResults (uint32_t bytesReq, SatFrame
         }
 
       slotsAllocated += info.second.size ();
+
+      SatTbtpMessage::DaSlotRangeInterval_t ranges = (*it)->GetDaSlotRanges (Mac48Address::ConvertFrom (req.m_address));
+
+      for (SatTbtpMessage::DaSlotRangeContainer_t::const_iterator it2 = ranges.first; it2 != ranges.second; it2++ )
+        {
+          tbtpAllocatedBytes += it2->m_count * m_frameConf->GetWaveformConf ()->GetWaveform (it2->m_waveformId)->GetPayloadInBytes ();
+          slotsAllocated += it2->m_count;
+        }
     }
 
   // check that information is identical in TBTP container and UT allocation container
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-id-mapper-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the trace ID lookups of SatIdMapper.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/mac48-address.h"
+#include "ns3/packet.h"
+#include "../model/satellite-id-mapper.h"
+#include "../model/satellite-mac-tag.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the dense trace ID lookups of SatIdMapper.
+ *
+ *  1.  Attach the MAC addresses of a GW and two UTs to the trace ID, UT ID,
+ *      GW ID and beam ID maps like the helpers do.
+ *  2.  Look the MAC, UT and GW IDs up with the trace IDs.
+ *  3.  Reset the mapper.
+ *
+ *  Expected result:
+ *   The trace ID lookups give the same IDs as the MAC address based lookups,
+ *   unknown trace IDs give -1 or an invalid address, and nothing is found
+ *   after reset.
+ */
+class SatIdMapperTraceIdTestCase : public TestCase
+{
+public:
+  SatIdMapperTraceIdTestCase ();
+  virtual ~SatIdMapperTraceIdTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatIdMapperTraceIdTestCase::SatIdMapperTraceIdTestCase ()
+  : TestCase ("Test trace ID lookups of the ID mapper.")
+{
+}
+
+SatIdMapperTraceIdTestCase::~SatIdMapperTraceIdTestCase ()
+{
+}
+
+void
+SatIdMapperTraceIdTestCase::DoRun (void)
+{
+  Ptr<SatIdMapper> mapper = CreateObject<SatIdMapper> ();
+
+  Mac48Address gwMac = Mac48Address::Allocate ();
+  Mac48Address utMac1 = Mac48Address::Allocate ();
+  Mac48Address utMac2 = Mac48Address::Allocate ();
+
+  uint32_t gwTraceId = mapper->AttachMacToTraceId (gwMac);
+  mapper->AttachMacToGwId (gwMac, 3);
+  mapper->AttachMacToBeamId (gwMac, 7);
+
+  uint32_t utTraceId1 = mapper->AttachMacToTraceId (utMac1);
+  mapper->AttachMacToUtId (utMac1);
+  mapper->AttachMacToBeamId (utMac1, 7);
+
+  uint32_t utTraceId2 = mapper->AttachMacToTraceId (utMac2);
+  mapper->AttachMacToUtId (utMac2);
+  mapper->AttachMacToBeamId (utMac2, 8);
+
+  NS_TEST_ASSERT_MSG_EQ (utTraceId2, gwTraceId + 2, "trace IDs not dense");
+
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetMacWithTraceId (gwTraceId), Address (gwMac), "wrong GW MAC");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetMacWithTraceId (utTraceId1), Address (utMac1), "wrong UT MAC");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetMacWithTraceId (utTraceId2), Address (utMac2), "wrong UT MAC");
+
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetGwIdWithTraceId (gwTraceId), 3, "wrong GW ID");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetUtIdWithTraceId (gwTraceId), -1, "GW has a UT ID");
+
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetUtIdWithTraceId (utTraceId1), mapper->GetUtIdWithMac (utMac1), "wrong UT ID");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetUtIdWithTraceId (utTraceId2), mapper->GetUtIdWithMac (utMac2), "wrong UT ID");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetGwIdWithTraceId (utTraceId1), -1, "UT has a GW ID");
+
+  // zero is reserved for unknown sources, and IDs beyond the given ones are unknown
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetUtIdWithTraceId (0), -1, "trace ID zero found");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetMacWithTraceId (0).IsInvalid (), true, "trace ID zero found");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetGwIdWithTraceId (utTraceId2 + 1), -1, "unknown trace ID found");
+
+  mapper->Reset ();
+
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetMacWithTraceId (gwTraceId).IsInvalid (), true, "trace ID found after reset");
+  NS_TEST_ASSERT_MSG_EQ (mapper->GetUtIdWithTraceId (utTraceId1), -1, "trace ID found after reset");
+
+  mapper->Dispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the MAC tag carries only the addresses.
+ *
+ * The trace ID of the source travels in the signal parameters, so the tag
+ * attached to every packet must not grow with it.
+ *
+ *  Expected result:
+ *   The serialized size of the tag is two MAC addresses, and the addresses
+ *   survive a round trip through a packet.
+ */
+class SatMacTagSizeTestCase : public TestCase
+{
+public:
+  SatMacTagSizeTestCase ();
+  virtual ~SatMacTagSizeTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMacTagSizeTestCase::SatMacTagSizeTestCase ()
+  : TestCase ("Test size and content of the MAC tag.")
+{
+}
+
+SatMacTagSizeTestCase::~SatMacTagSizeTestCase ()
+{
+}
+
+void
+SatMacTagSizeTestCase::DoRun (void)
+{
+  Mac48Address source = Mac48Address::Allocate ();
+  Mac48Address dest = Mac48Address::Allocate ();
+
+  SatMacTag tag;
+  tag.SetSourceAddress (source);
+  tag.SetDestAddress (dest);
+
+  NS_TEST_ASSERT_MSG_EQ (tag.GetSerializedSize (), 12, "unexpected MAC tag size");
+
+  Ptr<Packet> packet = Create<Packet> (100);
+  packet->AddPacketTag (tag);
+
+  SatMacTag readTag;
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (readTag), true, "MAC tag not found");
+  NS_TEST_ASSERT_MSG_EQ (readTag.GetSourceAddress (), source, "wrong source address");
+  NS_TEST_ASSERT_MSG_EQ (readTag.GetDestAddress (), dest, "wrong destination address");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatIdMapper unit test cases.
+ */
+class SatIdMapperTestSuite : public TestSuite
+{
+public:
+  SatIdMapperTestSuite ();
+};
+
+SatIdMapperTestSuite::SatIdMapperTestSuite ()
+  : TestSuite ("sat-id-mapper-unit-test", UNIT)
+{
+  AddTestCase (new SatIdMapperTraceIdTestCase, TestCase::QUICK);
+  AddTestCase (new SatMacTagSizeTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatIdMapperTestSuite satIdMapperUnit;
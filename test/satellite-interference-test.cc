@@ -36,6 +36,9 @@
 #include "../model/satellite-constant-interference.h"
 #include "../model/satellite-traced-interference.h"
 #include "../model/satellite-per-packet-interference.h"
+#include "../model/satellite-precomputed-interference.h"
+#include "../model/satellite-beam-interference-matrix.h"
+#include "../model/satellite-antenna-gain-pattern-container.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
 
@@ -239,6 +242,92 @@ SatPerPacketInterferenceTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite precomputed interference model.
+ *
+ * This case tests that SatPrecomputedInterference object calculates the
+ * interference of the co-channel beams from SatBeamInterferenceMatrix.
+ *  1.  Add three beams to the interference matrix, two of them co-channel.
+ *  2.  Add a receiver to the first beam.
+ *  3.  Notify transmissions of the second and the third beam.
+ *  4.  Get interference of receptions partly overlapping the transmissions.
+ *
+ *  Expected result:
+ *   Interference is the power of the wanted signal multiplied with the gain ratio
+ *   of the second and the first beam at the receiver and the overlapping share
+ *   of the transmission of the second beam. The third beam does not interfere.
+ *
+ */
+class SatPrecomputedInterferenceTestCase : public TestCase
+{
+public:
+  SatPrecomputedInterferenceTestCase ();
+  virtual ~SatPrecomputedInterferenceTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatPrecomputedInterferenceTestCase::SatPrecomputedInterferenceTestCase ()
+  : TestCase ("Test satellite precomputed interference model.")
+{
+}
+
+SatPrecomputedInterferenceTestCase::~SatPrecomputedInterferenceTestCase ()
+{
+}
+
+void
+SatPrecomputedInterferenceTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-if-unit", "precomputed", true);
+
+  SatAntennaGainPatternContainer gpContainer;
+  GeoCoordinate position = GeoCoordinate (50.25, 3.75, 0.0);
+  double ratio = gpContainer.GetAntennaGainPattern (2)->GetAntennaGain_lin (position) / gpContainer.GetAntennaGainPattern (1)->GetAntennaGain_lin (position);
+
+  Address rxAddress = Mac48Address::ConvertFrom (Mac48Address::Allocate ());
+
+  // matrix with a receiver 100 ms from the satellite
+  Ptr<SatBeamInterferenceMatrix> matrix = CreateObject<SatBeamInterferenceMatrix> ();
+  matrix->AddBeam (1, 1, gpContainer.GetAntennaGainPattern (1));
+  matrix->AddReceiver (rxAddress, 1, position, MilliSeconds (100));
+  matrix->AddBeam (2, 1, gpContainer.GetAntennaGainPattern (2));
+  matrix->AddBeam (3, 2, gpContainer.GetAntennaGainPattern (3));
+
+  matrix->NotifyBeamTx (2, MilliSeconds (10));
+  matrix->NotifyBeamTx (3, MilliSeconds (20));
+
+  double ifWrtCarrier = matrix->GetInterferenceWrtCarrier (rxAddress, MilliSeconds (105), MilliSeconds (115));
+  NS_TEST_ASSERT_MSG_EQ_TOL (ifWrtCarrier, 0.5 * ratio, 1e-12, "Interference of half overlapping transmission incorrect");
+
+  ifWrtCarrier = matrix->GetInterferenceWrtCarrier (rxAddress, MilliSeconds (115), MilliSeconds (125));
+  NS_TEST_ASSERT_MSG_EQ_TOL (ifWrtCarrier, 0.0, 1e-12, "Interference of not overlapping transmission incorrect");
+
+  // interference model with a receiver next to the satellite
+  Singleton<SatBeamInterferenceMatrix>::Get ()->AddBeam (1, 1, gpContainer.GetAntennaGainPattern (1));
+  Singleton<SatBeamInterferenceMatrix>::Get ()->AddBeam (2, 1, gpContainer.GetAntennaGainPattern (2));
+  Singleton<SatBeamInterferenceMatrix>::Get ()->AddReceiver (rxAddress, 1, position, Seconds (0));
+  Singleton<SatBeamInterferenceMatrix>::Get ()->NotifyBeamTx (2, MilliSeconds (5));
+
+  Ptr<SatPrecomputedInterference> interference = CreateObject<SatPrecomputedInterference> ();
+  Ptr<SatInterference::InterferenceChangeEvent> event = interference->Add (MilliSeconds (10), 2.0, rxAddress);
+
+  interference->NotifyRxStart (event);
+  double power = interference->Calculate (event);
+  interference->NotifyRxEnd (event);
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (power, 2.0 * 0.5 * ratio, 1e-12, "Calculated power not correct");
+
+  Singleton<SatBeamInterferenceMatrix>::Get ()->Reset ();
+
+  Simulator::Destroy ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite interference unit test cases.
@@ -254,6 +343,7 @@ SatInterferenceTestSuite::SatInterferenceTestSuite ()
 {
   AddTestCase (new SatConstantInterferenceTestCase, TestCase::QUICK);
   AddTestCase (new SatPerPacketInterferenceTestCase, TestCase::QUICK);
+  AddTestCase (new SatPrecomputedInterferenceTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-metadata-tag-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the stamping and removal of SatMetadataTag.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/mac48-address.h"
+#include "ns3/packet.h"
+#include "ns3/callback.h"
+#include "../model/satellite-metadata-tag.h"
+#include "../model/satellite-ut-llc.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test stamping and clearing of the metadata tag.
+ *
+ *  1.  Stamp the time stamps of all the layers to a packet.
+ *  2.  Clear the time stamps one by one, as the receiving layers do.
+ *  3.  Repeat with a packet carrying also the source address.
+ *
+ *  Expected result:
+ *   The time stamps are found until cleared, the tag is removed from the
+ *   packet with the last time stamp, and a tag with the source address is
+ *   kept with the address only.
+ */
+class SatMetadataTagStampTestCase : public TestCase
+{
+public:
+  SatMetadataTagStampTestCase ();
+  virtual ~SatMetadataTagStampTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMetadataTagStampTestCase::SatMetadataTagStampTestCase ()
+  : TestCase ("Test stamping and clearing of the metadata tag.")
+{
+}
+
+SatMetadataTagStampTestCase::~SatMetadataTagStampTestCase ()
+{
+}
+
+void
+SatMetadataTagStampTestCase::DoRun (void)
+{
+  Ptr<Packet> packet = Create<Packet> (100);
+  SatMetadataTag tag;
+
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (tag), false, "new packet is tagged");
+
+  for (uint32_t i = 0; i < SatMetadataTag::TS_COUNT; i++)
+    {
+      SatMetadataTag::StampPacket (packet, (SatMetadataTag::TimestampLayer_t) i, MilliSeconds (10 + i));
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (tag), true, "stamped packet not tagged");
+  NS_TEST_ASSERT_MSG_EQ (tag.HasSourceAddress (), false, "source address set by a time stamp");
+
+  for (uint32_t i = 0; i < SatMetadataTag::TS_COUNT; i++)
+    {
+      SatMetadataTag::TimestampLayer_t layer = (SatMetadataTag::TimestampLayer_t) i;
+      NS_TEST_ASSERT_MSG_EQ (tag.HasTimestamp (layer), true, "time stamp missing");
+      NS_TEST_ASSERT_MSG_EQ (tag.GetTimestamp (layer), MilliSeconds (10 + i), "wrong time stamp");
+    }
+
+  // the receiving layers clear their own time stamps, from the bottom up
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_PHY);
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_MAC);
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_LLC);
+
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (tag), true, "tag removed with time stamps left");
+  NS_TEST_ASSERT_MSG_EQ (tag.HasTimestamp (SatMetadataTag::TS_PHY), false, "PHY time stamp not cleared");
+  NS_TEST_ASSERT_MSG_EQ (tag.HasTimestamp (SatMetadataTag::TS_MAC), false, "MAC time stamp not cleared");
+  NS_TEST_ASSERT_MSG_EQ (tag.HasTimestamp (SatMetadataTag::TS_LLC), false, "LLC time stamp not cleared");
+  NS_TEST_ASSERT_MSG_EQ (tag.HasTimestamp (SatMetadataTag::TS_DEV), true, "device time stamp cleared");
+
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_DEV);
+
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (tag), false, "empty tag not removed");
+
+  // clearing from an untagged packet does nothing
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_DEV);
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (tag), false, "untagged packet got a tag");
+
+  // the source address is kept for the next satellite device
+  Mac48Address source = Mac48Address::Allocate ();
+  SatMetadataTag addressTag;
+  addressTag.SetSourceAddress (source);
+  addressTag.SetTimestamp (SatMetadataTag::TS_DEV, MilliSeconds (20));
+  SatMetadataTag::UpdatePacket (packet, addressTag);
+
+  SatMetadataTag::ClearPacketTimestamp (packet, SatMetadataTag::TS_DEV);
+
+  SatMetadataTag readTag;
+  NS_TEST_ASSERT_MSG_EQ (packet->PeekPacketTag (readTag), true, "tag with source address removed");
+  NS_TEST_ASSERT_MSG_EQ (readTag.HasSourceAddress (), true, "source address cleared");
+  NS_TEST_ASSERT_MSG_EQ (readTag.GetSourceAddress (), source, "wrong source address");
+  NS_TEST_ASSERT_MSG_EQ (readTag.HasTimestamp (SatMetadataTag::TS_DEV), false, "device time stamp not cleared");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the LLC removes its time stamp on reception.
+ *
+ *  1.  Stamp the LLC time stamp to a packet, as SatLlc::Enque does.
+ *  2.  Pass the packet to the receiving LLC of a UT.
+ *
+ *  Expected result:
+ *   The packet passed to the upper layer carries no metadata tag.
+ */
+class SatMetadataTagLlcRemoveTestCase : public TestCase
+{
+public:
+  SatMetadataTagLlcRemoveTestCase ();
+  virtual ~SatMetadataTagLlcRemoveTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Receive (Ptr<Packet> packet);
+
+  Ptr<const Packet> m_received;
+};
+
+SatMetadataTagLlcRemoveTestCase::SatMetadataTagLlcRemoveTestCase ()
+  : TestCase ("Test removal of the metadata tag at the receiving LLC.")
+{
+}
+
+SatMetadataTagLlcRemoveTestCase::~SatMetadataTagLlcRemoveTestCase ()
+{
+}
+
+void
+SatMetadataTagLlcRemoveTestCase::Receive (Ptr<Packet> packet)
+{
+  m_received = packet;
+}
+
+void
+SatMetadataTagLlcRemoveTestCase::DoRun (void)
+{
+  Ptr<SatUtLlc> llc = CreateObject<SatUtLlc> ();
+  llc->SetReceiveCallback (MakeCallback (&SatMetadataTagLlcRemoveTestCase::Receive, this));
+
+  Ptr<Packet> packet = Create<Packet> (100);
+  SatMetadataTag::StampPacket (packet, SatMetadataTag::TS_LLC, Simulator::Now ());
+
+  llc->ReceiveHigherLayerPdu (packet, Mac48Address::Allocate (), Mac48Address::Allocate ());
+
+  NS_TEST_ASSERT_MSG_EQ ((m_received != 0), true, "packet not received");
+
+  SatMetadataTag tag;
+  NS_TEST_ASSERT_MSG_EQ (m_received->PeekPacketTag (tag), false, "metadata tag not removed");
+
+  m_received = 0;
+  llc->Dispose ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatMetadataTag unit test cases.
+ */
+class SatMetadataTagTestSuite : public TestSuite
+{
+public:
+  SatMetadataTagTestSuite ();
+};
+
+SatMetadataTagTestSuite::SatMetadataTagTestSuite ()
+  : TestSuite ("sat-metadata-tag-unit-test", UNIT)
+{
+  AddTestCase (new SatMetadataTagStampTestCase, TestCase::QUICK);
+  AddTestCase (new SatMetadataTagLlcRemoveTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatMetadataTagTestSuite satMetadataTagUnit;
@@ -26,15 +26,19 @@
 
 // Include a header file from your module to test.
 #include <iostream>
+#include <fstream>
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/simulator.h"
 #include "ns3/config.h"
 #include "ns3/boolean.h"
 #include "ns3/string.h"
+#include "ns3/double.h"
 #include "ns3/mobility-helper.h"
 #include "../model/satellite-mobility-model.h"
 #include "../model/satellite-position-allocator.h"
+#include "../model/satellite-constant-position-mobility-model.h"
+#include "../model/satellite-trajectory-mobility-updater.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
 
@@ -313,6 +317,107 @@ SatMobilityList2TestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test trajectory driven satellite mobility.
+ *        (Trajectory mobility model and updater used).
+ *
+ *  This case tests that SatTrajectoryMobilityUpdater advances the position of
+ *  SatTrajectoryMobilityModel according to the trajectory file and notifies
+ *  only the positions exceeding the tolerances.
+ *    1.  Write a trajectory file with a stop, a small move and a large move.
+ *    2.  Create SatTrajectoryMobilityUpdater with position and elevation angle tolerances
+ *        and add a SatTrajectoryMobilityModel object to it.
+ *    3.  Run simulation over the trajectory and count the course changes.
+ *
+ *  Expected result:
+ *    Initial position and the large move are notified, the stop and the small move are not.
+ *    Final position is the last position of the trajectory.
+ *
+ */
+class SatMobilityTrajectoryTestCase : public TestCase
+{
+public:
+  SatMobilityTrajectoryTestCase ();
+  virtual ~SatMobilityTrajectoryTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CourseChanged (Ptr<const SatMobilityModel> position);
+
+  uint32_t m_courseChanges;
+};
+
+SatMobilityTrajectoryTestCase::SatMobilityTrajectoryTestCase ()
+  : TestCase ("Test satellite mobility (trajectory model) with batched updater."),
+    m_courseChanges (0)
+{
+}
+
+SatMobilityTrajectoryTestCase::~SatMobilityTrajectoryTestCase ()
+{
+}
+
+void
+SatMobilityTrajectoryTestCase::CourseChanged (Ptr<const SatMobilityModel> position)
+{
+  m_courseChanges++;
+}
+
+void
+SatMobilityTrajectoryTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-mobility", "trajectory", true);
+
+  // trajectory: initial position, stop, small move (~70 m) and large move (~110 km)
+  std::string fileName = Singleton<SatEnvVariables>::Get ()->GetOutputPath () + "/trajectory.txt";
+  std::ofstream trajectory (fileName.c_str ());
+  trajectory << "0.0 50.0 20.0 0.0" << std::endl;
+  trajectory << "1.0 50.0 20.0 0.0" << std::endl;
+  trajectory << "2.0 50.0 20.001 0.0" << std::endl;
+  trajectory << "3.0 51.0 20.0 0.0" << std::endl;
+  trajectory.close ();
+
+  Ptr<SatConstantPositionMobilityModel> satMobility = CreateObject<SatConstantPositionMobilityModel> ();
+  satMobility->SetGeoPosition (GeoCoordinate (0.0, 33.0, 35786000.0));
+
+  Ptr<SatTrajectoryMobilityUpdater> updater = CreateObject<SatTrajectoryMobilityUpdater> (satMobility);
+  updater->SetAttribute ("UpdateInterval", TimeValue (Seconds (1.0)));
+  updater->SetAttribute ("PositionTolerance", DoubleValue (1000.0));
+  updater->SetAttribute ("ElevationAngleTolerance", DoubleValue (0.1));
+
+  Ptr<SatTrajectoryMobilityModel> model = CreateObject<SatTrajectoryMobilityModel> ();
+  model->TraceConnectWithoutContext ("SatCourseChange",
+                                     MakeCallback (&SatMobilityTrajectoryTestCase::CourseChanged, this));
+
+  updater->Add (model, fileName);
+
+  NS_TEST_ASSERT_MSG_EQ (m_courseChanges, 1, "Initial position not notified.");
+  NS_TEST_ASSERT_MSG_EQ (model->GetGeoPosition ().GetLatitude (), 50.0, "Initial latitude is different.");
+
+  Simulator::Stop (Seconds (3.5));
+  Simulator::Run ();
+
+  GeoCoordinate pos = model->GetGeoPosition ();
+  Vector cartesian = model->GetPosition ();
+  Vector expected = pos.ToVector ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_courseChanges, 2, "Unexpected number of notified positions.");
+  NS_TEST_ASSERT_MSG_EQ (pos.GetLatitude (), 51.0, "Latitude is different.");
+  NS_TEST_ASSERT_MSG_EQ (pos.GetLongitude (), 20.0, "Longitude is different.");
+  NS_TEST_ASSERT_MSG_LT (CalculateDistance (cartesian, expected), 0.001, "Cartesian position differs from converted one.");
+  NS_TEST_ASSERT_MSG_GT (model->GetVelocity ().x * model->GetVelocity ().x
+                         + model->GetVelocity ().y * model->GetVelocity ().y
+                         + model->GetVelocity ().z * model->GetVelocity ().z, 0.0, "Velocity not set.");
+
+  updater->Dispose ();
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite mobility unit test cases.
@@ -329,6 +434,7 @@ SatMobilityTestSuite::SatMobilityTestSuite ()
   AddTestCase (new SatMobilityRandomTestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList1TestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList2TestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityTrajectoryTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
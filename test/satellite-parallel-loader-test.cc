@@ -0,0 +1,210 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-parallel-loader-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test that the values loaded by SatParallelLoader
+ * do not depend on the number of loader threads.
+ */
+
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/config.h"
+#include "ns3/uinteger.h"
+#include "ns3/singleton.h"
+#include "../model/satellite-enums.h"
+#include "../model/satellite-link-results.h"
+#include "../model/satellite-antenna-gain-pattern.h"
+#include "../model/satellite-antenna-gain-pattern-container.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the link results do not depend on the
+ * number of loader threads.
+ *
+ *  1.  Load the DVB-RCS2 and DVB-S2 link results with one loader thread.
+ *  2.  Load them again with four loader threads.
+ *  3.  Compare the BLERs of every waveform and MODCOD over a range of Eb/No
+ *      and Es/No values.
+ *
+ *  Expected result:
+ *   The BLERs are equal.
+ */
+class SatParallelLoaderLinkResultsTestCase : public TestCase
+{
+public:
+  SatParallelLoaderLinkResultsTestCase ();
+  virtual ~SatParallelLoaderLinkResultsTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatParallelLoaderLinkResultsTestCase::SatParallelLoaderLinkResultsTestCase ()
+  : TestCase ("Test that link results loaded with one and several threads are equal.")
+{
+}
+
+SatParallelLoaderLinkResultsTestCase::~SatParallelLoaderLinkResultsTestCase ()
+{
+}
+
+void
+SatParallelLoaderLinkResultsTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-parallel-loader", "link-results", true);
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (1));
+
+  Ptr<SatLinkResultsDvbRcs2> refRcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+  refRcs2->Initialize ();
+  Ptr<SatLinkResultsDvbS2> refS2 = CreateObject<SatLinkResultsDvbS2> ();
+  refS2->Initialize ();
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (4));
+
+  Ptr<SatLinkResultsDvbRcs2> rcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+  rcs2->Initialize ();
+  Ptr<SatLinkResultsDvbS2> s2 = CreateObject<SatLinkResultsDvbS2> ();
+  s2->Initialize ();
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (0));
+
+  // waveform ids 2-22 are supported
+  for (uint32_t waveformId = 2; waveformId <= 22; ++waveformId)
+    {
+      for (double ebNoDb = -5.0; ebNoDb <= 20.0; ebNoDb += 0.25)
+        {
+          NS_TEST_ASSERT_MSG_EQ (rcs2->GetBler (waveformId, ebNoDb), refRcs2->GetBler (waveformId, ebNoDb),
+                                 "different BLER of waveform " << waveformId << " at " << ebNoDb << " dB");
+        }
+    }
+
+  std::vector<SatEnums::SatModcod_t> modcods;
+  SatEnums::GetAvailableModcodsFwdLink (modcods);
+
+  for (std::vector<SatEnums::SatModcod_t>::const_iterator it = modcods.begin (); it != modcods.end (); ++it)
+    {
+      for (double esNoDb = -5.0; esNoDb <= 20.0; esNoDb += 0.25)
+        {
+          NS_TEST_ASSERT_MSG_EQ (s2->GetBler (*it, SatEnums::NORMAL_FRAME, esNoDb), refS2->GetBler (*it, SatEnums::NORMAL_FRAME, esNoDb),
+                                 "different BLER of " << SatEnums::GetModcodTypeName (*it) << " at " << esNoDb << " dB");
+          NS_TEST_ASSERT_MSG_EQ (s2->GetBler (*it, SatEnums::SHORT_FRAME, esNoDb), refS2->GetBler (*it, SatEnums::SHORT_FRAME, esNoDb),
+                                 "different short frame BLER of " << SatEnums::GetModcodTypeName (*it) << " at " << esNoDb << " dB");
+        }
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the antenna gain patterns do not depend on
+ * the number of loader threads.
+ *
+ *  1.  Load the antenna gain patterns with one loader thread.
+ *  2.  Load them again with four loader threads.
+ *  3.  Compare the gains of every beam and the best beams at the GW positions
+ *      of the 72 beam reference system.
+ *
+ *  Expected result:
+ *   The gains and the best beams are equal.
+ */
+class SatParallelLoaderAntennaPatternTestCase : public TestCase
+{
+public:
+  SatParallelLoaderAntennaPatternTestCase ();
+  virtual ~SatParallelLoaderAntennaPatternTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatParallelLoaderAntennaPatternTestCase::SatParallelLoaderAntennaPatternTestCase ()
+  : TestCase ("Test that antenna gain patterns loaded with one and several threads are equal.")
+{
+}
+
+SatParallelLoaderAntennaPatternTestCase::~SatParallelLoaderAntennaPatternTestCase ()
+{
+}
+
+void
+SatParallelLoaderAntennaPatternTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-parallel-loader", "antenna-patterns", true);
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (1));
+  Ptr<SatAntennaGainPatternContainer> refContainer = CreateObject<SatAntennaGainPatternContainer> ();
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (4));
+  Ptr<SatAntennaGainPatternContainer> container = CreateObject<SatAntennaGainPatternContainer> ();
+
+  Config::SetGlobal ("SatParallelLoaderThreads", UintegerValue (0));
+
+  // GW positions of the 72 beam reference system
+  std::vector<GeoCoordinate> coordinates;
+  coordinates.push_back (GeoCoordinate (50.25, 3.75, 0.0));
+  coordinates.push_back (GeoCoordinate (64.00, 8.25, 0.0));
+  coordinates.push_back (GeoCoordinate (42.25, -4.50, 0.0));
+  coordinates.push_back (GeoCoordinate (44.50, 13.50, 0.0));
+  coordinates.push_back (GeoCoordinate (37.25, 23.75, 0.0));
+
+  for (uint32_t i = 0; i < coordinates.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (container->GetBestBeamId (coordinates[i]), refContainer->GetBestBeamId (coordinates[i]),
+                             "different best beam at position " << i);
+
+      for (uint32_t beamId = 1; beamId <= 72; ++beamId)
+        {
+          NS_TEST_ASSERT_MSG_EQ (container->GetAntennaGainPattern (beamId)->GetAntennaGain_lin (coordinates[i]),
+                                 refContainer->GetAntennaGainPattern (beamId)->GetAntennaGain_lin (coordinates[i]),
+                                 "different gain of beam " << beamId << " at position " << i);
+        }
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatParallelLoader unit test cases.
+ */
+class SatParallelLoaderTestSuite : public TestSuite
+{
+public:
+  SatParallelLoaderTestSuite ();
+};
+
+SatParallelLoaderTestSuite::SatParallelLoaderTestSuite ()
+  : TestSuite ("sat-parallel-loader-unit-test", UNIT)
+{
+  AddTestCase (new SatParallelLoaderLinkResultsTestCase, TestCase::QUICK);
+  AddTestCase (new SatParallelLoaderAntennaPatternTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatParallelLoaderTestSuite satParallelLoaderUnit;
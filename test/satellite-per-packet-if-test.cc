@@ -54,7 +54,7 @@ static void LinkBudgetTraceCb ( std::string context, Ptr<SatSignalParameters> pa
                 << ", ChType= " << std::setw (17) << SatEnums::GetChannelTypeName (params->m_channelType)
                 << ", OwnAddr= " << ownAdd
                 << ", DestAddr= " << destAdd
-                << ", Beam= " << std::setw (2) << params->m_beamId
+                << ", Beam= " << std::setw (2) << params->m_burst->m_beamId
                 << ", Freq= " << params->m_carrierFreq_hz
                 << ", IFPwr= " << std::setw (8) << SatUtils::WToDbW<double> ( ifPower )
                 << ", RXPwr= " << std::setw (8) << SatUtils::WToDbW<double> ( params->m_rxPower_W )
@@ -271,13 +271,13 @@ SatPerPacketFwdLinkUserTestCase::DoRun (void)
 
   // set callback traces where we want results out
 
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
   NodeContainer utUsers = helper->GetUtUsers ();
@@ -426,13 +426,13 @@ SatPerPacketFwdLinkFullTestCase::DoRun (void)
 
   // set callback traces where we want results out
 
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
   NodeContainer utUsers = helper->GetUtUsers ();
@@ -585,13 +585,13 @@ SatPerPacketRtnLinkUserTestCase::DoRun (void)
 
   // set callback traces where we want results out
 
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
   NodeContainer utUsers = helper->GetUtUsers ();
@@ -711,13 +711,13 @@ SatPerPacketRtnLinkFullTestCase::DoRun (void)
 
   // set callback traces where we want results out
 
-  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/UserPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
-  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/RxCarrierList/*/LinkBudgetTrace",
+  Config::Connect ("/NodeList/*/DeviceList/*/FeederPhy/*/PhyRx/LinkBudgetTrace",
                    MakeCallback (&LinkBudgetTraceCb));
 
   NodeContainer utUsers = helper->GetUtUsers ();
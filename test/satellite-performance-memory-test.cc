@@ -28,6 +28,8 @@
  *
  */
 
+#include <algorithm>
+#include <limits>
 #include "ns3/string.h"
 #include "ns3/packet-sink-helper.h"
 #include "ns3/packet-sink.h"
@@ -39,8 +41,16 @@
 #include "ns3/cbr-application.h"
 #include "ns3/cbr-helper.h"
 #include "../helper/satellite-helper.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
+#include "../utils/satellite-accounting-simulator-impl.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-phy.h"
+#include "../model/satellite-phy-rx.h"
+#include "../model/satellite-phy-rx-carrier-per-slot.h"
+#include "ns3/satellite-id-mapper.h"
 
 using namespace ns3;
 
@@ -162,6 +172,175 @@ Pm1::DoRun (void)
 }
 
 
+/**
+ * \ingroup satellite
+ * \brief 'UT stack memory consumption' test case implementation, id: pm-2.
+ *
+ * 1.  User defined scenario is created twice in one beam, once with one UT and
+ *     once with several UTs, both with the full and the compact UT stack profile
+ *     (attribute SatUtHelper::CompactStack). The forward link band is divided
+ *     into four carriers.
+ * 2.  GW connected user sends packets to every UT connected user and every UT
+ *     connected user sends packets to the GW connected user, so that the
+ *     objects created on first use exist.
+ * 3.  Heap bytes in use after the traffic are counted, and the bytes per UT
+ *     are calculated from the difference of the two scenarios.
+ *
+ * Expected results: The compact UT stack leaves the unused forward link
+ * carriers of the UTs uncreated, and saves per UT more than the size of the
+ * carriers left uncreated. The rest of the UT stack is the same in both
+ * profiles, so the saving is a small part of the bytes per UT.
+ */
+class Pm2 : public TestCase
+{
+public:
+  Pm2 ();
+  virtual ~Pm2 ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Create a scenario, run traffic in it and count the heap bytes in
+   * use for it.
+   * \param utCount number of UTs in the beam
+   * \param compactStack whether to use the compact UT stack profile
+   * \param uncreatedCarriers least number of RX carriers left uncreated in a UT
+   * by the end of the run
+   * \return bytes in use
+   */
+  int64_t MeasureScenarioBytes (uint32_t utCount, bool compactStack, uint32_t &uncreatedCarriers);
+
+  /**
+   * \brief Calculate the bytes in use per UT.
+   * \param compactStack whether to use the compact UT stack profile
+   * \param uncreatedCarriers least number of RX carriers left uncreated in a UT
+   * \return bytes in use per UT
+   */
+  double MeasureBytesPerUt (bool compactStack, uint32_t &uncreatedCarriers);
+};
+
+Pm2::Pm2 ()
+  : TestCase ("'UT stack memory consumption' compares the bytes in use per UT with the full and compact UT stacks.")
+{
+}
+
+Pm2::~Pm2 ()
+{
+}
+
+int64_t
+Pm2::MeasureScenarioBytes (uint32_t utCount, bool compactStack, uint32_t &uncreatedCarriers)
+{
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatUtHelper::CompactStack", BooleanValue (compactStack));
+  Config::SetDefault ("ns3::SatConf::FwdCarrierAllocatedBandwidth", DoubleValue (0.03125e9));
+
+  uint64_t bytes = SatAccountingSimulatorImpl::GetLiveBytes ();
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[8] = SatBeamUserInfo (utCount, 1);
+  helper->CreateUserDefinedScenario (beamMap);
+
+  Config::SetDefault ("ns3::SatUtHelper::CompactStack", BooleanValue (false));
+  Config::SetDefault ("ns3::SatConf::FwdCarrierAllocatedBandwidth", DoubleValue (0.125e9));
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("0.5s"));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+
+  ApplicationContainer apps = sink.Install (gwUsers.Get (0));
+  apps.Add (cbr.Install (utUsers));
+
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      Address utAddress = Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port));
+
+      sink.SetAttribute ("Local", AddressValue (utAddress));
+      apps.Add (sink.Install (utUsers.Get (i)));
+
+      cbr.SetAttribute ("Remote", AddressValue (utAddress));
+      apps.Add (cbr.Install (gwUsers.Get (0)));
+    }
+
+  apps.Start (Seconds (1.0));
+  apps.Stop (Seconds (1.9));
+
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+
+  int64_t usedBytes = (int64_t) SatAccountingSimulatorImpl::GetLiveBytes () - (int64_t) bytes;
+
+  NodeContainer uts = helper->GetBeamHelper ()->GetUtNodes ();
+  uncreatedCarriers = std::numeric_limits<uint32_t>::max ();
+
+  for (NodeContainer::Iterator it = uts.Begin (); it != uts.End (); it++)
+    {
+      for (uint32_t i = 0; i < (*it)->GetNDevices (); i++)
+        {
+          Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> ((*it)->GetDevice (i));
+
+          if (satNd != NULL)
+            {
+              Ptr<SatPhyRx> phyRx = satNd->GetPhy ()->GetPhyRx ();
+              uncreatedCarriers = std::min (uncreatedCarriers, phyRx->GetNRxCarriers () - phyRx->GetNCreatedRxCarriers ());
+            }
+        }
+    }
+
+  Simulator::Destroy ();
+
+  return usedBytes;
+}
+
+double
+Pm2::MeasureBytesPerUt (bool compactStack, uint32_t &uncreatedCarriers)
+{
+  const uint32_t utCount = 21;
+
+  int64_t oneUtBytes = MeasureScenarioBytes (1, compactStack, uncreatedCarriers);
+  int64_t manyUtBytes = MeasureScenarioBytes (utCount, compactStack, uncreatedCarriers);
+
+  return (double) (manyUtBytes - oneUtBytes) / (utCount - 1);
+}
+
+void
+Pm2::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-perf-mem", "ut-stack", true);
+
+  NS_TEST_ASSERT_MSG_EQ (SatAccountingSimulatorImpl::IsAllocationCountingEnabled (), true, "Test runner not linked with the counting operator new!");
+
+  uint32_t fullUncreatedCarriers = 0;
+  uint32_t compactUncreatedCarriers = 0;
+  double fullBytesPerUt = MeasureBytesPerUt (false, fullUncreatedCarriers);
+  double compactBytesPerUt = MeasureBytesPerUt (true, compactUncreatedCarriers);
+
+  NS_TEST_ASSERT_MSG_GT (fullBytesPerUt, 0.0, "No memory used for UTs!");
+  NS_TEST_ASSERT_MSG_GT (compactBytesPerUt, 0.0, "No memory used for UTs with compact stack!");
+  NS_TEST_ASSERT_MSG_EQ (fullUncreatedCarriers, 0, "Carriers left uncreated with the full stack!");
+  NS_TEST_ASSERT_MSG_GT (compactUncreatedCarriers, 0, "Unused carriers created with the compact stack!");
+
+  // the saving covers at least the carrier objects left uncreated, not their own allocations
+  double uncreatedCarrierBytes = (double) compactUncreatedCarriers * sizeof (SatPhyRxCarrierPerSlot);
+  NS_TEST_ASSERT_MSG_GT (fullBytesPerUt - compactBytesPerUt, uncreatedCarrierBytes, "Compact UT stack does not save the uncreated carriers!");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+
 // The TestSuite class names the TestSuite as sat-perf-mem, identifies what type of TestSuite (SYSTEM),
 // and enables the TestCases to be run.  Typically, only the constructor for
 // this class must be defined
@@ -177,6 +356,7 @@ PerfMemTestSuite::PerfMemTestSuite ()
 {
   // add pm-1 case to suite sat-perf-mem
   AddTestCase (new Pm1, TestCase::QUICK);
+  AddTestCase (new Pm2, TestCase::QUICK);
 }
 
 // Allocate an instance of this TestSuite
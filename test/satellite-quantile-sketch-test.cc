@@ -0,0 +1,230 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-quantile-sketch-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the quantile sketch distribution collector.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "../stats/satellite-quantile-sketch-collector.h"
+#include <cmath>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the accuracy of the quantiles produced by the
+ *        sketch, with positive, negative and zero valued samples.
+ *
+ *  Expected result:
+ *    Every quantile is within the relative accuracy of the exact quantile.
+ */
+class SatQuantileSketchAccuracyTestCase : public TestCase
+{
+public:
+  SatQuantileSketchAccuracyTestCase ();
+  virtual ~SatQuantileSketchAccuracyTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatQuantileSketchAccuracyTestCase::SatQuantileSketchAccuracyTestCase ()
+  : TestCase ("Test quantile accuracy of the sketch collector.")
+{
+}
+
+SatQuantileSketchAccuracyTestCase::~SatQuantileSketchAccuracyTestCase ()
+{
+}
+
+void
+SatQuantileSketchAccuracyTestCase::DoRun (void)
+{
+  Ptr<SatQuantileSketchCollector> sketch = CreateObject<SatQuantileSketchCollector> ();
+  const double accuracy = sketch->GetRelativeAccuracy ();
+
+  // Samples -10.00, -9.99, ..., 9.99, 10.00 in shuffled order
+  std::vector<double> samples;
+  for (int32_t i = -1000; i <= 1000; ++i)
+    {
+      samples.push_back (i / 100.0);
+    }
+
+  for (uint32_t i = 0; i < samples.size (); ++i)
+    {
+      sketch->TraceSinkDouble (0.0, samples[(i * 7919) % samples.size ()]);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (sketch->GetCount (), samples.size (), "Sample count incorrect");
+
+  const double quantiles[] = { 0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0 };
+  for (uint32_t i = 0; i < sizeof (quantiles) / sizeof (double); ++i)
+    {
+      const double exact = samples[static_cast<uint32_t> (quantiles[i] * (samples.size () - 1))];
+      const double estimate = sketch->GetQuantile (quantiles[i]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (estimate, exact, std::fabs (exact) * accuracy + 1e-9,
+                                 "Quantile " << quantiles[i] << " incorrect");
+    }
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the number of sketch buckets is bounded, and
+ *        that collapsing affects only the lower tail of the distribution.
+ *
+ *  Expected result:
+ *    Number of buckets does not exceed the limit, and the high quantiles are
+ *    still within the relative accuracy.
+ */
+class SatQuantileSketchBoundedTestCase : public TestCase
+{
+public:
+  SatQuantileSketchBoundedTestCase ();
+  virtual ~SatQuantileSketchBoundedTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatQuantileSketchBoundedTestCase::SatQuantileSketchBoundedTestCase ()
+  : TestCase ("Test bounded memory of the sketch collector.")
+{
+}
+
+SatQuantileSketchBoundedTestCase::~SatQuantileSketchBoundedTestCase ()
+{
+}
+
+void
+SatQuantileSketchBoundedTestCase::DoRun (void)
+{
+  Ptr<SatQuantileSketchCollector> sketch = CreateObject<SatQuantileSketchCollector> ();
+  sketch->SetAttribute ("MaxNumOfBins", UintegerValue (64));
+  const double accuracy = sketch->GetRelativeAccuracy ();
+
+  // Samples spanning twelve orders of magnitude
+  std::vector<double> samples;
+  for (uint32_t i = 0; i < 1200; ++i)
+    {
+      samples.push_back (1e-6 * std::pow (10.0, i / 100.0));
+    }
+
+  for (uint32_t i = 0; i < samples.size (); ++i)
+    {
+      sketch->TraceSinkDouble1 (samples[i]);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((sketch->GetNumOfBins () <= 64), true, "Too many buckets in use");
+
+  const double exact = samples[static_cast<uint32_t> (0.99 * (samples.size () - 1))];
+  NS_TEST_ASSERT_MSG_EQ_TOL (sketch->GetQuantile (0.99), exact, exact * accuracy,
+                             "High quantile incorrect after collapsing");
+  NS_TEST_ASSERT_MSG_EQ_TOL (sketch->GetQuantile (1.0), samples.back (), 1e-9,
+                             "Maximum incorrect after collapsing");
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that merging sketches is equivalent to feeding all
+ *        samples into a single sketch.
+ *
+ *  Expected result:
+ *    Merged sketch produces identical quantiles to the single sketch.
+ */
+class SatQuantileSketchMergeTestCase : public TestCase
+{
+public:
+  SatQuantileSketchMergeTestCase ();
+  virtual ~SatQuantileSketchMergeTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatQuantileSketchMergeTestCase::SatQuantileSketchMergeTestCase ()
+  : TestCase ("Test merging of sketch collectors.")
+{
+}
+
+SatQuantileSketchMergeTestCase::~SatQuantileSketchMergeTestCase ()
+{
+}
+
+void
+SatQuantileSketchMergeTestCase::DoRun (void)
+{
+  Ptr<SatQuantileSketchCollector> all = CreateObject<SatQuantileSketchCollector> ();
+  Ptr<SatQuantileSketchCollector> merged = CreateObject<SatQuantileSketchCollector> ();
+  std::vector<Ptr<SatQuantileSketchCollector> > parts;
+
+  for (uint32_t i = 0; i < 4; ++i)
+    {
+      parts.push_back (CreateObject<SatQuantileSketchCollector> ());
+    }
+
+  for (uint32_t i = 0; i < 4000; ++i)
+    {
+      const double sample = 0.5 + 0.001 * ((i * 37) % 1000) - 0.25 * (i % 4);
+      all->TraceSinkDouble1 (sample);
+      parts[i % 4]->TraceSinkDouble1 (sample);
+    }
+
+  for (uint32_t i = 0; i < parts.size (); ++i)
+    {
+      merged->Merge (parts[i]);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (merged->GetCount (), all->GetCount (), "Merged sample count incorrect");
+
+  for (double q = 0.0; q <= 1.0; q += 0.05)
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (merged->GetQuantile (q), all->GetQuantile (q), 1e-12,
+                                 "Merged quantile " << q << " incorrect");
+    }
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the quantile sketch distribution collector.
+ */
+class SatQuantileSketchTestSuite : public TestSuite
+{
+public:
+  SatQuantileSketchTestSuite ();
+};
+
+SatQuantileSketchTestSuite::SatQuantileSketchTestSuite ()
+  : TestSuite ("sat-quantile-sketch-unit-test", UNIT)
+{
+  AddTestCase (new SatQuantileSketchAccuracyTestCase, TestCase::QUICK);
+  AddTestCase (new SatQuantileSketchBoundedTestCase, TestCase::QUICK);
+  AddTestCase (new SatQuantileSketchMergeTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatQuantileSketchTestSuite satQuantileSketchUnit;
@@ -0,0 +1,307 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-queue-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the size class counters of SatQueue and
+ *        the event-driven tracking of the queue size.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/callback.h"
+#include "ns3/mac48-address.h"
+#include "../model/satellite-queue.h"
+#include "../model/satellite-gw-llc.h"
+#include "../model/satellite-node-info.h"
+#include <deque>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the size class counters and the number of
+ *        smaller packets against a reference queue, while packets are
+ *        enqueued, dequeued and pushed back to the front.
+ *
+ *  Expected result:
+ *    Counters and the number of smaller packets match the reference.
+ */
+class SatQueueSizeClassTestCase : public TestCase
+{
+public:
+  SatQueueSizeClassTestCase ();
+  virtual ~SatQueueSizeClassTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatQueueSizeClassTestCase::SatQueueSizeClassTestCase ()
+  : TestCase ("Test size class counters of satellite queue.")
+{
+}
+
+SatQueueSizeClassTestCase::~SatQueueSizeClassTestCase ()
+{
+}
+
+void
+SatQueueSizeClassTestCase::DoRun (void)
+{
+  Ptr<SatQueue> queue = CreateObject<SatQueue> ();
+  queue->SetAttribute ("MaxPackets", UintegerValue (100));
+
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  rand->SetStream (1);
+
+  std::deque<uint32_t> reference;
+
+  for (uint32_t round = 0; round < 2000; ++round)
+    {
+      uint32_t action = rand->GetInteger (0, 2);
+
+      if (action < 2 && reference.size () < 100)
+        {
+          uint32_t size = rand->GetInteger (1, 1500);
+          queue->Enqueue (Create<Packet> (size));
+          reference.push_back (size);
+        }
+      else if (!reference.empty ())
+        {
+          Ptr<Packet> p = queue->Dequeue ();
+          NS_TEST_ASSERT_MSG_EQ (p->GetSize (), reference.front (), "Dequeued packet size incorrect");
+          reference.pop_front ();
+
+          // push back a fragment every now and then
+          if (p->GetSize () > 100 && rand->GetInteger (0, 1) == 0)
+            {
+              queue->PushFront (Create<Packet> (p->GetSize () / 2));
+              reference.push_front (p->GetSize () / 2);
+            }
+        }
+
+      uint32_t classPackets[SatQueue::NUM_SIZE_CLASSES] = { 0 };
+      uint32_t classBytes[SatQueue::NUM_SIZE_CLASSES] = { 0 };
+
+      for (std::deque<uint32_t>::const_iterator it = reference.begin (); it != reference.end (); ++it)
+        {
+          ++classPackets[SatQueue::GetSizeClass (*it)];
+          classBytes[SatQueue::GetSizeClass (*it)] += *it;
+        }
+
+      for (uint32_t sizeClass = 0; sizeClass < SatQueue::NUM_SIZE_CLASSES; ++sizeClass)
+        {
+          NS_TEST_ASSERT_MSG_EQ (queue->GetNPacketsInSizeClass (sizeClass), classPackets[sizeClass], "Size class packets incorrect");
+          NS_TEST_ASSERT_MSG_EQ (queue->GetNBytesInSizeClass (sizeClass), classBytes[sizeClass], "Size class bytes incorrect");
+        }
+
+      uint32_t threshold = rand->GetInteger (0, 1600);
+      uint32_t smaller = 0;
+
+      for (std::deque<uint32_t>::const_iterator it = reference.begin ();
+           it != reference.end () && *it <= threshold; ++it)
+        {
+          ++smaller;
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (queue->GetNumSmallerPackets (threshold), smaller, "Number of smaller packets incorrect");
+    }
+
+  queue->Dispose ();
+  Simulator::Destroy ();
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the queue size tracked from the QueueSizeChange
+ *        trace source of the LLC against the sampled queue size.
+ *
+ *  1.  Enqueue packets to a GW LLC and give it transmission opportunities
+ *      every 10 ms for one second.
+ *  2.  Integrate the queue size from the QueueSizeChange trace over time.
+ *  3.  Sample the queue size of the LLC in the middle of every millisecond.
+ *  4.  Repeat with a GW LLC without queue size tracking enabled.
+ *
+ *  Expected result:
+ *    The time-weighted average of the tracked size equals the average of the
+ *    samples, and nothing is traced without queue size tracking.
+ */
+class SatQueueEventDrivenSizeTestCase : public TestCase
+{
+public:
+  SatQueueEventDrivenSizeTestCase ();
+  virtual ~SatQueueEventDrivenSizeTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void QueueSizeChanged (Mac48Address source, Mac48Address dest, int32_t bytesDelta, int32_t packetsDelta);
+  void Step (uint32_t step);
+  void Sample ();
+
+  Ptr<SatGwLlc> m_llc;
+  Mac48Address m_utAddress;
+  uint32_t m_changes;
+  int64_t m_bytes;
+  Time m_lastChange;
+  double m_area;
+  double m_sampleSum;
+  uint32_t m_samples;
+};
+
+SatQueueEventDrivenSizeTestCase::SatQueueEventDrivenSizeTestCase ()
+  : TestCase ("Test event-driven queue size against the sampled queue size."),
+    m_changes (0),
+    m_bytes (0),
+    m_area (0.0),
+    m_sampleSum (0.0),
+    m_samples (0)
+{
+}
+
+SatQueueEventDrivenSizeTestCase::~SatQueueEventDrivenSizeTestCase ()
+{
+}
+
+void
+SatQueueEventDrivenSizeTestCase::QueueSizeChanged (Mac48Address source, Mac48Address dest,
+                                                   int32_t bytesDelta, int32_t packetsDelta)
+{
+  m_changes++;
+  m_area += m_bytes * (Simulator::Now () - m_lastChange).GetSeconds ();
+  m_lastChange = Simulator::Now ();
+  m_bytes += bytesDelta;
+}
+
+void
+SatQueueEventDrivenSizeTestCase::Step (uint32_t step)
+{
+  // bursts of one or two packets, and a transmission opportunity every fourth step
+  if (step % 3 != 2)
+    {
+      for (uint32_t i = 0; i <= step % 2; i++)
+        {
+          m_llc->Enque (Create<Packet> (100 + 10 * step), m_utAddress, 0);
+        }
+    }
+
+  if (step % 4 == 3)
+    {
+      uint32_t bytesLeft = 0;
+      uint32_t nextMinTxO = 0;
+      m_llc->NotifyTxOpportunity (4000, m_utAddress, 0, bytesLeft, nextMinTxO);
+    }
+}
+
+void
+SatQueueEventDrivenSizeTestCase::Sample ()
+{
+  m_sampleSum += m_llc->GetNBytesInQueue (m_utAddress);
+  m_samples++;
+}
+
+void
+SatQueueEventDrivenSizeTestCase::DoRun (void)
+{
+  m_utAddress = Mac48Address::Allocate ();
+
+  for (uint32_t run = 0; run < 2; run++)
+    {
+      bool trackingEnabled = (run == 0);
+
+      m_changes = 0;
+      m_bytes = 0;
+      m_lastChange = Seconds (0);
+      m_area = 0.0;
+      m_sampleSum = 0.0;
+      m_samples = 0;
+
+      m_llc = CreateObject<SatGwLlc> ();
+      m_llc->SetNodeInfo (Create<SatNodeInfo> (SatEnums::NT_GW, 0, Mac48Address::Allocate ()));
+
+      if (trackingEnabled)
+        {
+          m_llc->EnableQueueSizeTracking ();
+        }
+
+      m_llc->TraceConnectWithoutContext ("QueueSizeChange",
+                                         MakeCallback (&SatQueueEventDrivenSizeTestCase::QueueSizeChanged, this));
+
+      for (uint32_t step = 0; step < 100; step++)
+        {
+          Simulator::Schedule (MilliSeconds (10 * step), &SatQueueEventDrivenSizeTestCase::Step, this, step);
+        }
+
+      for (uint32_t sample = 0; sample < 1000; sample++)
+        {
+          Simulator::Schedule (MicroSeconds (1000 * sample + 500), &SatQueueEventDrivenSizeTestCase::Sample, this);
+        }
+
+      Simulator::Stop (Seconds (1));
+      Simulator::Run ();
+
+      // the run lasts one second, thus the area is the time-weighted average
+      m_area += m_bytes * (Seconds (1) - m_lastChange).GetSeconds ();
+
+      NS_TEST_ASSERT_MSG_EQ (m_samples, 1000, "Unexpected number of samples");
+      NS_TEST_ASSERT_MSG_GT (m_sampleSum, 0.0, "Nothing was queued");
+
+      if (trackingEnabled)
+        {
+          NS_TEST_ASSERT_MSG_GT (m_changes, 0, "Queue size changes not traced");
+          NS_TEST_ASSERT_MSG_EQ (m_bytes, m_llc->GetNBytesInQueue (m_utAddress), "Tracked queue size incorrect");
+          NS_TEST_ASSERT_MSG_EQ_TOL (m_area, m_sampleSum / m_samples, 1e-6 * m_sampleSum / m_samples,
+                                     "Time-weighted queue size differs from the sampled one");
+        }
+      else
+        {
+          NS_TEST_ASSERT_MSG_EQ (m_changes, 0, "Queue size changes traced without tracking enabled");
+        }
+
+      m_llc->Dispose ();
+      m_llc = 0;
+      Simulator::Destroy ();
+    }
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for satellite queue.
+ */
+class SatQueueTestSuite : public TestSuite
+{
+public:
+  SatQueueTestSuite ();
+};
+
+SatQueueTestSuite::SatQueueTestSuite ()
+  : TestSuite ("sat-queue-unit-test", UNIT)
+{
+  AddTestCase (new SatQueueSizeClassTestCase, TestCase::QUICK);
+  AddTestCase (new SatQueueEventDrivenSizeTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatQueueTestSuite satQueueUnit;
@@ -33,6 +33,8 @@
 #include "ns3/simulator.h"
 #include "ns3/core-module.h"
 #include "../helper/satellite-helper.h"
+#include "../helper/simulation-helper.h"
+#include "../model/satellite-mobility-model.h"
 #include "ns3/singleton.h"
 #include "ns3/satellite-id-mapper.h"
 #include "../utils/satellite-env-variables.h"
@@ -338,6 +340,122 @@ ScenarioCreationUser::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief 'Scenario Creation, UT layout' test case implementation.
+ *
+ * This case tests that a UT layout saved from a created scenario gives the
+ * same UTs when loaded for the next scenario.
+ *  1.  Scenario with random UT positions and two UTs with two users per beam created
+ *      with simulation helper and its UT layout saved to a file.
+ *  2.  New scenario created with simulation helper from the saved UT layout.
+ *
+ *  Expected result:
+ *    • Both scenarios have the same beams, and the same UT count per beam.
+ *    • Every UT has the same position and the same user count in both scenarios.
+ *
+ */
+class ScenarioCreationUtLayout : public TestCase
+{
+public:
+  ScenarioCreationUtLayout ();
+  virtual ~ScenarioCreationUtLayout ();
+
+private:
+  virtual void DoRun (void);
+
+  typedef std::map<uint32_t, std::vector<std::pair<GeoCoordinate, uint32_t> > > UtLayout_t;
+
+  // get the beams, UT positions and user counts of a created scenario
+  UtLayout_t GetUtLayout (Ptr<SatHelper> helper) const;
+};
+
+ScenarioCreationUtLayout::ScenarioCreationUtLayout ()
+  : TestCase ("'Scenario Creation, UT layout' case tests that a saved UT layout is restored")
+{
+}
+
+ScenarioCreationUtLayout::~ScenarioCreationUtLayout ()
+{
+}
+
+ScenarioCreationUtLayout::UtLayout_t
+ScenarioCreationUtLayout::GetUtLayout (Ptr<SatHelper> helper) const
+{
+  UtLayout_t layout;
+  std::list<uint32_t> beams = helper->GetBeamHelper ()->GetBeams ();
+
+  for (std::list<uint32_t>::const_iterator it = beams.begin (); it != beams.end (); ++it)
+    {
+      NodeContainer uts = helper->GetBeamHelper ()->GetUtNodes (*it);
+
+      for (uint32_t i = 0; i < uts.GetN (); i++)
+        {
+          GeoCoordinate position = uts.Get (i)->GetObject<SatMobilityModel> ()->GetGeoPosition ();
+          uint32_t userCount = helper->GetUserHelper ()->GetUtUserCount (uts.Get (i));
+          layout[*it].push_back (std::make_pair (position, userCount));
+        }
+    }
+
+  return layout;
+}
+
+//
+// ScenarioCreationUtLayout TestCase implementation
+//
+void
+ScenarioCreationUtLayout::DoRun (void)
+{
+  // Reset singletons
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("test-scenario-creation");
+  simulationHelper->SetBeams ("8 9");
+  simulationHelper->SetUtCountPerBeam (2);
+  simulationHelper->SetUserCountPerUt (2);
+
+  UtLayout_t savedLayout = GetUtLayout (simulationHelper->CreateSatScenario ());
+  std::string fileName = Singleton<SatEnvVariables>::Get ()->GetOutputPath () + "/ut-layout.bin";
+  simulationHelper->SaveUtLayout (fileName);
+
+  simulationHelper->Dispose ();
+  Simulator::Destroy ();
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  Ptr<SimulationHelper> loadingHelper = CreateObject<SimulationHelper> ("test-scenario-creation");
+  loadingHelper->SetBeams ("1");
+  loadingHelper->LoadUtLayout (fileName);
+
+  // the layout replaces the configured beams only in the created scenario
+  NS_TEST_ASSERT_MSG_EQ (loadingHelper->IsBeamEnabled (1), true, "Configured beams cleared by the layout!");
+  NS_TEST_ASSERT_MSG_EQ (loadingHelper->IsBeamEnabled (8), false, "Beams of the layout added to the configured beams!");
+
+  UtLayout_t loadedLayout = GetUtLayout (loadingHelper->CreateSatScenario ());
+
+  NS_TEST_ASSERT_MSG_EQ (loadedLayout.size (), savedLayout.size (), "Beam count is not what expected!");
+
+  for (UtLayout_t::const_iterator it = savedLayout.begin (); it != savedLayout.end (); ++it)
+    {
+      NS_TEST_ASSERT_MSG_EQ (loadedLayout[it->first].size (), it->second.size (), "UT count of beam " << it->first << " is not what expected!");
+
+      for (uint32_t i = 0; i < it->second.size (); i++)
+        {
+          const GeoCoordinate &saved = it->second[i].first;
+          const GeoCoordinate &loaded = loadedLayout[it->first][i].first;
+
+          NS_TEST_ASSERT_MSG_EQ_TOL (loaded.GetLatitude (), saved.GetLatitude (), 1e-9, "UT latitude is not what expected!");
+          NS_TEST_ASSERT_MSG_EQ_TOL (loaded.GetLongitude (), saved.GetLongitude (), 1e-9, "UT longitude is not what expected!");
+          NS_TEST_ASSERT_MSG_EQ_TOL (loaded.GetAltitude (), saved.GetAltitude (), 1e-6, "UT altitude is not what expected!");
+          NS_TEST_ASSERT_MSG_EQ (loadedLayout[it->first][i].second, it->second[i].second, "UT user count is not what expected!");
+        }
+    }
+
+  loadingHelper->Dispose ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+
+  Simulator::Destroy ();
+}
+
 // The TestSuite class names the TestSuite as sat-scenario-creation, identifies what type of TestSuite (SYSTEM),
 // and enables the TestCases to be run. Typically, only the constructor for
 // this class must be defined
@@ -363,6 +481,9 @@ ScenarioCreationTestSuite::ScenarioCreationTestSuite ()
   // add ScenarioCreationUser case to suite sat-scenario-creation
   AddTestCase (new ScenarioCreationUser, TestCase::QUICK);
 
+  // add ScenarioCreationUtLayout case to suite sat-scenario-creation
+  AddTestCase (new ScenarioCreationUtLayout, TestCase::QUICK);
+
 }
 
 // Allocate an instance of this TestSuite
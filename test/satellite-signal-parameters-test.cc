@@ -0,0 +1,304 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-signal-parameters-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the memory pool and the shared burst of the
+ * signal parameters.
+ */
+
+#include <thread>
+#include <vector>
+#include <set>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+#include "../model/satellite-signal-parameters.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the reuse of the signal parameters pool.
+ *
+ *  1.  Create signal parameters and a copy of them, and release both.
+ *  2.  Create signal parameters again.
+ *
+ *  Expected result:
+ *   The released memory blocks are reused for the new instances, and the
+ *   copy carries the values of the original.
+ */
+class SatSignalParametersPoolTestCase : public TestCase
+{
+public:
+  SatSignalParametersPoolTestCase ();
+  virtual ~SatSignalParametersPoolTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSignalParametersPoolTestCase::SatSignalParametersPoolTestCase ()
+  : TestCase ("Test reuse of released signal parameters.")
+{
+}
+
+SatSignalParametersPoolTestCase::~SatSignalParametersPoolTestCase ()
+{
+}
+
+void
+SatSignalParametersPoolTestCase::DoRun (void)
+{
+  Ptr<SatSignalParameters> params = Create<SatSignalParameters> ();
+  params->m_rxPower_W = 5.0;
+  params->m_sinr = 3.0;
+
+  Ptr<SatSignalParameters> copy = params->Copy ();
+
+  NS_TEST_ASSERT_MSG_EQ (copy->m_rxPower_W, 5.0, "RX power not copied");
+  NS_TEST_ASSERT_MSG_EQ (copy->m_sinr, 3.0, "SINR not copied");
+
+  SatSignalParameters *first = PeekPointer (params);
+  SatSignalParameters *second = PeekPointer (copy);
+
+  // the blocks are released in this order, and reused in the reverse order
+  params = 0;
+  copy = 0;
+
+  Ptr<SatSignalParameters> reused1 = Create<SatSignalParameters> ();
+  Ptr<SatSignalParameters> reused2 = Create<SatSignalParameters> ();
+
+  NS_TEST_ASSERT_MSG_EQ (PeekPointer (reused1), second, "released block not reused");
+  NS_TEST_ASSERT_MSG_EQ (PeekPointer (reused2), first, "released block not reused");
+  NS_TEST_ASSERT_MSG_EQ (reused1->m_rxPower_W, 0.0, "reused instance not initialized");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the signal parameters pool is safe with
+ * several threads.
+ *
+ *  1.  Create and release signal parameters in several threads at the same time,
+ *      releasing some of them in another thread than they were created in.
+ *
+ *  Expected result:
+ *   Every thread gets distinct instances of its own and reuses the blocks
+ *   it released.
+ */
+class SatSignalParametersPoolThreadTestCase : public TestCase
+{
+public:
+  SatSignalParametersPoolThreadTestCase ();
+  virtual ~SatSignalParametersPoolThreadTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Create and release signal parameters.
+   * \param released instances to release in this thread
+   * \param created instances created in this thread
+   * \param reuseCount number of created instances reusing a released block
+   */
+  static void CreateAndRelease (std::vector<Ptr<SatSignalParameters> > *released,
+                                std::vector<Ptr<SatSignalParameters> > *created,
+                                uint32_t *reuseCount);
+};
+
+SatSignalParametersPoolThreadTestCase::SatSignalParametersPoolThreadTestCase ()
+  : TestCase ("Test signal parameters pool with several threads.")
+{
+}
+
+SatSignalParametersPoolThreadTestCase::~SatSignalParametersPoolThreadTestCase ()
+{
+}
+
+void
+SatSignalParametersPoolThreadTestCase::CreateAndRelease (std::vector<Ptr<SatSignalParameters> > *released,
+                                                         std::vector<Ptr<SatSignalParameters> > *created,
+                                                         uint32_t *reuseCount)
+{
+  released->clear ();
+
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      Ptr<SatSignalParameters> params = Create<SatSignalParameters> ();
+      SatSignalParameters *block = PeekPointer (params);
+      params = 0;
+
+      params = Create<SatSignalParameters> ();
+
+      if (PeekPointer (params) == block)
+        {
+          (*reuseCount)++;
+        }
+
+      params->m_sinr = i;
+      created->push_back (params);
+    }
+}
+
+void
+SatSignalParametersPoolThreadTestCase::DoRun (void)
+{
+  const uint32_t threadCount = 4;
+
+  // instances created in the main thread are released in the worker threads
+  std::vector<std::vector<Ptr<SatSignalParameters> > > released (threadCount);
+  std::vector<std::vector<Ptr<SatSignalParameters> > > created (threadCount);
+  std::vector<uint32_t> reuseCounts (threadCount, 0);
+
+  for (uint32_t t = 0; t < threadCount; t++)
+    {
+      for (uint32_t i = 0; i < 100; i++)
+        {
+          released[t].push_back (Create<SatSignalParameters> ());
+        }
+    }
+
+  std::vector<std::thread> threads;
+
+  for (uint32_t t = 0; t < threadCount; t++)
+    {
+      threads.push_back (std::thread (&SatSignalParametersPoolThreadTestCase::CreateAndRelease,
+                                      &released[t], &created[t], &reuseCounts[t]));
+    }
+
+  for (std::vector<std::thread>::iterator it = threads.begin (); it != threads.end (); ++it)
+    {
+      it->join ();
+    }
+
+  std::set<SatSignalParameters *> blocks;
+
+  for (uint32_t t = 0; t < threadCount; t++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (reuseCounts[t], 1000, "released block not reused in thread " << t);
+
+      for (uint32_t i = 0; i < created[t].size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (created[t][i]->m_sinr, (double) i, "instance overwritten in thread " << t);
+          NS_TEST_ASSERT_MSG_EQ (blocks.insert (PeekPointer (created[t][i])).second, true, "instance shared between threads");
+        }
+    }
+
+  // release the instances created in the worker threads in the main thread
+  created.clear ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the sharing of the burst between the
+ * receivers of a transmission.
+ *
+ *  1.  Create signal parameters with a burst of two packets and copy them
+ *      for two receivers.
+ *  2.  Set different RX power for the receivers and detach the packets of
+ *      one receiver.
+ *
+ *  Expected result:
+ *   The copies share the burst until detached, the detached receiver has
+ *   copies of the packets with the same transmission information, and the
+ *   RX power is kept per receiver.
+ */
+class SatSignalParametersBurstTestCase : public TestCase
+{
+public:
+  SatSignalParametersBurstTestCase ();
+  virtual ~SatSignalParametersBurstTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSignalParametersBurstTestCase::SatSignalParametersBurstTestCase ()
+  : TestCase ("Test sharing of the burst between receivers.")
+{
+}
+
+SatSignalParametersBurstTestCase::~SatSignalParametersBurstTestCase ()
+{
+}
+
+void
+SatSignalParametersBurstTestCase::DoRun (void)
+{
+  SatSignalParameters::PacketsInBurst_t packets;
+  packets.push_back (Create<Packet> (100));
+  packets.push_back (Create<Packet> (200));
+
+  SatSignalParameters::txInfo_s txInfo;
+  txInfo.packetType = SatEnums::PACKET_TYPE_DEDICATED_ACCESS;
+  txInfo.modCod = SatEnums::SAT_MODCOD_QPSK_1_TO_2;
+  txInfo.fecBlockSizeInBytes = 300;
+  txInfo.frameType = SatEnums::NORMAL_FRAME;
+  txInfo.waveformId = 3;
+  txInfo.crdsaUniquePacketId = 0;
+
+  Ptr<SatSignalParameters> txParams = Create<SatSignalParameters> ();
+  txParams->m_burst = Create<SatSignalParameters::Burst> (packets, txInfo, MilliSeconds (1), 5, 2, 7);
+
+  Ptr<SatSignalParameters> rx1 = txParams->Copy ();
+  Ptr<SatSignalParameters> rx2 = txParams->Copy ();
+
+  NS_TEST_ASSERT_MSG_EQ (PeekPointer (rx1->m_burst), PeekPointer (txParams->m_burst), "burst not shared");
+  NS_TEST_ASSERT_MSG_EQ (PeekPointer (rx2->m_burst), PeekPointer (txParams->m_burst), "burst not shared");
+
+  rx1->m_rxPower_W = 1.0;
+  rx2->m_rxPower_W = 2.0;
+  rx1->DetachPacketsInBurst ();
+
+  NS_TEST_ASSERT_MSG_NE (PeekPointer (rx1->m_burst), PeekPointer (txParams->m_burst), "burst not detached");
+  NS_TEST_ASSERT_MSG_EQ (PeekPointer (rx2->m_burst), PeekPointer (txParams->m_burst), "burst of other receiver detached");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_packetsInBurst.size (), 2u, "packets lost in detach");
+  NS_TEST_ASSERT_MSG_NE (PeekPointer (rx1->m_burst->m_packetsInBurst[0]), PeekPointer (packets[0]), "packet not copied");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_packetsInBurst[1]->GetSize (), 200u, "packet copy differs");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_txInfo.waveformId, 3u, "transmission information lost in detach");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_beamId, 5u, "beam ID lost in detach");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_carrierId, 2u, "carrier ID lost in detach");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_sourceTraceId, 7u, "source trace ID lost in detach");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_burst->m_duration, MilliSeconds (1), "duration lost in detach");
+  NS_TEST_ASSERT_MSG_EQ (rx1->m_rxPower_W, 1.0, "RX power not kept per receiver");
+  NS_TEST_ASSERT_MSG_EQ (rx2->m_rxPower_W, 2.0, "RX power not kept per receiver");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the signal parameters unit test cases.
+ */
+class SatSignalParametersTestSuite : public TestSuite
+{
+public:
+  SatSignalParametersTestSuite ();
+};
+
+SatSignalParametersTestSuite::SatSignalParametersTestSuite ()
+  : TestSuite ("sat-signal-parameters-unit-test", UNIT)
+{
+  AddTestCase (new SatSignalParametersPoolTestCase, TestCase::QUICK);
+  AddTestCase (new SatSignalParametersPoolThreadTestCase, TestCase::QUICK);
+  AddTestCase (new SatSignalParametersBurstTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSignalParametersTestSuite satSignalParametersUnit;
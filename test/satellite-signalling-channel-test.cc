@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-signalling-channel-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the loss and the capacity reservation of
+ * the abstracted signalling messages of SatSignallingChannel.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/singleton.h"
+#include "ns3/mac48-address.h"
+#include "ns3/packet.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "../model/satellite-enums.h"
+#include "../model/satellite-utils.h"
+#include "../model/satellite-mac.h"
+#include "../model/satellite-link-results.h"
+#include "../model/satellite-signalling-channel.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief MAC counting the signalling messages received and the signalling
+ * capacity reserved through the signalling channel.
+ */
+class SatSignallingTestMac : public SatMac
+{
+public:
+  SatSignallingTestMac ()
+    : SatMac (1),
+      m_receivedPackets (0),
+      m_reservedBytes (0)
+  {
+  }
+
+  virtual void ReceiveSignalingPacket (Ptr<Packet> packet)
+  {
+    m_receivedPackets++;
+    m_lastReceiveTime = Simulator::Now ();
+  }
+
+  virtual void ReserveSignallingCapacity (uint32_t bytes)
+  {
+    m_reservedBytes += bytes;
+  }
+
+  uint32_t m_receivedPackets;
+  uint32_t m_reservedBytes;
+  Time m_lastReceiveTime;
+};
+
+/**
+ * \ingroup satellite
+ * \brief Base of the signalling channel test cases, creating a channel with
+ * a GW and a UT.
+ */
+class SatSignallingChannelBaseTestCase : public TestCase
+{
+public:
+  SatSignallingChannelBaseTestCase (std::string name);
+  virtual ~SatSignallingChannelBaseTestCase ();
+
+protected:
+  /**
+   * \brief Create the channel, the link results and the terminals.
+   */
+  void CreateChannel ();
+
+  /**
+   * \brief Release the channel and the terminals.
+   */
+  void DestroyChannel ();
+
+  /**
+   * \brief Count the dropped messages.
+   * \param packet the dropped message
+   * \param address address of the receiver
+   */
+  void Dropped (Ptr<const Packet> packet, const Address &address);
+
+  static const double BANDWIDTH_HZ;
+  static const uint32_t WAVEFORM_ID = 2;
+
+  Ptr<SatSignallingChannel> m_channel;
+  Ptr<SatSignallingTestMac> m_gwMac;
+  Ptr<SatSignallingTestMac> m_utMac;
+  Mac48Address m_gwAddress;
+  Mac48Address m_utAddress;
+  uint32_t m_dropped;
+};
+
+const double SatSignallingChannelBaseTestCase::BANDWIDTH_HZ = 1e7;
+
+SatSignallingChannelBaseTestCase::SatSignallingChannelBaseTestCase (std::string name)
+  : TestCase (name),
+    m_dropped (0)
+{
+}
+
+SatSignallingChannelBaseTestCase::~SatSignallingChannelBaseTestCase ()
+{
+}
+
+void
+SatSignallingChannelBaseTestCase::CreateChannel ()
+{
+  Ptr<SatLinkResultsDvbS2> linkResultsS2 = CreateObject<SatLinkResultsDvbS2> ();
+  Ptr<SatLinkResultsDvbRcs2> linkResultsRcs2 = CreateObject<SatLinkResultsDvbRcs2> ();
+  linkResultsS2->Initialize ();
+  linkResultsRcs2->Initialize ();
+
+  Ptr<ConstantPositionMobilityModel> geoMobility = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<ConstantPositionMobilityModel> gwMobility = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<ConstantPositionMobilityModel> utMobility = CreateObject<ConstantPositionMobilityModel> ();
+  geoMobility->SetPosition (Vector (0.0, 0.0, 35786000.0));
+
+  m_channel = CreateObject<SatSignallingChannel> ();
+  m_channel->SetLinks (geoMobility,
+                       CreateObject<ConstantSpeedPropagationDelayModel> (),
+                       CreateObject<ConstantSpeedPropagationDelayModel> ());
+  m_channel->SetFwdLinkResults (linkResultsS2, SatEnums::SAT_MODCOD_QPSK_1_TO_2, SatEnums::NORMAL_FRAME, BANDWIDTH_HZ);
+  m_channel->SetRtnLinkResults (linkResultsRcs2, WAVEFORM_ID, SatEnums::SAT_MODCOD_QPSK_1_TO_3, BANDWIDTH_HZ);
+  m_channel->TraceConnectWithoutContext ("Drop", MakeCallback (&SatSignallingChannelBaseTestCase::Dropped, this));
+
+  m_gwMac = CreateObject<SatSignallingTestMac> ();
+  m_utMac = CreateObject<SatSignallingTestMac> ();
+  m_gwAddress = Mac48Address::Allocate ();
+  m_utAddress = Mac48Address::Allocate ();
+
+  m_channel->AddTerminal (m_gwAddress, m_gwMac, gwMobility, 0, true);
+  m_channel->AddTerminal (m_utAddress, m_utMac, utMobility, 1, false);
+}
+
+void
+SatSignallingChannelBaseTestCase::DestroyChannel ()
+{
+  m_channel->Dispose ();
+  m_channel = 0;
+  m_gwMac = 0;
+  m_utMac = 0;
+}
+
+void
+SatSignallingChannelBaseTestCase::Dropped (Ptr<const Packet> packet, const Address &address)
+{
+  m_dropped++;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the loss probability of the signalling
+ * messages follows the C/N0 of the links.
+ *
+ *  1.  Create a signalling channel with a GW and a UT, and set the loss
+ *      probabilities used before the C/N0 is known.
+ *  2.  Notify the channel about a high and a low C/N0 measured by the UT
+ *      from the GW, and by the GW from the UT.
+ *
+ *  Expected result:
+ *   The configured loss probabilities are used until a C/N0 is notified.
+ *   After that, the loss probability of a link direction is the BLER of the
+ *   link results at the C/N0 of the link, and the C/N0 of one direction does
+ *   not change the other direction.
+ */
+class SatSignallingChannelLossTestCase : public SatSignallingChannelBaseTestCase
+{
+public:
+  SatSignallingChannelLossTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSignallingChannelLossTestCase::SatSignallingChannelLossTestCase ()
+  : SatSignallingChannelBaseTestCase ("Test that the signalling loss follows the C/N0 of the links.")
+{
+}
+
+void
+SatSignallingChannelLossTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-signalling-channel", "loss", true);
+
+  CreateChannel ();
+  m_channel->SetAttribute ("FwdLossProbability", DoubleValue (0.25));
+  m_channel->SetAttribute ("RtnLossProbability", DoubleValue (0.5));
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_gwAddress, m_utAddress), 0.25, 1e-9, "configured forward loss not used");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_utAddress, m_gwAddress), 0.5, 1e-9, "configured return loss not used");
+
+  // C/N0 of 40 dB and -20 dB above the bandwidth, far outside the link results
+  double highCno = SatUtils::DbToLinear (40.0) * BANDWIDTH_HZ;
+  double lowCno = SatUtils::DbToLinear (-20.0) * BANDWIDTH_HZ;
+
+  m_channel->NotifyCno (1, m_gwAddress, m_utAddress, highCno);
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_gwAddress, m_utAddress), 0.0, 1e-9, "forward loss with high C/N0");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_utAddress, m_gwAddress), 0.5, 1e-9, "return loss changed by forward C/N0");
+
+  m_channel->NotifyCno (1, m_gwAddress, m_utAddress, lowCno);
+  m_channel->NotifyCno (1, m_utAddress, m_gwAddress, highCno);
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_gwAddress, m_utAddress), 1.0, 1e-9, "forward loss with low C/N0");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_utAddress, m_gwAddress), 0.0, 1e-9, "return loss with high C/N0");
+
+  m_channel->NotifyCno (1, m_utAddress, m_gwAddress, lowCno);
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_channel->GetLossProbability (m_utAddress, m_gwAddress), 1.0, 1e-9, "return loss with low C/N0");
+
+  DestroyChannel ();
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the signalling messages reserve capacity
+ * from their senders and are dropped on a bad link.
+ *
+ *  1.  Create a signalling channel with a GW and a UT, with no configured
+ *      loss.
+ *  2.  Notify the channel about a low C/N0 measured by the UT.
+ *  3.  Send a message from the GW to the UT and two messages from the UT to
+ *      the GW, and run the simulation.
+ *
+ *  Expected result:
+ *   The sizes of the messages are reserved from the MACs of the senders. The
+ *   message of the GW is dropped, and the messages of the UT are received
+ *   by the GW after their air time with the MODCOD of the return link and
+ *   the propagation delay via the satellite.
+ */
+class SatSignallingChannelReserveTestCase : public SatSignallingChannelBaseTestCase
+{
+public:
+  SatSignallingChannelReserveTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSignallingChannelReserveTestCase::SatSignallingChannelReserveTestCase ()
+  : SatSignallingChannelBaseTestCase ("Test that the signalling messages reserve capacity and are lost on a bad link.")
+{
+}
+
+void
+SatSignallingChannelReserveTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-signalling-channel", "reserve", true);
+
+  CreateChannel ();
+  m_channel->SetAttribute ("FwdLossProbability", DoubleValue (0.0));
+  m_channel->SetAttribute ("RtnLossProbability", DoubleValue (0.0));
+
+  m_channel->NotifyCno (1, m_gwAddress, m_utAddress, SatUtils::DbToLinear (-20.0) * BANDWIDTH_HZ);
+
+  m_channel->Send (Create<Packet> (120), m_gwAddress, m_utAddress);
+  m_channel->Send (Create<Packet> (40), m_utAddress, m_gwAddress);
+  m_channel->Send (Create<Packet> (60), m_utAddress, m_gwAddress);
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_gwMac->m_reservedBytes, 120, "capacity not reserved from the GW");
+  NS_TEST_ASSERT_MSG_EQ (m_utMac->m_reservedBytes, 100, "capacity not reserved from the UT");
+  NS_TEST_ASSERT_MSG_EQ (m_dropped, 1, "message of the GW not dropped");
+  NS_TEST_ASSERT_MSG_EQ (m_utMac->m_receivedPackets, 0, "message received by the UT");
+  NS_TEST_ASSERT_MSG_EQ (m_gwMac->m_receivedPackets, 2, "messages of the UT not received");
+
+  // QPSK 1/3 carries 2/3 bits per symbol, the GW and the UT are both 35786 km from the satellite
+  double airTime = 100 * 8 / (BANDWIDTH_HZ * 2.0 / 3.0);
+  double propagationDelay = 2 * 35786000.0 / 299792458.0;
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_gwMac->m_lastReceiveTime.GetSeconds (), airTime + propagationDelay, 1e-8, "messages of the UT received at wrong time");
+
+  DestroyChannel ();
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for SatSignallingChannel unit test cases.
+ */
+class SatSignallingChannelTestSuite : public TestSuite
+{
+public:
+  SatSignallingChannelTestSuite ();
+};
+
+SatSignallingChannelTestSuite::SatSignallingChannelTestSuite ()
+  : TestSuite ("sat-signalling-channel-unit-test", UNIT)
+{
+  AddTestCase (new SatSignallingChannelLossTestCase, TestCase::QUICK);
+  AddTestCase (new SatSignallingChannelReserveTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSignallingChannelTestSuite satSignallingChannelUnit;
@@ -36,11 +36,22 @@
 #include "ns3/simulator.h"
 #include "ns3/config.h"
 #include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/cbr-application.h"
 #include "ns3/cbr-helper.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv4-l3-protocol.h"
 #include "../helper/satellite-helper.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-phy.h"
+#include "../model/satellite-phy-rx.h"
+#include "../model/satellite-bbframe.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
+#include <algorithm>
+#include <vector>
 
 using namespace ns3;
 
@@ -1016,6 +1027,655 @@ SimpleUnicast8::DoRun (void)
   // <<< End of actual test using Larger scenario <<<
 }
 
+/**
+ * \ingroup satellite
+ * \brief 'Forward Link Unicast, Beam prefix routing' test case implementation.
+ *
+ * This case tests successful transmission of UDP packets from GW connected user
+ * to UT connected users, when the GW routes the UT networks of a beam with a
+ * single prefix.
+ *  1.  User defined scenario with three UTs in beam 8 and two UTs in beam 9 created
+ *      with routing mode BeamPrefixRoutes.
+ *  2.  A single packet is transmitted from GW user to every UT user.
+ *
+ *  Expected result:
+ *    The GW has one route per beam to the UT networks, the UT networks of the beams
+ *    are in separate aligned blocks, the GW satellite netdevices do not need ARP,
+ *    drop packets to networks without a UT and every UT user receives the packet
+ *    sent to it.
+ *
+ */
+class SimpleUnicast9 : public TestCase
+{
+public:
+  SimpleUnicast9 ();
+  virtual ~SimpleUnicast9 ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SimpleUnicast9::SimpleUnicast9 ()
+  : TestCase ("'Forward Link Unicast, Beam prefix routing' case tests successful transmission of a single UDP packet from GW connected user to UT connected users routed with beam prefixes.")
+{
+}
+
+SimpleUnicast9::~SimpleUnicast9 ()
+{
+}
+
+//
+// SimpleUnicast9 TestCase implementation
+//
+void
+SimpleUnicast9::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-simple-unicast", "unicast9", true);
+
+  // Configure a static error probability
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatBeamHelper::RoutingMode", EnumValue (SatBeamHelper::ROUTING_BEAM_PREFIX_ROUTES));
+
+  std::string scenarioName = "Scenario72";
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> (scenarioName);
+  SatBeamUserInfo beamInfo = SatBeamUserInfo (2, 1);
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[9] = beamInfo;
+  beamInfo.AppendUt (1);
+  beamMap[8] = beamInfo;
+
+  helper->CreateUserDefinedScenario (beamMap);
+
+  Config::SetDefault ("ns3::SatBeamHelper::RoutingMode", EnumValue (SatBeamHelper::ROUTING_UT_NETWORK_ROUTES));
+
+  // >>> Start of actual test using user defined scenario >>>
+
+  // check the routes of the GWs to the UT networks (10.0.0.0/8 with default addresses)
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  NodeContainer gws = helper->GetBeamHelper ()->GetGwNodes ();
+  uint32_t utNetworkRouteCount = 0;
+  Ptr<SatNetDevice> gwSatNd;
+
+  for (uint32_t i = 0; i < gws.GetN (); i++)
+    {
+      Ptr<Ipv4> ipv4 = gws.Get (i)->GetObject<Ipv4> ();
+      Ptr<Ipv4StaticRouting> routing = ipv4RoutingHelper.GetStaticRouting (ipv4);
+
+      for (uint32_t j = 0; j < routing->GetNRoutes (); j++)
+        {
+          Ipv4RoutingTableEntry route = routing->GetRoute (j);
+          Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> (ipv4->GetNetDevice (route.GetInterface ()));
+
+          if (satNd != NULL && Ipv4Mask ("255.0.0.0").IsMatch (route.GetDest (), Ipv4Address ("10.0.0.0")))
+            {
+              utNetworkRouteCount++;
+              gwSatNd = satNd;
+              NS_TEST_ASSERT_MSG_EQ (satNd->NeedsArp (), false, "GW satellite netdevice uses ARP!");
+            }
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (utNetworkRouteCount, 2, "GW routes to UT networks are not one per beam!");
+
+  // the fourth network of the block of beam 8 has no UT, so a packet to it
+  // is dropped instead of being broadcast to the beam
+  Ipv4Header ipv4Header;
+  ipv4Header.SetDestination (Ipv4Address ("10.7.0.1"));
+  Ptr<Packet> unknownPacket = Create<Packet> (100);
+  unknownPacket->AddHeader (ipv4Header);
+
+  NS_TEST_ASSERT_MSG_EQ (gwSatNd->Send (unknownPacket, gwSatNd->GetBroadcast (), Ipv4L3Protocol::PROT_NUMBER), false,
+                         "Packet to an unknown UT network not dropped!");
+
+  // UT networks are /16 by default, thus the block of three UTs of beam 8 is
+  // 10.4.0.0/14 and the block of two UTs of beam 9 10.8.0.0/15
+  NodeContainer utUsers = helper->GetUtUsers ();
+  NS_TEST_ASSERT_MSG_EQ (utUsers.GetN (), 5, "UT user count is not what expected!");
+
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      Ipv4Address address = helper->GetUserAddress (utUsers.Get (i));
+      Ipv4Address block = (i < 3) ? Ipv4Address ("10.4.0.0") : Ipv4Address ("10.8.0.0");
+      Ipv4Mask blockMask = (i < 3) ? Ipv4Mask ("255.252.0.0") : Ipv4Mask ("255.254.0.0");
+
+      NS_TEST_ASSERT_MSG_EQ (blockMask.IsMatch (address, block), true, "UT user address " << address << " outside the block of its beam!");
+    }
+
+  // send a single packet to every UT user
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address ());
+  cbr.SetAttribute ("Interval", StringValue ("1s"));
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address ());
+
+  ApplicationContainer gwApps;
+  ApplicationContainer utApps;
+
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      Address address = Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port));
+
+      cbr.SetAttribute ("Remote", AddressValue (address));
+      gwApps.Add (cbr.Install (helper->GetGwUsers ().Get (0)));
+
+      sink.SetAttribute ("Local", AddressValue (address));
+      utApps.Add (sink.Install (utUsers.Get (i)));
+    }
+
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (2.1));
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (3.0));
+
+  Simulator::Stop (Seconds (11));
+  Simulator::Run ();
+
+  Simulator::Destroy ();
+
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      Ptr<PacketSink> receiver = DynamicCast<PacketSink> (utApps.Get (i));
+      Ptr<CbrApplication> sender = DynamicCast<CbrApplication> (gwApps.Get (i));
+
+      NS_TEST_ASSERT_MSG_NE (sender->GetSent (), (uint32_t)0, "Nothing sent to UT user " << i << "!");
+      NS_TEST_ASSERT_MSG_EQ (receiver->GetTotalRx (), sender->GetSent (), "Packets were lost to UT user " << i << "!");
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+  // <<< End of actual test using user defined scenario <<<
+}
+
+/**
+ * \ingroup satellite
+ * \brief 'Forward Link Unicast, Idle carrier suspension' test case implementation.
+ *
+ * This case tests that the forward link carrier of a GW resumes after an idle
+ * period at the same frame boundaries as a carrier that never went idle.
+ *  1.  Simple test scenario set with helper, dummy frame sending disabled.
+ *  2.  Three packets are transmitted one second apart from the GW connected user
+ *      to the UT connected user, leaving the carrier idle between them.
+ *  3.  The scenario is run first with IdleCarrierSuspendEnabled off and then on.
+ *
+ *  Expected result:
+ *    The BB frames are sent at the same times in both runs, and all the packets
+ *    are received in both runs.
+ */
+class SimpleUnicast10 : public TestCase
+{
+public:
+  SimpleUnicast10 ();
+  virtual ~SimpleUnicast10 ();
+
+private:
+  virtual void DoRun (void);
+  void BbFrameTx (Ptr<SatBbFrame> bbFrame);
+  void RunScenario (bool suspendEnabled, std::vector<Time> &frameTimes, uint32_t &sent, uint32_t &received);
+
+  std::vector<Time> *m_frameTimes;
+};
+
+SimpleUnicast10::SimpleUnicast10 ()
+  : TestCase ("'Forward Link Unicast, Idle carrier suspension' case tests that frame timing after resuming an idle carrier matches a never idle carrier."),
+    m_frameTimes (0)
+{
+}
+
+SimpleUnicast10::~SimpleUnicast10 ()
+{
+}
+
+void
+SimpleUnicast10::BbFrameTx (Ptr<SatBbFrame> bbFrame)
+{
+  m_frameTimes->push_back (Simulator::Now ());
+}
+
+void
+SimpleUnicast10::RunScenario (bool suspendEnabled, std::vector<Time> &frameTimes, uint32_t &sent, uint32_t &received)
+{
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwMac::DummyFrameSendingEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGwMac::IdleCarrierSuspendEnabled", BooleanValue (suspendEnabled));
+
+  std::string scenarioName = "Scenario72";
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> (scenarioName);
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  Config::SetDefault ("ns3::SatGwMac::IdleCarrierSuspendEnabled", BooleanValue (false));
+
+  // trace the BB frames of the GW
+  m_frameTimes = &frameTimes;
+  NodeContainer gws = helper->GetBeamHelper ()->GetGwNodes ();
+
+  for (uint32_t i = 0; i < gws.GetN (); i++)
+    {
+      for (uint32_t j = 0; j < gws.Get (i)->GetNDevices (); j++)
+        {
+          Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> (gws.Get (i)->GetDevice (j));
+
+          if (satNd != NULL)
+            {
+              satNd->GetMac ()->TraceConnectWithoutContext ("BBFrameTxTrace", MakeCallback (&SimpleUnicast10::BbFrameTx, this));
+            }
+        }
+    }
+
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("1s"));
+
+  ApplicationContainer gwApps = cbr.Install (helper->GetGwUsers ());
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (3.1));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+
+  ApplicationContainer utApps = sink.Install (utUsers);
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (4.0));
+
+  Simulator::Stop (Seconds (5));
+  Simulator::Run ();
+
+  Simulator::Destroy ();
+
+  sent = DynamicCast<CbrApplication> (gwApps.Get (0))->GetSent ();
+  received = DynamicCast<PacketSink> (utApps.Get (0))->GetTotalRx ();
+  m_frameTimes = 0;
+}
+
+//
+// SimpleUnicast10 TestCase implementation
+//
+void
+SimpleUnicast10::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-simple-unicast", "unicast10", true);
+
+  // >>> Start of actual test using Simple scenario >>>
+
+  std::vector<Time> refFrameTimes;
+  uint32_t refSent = 0;
+  uint32_t refReceived = 0;
+  RunScenario (false, refFrameTimes, refSent, refReceived);
+
+  std::vector<Time> frameTimes;
+  uint32_t sent = 0;
+  uint32_t received = 0;
+  RunScenario (true, frameTimes, sent, received);
+
+  NS_TEST_ASSERT_MSG_EQ (refSent, 3, "Unexpected number of packets sent!");
+  NS_TEST_ASSERT_MSG_EQ (refReceived, refSent, "Packets were lost by the never idle carrier!");
+  NS_TEST_ASSERT_MSG_EQ (received, sent, "Packets were lost by the suspended carrier!");
+  NS_TEST_ASSERT_MSG_EQ (received, refReceived, "Different amount of data received after suspension!");
+
+  NS_TEST_ASSERT_MSG_NE (refFrameTimes.size (), 0, "No BB frames sent!");
+  NS_TEST_ASSERT_MSG_EQ (frameTimes.size (), refFrameTimes.size (), "Different number of BB frames sent after suspension!");
+
+  for (uint32_t i = 0; i < std::min (frameTimes.size (), refFrameTimes.size ()); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (frameTimes[i], refFrameTimes[i], "BB frame " << i << " not sent at the frame boundary of a never idle carrier!");
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+  // <<< End of actual test using Simple scenario <<<
+}
+
+/**
+ * \ingroup satellite
+ * \brief 'Forward Link Unicast, Lazy receiver carriers' test case implementation.
+ *
+ * This case tests that the receiver carriers created on their first reception
+ * give the same results as the carriers created with the scenario.
+ *  1.  Simple test scenario set with helper, the forward link band divided into
+ *      four carriers per channel.
+ *  2.  Ten packets are transmitted from the GW connected user to the UT connected user.
+ *  3.  The SINR trace source of the UT receiver is connected.
+ *  4.  The scenario is run first with LazyRxCarrierCreation off and then on.
+ *
+ *  Expected result:
+ *    With lazy creation no forward link carriers of the UT exist before the run,
+ *    also after connecting the trace, and after the run only the used carrier
+ *    exists. The packets are received at the same times and the SINR is traced
+ *    as many times in both runs.
+ */
+class SimpleUnicast11 : public TestCase
+{
+public:
+  SimpleUnicast11 ();
+  virtual ~SimpleUnicast11 ();
+
+private:
+  virtual void DoRun (void);
+  void SinkRx (Ptr<const Packet> packet, const Address &address);
+  void SinrTrace (double sinr, const Address &source);
+  void RunScenario (bool lazyEnabled, std::vector<Time> &rxTimes,
+                    uint32_t &nCarriers, uint32_t &createdBefore, uint32_t &createdAfter,
+                    uint32_t &sinrTraced);
+
+  std::vector<Time> *m_rxTimes;
+  uint32_t m_sinrTraced;
+};
+
+SimpleUnicast11::SimpleUnicast11 ()
+  : TestCase ("'Forward Link Unicast, Lazy receiver carriers' case tests that carriers created on first reception give the results of carriers created up front."),
+    m_rxTimes (0),
+    m_sinrTraced (0)
+{
+}
+
+SimpleUnicast11::~SimpleUnicast11 ()
+{
+}
+
+void
+SimpleUnicast11::SinkRx (Ptr<const Packet> packet, const Address &address)
+{
+  m_rxTimes->push_back (Simulator::Now ());
+}
+
+void
+SimpleUnicast11::SinrTrace (double sinr, const Address &source)
+{
+  m_sinrTraced++;
+}
+
+void
+SimpleUnicast11::RunScenario (bool lazyEnabled, std::vector<Time> &rxTimes,
+                              uint32_t &nCarriers, uint32_t &createdBefore, uint32_t &createdAfter,
+                              uint32_t &sinrTraced)
+{
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatConf::FwdCarrierAllocatedBandwidth", DoubleValue (0.03125e9));
+  Config::SetDefault ("ns3::SatPhyRx::LazyRxCarrierCreation", BooleanValue (lazyEnabled));
+
+  std::string scenarioName = "Scenario72";
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> (scenarioName);
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  Config::SetDefault ("ns3::SatPhyRx::LazyRxCarrierCreation", BooleanValue (false));
+  Config::SetDefault ("ns3::SatConf::FwdCarrierAllocatedBandwidth", DoubleValue (0.125e9));
+
+  // the receiver of the UT
+  Ptr<SatPhyRx> utPhyRx;
+  Ptr<Node> ut = helper->GetBeamHelper ()->GetUtNodes ().Get (0);
+
+  for (uint32_t i = 0; i < ut->GetNDevices (); i++)
+    {
+      Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> (ut->GetDevice (i));
+
+      if (satNd != NULL)
+        {
+          utPhyRx = satNd->GetPhy ()->GetPhyRx ();
+        }
+    }
+
+  NS_ASSERT (utPhyRx != NULL);
+
+  // connecting the carrier traces through the receiver does not create carriers
+  m_sinrTraced = 0;
+  utPhyRx->TraceConnectWithoutContext ("Sinr", MakeCallback (&SimpleUnicast11::SinrTrace, this));
+
+  nCarriers = utPhyRx->GetNRxCarriers ();
+  createdBefore = utPhyRx->GetNCreatedRxCarriers ();
+
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("100ms"));
+
+  ApplicationContainer gwApps = cbr.Install (helper->GetGwUsers ());
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (1.95));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+
+  ApplicationContainer utApps = sink.Install (utUsers);
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (3.0));
+
+  m_rxTimes = &rxTimes;
+  utApps.Get (0)->TraceConnectWithoutContext ("Rx", MakeCallback (&SimpleUnicast11::SinkRx, this));
+
+  Simulator::Stop (Seconds (4));
+  Simulator::Run ();
+
+  createdAfter = utPhyRx->GetNCreatedRxCarriers ();
+  sinrTraced = m_sinrTraced;
+
+  Simulator::Destroy ();
+
+  m_rxTimes = 0;
+}
+
+//
+// SimpleUnicast11 TestCase implementation
+//
+void
+SimpleUnicast11::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-simple-unicast", "unicast11", true);
+
+  // >>> Start of actual test using Simple scenario >>>
+
+  std::vector<Time> refRxTimes;
+  uint32_t refCarriers = 0;
+  uint32_t refCreatedBefore = 0;
+  uint32_t refCreatedAfter = 0;
+  uint32_t refSinrTraced = 0;
+  RunScenario (false, refRxTimes, refCarriers, refCreatedBefore, refCreatedAfter, refSinrTraced);
+
+  std::vector<Time> rxTimes;
+  uint32_t carriers = 0;
+  uint32_t createdBefore = 0;
+  uint32_t createdAfter = 0;
+  uint32_t sinrTraced = 0;
+  RunScenario (true, rxTimes, carriers, createdBefore, createdAfter, sinrTraced);
+
+  NS_TEST_ASSERT_MSG_EQ (refCarriers, 4, "Unexpected number of forward link carriers!");
+  NS_TEST_ASSERT_MSG_EQ (carriers, refCarriers, "Different number of carriers with lazy creation!");
+  NS_TEST_ASSERT_MSG_EQ (refCreatedBefore, refCarriers, "Carriers not created with the scenario!");
+  NS_TEST_ASSERT_MSG_EQ (refCreatedAfter, refCarriers, "Carriers removed during the run!");
+
+  NS_TEST_ASSERT_MSG_EQ (createdBefore, 0, "Carriers created before any reception!");
+  NS_TEST_ASSERT_MSG_EQ (createdAfter, 1, "Other than the used carrier created!");
+
+  NS_TEST_ASSERT_MSG_GT (refSinrTraced, 0, "SINR not traced through the receiver!");
+  NS_TEST_ASSERT_MSG_EQ (sinrTraced, refSinrTraced, "SINR traced differently with lazy creation!");
+
+  NS_TEST_ASSERT_MSG_EQ (refRxTimes.size (), 10, "Unexpected number of packets received!");
+  NS_TEST_ASSERT_MSG_EQ (rxTimes.size (), refRxTimes.size (), "Different number of packets received with lazy creation!");
+
+  for (uint32_t i = 0; i < std::min (rxTimes.size (), refRxTimes.size ()); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (rxTimes[i], refRxTimes[i], "Packet " << i << " received at a different time with lazy creation!");
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+  // <<< End of actual test using Simple scenario <<<
+}
+
+
+/**
+ * \ingroup satellite
+ * \brief 'Return Link Unicast, Compact TBTP' test case implementation.
+ *
+ * This case tests that the UT transmits in the same time slots with the
+ * compact TBTP format as with the legacy format.
+ *  1.  Simple test scenario set with helper.
+ *  2.  Ten packets are transmitted from the UT connected user to the GW connected user.
+ *  3.  The scenario is run first with legacy TBTPs and then with compact TBTPs.
+ *
+ *  Expected result:
+ *    The dedicated access time slots of the UT start at the same times, on the
+ *    same carriers and with the same RC indices in both runs, and the packets
+ *    are received at the same times.
+ */
+class SimpleUnicast12 : public TestCase
+{
+public:
+  SimpleUnicast12 ();
+  virtual ~SimpleUnicast12 ();
+
+private:
+  /**
+   * \brief Start time, carrier and RC index of a time slot.
+   */
+  typedef std::pair<Time, std::pair<uint32_t, uint32_t> > Slot_t;
+
+  virtual void DoRun (void);
+  void SinkRx (Ptr<const Packet> packet, const Address &address);
+  void DaTxOpportunity (uint32_t carrierId, uint8_t rcIndex);
+  void RunScenario (bool compact, std::vector<Slot_t> &slots, std::vector<Time> &rxTimes);
+
+  std::vector<Slot_t> *m_slots;
+  std::vector<Time> *m_rxTimes;
+};
+
+SimpleUnicast12::SimpleUnicast12 ()
+  : TestCase ("'Return Link Unicast, Compact TBTP' case tests that compact TBTPs give the time slots of legacy TBTPs."),
+    m_slots (0),
+    m_rxTimes (0)
+{
+}
+
+SimpleUnicast12::~SimpleUnicast12 ()
+{
+}
+
+void
+SimpleUnicast12::SinkRx (Ptr<const Packet> packet, const Address &address)
+{
+  m_rxTimes->push_back (Simulator::Now ());
+}
+
+void
+SimpleUnicast12::DaTxOpportunity (uint32_t carrierId, uint8_t rcIndex)
+{
+  m_slots->push_back (std::make_pair (Simulator::Now (), std::make_pair (carrierId, (uint32_t) rcIndex)));
+}
+
+void
+SimpleUnicast12::RunScenario (bool compact, std::vector<Slot_t> &slots, std::vector<Time> &rxTimes)
+{
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatTbtpMessage::Compact", BooleanValue (compact));
+
+  std::string scenarioName = "Scenario72";
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> (scenarioName);
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  // the MAC of the UT
+  Ptr<Node> ut = helper->GetBeamHelper ()->GetUtNodes ().Get (0);
+  Ptr<SatMac> utMac;
+
+  for (uint32_t i = 0; i < ut->GetNDevices (); i++)
+    {
+      Ptr<SatNetDevice> satNd = DynamicCast<SatNetDevice> (ut->GetDevice (i));
+
+      if (satNd != NULL)
+        {
+          utMac = satNd->GetMac ();
+        }
+    }
+
+  NS_ASSERT (utMac != NULL);
+
+  m_slots = &slots;
+  utMac->TraceConnectWithoutContext ("DaTxOpportunity", MakeCallback (&SimpleUnicast12::DaTxOpportunity, this));
+
+  NodeContainer utUsers = helper->GetUtUsers ();
+  NodeContainer gwUsers = helper->GetGwUsers ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("100ms"));
+
+  ApplicationContainer utApps = cbr.Install (utUsers.Get (0));
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (1.95));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+
+  ApplicationContainer gwApps = sink.Install (gwUsers.Get (0));
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (3.0));
+
+  m_rxTimes = &rxTimes;
+  gwApps.Get (0)->TraceConnectWithoutContext ("Rx", MakeCallback (&SimpleUnicast12::SinkRx, this));
+
+  Simulator::Stop (Seconds (4));
+  Simulator::Run ();
+
+  Simulator::Destroy ();
+
+  Config::SetDefault ("ns3::SatTbtpMessage::Compact", BooleanValue (false));
+
+  m_slots = 0;
+  m_rxTimes = 0;
+}
+
+//
+// SimpleUnicast12 TestCase implementation
+//
+void
+SimpleUnicast12::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-simple-unicast", "unicast12", true);
+
+  // >>> Start of actual test using Simple scenario >>>
+
+  std::vector<Slot_t> refSlots;
+  std::vector<Time> refRxTimes;
+  RunScenario (false, refSlots, refRxTimes);
+
+  std::vector<Slot_t> slots;
+  std::vector<Time> rxTimes;
+  RunScenario (true, slots, rxTimes);
+
+  NS_TEST_ASSERT_MSG_NE (refSlots.size (), 0, "No time slots given with legacy TBTPs!");
+  NS_TEST_ASSERT_MSG_EQ (slots.size (), refSlots.size (), "Different number of time slots with compact TBTPs!");
+
+  for (uint32_t i = 0; i < std::min (slots.size (), refSlots.size ()); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (slots[i].first, refSlots[i].first, "Time slot " << i << " starts at a different time with compact TBTPs!");
+      NS_TEST_ASSERT_MSG_EQ (slots[i].second.first, refSlots[i].second.first, "Time slot " << i << " on a different carrier with compact TBTPs!");
+      NS_TEST_ASSERT_MSG_EQ (slots[i].second.second, refSlots[i].second.second, "Time slot " << i << " with a different RC index with compact TBTPs!");
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (refRxTimes.size (), 10, "Unexpected number of packets received!");
+  NS_TEST_ASSERT_MSG_EQ (rxTimes.size (), refRxTimes.size (), "Different number of packets received with compact TBTPs!");
+
+  for (uint32_t i = 0; i < std::min (rxTimes.size (), refRxTimes.size ()); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (rxTimes[i], refRxTimes[i], "Packet " << i << " received at a different time with compact TBTPs!");
+    }
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+  // <<< End of actual test using Simple scenario <<<
+}
 
 // The TestSuite class names the TestSuite as sat-simple-unicast, identifies what type of TestSuite (SYSTEM),
 // and enables the TestCases to be run.  Typically, only the constructor for
@@ -1053,6 +1713,18 @@ SimpleUnicastTestSuite::SimpleUnicastTestSuite ()
 
   // add simple-unicast-8 case to suite sat-simple-unicast
   AddTestCase (new SimpleUnicast8, TestCase::QUICK);
+
+  // add simple-unicast-9 case to suite sat-simple-unicast
+  AddTestCase (new SimpleUnicast9, TestCase::QUICK);
+
+  // add simple-unicast-10 case to suite sat-simple-unicast
+  AddTestCase (new SimpleUnicast10, TestCase::QUICK);
+
+  // add simple-unicast-11 case to suite sat-simple-unicast
+  AddTestCase (new SimpleUnicast11, TestCase::QUICK);
+
+  // add simple-unicast-12 case to suite sat-simple-unicast
+  AddTestCase (new SimpleUnicast12, TestCase::QUICK);
 }
 
 // Allocate an instance of this TestSuite
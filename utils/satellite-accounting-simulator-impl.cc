@@ -0,0 +1,338 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <typeinfo>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "satellite-accounting-simulator-impl.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatAccountingSimulatorImpl");
+
+/**
+ * Number of heap allocations done with the global operator new, maintained
+ * by the replacement of the operator, see satellite-allocation-counter.cc.
+ */
+static std::atomic<uint64_t> g_satAllocationCount (0);
+
+/**
+ * Number of bytes requested with the global operator new.
+ */
+static std::atomic<uint64_t> g_satAllocatedBytes (0);
+
+/**
+ * Number of bytes allocated with the global operator new and not yet freed.
+ */
+static std::atomic<uint64_t> g_satLiveBytes (0);
+
+/**
+ * Set when the replacement of the global operator new is linked in.
+ */
+static std::atomic<bool> g_satAllocationCountingEnabled (false);
+
+namespace ns3 {
+
+/**
+ * Substrings of the event type names identifying the subsystems. The event
+ * type name contains the class of the member function the event calls, so
+ * the keyword found earliest in the name decides the subsystem.
+ */
+static const struct
+{
+  const char *keyword;
+  SatAccountingSimulatorImpl::Subsystem_t subsystem;
+} g_subsystemKeywords[] =
+{
+  { "SatChannel", SatAccountingSimulatorImpl::SUBSYSTEM_CHANNEL },
+  { "PropagationDelay", SatAccountingSimulatorImpl::SUBSYSTEM_CHANNEL },
+  { "SatPhyRxCarrier", SatAccountingSimulatorImpl::SUBSYSTEM_PHY_RX_CARRIER },
+  { "SatInterference", SatAccountingSimulatorImpl::SUBSYSTEM_PHY_RX_CARRIER },
+  { "SatMac", SatAccountingSimulatorImpl::SUBSYSTEM_MAC },
+  { "SatUtMac", SatAccountingSimulatorImpl::SUBSYSTEM_MAC },
+  { "SatGwMac", SatAccountingSimulatorImpl::SUBSYSTEM_MAC },
+  { "SatGeoMac", SatAccountingSimulatorImpl::SUBSYSTEM_MAC },
+  { "SatRandomAccess", SatAccountingSimulatorImpl::SUBSYSTEM_MAC },
+  { "Llc", SatAccountingSimulatorImpl::SUBSYSTEM_LLC },
+  { "Encapsulator", SatAccountingSimulatorImpl::SUBSYSTEM_LLC },
+  { "SatQueue", SatAccountingSimulatorImpl::SUBSYSTEM_LLC },
+  { "Scheduler", SatAccountingSimulatorImpl::SUBSYSTEM_SCHEDULER },
+  { "SatNcc", SatAccountingSimulatorImpl::SUBSYSTEM_SCHEDULER },
+  { "SatRequestManager", SatAccountingSimulatorImpl::SUBSYSTEM_SCHEDULER },
+  { "Fading", SatAccountingSimulatorImpl::SUBSYSTEM_FADING },
+  { "Markov", SatAccountingSimulatorImpl::SUBSYSTEM_FADING },
+  { "SatLoo", SatAccountingSimulatorImpl::SUBSYSTEM_FADING },
+  { "Rayleigh", SatAccountingSimulatorImpl::SUBSYSTEM_FADING },
+  { "SatStats", SatAccountingSimulatorImpl::SUBSYSTEM_STATS },
+  { "Collector", SatAccountingSimulatorImpl::SUBSYSTEM_STATS },
+  { "Probe", SatAccountingSimulatorImpl::SUBSYSTEM_STATS },
+  { "Aggregator", SatAccountingSimulatorImpl::SUBSYSTEM_STATS },
+};
+
+
+class SatAccountingSimulatorImpl::AccountedEvent : public EventImpl
+{
+public:
+  AccountedEvent (SatAccountingSimulatorImpl *owner, Subsystem_t subsystem, EventImpl *event)
+    : m_owner (owner),
+      m_subsystem (subsystem),
+      m_event (event, false)
+  {
+  }
+
+protected:
+  virtual void Notify ()
+  {
+    uint64_t allocations = GetAllocationCount ();
+    m_event->Invoke ();
+    m_owner->CountExecution (m_subsystem, GetAllocationCount () - allocations);
+  }
+
+private:
+  SatAccountingSimulatorImpl *m_owner;
+  Subsystem_t m_subsystem;
+  Ptr<EventImpl> m_event;
+};
+
+
+NS_OBJECT_ENSURE_REGISTERED (SatAccountingSimulatorImpl);
+
+TypeId
+SatAccountingSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatAccountingSimulatorImpl")
+    .SetParent<DefaultSimulatorImpl> ()
+    .AddConstructor<SatAccountingSimulatorImpl> ()
+  ;
+  return tid;
+}
+
+SatAccountingSimulatorImpl::SatAccountingSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+
+  ResetCounters ();
+}
+
+SatAccountingSimulatorImpl::~SatAccountingSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+EventId
+SatAccountingSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
+{
+  return DefaultSimulatorImpl::Schedule (delay, Wrap (event));
+}
+
+void
+SatAccountingSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event)
+{
+  DefaultSimulatorImpl::ScheduleWithContext (context, delay, Wrap (event));
+}
+
+EventId
+SatAccountingSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  return DefaultSimulatorImpl::ScheduleNow (Wrap (event));
+}
+
+EventImpl *
+SatAccountingSimulatorImpl::Wrap (EventImpl *event)
+{
+  Subsystem_t subsystem = Classify (event);
+  m_scheduled[subsystem]++;
+
+  return new AccountedEvent (this, subsystem, event);
+}
+
+SatAccountingSimulatorImpl::Subsystem_t
+SatAccountingSimulatorImpl::Classify (EventImpl *event)
+{
+  const char *typeName = typeid (*event).name ();
+
+  std::map<const char *, Subsystem_t>::const_iterator it = m_subsystemByType.find (typeName);
+  if (it != m_subsystemByType.end ())
+    {
+      return it->second;
+    }
+
+  Subsystem_t subsystem = SUBSYSTEM_OTHER;
+  const char *earliest = 0;
+
+  for (uint32_t i = 0; i < sizeof (g_subsystemKeywords) / sizeof (g_subsystemKeywords[0]); ++i)
+    {
+      const char *found = std::strstr (typeName, g_subsystemKeywords[i].keyword);
+      if (found != 0 && (earliest == 0 || found < earliest))
+        {
+          earliest = found;
+          subsystem = g_subsystemKeywords[i].subsystem;
+        }
+    }
+
+  NS_LOG_INFO ("Event type " << typeName << " accounted to " << GetSubsystemName (subsystem));
+
+  m_subsystemByType.insert (std::make_pair (typeName, subsystem));
+  return subsystem;
+}
+
+void
+SatAccountingSimulatorImpl::CountExecution (Subsystem_t subsystem, uint64_t allocations)
+{
+  m_executed[subsystem]++;
+  m_allocations[subsystem] += allocations;
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetScheduledEvents (Subsystem_t subsystem) const
+{
+  NS_ASSERT (subsystem < SUBSYSTEM_COUNT);
+  return m_scheduled[subsystem];
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetExecutedEvents (Subsystem_t subsystem) const
+{
+  NS_ASSERT (subsystem < SUBSYSTEM_COUNT);
+  return m_executed[subsystem];
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetAllocations (Subsystem_t subsystem) const
+{
+  NS_ASSERT (subsystem < SUBSYSTEM_COUNT);
+  return m_allocations[subsystem];
+}
+
+void
+SatAccountingSimulatorImpl::ResetCounters ()
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t i = 0; i < SUBSYSTEM_COUNT; ++i)
+    {
+      m_scheduled[i] = 0;
+      m_executed[i] = 0;
+      m_allocations[i] = 0;
+    }
+}
+
+std::string
+SatAccountingSimulatorImpl::GetReport () const
+{
+  std::ostringstream oss;
+  oss << std::left << std::setw (16) << "subsystem"
+      << std::right << std::setw (14) << "scheduled"
+      << std::setw (14) << "executed"
+      << std::setw (14) << "allocations" << std::endl;
+
+  for (uint32_t i = 0; i < SUBSYSTEM_COUNT; ++i)
+    {
+      oss << std::left << std::setw (16) << GetSubsystemName ((Subsystem_t) i)
+          << std::right << std::setw (14) << m_scheduled[i]
+          << std::setw (14) << m_executed[i]
+          << std::setw (14) << m_allocations[i] << std::endl;
+    }
+
+  if (IsAllocationCountingEnabled ())
+    {
+      oss << "total allocations in process: " << GetAllocationCount () << std::endl;
+    }
+  else
+    {
+      oss << "allocations are not counted, the program is not linked with the counting operator new" << std::endl;
+    }
+  return oss.str ();
+}
+
+std::string
+SatAccountingSimulatorImpl::GetSubsystemName (Subsystem_t subsystem)
+{
+  switch (subsystem)
+    {
+    case SUBSYSTEM_CHANNEL:
+      return "channel";
+    case SUBSYSTEM_PHY_RX_CARRIER:
+      return "phy-rx-carrier";
+    case SUBSYSTEM_MAC:
+      return "mac";
+    case SUBSYSTEM_LLC:
+      return "llc";
+    case SUBSYSTEM_SCHEDULER:
+      return "scheduler";
+    case SUBSYSTEM_FADING:
+      return "fading";
+    case SUBSYSTEM_STATS:
+      return "stats";
+    case SUBSYSTEM_OTHER:
+      return "other";
+    default:
+      NS_FATAL_ERROR ("Invalid subsystem " << (uint32_t) subsystem);
+      break;
+    }
+  return "";
+}
+
+void
+SatAccountingSimulatorImpl::CountAllocation (std::size_t size)
+{
+  g_satAllocationCount.fetch_add (1, std::memory_order_relaxed);
+  g_satAllocatedBytes.fetch_add (size, std::memory_order_relaxed);
+  g_satLiveBytes.fetch_add (size, std::memory_order_relaxed);
+}
+
+void
+SatAccountingSimulatorImpl::CountDeallocation (std::size_t size)
+{
+  g_satLiveBytes.fetch_sub (size, std::memory_order_relaxed);
+}
+
+void
+SatAccountingSimulatorImpl::EnableAllocationCounting ()
+{
+  g_satAllocationCountingEnabled.store (true, std::memory_order_relaxed);
+}
+
+bool
+SatAccountingSimulatorImpl::IsAllocationCountingEnabled ()
+{
+  return g_satAllocationCountingEnabled.load (std::memory_order_relaxed);
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetAllocationCount ()
+{
+  return g_satAllocationCount.load (std::memory_order_relaxed);
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetAllocatedBytes ()
+{
+  return g_satAllocatedBytes.load (std::memory_order_relaxed);
+}
+
+uint64_t
+SatAccountingSimulatorImpl::GetLiveBytes ()
+{
+  return g_satLiveBytes.load (std::memory_order_relaxed);
+}
+
+} // namespace ns3
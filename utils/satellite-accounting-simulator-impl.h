@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef SATELLITE_ACCOUNTING_SIMULATOR_IMPL_H
+#define SATELLITE_ACCOUNTING_SIMULATOR_IMPL_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include "ns3/default-simulator-impl.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Simulator implementation, which counts scheduled events, executed
+ * events and heap allocations per satellite subsystem. Otherwise it behaves
+ * exactly like DefaultSimulatorImpl.
+ *
+ * Each scheduled event is classified into a subsystem by the type of the
+ * event implementation, i.e. by the class of the member function or the
+ * arguments the event was made of. Executed events are counted and the
+ * heap allocations done while executing them are attributed to the same
+ * subsystem.
+ *
+ * Heap allocations are counted only in programs linked with the replacement
+ * of the global operators new and delete in
+ * utils/satellite-allocation-counter.cc, like the kernel benchmark,
+ * sat-profiling-sim and the allocation test runner. The module itself does not replace the operators, so the
+ * allocation counters stay zero elsewhere, see
+ * IsAllocationCountingEnabled ().
+ *
+ * The implementation is taken into use by setting the global value
+ * "SimulatorImplementationType" to "ns3::SatAccountingSimulatorImpl" before
+ * anything is scheduled, which is what SimulationHelper::EnableEventAccounting
+ * does.
+ */
+class SatAccountingSimulatorImpl : public DefaultSimulatorImpl
+{
+public:
+  /**
+   * \brief Subsystems the events are accounted to.
+   */
+  typedef enum
+  {
+    SUBSYSTEM_CHANNEL = 0,
+    SUBSYSTEM_PHY_RX_CARRIER,
+    SUBSYSTEM_MAC,
+    SUBSYSTEM_LLC,
+    SUBSYSTEM_SCHEDULER,
+    SUBSYSTEM_FADING,
+    SUBSYSTEM_STATS,
+    SUBSYSTEM_OTHER,
+    SUBSYSTEM_COUNT
+  } Subsystem_t;
+
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Constructor
+   */
+  SatAccountingSimulatorImpl ();
+
+  /**
+   * \brief Destructor
+   */
+  ~SatAccountingSimulatorImpl ();
+
+  virtual EventId Schedule (Time const &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+
+  /**
+   * \brief Get the number of scheduled events of a subsystem.
+   * \param subsystem the subsystem
+   * \return number of events scheduled since the start or the last reset
+   */
+  uint64_t GetScheduledEvents (Subsystem_t subsystem) const;
+
+  /**
+   * \brief Get the number of executed events of a subsystem.
+   * \param subsystem the subsystem
+   * \return number of events executed since the start or the last reset
+   */
+  uint64_t GetExecutedEvents (Subsystem_t subsystem) const;
+
+  /**
+   * \brief Get the number of heap allocations done in the events of a subsystem.
+   * \param subsystem the subsystem
+   * \return number of allocations since the start or the last reset
+   */
+  uint64_t GetAllocations (Subsystem_t subsystem) const;
+
+  /**
+   * \brief Reset all the counters.
+   */
+  void ResetCounters ();
+
+  /**
+   * \brief Get a human readable report of the counters, one line per
+   * subsystem.
+   * \return the report
+   */
+  std::string GetReport () const;
+
+  /**
+   * \brief Get the name of a subsystem.
+   * \param subsystem the subsystem
+   * \return the name
+   */
+  static std::string GetSubsystemName (Subsystem_t subsystem);
+
+  /**
+   * \brief Count a heap allocation. Called by the replacement of the global
+   * operator new.
+   * \param size number of bytes requested
+   */
+  static void CountAllocation (std::size_t size);
+
+  /**
+   * \brief Count the release of a heap allocation. Called by the replacement
+   * of the global operator delete.
+   * \param size number of bytes requested for the released memory
+   */
+  static void CountDeallocation (std::size_t size);
+
+  /**
+   * \brief Mark the heap allocations counted. Called when the replacement of
+   * the global operator new is linked in.
+   */
+  static void EnableAllocationCounting ();
+
+  /**
+   * \brief Check whether the heap allocations are counted.
+   * \return true if the program is linked with the replacement of the global
+   * operator new
+   */
+  static bool IsAllocationCountingEnabled ();
+
+  /**
+   * \brief Get the number of heap allocations done with the global operator
+   * new in the whole process so far.
+   * \return the allocation count
+   */
+  static uint64_t GetAllocationCount ();
+
+  /**
+   * \brief Get the number of bytes requested with the global operator new in
+   * the whole process so far. Freed memory is not subtracted.
+   * \return the allocated bytes
+   */
+  static uint64_t GetAllocatedBytes ();
+
+  /**
+   * \brief Get the number of bytes allocated with the global operator new
+   * and not yet freed.
+   * \return the bytes in use
+   */
+  static uint64_t GetLiveBytes ();
+
+private:
+  /**
+   * \brief Event wrapping the scheduled event, which counts its execution
+   * and the allocations done during it.
+   */
+  class AccountedEvent;
+
+  /**
+   * \brief Classify the event into a subsystem, caching the result per event
+   * type.
+   * \param event the event
+   * \return the subsystem
+   */
+  Subsystem_t Classify (EventImpl *event);
+
+  /**
+   * \brief Count the scheduling of an event and wrap it.
+   * \param event the event
+   * \return wrapped event to be given to the default implementation
+   */
+  EventImpl * Wrap (EventImpl *event);
+
+  /**
+   * \brief Count the execution of an event.
+   * \param subsystem the subsystem of the event
+   * \param allocations number of allocations done during the event
+   */
+  void CountExecution (Subsystem_t subsystem, uint64_t allocations);
+
+  uint64_t m_scheduled[SUBSYSTEM_COUNT];
+  uint64_t m_executed[SUBSYSTEM_COUNT];
+  uint64_t m_allocations[SUBSYSTEM_COUNT];
+
+  /**
+   * \brief Subsystems of the event types seen so far, keyed by the type name
+   * pointer.
+   */
+  std::map<const char *, Subsystem_t> m_subsystemByType;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_ACCOUNTING_SIMULATOR_IMPL_H */
@@ -0,0 +1,296 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-allocation-counter.cc
+ * \ingroup satellite
+ * \brief Replacement of the global operators new and delete, which counts
+ * the heap allocations and the heap bytes in use for
+ * SatAccountingSimulatorImpl.
+ *
+ * The file is not part of the satellite module library, so that ordinary
+ * simulations keep the allocator of the C++ library. A program opts in by
+ * adding the file to its sources in the wscript, like the kernel benchmark,
+ * sat-profiling-sim and the allocation test runner do. The shared test
+ * library is not linked with it.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "ns3/satellite-accounting-simulator-impl.h"
+
+namespace {
+
+/**
+ * Bytes reserved in front of each block for its requested size. Keeps the
+ * returned memory aligned for any fundamental type.
+ */
+const std::size_t SAT_ALLOCATION_HEADER = alignof (std::max_align_t);
+
+/**
+ * Store the requested size in front of the returned memory and count the
+ * allocation.
+ * \param p the memory returned to the caller
+ * \param size number of bytes
+ * \return p
+ */
+void *
+SatCountBlock (char *p, std::size_t size)
+{
+  *reinterpret_cast<std::size_t *> (p - sizeof (std::size_t)) = size;
+  ns3::SatAccountingSimulatorImpl::CountAllocation (size);
+  return p;
+}
+
+/**
+ * Count the release of memory returned by SatCountBlock.
+ * \param p the memory returned to the caller
+ */
+void
+SatUncountBlock (void *p)
+{
+  ns3::SatAccountingSimulatorImpl::CountDeallocation (*reinterpret_cast<std::size_t *> (static_cast<char *> (p) - sizeof (std::size_t)));
+}
+
+/**
+ * Allocate counted memory.
+ * \param size number of bytes
+ * \return the memory, or null if out of memory
+ */
+void *
+SatCountedAlloc (std::size_t size)
+{
+  char *base = static_cast<char *> (std::malloc (SAT_ALLOCATION_HEADER + size));
+  if (base == 0)
+    {
+      return 0;
+    }
+  return SatCountBlock (base + SAT_ALLOCATION_HEADER, size);
+}
+
+/**
+ * Free memory allocated with SatCountedAlloc.
+ * \param p the memory, may be null
+ */
+void
+SatCountedFree (void *p)
+{
+  if (p != 0)
+    {
+      SatUncountBlock (p);
+      std::free (static_cast<char *> (p) - SAT_ALLOCATION_HEADER);
+    }
+}
+
+#ifdef __cpp_aligned_new
+/**
+ * Get the bytes reserved in front of a block with the given alignment.
+ * \param alignment alignment of the memory
+ * \return header size
+ */
+std::size_t
+SatAlignedHeader (std::align_val_t alignment)
+{
+  return std::max (static_cast<std::size_t> (alignment), SAT_ALLOCATION_HEADER);
+}
+
+/**
+ * Allocate counted memory with an alignment larger than the default one.
+ * \param size number of bytes
+ * \param alignment alignment of the memory
+ * \return the memory, or null if out of memory
+ */
+void *
+SatCountedAlignedAlloc (std::size_t size, std::align_val_t alignment)
+{
+  // aligned_alloc requires the size to be a multiple of the alignment
+  std::size_t align = static_cast<std::size_t> (alignment);
+  std::size_t header = SatAlignedHeader (alignment);
+  std::size_t alignedSize = (header + size + align - 1) / align * align;
+
+  char *base = static_cast<char *> (std::aligned_alloc (align, alignedSize));
+  if (base == 0)
+    {
+      return 0;
+    }
+  return SatCountBlock (base + header, size);
+}
+
+/**
+ * Free memory allocated with SatCountedAlignedAlloc.
+ * \param p the memory, may be null
+ * \param alignment alignment the memory was allocated with
+ */
+void
+SatCountedAlignedFree (void *p, std::align_val_t alignment)
+{
+  if (p != 0)
+    {
+      SatUncountBlock (p);
+      std::free (static_cast<char *> (p) - SatAlignedHeader (alignment));
+    }
+}
+#endif
+
+/**
+ * Marks the allocations counted when the file is linked in.
+ */
+struct SatAllocationCounterInit
+{
+  SatAllocationCounterInit ()
+  {
+    ns3::SatAccountingSimulatorImpl::EnableAllocationCounting ();
+  }
+} g_satAllocationCounterInit;
+
+} // namespace
+
+void *
+operator new (std::size_t size)
+{
+  void *p = SatCountedAlloc (size);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void *
+operator new[] (std::size_t size)
+{
+  return operator new (size);
+}
+
+void *
+operator new (std::size_t size, const std::nothrow_t &) noexcept
+{
+  return SatCountedAlloc (size);
+}
+
+void *
+operator new[] (std::size_t size, const std::nothrow_t &) noexcept
+{
+  return SatCountedAlloc (size);
+}
+
+void
+operator delete (void *p) noexcept
+{
+  SatCountedFree (p);
+}
+
+void
+operator delete[] (void *p) noexcept
+{
+  SatCountedFree (p);
+}
+
+void
+operator delete (void *p, std::size_t) noexcept
+{
+  SatCountedFree (p);
+}
+
+void
+operator delete[] (void *p, std::size_t) noexcept
+{
+  SatCountedFree (p);
+}
+
+void
+operator delete (void *p, const std::nothrow_t &) noexcept
+{
+  SatCountedFree (p);
+}
+
+void
+operator delete[] (void *p, const std::nothrow_t &) noexcept
+{
+  SatCountedFree (p);
+}
+
+#ifdef __cpp_aligned_new
+void *
+operator new (std::size_t size, std::align_val_t alignment)
+{
+  void *p = SatCountedAlignedAlloc (size, alignment);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void *
+operator new[] (std::size_t size, std::align_val_t alignment)
+{
+  return operator new (size, alignment);
+}
+
+void *
+operator new (std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  return SatCountedAlignedAlloc (size, alignment);
+}
+
+void *
+operator new[] (std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  return SatCountedAlignedAlloc (size, alignment);
+}
+
+void
+operator delete (void *p, std::align_val_t alignment) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+
+void
+operator delete[] (void *p, std::align_val_t alignment) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+
+void
+operator delete (void *p, std::size_t, std::align_val_t alignment) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+
+void
+operator delete[] (void *p, std::size_t, std::align_val_t alignment) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+
+void
+operator delete (void *p, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+
+void
+operator delete[] (void *p, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  SatCountedAlignedFree (p, alignment);
+}
+#endif
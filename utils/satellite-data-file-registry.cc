@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <climits>
+#include <cstdlib>
+#include "ns3/log.h"
+#include "satellite-data-file-registry.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatDataFileRegistry");
+
+namespace ns3 {
+
+void
+SatDataFileRegistry::Clear ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_entries.clear ();
+}
+
+uint32_t
+SatDataFileRegistry::GetN () const
+{
+  return m_entries.size ();
+}
+
+std::string
+SatDataFileRegistry::GetCanonicalPath (std::string filePathName)
+{
+  char resolved[PATH_MAX];
+
+  if (realpath (filePathName.c_str (), resolved) != NULL)
+    {
+      return std::string (resolved);
+    }
+
+  return filePathName;
+}
+
+std::string
+SatDataFileRegistry::GetKey (const std::string &typeName, const std::string &filePathName, const std::string &parameters)
+{
+  return typeName + "|" + GetCanonicalPath (filePathName) + "|" + parameters;
+}
+
+Ptr<const SatDataFileRegistry::Entry>
+SatDataFileRegistry::Find (const std::string &key) const
+{
+  std::map<std::string, Ptr<const Entry> >::const_iterator it = m_entries.find (key);
+
+  if (it != m_entries.end ())
+    {
+      NS_LOG_INFO ("Shared data found for " << key);
+      return it->second;
+    }
+
+  return NULL;
+}
+
+void
+SatDataFileRegistry::Insert (const std::string &key, Ptr<const Entry> entry)
+{
+  NS_LOG_FUNCTION (this << key);
+
+  m_entries[key] = entry;
+}
+
+} // namespace ns3
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef SATELLITE_DATA_FILE_REGISTRY_H
+#define SATELLITE_DATA_FILE_REGISTRY_H
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Process-wide registry of immutable data parsed from input files.
+ * Objects built from the same file with the same parse parameters are loaded
+ * only once and the same read-only instance is handed out to every caller,
+ * e.g. to every UT of the scenario. The registry is used through
+ * Singleton<SatDataFileRegistry>.
+ *
+ * A type stored in the registry derives from SatDataFileRegistry::Entry and
+ * has a constructor taking the file path (and optionally one parse
+ * parameter), which parses the file. The registry is meant to be used while
+ * building the scenario and is not thread safe.
+ */
+class SatDataFileRegistry
+{
+public:
+  /**
+   * \brief Base class of the data stored in the registry.
+   */
+  class Entry : public SimpleRefCount<Entry>
+  {
+  public:
+    virtual ~Entry ()
+    {
+    }
+  };
+
+  /**
+   * \brief Get the data of type T parsed from a file, loading it on first use.
+   * \param filePathName path of the file
+   * \return shared read-only data
+   */
+  template <class T>
+  Ptr<const T> Get (std::string filePathName)
+  {
+    const std::string key = GetKey (typeid (T).name (), filePathName, "");
+    Ptr<const Entry> entry = Find (key);
+
+    if (entry == NULL)
+      {
+        entry = Create<T> (filePathName);
+        Insert (key, entry);
+      }
+
+    return DynamicCast<const T> (entry);
+  }
+
+  /**
+   * \brief Get the data of type T parsed from a file with a parse parameter,
+   * loading it on first use.
+   * \param filePathName path of the file
+   * \param parameter parse parameter given to the constructor of T, which is
+   *        also part of the key
+   * \return shared read-only data
+   */
+  template <class T, class P>
+  Ptr<const T> Get (std::string filePathName, P parameter)
+  {
+    std::ostringstream oss;
+    oss << parameter;
+
+    const std::string key = GetKey (typeid (T).name (), filePathName, oss.str ());
+    Ptr<const Entry> entry = Find (key);
+
+    if (entry == NULL)
+      {
+        entry = Create<T> (filePathName, parameter);
+        Insert (key, entry);
+      }
+
+    return DynamicCast<const T> (entry);
+  }
+
+  /**
+   * \brief Release the registry references to all the loaded data. The data
+   * still in use is freed when its last user releases it.
+   */
+  void Clear ();
+
+  /**
+   * \brief Get the number of loaded data objects.
+   * \return number of entries
+   */
+  uint32_t GetN () const;
+
+  /**
+   * \brief Get the canonical form of a file path, i.e. the absolute path with
+   * symbolic links and relative components resolved. If the file does not
+   * exist, the path is returned as such.
+   * \param filePathName path of the file
+   * \return canonical path
+   */
+  static std::string GetCanonicalPath (std::string filePathName);
+
+private:
+  /**
+   * \brief Build the key of an entry.
+   * \param typeName name of the data type
+   * \param filePathName path of the file
+   * \param parameters parse parameters as a string
+   * \return the key
+   */
+  static std::string GetKey (const std::string &typeName, const std::string &filePathName, const std::string &parameters);
+
+  /**
+   * \brief Find an entry.
+   * \param key the key
+   * \return the entry or NULL, if not loaded
+   */
+  Ptr<const Entry> Find (const std::string &key) const;
+
+  /**
+   * \brief Store an entry.
+   * \param key the key
+   * \param entry the entry
+   */
+  void Insert (const std::string &key, Ptr<const Entry> entry);
+
+  std::map<std::string, Ptr<const Entry> > m_entries;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_DATA_FILE_REGISTRY_H */
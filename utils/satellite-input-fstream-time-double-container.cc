@@ -18,15 +18,20 @@
  * Author: Frans Laakso <frans.laakso@magister.fi>
  */
 
+#include <cmath>
 #include "satellite-input-fstream-time-double-container.h"
 #include "ns3/log.h"
 #include "ns3/abort.h"
 #include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "satellite-env-variables.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatInputFileStreamTimeDoubleContainer");
 
 namespace ns3 {
 
+const std::string SatInputFileStreamTimeDoubleContainer::BINARY_FILE_SUFFIX = ".bin";
+
 TypeId
 SatInputFileStreamTimeDoubleContainer::GetTypeId (void)
 {
@@ -40,6 +45,9 @@ SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer (st
   : m_inputFileStreamWrapper (),
     m_inputFileStream (),
     m_container (),
+    m_numOfRows (0),
+    m_uniformSampling (false),
+    m_samplingInterval (0),
     m_fileName (filename),
     m_fileMode (filemode),
     m_valuesInRow (valuesInRow),
@@ -57,6 +65,9 @@ SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer ()
   : m_inputFileStreamWrapper (),
     m_inputFileStream (),
     m_container (),
+    m_numOfRows (),
+    m_uniformSampling (),
+    m_samplingInterval (),
     m_fileName (),
     m_fileMode (),
     m_valuesInRow (),
@@ -96,6 +107,23 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer (std::string filename, st
   m_fileMode = filemode;
   m_valuesInRow = valuesInRow;
 
+  if (!ReadBinaryFile (filename + BINARY_FILE_SUFFIX))
+    {
+      ReadTextFile (filename, filemode);
+    }
+
+  CheckContainerSanity ();
+
+  CheckUniformSampling ();
+
+  ResetStream ();
+}
+
+void
+SatInputFileStreamTimeDoubleContainer::ReadTextFile (std::string filename, std::ios::openmode filemode)
+{
+  NS_LOG_FUNCTION (this << filename);
+
   m_inputFileStreamWrapper = new SatInputFileStreamWrapper (filename,filemode);
   m_inputFileStream = m_inputFileStreamWrapper->GetStream ();
 
@@ -105,7 +133,8 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer (std::string filename, st
 
       while (!m_inputFileStream->eof ())
         {
-          m_container.push_back (tempVector);
+          m_container.insert (m_container.end (), tempVector.begin (), tempVector.end ());
+          m_numOfRows++;
           tempVector = ReadRow ();
         }
       m_inputFileStream->close ();
@@ -114,10 +143,124 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer (std::string filename, st
     {
       NS_ABORT_MSG ("Input stream is not valid for reading.");
     }
+}
 
-  CheckContainerSanity ();
+bool
+SatInputFileStreamTimeDoubleContainer::ReadBinaryFile (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
 
-  ResetStream ();
+  if (!Singleton<SatEnvVariables>::Get ()->IsValidFile (filename))
+    {
+      return false;
+    }
+
+  std::ifstream ifs (filename.c_str (), std::ios::in | std::ios::binary);
+
+  if (!ifs.is_open ())
+    {
+      return false;
+    }
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint32_t valuesInRow = 0;
+  uint32_t numOfRows = 0;
+
+  ifs.read (reinterpret_cast<char *> (&magic), sizeof (magic));
+  ifs.read (reinterpret_cast<char *> (&version), sizeof (version));
+  ifs.read (reinterpret_cast<char *> (&valuesInRow), sizeof (valuesInRow));
+  ifs.read (reinterpret_cast<char *> (&numOfRows), sizeof (numOfRows));
+
+  if (!ifs.good () || magic != BINARY_FILE_MAGIC || version != BINARY_FILE_VERSION)
+    {
+      NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ReadBinaryFile - Invalid binary file " << filename);
+    }
+
+  if (valuesInRow != m_valuesInRow)
+    {
+      NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ReadBinaryFile - " << filename << " has " << valuesInRow << " values in row, expected " << m_valuesInRow);
+    }
+
+  // Rows are read with a single read to the container
+  m_container.resize (numOfRows * m_valuesInRow);
+
+  if (!m_container.empty ())
+    {
+      ifs.read (reinterpret_cast<char *> (&m_container[0]), m_container.size () * sizeof (double));
+
+      if (ifs.gcount () != (std::streamsize)(m_container.size () * sizeof (double)))
+        {
+          NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ReadBinaryFile - Truncated binary file " << filename);
+        }
+    }
+
+  m_numOfRows = numOfRows;
+
+  NS_LOG_INFO ("Read " << m_numOfRows << " rows from binary file " << filename);
+
+  return true;
+}
+
+void
+SatInputFileStreamTimeDoubleContainer::ConvertToBinary (std::string textFileName, std::string binaryFileName, uint32_t valuesInRow)
+{
+  NS_LOG_FUNCTION (textFileName << binaryFileName << valuesInRow);
+
+  std::ifstream ifs (textFileName.c_str (), std::ios::in);
+
+  if (!ifs.is_open ())
+    {
+      NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ConvertToBinary - Unable to open " << textFileName);
+    }
+
+  // Read the rows the same way as the text format is read to the container
+  std::vector<double> values;
+  std::vector<double> row (valuesInRow);
+  uint32_t numOfRows = 0;
+
+  while (true)
+    {
+      for (uint32_t i = 0; i < valuesInRow; i++)
+        {
+          ifs >> row[i];
+        }
+
+      if (ifs.eof ())
+        {
+          break;
+        }
+
+      if (ifs.fail ())
+        {
+          NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ConvertToBinary - Invalid value in " << textFileName << " at row " << numOfRows + 1);
+        }
+
+      values.insert (values.end (), row.begin (), row.end ());
+      numOfRows++;
+    }
+
+  std::ofstream ofs (binaryFileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!ofs.is_open ())
+    {
+      NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ConvertToBinary - Unable to open " << binaryFileName);
+    }
+
+  uint32_t magic = BINARY_FILE_MAGIC;
+  uint32_t version = BINARY_FILE_VERSION;
+
+  ofs.write (reinterpret_cast<const char *> (&magic), sizeof (magic));
+  ofs.write (reinterpret_cast<const char *> (&version), sizeof (version));
+  ofs.write (reinterpret_cast<const char *> (&valuesInRow), sizeof (valuesInRow));
+  ofs.write (reinterpret_cast<const char *> (&numOfRows), sizeof (numOfRows));
+
+  if (!values.empty ())
+    {
+      ofs.write (reinterpret_cast<const char *> (&values[0]), values.size () * sizeof (double));
+    }
+
+  ofs.close ();
 }
 
 std::vector<double>
@@ -142,30 +285,69 @@ SatInputFileStreamTimeDoubleContainer::CheckContainerSanity ()
   NS_LOG_FUNCTION (this);
 
   /// check time sample sanity
-  if (m_container.size () < 1)
+  if (GetNumOfRows () < 1)
     {
       NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Empty file");
     }
-  else if (m_container.size () == 1)
+  else if (GetNumOfRows () == 1)
     {
-      if (m_container[m_container.size () - 1].at (m_timeColumn) == 0)
+      if (GetSampleTime (GetNumOfRows () - 1) == 0)
         {
           NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input file format (time sample error)");
         }
     }
   else
     {
-      double tempValue1 = m_container[0].at (m_timeColumn);
+      double tempValue1 = GetSampleTime (0);
 
-      for (uint32_t i = 1; i < m_container.size (); i++)
+      for (uint32_t i = 1; i < GetNumOfRows (); i++)
         {
-          if (tempValue1 > m_container[i].at (m_timeColumn))
+          if (tempValue1 > GetSampleTime (i))
             {
               NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input file format (time sample error)");
             }
-          tempValue1 = m_container[i].at (m_timeColumn);
+          tempValue1 = GetSampleTime (i);
+        }
+    }
+}
+
+void
+SatInputFileStreamTimeDoubleContainer::CheckUniformSampling ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_uniformSampling = false;
+  m_samplingInterval = 0;
+
+  if (GetNumOfRows () < 2)
+    {
+      return;
+    }
+
+  double first = GetSampleTime (0);
+  double interval = (GetSampleTime (GetNumOfRows () - 1) - first) / (GetNumOfRows () - 1);
+
+  if (interval <= 0)
+    {
+      return;
+    }
+
+  // The index computation is only an initial guess refined against the
+  // actual samples, thus the tolerance affects only the lookup speed
+  double tolerance = 0.01 * interval;
+
+  for (uint32_t i = 1; i < GetNumOfRows (); i++)
+    {
+      if (std::abs (GetSampleTime (i) - (first + i * interval)) > tolerance)
+        {
+          return;
         }
     }
+
+  m_uniformSampling = true;
+  m_samplingInterval = interval;
+
+  NS_LOG_INFO ("Uniform sampling with interval " << m_samplingInterval << " in " << m_fileName);
 }
 
 std::vector<double>
@@ -173,11 +355,34 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample ()
 {
   NS_LOG_FUNCTION (this);
 
+  uint32_t row = LocateNextClosestTimeSample ();
+
+  std::vector<double>::const_iterator rowBegin = m_container.begin () + row * m_valuesInRow;
+  return std::vector<double> (rowBegin, rowBegin + m_valuesInRow);
+}
+
+double
+SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample (uint32_t column)
+{
+  NS_LOG_FUNCTION (this << column);
+
+  NS_ASSERT (column < m_valuesInRow);
+
+  uint32_t row = LocateNextClosestTimeSample ();
+
+  return m_container[row * m_valuesInRow + column];
+}
+
+uint32_t
+SatInputFileStreamTimeDoubleContainer::LocateNextClosestTimeSample ()
+{
+  NS_LOG_FUNCTION (this);
+
   while (!FindNextClosest (m_lastValidPosition,m_timeShiftValue, Now ().GetSeconds ()))
     {
       m_lastValidPosition = 0;
       m_numOfPasses++;
-      m_timeShiftValue = m_numOfPasses * m_container[m_container.size () - 1].at (m_timeColumn);
+      m_timeShiftValue = m_numOfPasses * GetSampleTime (GetNumOfRows () - 1);
 
       NS_LOG_INFO ("Looping samples again with shift value: " << m_timeShiftValue);
     }
@@ -188,57 +393,112 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample ()
       std::cout << "The container will loop samples from the beginning." << std::endl;
     }
 
-  return m_container[m_lastValidPosition];
+  return m_lastValidPosition;
 }
 
-bool
-SatInputFileStreamTimeDoubleContainer::FindNextClosest (uint32_t lastValidPosition, double timeShiftValue, double comparisonTimeValue)
+uint32_t
+SatInputFileStreamTimeDoubleContainer::FindFirstNotBefore (uint32_t firstPosition, double timeShiftValue, double comparisonTimeValue) const
 {
-  NS_LOG_FUNCTION (this);
+  NS_LOG_FUNCTION (this << firstPosition << timeShiftValue << comparisonTimeValue);
 
-  NS_ASSERT (m_timeColumn < m_valuesInRow);
-  NS_ASSERT (m_container.size () > 0);
-  NS_ASSERT (lastValidPosition >= 0 && lastValidPosition < m_container.size ());
+  uint32_t numOfRows = GetNumOfRows ();
+  uint32_t position = firstPosition;
 
-  NS_LOG_INFO ("SatInputFileStreamDoubleContainer::FindNextClosest: lastValidPosition " << lastValidPosition << " column " << m_timeColumn << " timeShiftValue " << timeShiftValue << " comparisonTimeValue " << comparisonTimeValue);
+  if (m_uniformSampling)
+    {
+      // Compute the index and correct it against the actual samples
+      double index = std::ceil ((comparisonTimeValue - timeShiftValue - GetSampleTime (0)) / m_samplingInterval);
 
-  bool valueFound = false;
+      if (index >= numOfRows)
+        {
+          position = numOfRows;
+        }
+      else if (index > firstPosition)
+        {
+          position = (uint32_t) index;
+        }
 
-  for (uint32_t i = lastValidPosition; i < m_container.size (); i++)
+      while (position > firstPosition && GetSampleTime (position - 1) + timeShiftValue >= comparisonTimeValue)
+        {
+          position--;
+        }
+
+      while (position < numOfRows && GetSampleTime (position) + timeShiftValue < comparisonTimeValue)
+        {
+          position++;
+        }
+    }
+  else
     {
-      if (m_container[i].at (m_timeColumn) + timeShiftValue >= comparisonTimeValue)
+      // Binary search, the samples are in non-decreasing time order
+      uint32_t last = numOfRows;
+
+      while (position < last)
         {
-          double difference1 = std::abs (m_container[lastValidPosition].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
-          double difference2 = std::abs (m_container[i].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
+          uint32_t middle = position + (last - position) / 2;
 
-          if (difference1 < difference2)
+          if (GetSampleTime (middle) + timeShiftValue < comparisonTimeValue)
             {
-              m_lastValidPosition = lastValidPosition;
+              position = middle + 1;
             }
           else
             {
-              m_lastValidPosition = i;
+              last = middle;
             }
-          valueFound = true;
-          break;
         }
-      lastValidPosition = i;
+    }
+
+  return position;
+}
+
+bool
+SatInputFileStreamTimeDoubleContainer::FindNextClosest (uint32_t lastValidPosition, double timeShiftValue, double comparisonTimeValue)
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_ASSERT (m_timeColumn < m_valuesInRow);
+  NS_ASSERT (GetNumOfRows () > 0);
+  NS_ASSERT (lastValidPosition >= 0 && lastValidPosition < GetNumOfRows ());
+
+  NS_LOG_INFO ("SatInputFileStreamDoubleContainer::FindNextClosest: lastValidPosition " << lastValidPosition << " column " << m_timeColumn << " timeShiftValue " << timeShiftValue << " comparisonTimeValue " << comparisonTimeValue);
+
+  bool valueFound = false;
+
+  uint32_t position = FindFirstNotBefore (lastValidPosition, timeShiftValue, comparisonTimeValue);
+
+  if (position < GetNumOfRows ())
+    {
+      // Compare against the previous sample, which is before the comparison time value
+      uint32_t previousPosition = (position > lastValidPosition) ? position - 1 : lastValidPosition;
+
+      double difference1 = std::abs (GetSampleTime (previousPosition) + timeShiftValue - comparisonTimeValue);
+      double difference2 = std::abs (GetSampleTime (position) + timeShiftValue - comparisonTimeValue);
+
+      if (difference1 < difference2)
+        {
+          m_lastValidPosition = previousPosition;
+        }
+      else
+        {
+          m_lastValidPosition = position;
+        }
+      valueFound = true;
     }
 
   if (valueFound && m_numOfPasses > 0 && m_lastValidPosition == 0)
     {
-      double difference1 = std::abs (m_container[m_lastValidPosition].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
-      double difference2 = std::abs (m_container[m_container.size () - 1].at (m_timeColumn) + ((m_numOfPasses - 1) * m_container[m_container.size () - 1].at (m_timeColumn)) - comparisonTimeValue);
+      double difference1 = std::abs (GetSampleTime (m_lastValidPosition) + timeShiftValue - comparisonTimeValue);
+      double difference2 = std::abs (GetSampleTime (GetNumOfRows () - 1) + ((m_numOfPasses - 1) * GetSampleTime (GetNumOfRows () - 1)) - comparisonTimeValue);
 
       if (difference1 > difference2)
         {
-          m_lastValidPosition = m_container.size () - 1;
+          m_lastValidPosition = GetNumOfRows () - 1;
           m_numOfPasses--;
-          m_timeShiftValue = m_numOfPasses * m_container[m_container.size () - 1].at (m_timeColumn);
+          m_timeShiftValue = m_numOfPasses * GetSampleTime (GetNumOfRows () - 1);
         }
     }
 
-  NS_LOG_INFO ("Done: " << valueFound << " value: " << m_container[m_lastValidPosition].at (m_timeColumn) << " @ line: " << m_lastValidPosition + 1 << " comparison time value: " << comparisonTimeValue << " passes: " << m_numOfPasses);
+  NS_LOG_INFO ("Done: " << valueFound << " value: " << GetSampleTime (m_lastValidPosition) << " @ line: " << m_lastValidPosition + 1 << " comparison time value: " << comparisonTimeValue << " passes: " << m_numOfPasses);
 
   return valueFound;
 }
@@ -270,18 +530,11 @@ SatInputFileStreamTimeDoubleContainer::ClearContainer ()
 {
   NS_LOG_FUNCTION (this);
 
-  if (!m_container.empty ())
-    {
-      for (uint32_t i = 0; i < m_container.size (); i++)
-        {
-          if (!m_container[i].empty ())
-            {
-              m_container[i].clear ();
-            }
-        }
-      m_container.clear ();
-    }
+  m_container.clear ();
 
+  m_numOfRows = 0;
+  m_uniformSampling = false;
+  m_samplingInterval = 0;
   m_valuesInRow = 0;
   m_lastValidPosition = 0;
   m_numOfPasses = 0;
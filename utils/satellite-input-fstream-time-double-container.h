@@ -22,6 +22,7 @@
 #define SAT_INPUT_FSTREAM_TIME_DOUBLE_CONTAINER_H
 
 #include <fstream>
+#include <vector>
 #include "ns3/object.h"
 #include "satellite-input-fstream-wrapper.h"
 
@@ -35,6 +36,17 @@ namespace ns3 {
  * and iterating the stored values.
  *
  * Row format is [time, value1, ..., value n].
+ *
+ * Besides the text format, the container reads a binary format, which is
+ * preferred when a file named <filename>.bin exists next to the text file.
+ * The binary file consists of a header (magic, version, values in row,
+ * number of rows; all uint32_t) followed by the rows as doubles in native
+ * byte order. Binary files are created from the text files with
+ * ConvertToBinary.
+ *
+ * The time samples are located with a constant time index computation
+ * when the samples are uniformly spaced and with a binary search
+ * otherwise.
  */
 class SatInputFileStreamTimeDoubleContainer : public Object
 {
@@ -77,6 +89,28 @@ public:
    */
   std::vector<double> ProceedToNextClosestTimeSample ();
 
+  /**
+   * \brief Function for locating the next closest time sample and returning
+   * a single value of it without copying the row
+   * \param column column of the value
+   * \return matching value
+   */
+  double ProceedToNextClosestTimeSample (uint32_t column);
+
+  /**
+   * \brief Convert a text input file to the binary format. A value which
+   * is not a number is a fatal error.
+   * \param textFileName text file name
+   * \param binaryFileName binary file name
+   * \param valuesInRow number of values in a row
+   */
+  static void ConvertToBinary (std::string textFileName, std::string binaryFileName, uint32_t valuesInRow);
+
+  /**
+   * Suffix of a binary input file preferred over the text file
+   */
+  static const std::string BINARY_FILE_SUFFIX;
+
   /**
    * \brief Do needed dispose actions
    */
@@ -104,6 +138,61 @@ private:
    */
   std::vector<double> ReadRow ();
 
+  /**
+   * \brief Function for reading the text format file to the container
+   * \param filename file name
+   * \param filemode file mode
+   */
+  void ReadTextFile (std::string filename, std::ios::openmode filemode);
+
+  /**
+   * \brief Function for reading the binary format file to the container
+   * \param filename file name
+   * \return was the file read
+   */
+  bool ReadBinaryFile (std::string filename);
+
+  /**
+   * \brief Function for locating the next closest time sample. The samples
+   * are looped if the container does not have enough samples.
+   * \return row of the next closest time sample
+   */
+  uint32_t LocateNextClosestTimeSample ();
+
+  /**
+   * \brief Function for checking whether the time samples are uniformly spaced
+   */
+  void CheckUniformSampling ();
+
+  /**
+   * \brief Get the time of a sample
+   * \param row row of the sample
+   * \return sample time
+   */
+  inline double GetSampleTime (uint32_t row) const
+  {
+    return m_container[row * m_valuesInRow + m_timeColumn];
+  }
+
+  /**
+   * \brief Get the number of rows in the container
+   * \return number of rows
+   */
+  inline uint32_t GetNumOfRows () const
+  {
+    return m_numOfRows;
+  }
+
+  /**
+   * \brief Function for locating the first sample with time larger or equal
+   * to the comparison time value
+   * \param firstPosition position to start from
+   * \param timeShiftValue value to shift the time
+   * \param comparisonTimeValue comparison time value
+   * \return position of the sample or number of rows if not found
+   */
+  uint32_t FindFirstNotBefore (uint32_t firstPosition, double timeShiftValue, double comparisonTimeValue) const;
+
   /**
    * \brief Function for locating the next closest value index. This locator loops the samples if the container does not have enough samples. Next closest index value is saved to a separate member variable.
    * \param lastValidPosition position of last matching value
@@ -118,6 +207,16 @@ private:
    */
   void CheckContainerSanity ();
 
+  /**
+   * Magic number of the binary format
+   */
+  static const uint32_t BINARY_FILE_MAGIC = 0x53415442;
+
+  /**
+   * Version of the binary format
+   */
+  static const uint32_t BINARY_FILE_VERSION = 1;
+
   /**
    * \brief Pointer to input file stream wrapper
    */
@@ -129,9 +228,24 @@ private:
   std::ifstream* m_inputFileStream;
 
   /**
-   * \brief Container for value rows
+   * \brief Container for value rows, stored row after row
+   */
+  std::vector<double> m_container;
+
+  /**
+   * \brief Number of rows in the container
+   */
+  uint32_t m_numOfRows;
+
+  /**
+   * \brief Are the time samples uniformly spaced
+   */
+  bool m_uniformSampling;
+
+  /**
+   * \brief Time between samples when uniformly spaced
    */
-  std::vector<std::vector<double> > m_container;
+  double m_samplingInterval;
 
   /**
    * \brief File name
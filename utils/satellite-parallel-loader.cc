@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include <thread>
+#include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/uinteger.h"
+#include "satellite-parallel-loader.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatParallelLoader");
+
+namespace ns3 {
+
+static GlobalValue g_satParallelLoaderThreads ("SatParallelLoaderThreads",
+                                               "The number of threads used to parse the satellite input files "
+                                               "at scenario creation. Value 0 uses one thread per hardware thread "
+                                               "and value 1 parses the files sequentially.",
+                                               UintegerValue (0),
+                                               MakeUintegerChecker<uint32_t> ());
+
+SatParallelLoader::SatParallelLoader ()
+  : m_tasks (),
+    m_next (0)
+{
+}
+
+void
+SatParallelLoader::Add (ParseCallback cb, std::string filePathName)
+{
+  NS_LOG_FUNCTION (this << filePathName);
+
+  Task_t task;
+  task.m_cb = cb;
+  task.m_filePathName = filePathName;
+  m_tasks.push_back (task);
+}
+
+void
+SatParallelLoader::Run ()
+{
+  NS_LOG_FUNCTION (this << m_tasks.size ());
+
+  uint32_t threads = std::min<uint32_t> (GetThreadCount (), m_tasks.size ());
+  m_next = 0;
+
+  if (threads <= 1)
+    {
+      Work (this);
+    }
+  else
+    {
+      // The calling thread works as one of the workers
+      std::vector<std::thread> workers;
+      for (uint32_t i = 1; i < threads; ++i)
+        {
+          workers.push_back (std::thread (&SatParallelLoader::Work, this));
+        }
+
+      Work (this);
+
+      for (std::vector<std::thread>::iterator it = workers.begin (); it != workers.end (); ++it)
+        {
+          it->join ();
+        }
+    }
+
+  m_tasks.clear ();
+}
+
+uint32_t
+SatParallelLoader::GetN () const
+{
+  return m_tasks.size ();
+}
+
+uint32_t
+SatParallelLoader::GetThreadCount ()
+{
+  UintegerValue value;
+  g_satParallelLoaderThreads.GetValue (value);
+  uint32_t threads = value.Get ();
+
+  if (threads == 0)
+    {
+      threads = std::max<uint32_t> (std::thread::hardware_concurrency (), 1);
+    }
+
+  return threads;
+}
+
+void
+SatParallelLoader::Work (SatParallelLoader *loader)
+{
+  uint32_t i = loader->m_next.fetch_add (1);
+
+  while (i < loader->m_tasks.size ())
+    {
+      const Task_t &task = loader->m_tasks[i];
+      task.m_cb (task.m_filePathName);
+      i = loader->m_next.fetch_add (1);
+    }
+}
+
+} // namespace ns3
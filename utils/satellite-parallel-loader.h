@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef SATELLITE_PARALLEL_LOADER_H
+#define SATELLITE_PARALLEL_LOADER_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "ns3/callback.h"
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Loader, which parses independent input files concurrently on a
+ * pool of threads while the scenario is being built.
+ *
+ * The owner of the loaded objects constructs them on the main thread in its
+ * normal order, so that e.g. random variable streams are created in the
+ * same order as with sequential loading. Only the parsing of the files is
+ * registered to the loader with Add (). Run () then executes the registered
+ * parse functions and returns after all of them have finished, after which
+ * the owner may use the objects. Each parse function fills only the object
+ * it was registered for, so the loaded values do not depend on the number
+ * of threads or on the order the files are parsed in.
+ *
+ * The number of threads is taken from the global value
+ * "SatParallelLoaderThreads". Value 1 parses the files sequentially on the
+ * calling thread. The parse functions must not log, as ns-3 logging is not
+ * thread safe; the owners log on the main thread when registering the files.
+ */
+class SatParallelLoader : public SimpleRefCount<SatParallelLoader>
+{
+public:
+  /**
+   * \brief Parse function of a single file, called with the path of the file.
+   */
+  typedef Callback<void, std::string> ParseCallback;
+
+  /**
+   * \brief Constructor
+   */
+  SatParallelLoader ();
+
+  /**
+   * \brief Register a file to be parsed by Run ().
+   * \param cb parse function, which must only modify its own object
+   * \param filePathName path of the file given to the parse function
+   */
+  void Add (ParseCallback cb, std::string filePathName);
+
+  /**
+   * \brief Parse all the registered files and wait for them to complete.
+   * The registered files are removed, so the loader can be reused.
+   */
+  void Run ();
+
+  /**
+   * \brief Get the number of registered files not yet parsed.
+   * \return number of files
+   */
+  uint32_t GetN () const;
+
+  /**
+   * \brief Get the number of threads used by Run (), resolved from the global
+   * value "SatParallelLoaderThreads".
+   * \return number of threads, at least one
+   */
+  static uint32_t GetThreadCount ();
+
+private:
+  /**
+   * \brief File registered to the loader.
+   */
+  typedef struct
+  {
+    ParseCallback m_cb;
+    std::string m_filePathName;
+  } Task_t;
+
+  /**
+   * \brief Worker thread body: parse files until there are none left.
+   * \param loader the loader
+   */
+  static void Work (SatParallelLoader *loader);
+
+  std::vector<Task_t> m_tasks;
+
+  /**
+   * \brief Index of the next file to be parsed during Run ().
+   */
+  std::atomic<uint32_t> m_next;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_PARALLEL_LOADER_H */